@@ -0,0 +1,87 @@
+#!/bin/bash
+
+#############################################################################
+# This script measures how long it takes blockem to compute the next move   #
+# of each one of the 1vs1 games contained in src/tests/examples/games       #
+# using a different number of threads for the search (1, 2, 4, 8 and 16 by  #
+# default). Results are printed on the screen as a table with the time      #
+# spent per game and number of threads, and the speedup compared to the     #
+# 1-thread search                                                           #
+#                                                                           #
+# Usage: $0 [depth] [list of number of threads]                             #
+#   depth defaults to 3                                                     #
+#   list of number of threads defaults to "1 2 4 8 16"                      #
+#                                                                           #
+# IMPORTANT: Make sure you compiled blockem with full optimisation (that    #
+# is, without the --enable-debug or --enable-gprof options) or results      #
+# won't be meaningful. Run it on a multi-core machine too: with only one    #
+# core more threads just add their overhead to the search                   #
+#############################################################################
+
+if [ $# -ge 1 ]; then
+    if [ $1 = "--help" ]; then
+        echo "This script measures how long it takes blockem to compute the next move"
+        echo "of each one of the 1vs1 games contained in src/tests/examples/games"
+        echo "using a different number of threads for the search (1, 2, 4, 8 and 16 by"
+        echo "default). Results are printed on the screen as a table with the time"
+        echo "spent per game and number of threads, and the speedup compared to the"
+        echo "1-thread search"
+        echo ""
+        echo "Usage: $0 [depth] [list of number of threads]"
+        echo "  depth defaults to 3"
+        echo "  list of number of threads defaults to \"1 2 4 8 16\""
+        echo ""
+        echo "IMPORTANT: Make sure you compiled blockem with full optimisation (that"
+        echo "is, without the --enable-debug or --enable-gprof options) or results"
+        echo "won't be meaningful. Run it on a multi-core machine too: with only one"
+        echo "core more threads just add their overhead to the search"
+        exit 0
+    fi
+fi
+
+GAME_INPUT_DIR=../src/tests/examples/games/
+PATH_TO_BIN=../src/blockem
+DEPTH=${1:-3}
+THREADS=${2:-"1 2 4 8 16"}
+
+if [ ! -f $PATH_TO_BIN ]; then
+    echo "You must compile blockem before running the benchmark. Run '$0 --help' for more help"
+    exit
+fi
+
+# current time in milliseconds
+function now_ms
+{
+    echo $(( `date +%s%N` / 1000000 ))
+}
+
+printf "%-24s" "game (depth $DEPTH)"
+for N in $THREADS; do
+    printf "%16s" "$N thread(s)"
+done
+echo ""
+
+for THIS_FILE in `find $GAME_INPUT_DIR -maxdepth 1 -type f -not -iname "*error*" -not -iname "*.old" | sort`; do
+    BASENAME=`basename $THIS_FILE`
+    printf "%-24s" $BASENAME
+
+    BASE_TIME=0
+    for N in $THREADS; do
+        START=`now_ms`
+        $PATH_TO_BIN --mode=2 -d $DEPTH --threads=$N $THIS_FILE > /dev/null 2>&1
+        END=`now_ms`
+        ELAPSED=$(( END - START ))
+
+        if [ $BASE_TIME -eq 0 ]; then
+            BASE_TIME=$ELAPSED
+        fi
+
+        if [ $ELAPSED -gt 0 ]; then
+            SPEEDUP=`echo "scale=2; $BASE_TIME / $ELAPSED" | bc`
+        else
+            SPEEDUP="-"
+        fi
+        printf "%16s" "${ELAPSED}ms (x$SPEEDUP)"
+    done
+    echo ""
+done
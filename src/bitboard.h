@@ -0,0 +1,129 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  bitboard.h
+/// @brief Fixed-width bit plane with one bit per square of the board
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Access to all the words at once (vectorised code)
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef BITBOARD_H_
+#define BITBOARD_H_
+
+#include <stdint.h> // for types
+#include "assert.h"
+#include "coordinate.h"
+
+/// number of 64-bit words of a bitboard
+const int32_t BITBOARD_N_WORDS = 8;
+/// number of bits of a bitboard. Boards can't have more squares than this
+const int32_t BITBOARD_N_BITS  = BITBOARD_N_WORDS * 64;
+
+/// @brief a plane of bits, one per square of the board
+/// Squares are saved row after row, with no gap in between: the square (row, col)
+/// of a board with nColumns columns is the bit (row * nColumns + col). A 14x14 board
+/// uses the lowest 196 bits (the first 4 words), a 20x20 one the lowest 400
+///
+/// It doesn't allocate any memory, so it can be copied with a plain memcpy.
+/// Bits which don't belong to the board are never set by the Board and Player
+/// classes, so the result of PopCount is always the number of squares set
+class Bitboard
+{
+public:
+    /// creates an empty plane (all bits set to 0)
+    Bitboard();
+
+    /// @return the index of the bit that represents a_coord in a board with
+    ///         a_nColumns columns
+    static int32_t CoordToIndex(const Coordinate &a_coord, int32_t a_nColumns);
+
+    /// @brief saves into out_coord the coordinate represented by the bit a_index
+    ///        in a board with a_nColumns columns
+    static void IndexToCoord(int32_t a_index, int32_t a_nColumns, Coordinate &out_coord);
+
+    /// @brief sets all the bits to 0
+    void Clear();
+
+    /// @brief sets to 1 the lowest a_nBits bits and to 0 the rest of them
+    void SetLowest(int32_t a_nBits);
+
+    /// @return true if the bit a_index is set
+    bool IsSet(int32_t a_index) const;
+
+    /// @brief sets the bit a_index to 1
+    void Set(int32_t a_index);
+
+    /// @brief sets the bit a_index to 0
+    void Unset(int32_t a_index);
+
+    /// @return true if no bit is set
+    bool IsEmpty() const;
+
+    /// @return number of bits set
+    int32_t PopCount() const;
+
+    /// @return the index of the first bit set starting from a_index (included),
+    ///         or -1 if there is none
+    int32_t NextSetBit(int32_t a_index) const;
+
+    /// @return the 64-bit word a_word of the plane
+    uint64_t GetWord(int32_t a_word) const;
+
+    /// @return the BITBOARD_N_WORDS words of the plane, lowest first. They are
+    ///         contiguous in memory so vectorised code can load several of them at once
+    const uint64_t* GetWords() const;
+
+    Bitboard& operator&= (const Bitboard &a_src);
+    Bitboard& operator|= (const Bitboard &a_src);
+    Bitboard& operator^= (const Bitboard &a_src);
+    Bitboard operator& (const Bitboard &a_src) const;
+    Bitboard operator| (const Bitboard &a_src) const;
+    Bitboard operator^ (const Bitboard &a_src) const;
+    Bitboard operator~ () const;
+
+    /// @brief moves every bit a_nBits positions up (towards the highest bit)
+    /// bits moved out of the plane are lost
+    Bitboard operator<< (int32_t a_nBits) const;
+    /// @brief moves every bit a_nBits positions down (towards the bit 0)
+    /// bits moved out of the plane are lost
+    Bitboard operator>> (int32_t a_nBits) const;
+
+    bool operator== (const Bitboard &a_src) const;
+    bool operator!= (const Bitboard &a_src) const;
+
+    /// @return number of bits set in a 64-bit word
+    static int32_t PopCount64(uint64_t a_word);
+
+    /// @return index of the lowest bit set in a non-zero 64-bit word
+    static int32_t LowestBit64(uint64_t a_word);
+
+private:
+    /// the bits of the plane. Bit 0 is the lowest bit of m_words[0]
+    uint64_t m_words[BITBOARD_N_WORDS];
+};
+
+// include implementation details of inline functions
+#include "impl/bitboard_impl.h"
+
+#endif /* BITBOARD_H_ */
@@ -25,6 +25,7 @@
 ///           Faustino Frechilla 26-Sep-2010  Original development
 ///           Faustino Frechilla 05-Oct-2010  Support for infochallenge tag
 ///           Faustino Frechilla 07-Oct-2010  i18n
+///           agent              17-Oct-2026  Board size limited to BOARD_MAX_ROWS x BOARD_MAX_COLUMNS
 /// @endhistory
 ///
 // ============================================================================
@@ -44,6 +45,7 @@
 
 #include "gettext.h" // i18n
 #include "blockem_challenge.h"
+#include "board.h"           // BOARD_MAX_ROWS, BOARD_MAX_COLUMNS
 
 static const uint32_t   ERROR_STRING_BUFFER_SIZE = 256;
 
@@ -365,6 +367,13 @@ void BlockemChallenge::XMLParseTagBoard(
                     // i18n reference to xml tags
                     _("Bad integer value in \"nrows\". MUST be a positive number"));
             }
+            if (nRows > BOARD_MAX_ROWS)
+            {
+                XMLParsingFatalError(a_xmlFile,
+                    // i18n TRANSLATORS: Please, leave quoted strings as they are since they
+                    // i18n reference to xml tags
+                    _("Bad integer value in \"nrows\". Board is too big"));
+            }
 
             SetBoardRows(nRows);
         } // if ... (xmlStrcmp(child_node->name, (const xmlChar*) "nrows") == 0)
@@ -402,6 +411,13 @@ void BlockemChallenge::XMLParseTagBoard(
                     // i18n reference to xml tags
                     _("Bad integer value in \"ncolumns\". MUST be a positive number"));
             }
+            if (nCols > BOARD_MAX_COLUMNS)
+            {
+                XMLParsingFatalError(a_xmlFile,
+                    // i18n TRANSLATORS: Please, leave quoted strings as they are since they
+                    // i18n reference to xml tags
+                    _("Bad integer value in \"ncolumns\". Board is too big"));
+            }
 
             SetBoardColumns(nCols);
         } // if ... (xmlStrcmp(child_node->name, (const xmlChar*) "ncolumns") == 0)
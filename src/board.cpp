@@ -23,6 +23,8 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 30-Mar-2009  Original development
+///           agent              17-Oct-2026  Board saved into bit planes
+///           agent              17-Oct-2026  Circular weights saved into bit planes
 /// @endhistory
 ///
 // ============================================================================
@@ -30,101 +32,137 @@
 #include "board.h"
 #include <iostream>
 #include <iomanip> // setw
+#include <algorithm> // std::max
+#include <cstdlib> // std::abs
 
 Board::Board(int32_t a_rows, int32_t a_columns, char a_emptyChar, char** a_board):
+    m_nPlayerPlanes(0),
     m_emptyChar(a_emptyChar),
     m_nRows(a_rows),
     m_nColumns(a_columns)
 {
-    // allocate the space for the board and set all of it to the emptyChar
-	m_theBoard = new char* [m_nRows];
-    for (int32_t i = 0; i < m_nRows; i++)
+#ifdef DEBUG
+    assert( (m_nRows > 0) && (m_nRows <= BOARD_MAX_ROWS) );
+    assert( (m_nColumns > 0) && (m_nColumns <= BOARD_MAX_COLUMNS) );
+    assert( (m_nRows * m_nColumns) <= BITBOARD_N_BITS );
+#endif
+
+    for (int32_t i = 0; i < BOARD_MAX_PLAYERS; i++)
     {
-    	m_theBoard[i] = new char[m_nColumns];
-        for (int32_t j = 0; j < m_nColumns; j++)
+        m_playerChars[i] = m_emptyChar;
+    }
+    for (int32_t i = 0; i < (BOARD_MAX_ROWS * BOARD_MAX_COLUMNS); i++)
+    {
+        m_squares[i] = m_emptyChar;
+    }
+
+    // masks used to keep shifted planes inside the board
+    m_insideMask.SetLowest(m_nRows * m_nColumns);
+    for (int32_t offset = -BOARD_MAX_PLANE_SHIFT; offset <= BOARD_MAX_PLANE_SHIFT; offset++)
+    {
+        Bitboard &thisMask = m_columnMasks[BOARD_MAX_PLANE_SHIFT + offset];
+        thisMask = m_insideMask;
+        for (int32_t i = 0; i < m_nRows; i++)
         {
-            if (a_board != NULL)
-            {
-                // in case we have a board to copy do so
-                m_theBoard[i][j] = a_board[i][j];
-            }
-            else
+            for (int32_t j = 0; j < m_nColumns; j++)
             {
-                m_theBoard[i][j] = m_emptyChar;
+                if ( ((j + offset) < 0) || ((j + offset) >= m_nColumns) )
+                {
+                    thisMask.Unset((i * m_nColumns) + j);
+                }
             }
         }
     }
-}
 
-Board::~Board()
-{
-    // delete the array that saves the board
-	for (int32_t i = 0; i < m_nRows; i++)
-	{
-		delete [] m_theBoard[i];
-	}
-
-	delete [] m_theBoard;
-}
-
-Board::Board(const Board &a_src)
-{
-    // allocate the memory needed before copying from object
-    this->m_theBoard = new char* [a_src.m_nRows];
-    for (int32_t i = 0; i < a_src.m_nRows; i++)
+    // rings of squares around the middle of the board. Same middle as the one
+    // used by Player::GetFirstNucleationPointSpiral
+    int32_t middleRow = m_nRows / 2;
+    int32_t middleCol = m_nColumns / 2;
+    m_nSpiralRings = 0;
+    for (int32_t i = 0; i < m_nRows; i++)
     {
-        this->m_theBoard[i] = new char[a_src.m_nColumns];
+        for (int32_t j = 0; j < m_nColumns; j++)
+        {
+            int32_t ring = std::max(std::abs(i - middleRow), std::abs(j - middleCol));
+            m_spiralRings[ring].Set((i * m_nColumns) + j);
+            m_nSpiralRings = std::max(m_nSpiralRings, ring + 1);
+        }
     }
 
-    CopyFromObject(a_src);
-}
-
-Board& Board::operator= (const Board &a_src)
-{
-    if (this != &a_src)
+    // circular weight of every square split into bit planes (two's complement)
+    for (int32_t i = 0; i < m_nRows; i++)
     {
-        // only delete the memory already allocated if the size of the
-        // new board is different from "this"
-        if ( (this->m_nRows    != a_src.m_nRows)  ||
-             (this->m_nColumns != a_src.m_nColumns) )
+        for (int32_t j = 0; j < m_nColumns; j++)
         {
-            // delete the array that currently saves the board configuration
-            for (int32_t i = 0; i < this->m_nRows; i++)
+            int32_t weight = Player::CalculateCircularWeight(m_nRows, m_nColumns, Coordinate(i, j));
+#ifdef DEBUG
+            assert(weight >= -(1 << (BOARD_CIRCULAR_WEIGHT_BITS - 1)));
+            assert(weight <   (1 << (BOARD_CIRCULAR_WEIGHT_BITS - 1)));
+#endif
+            uint32_t weightBits       = static_cast<uint32_t>(weight);
+            uint32_t halvedWeightBits = static_cast<uint32_t>(weight / 2);
+            for (int32_t bit = 0; bit < BOARD_CIRCULAR_WEIGHT_BITS; bit++)
             {
-                delete [] this->m_theBoard[i];
+                if ((weightBits >> bit) & 1)
+                {
+                    m_circularWeightSlices[0][bit].Set((i * m_nColumns) + j);
+                }
+                if ((halvedWeightBits >> bit) & 1)
+                {
+                    m_circularWeightSlices[1][bit].Set((i * m_nColumns) + j);
+                }
             }
-            delete [] this->m_theBoard;
+        }
+    }
 
-            // once the old memory is deleted allocate the new memory
-            // needed for the new size before copying from object
-            this->m_theBoard = new char* [a_src.m_nRows];
-            for (int32_t i = 0; i < a_src.m_nRows; i++)
+    if (a_board != NULL)
+    {
+        // in case we have a board to copy do so
+        for (int32_t i = 0; i < m_nRows; i++)
+        {
+            for (int32_t j = 0; j < m_nColumns; j++)
             {
-                this->m_theBoard[i] = new char[a_src.m_nColumns];
+                if (a_board[i][j] != m_emptyChar)
+                {
+                    SetCharInIndex((i * m_nColumns) + j, a_board[i][j]);
+                }
             }
         }
-
-        // copy the new info from the source object
-        CopyFromObject(a_src);
     }
-
-    return *this;
 }
 
-void Board::CopyFromObject(const Board &a_src)
+void Board::SetCharInIndex(int32_t a_index, char a_presentationChar)
 {
-    this->m_emptyChar = a_src.m_emptyChar;
-    this->m_nRows     = a_src.m_nRows;
-    this->m_nColumns  = a_src.m_nColumns;
+    int32_t planeIndex = GetPlayerPlaneIndex(a_presentationChar);
+    if (planeIndex < 0)
+    {
+#ifdef DEBUG
+        assert(m_nPlayerPlanes < BOARD_MAX_PLAYERS);
+#endif
+        if (m_nPlayerPlanes >= BOARD_MAX_PLAYERS)
+        {
+            // no more planes available. This player can't be saved
+            return;
+        }
 
-    // set all the coords of the board to the src's
-    for (int32_t i = 0; i < a_src.m_nRows; i++)
+        planeIndex = m_nPlayerPlanes++;
+        m_playerChars[planeIndex] = a_presentationChar;
+        m_playerPlanes[planeIndex].Clear();
+    }
+
+    if (m_squares[a_index] != m_emptyChar)
     {
-        for (int32_t j = 0; j < a_src.m_nColumns; j++)
+        // the square could be taken by another player
+        int32_t oldPlaneIndex = GetPlayerPlaneIndex(m_squares[a_index]);
+        if (oldPlaneIndex >= 0)
         {
-            this->m_theBoard[i][j] = a_src.m_theBoard[i][j];
+            m_playerPlanes[oldPlaneIndex].Unset(a_index);
         }
     }
+
+    m_squares[a_index] = a_presentationChar;
+    m_occupied.Set(a_index);
+    m_playerPlanes[planeIndex].Set(a_index);
 }
 
 void Board::PrintBoard(std::ostream& a_outStream) const
@@ -148,7 +186,7 @@ void Board::PrintBoard(std::ostream& a_outStream) const
         a_outStream << std::setfill(' ') << std::setw(2) << i << " |";
         for (int32_t j = 0; j < m_nColumns; j++)
         {
-            a_outStream << " " << m_theBoard[i][j] << " |";
+            a_outStream << " " << m_squares[(i * m_nColumns) + j] << " |";
         }
         a_outStream << std::endl;
     }
@@ -163,12 +201,16 @@ void Board::PrintBoard(std::ostream& a_outStream) const
 
 void Board::Reset()
 {
-    for (int32_t i = 0; i < m_nRows; i++)
+    m_occupied.Clear();
+    for (int32_t i = 0; i < BOARD_MAX_PLAYERS; i++)
     {
-        for (int32_t j = 0; j < m_nColumns; j++)
-        {
-            m_theBoard[i][j] = m_emptyChar;
-        }
+        m_playerPlanes[i].Clear();
+        m_playerChars[i] = m_emptyChar;
     }
-}
+    m_nPlayerPlanes = 0;
 
+    for (int32_t i = 0; i < (BOARD_MAX_ROWS * BOARD_MAX_COLUMNS); i++)
+    {
+        m_squares[i] = m_emptyChar;
+    }
+}
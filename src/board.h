@@ -23,6 +23,8 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 30-Mar-2009  Original development
+///           agent              17-Oct-2026  Board saved into bit planes
+///           agent              17-Oct-2026  Circular weights saved into bit planes
 /// @endhistory
 ///
 // ============================================================================
@@ -35,21 +37,41 @@
 #include <ostream>
 #include "assert.h"
 #include "coordinate.h"
+#include "bitboard.h"
 #include "player.h"
 
+/// maximum number of rows of a board
+const int32_t BOARD_MAX_ROWS    = 20;
+/// maximum number of columns of a board
+const int32_t BOARD_MAX_COLUMNS = 20;
+/// maximum number of different players (presentation chars) a board can save
+const int32_t BOARD_MAX_PLAYERS = 4;
+/// maximum number of columns a plane can be moved by GetShiftedPlane. Every square
+/// of a piece and of its forbidden area is at 3 rows/columns from its middle at most
+const int32_t BOARD_MAX_PLANE_SHIFT = 3;
+/// maximum number of rings of squares around the middle of a board
+const int32_t BOARD_MAX_SPIRAL_RINGS = 1 + (BOARD_MAX_ROWS > BOARD_MAX_COLUMNS ?
+                                            BOARD_MAX_ROWS / 2 : BOARD_MAX_COLUMNS / 2);
+/// number of bits (two's complement) the circular weight of a square is saved
+/// with (see GetCircularWeightSlice). Weights of boards no bigger than
+/// BOARD_MAX_ROWSxBOARD_MAX_COLUMNS go from -4 to 6
+const int32_t BOARD_CIRCULAR_WEIGHT_BITS = 4;
+
+/// @brief the state of a blockem board
+/// The board is saved into bit planes (see Bitboard): one with the squares that
+/// are taken and one per player with the squares taken by that player. Players
+/// are identified by their presentation char. The presentation char of every
+/// square is kept as well, so questions about only one square are answered with
+/// only one memory read. The class doesn't allocate any memory so boards can be
+/// copied with a plain memcpy
 class Board
 {
 public:
     /// @param a_emptyChar. Character to be used to represent an empty place in the board
     /// @param a_board. array that should be a_nRows height X a_nColumns wide which will
     ///        initialize the board status
+    /// a_rows can't be bigger than BOARD_MAX_ROWS and a_columns than BOARD_MAX_COLUMNS
     Board(int32_t a_rows, int32_t a_columns, char a_emptyChar = ' ', char** a_board = NULL);
-    virtual ~Board();
-
-    /// @brief copy constructor. Needed because there's some dynamic memory
-    Board(const Board &a_src);
-    /// @brief operator=. Needed because there's some dynamic memory
-    Board& operator= (const Board &a_src);
 
     /// @return true if the position specified by a_coord is empty
     bool IsCoordEmpty(const Coordinate &a_coord) const;
@@ -69,6 +91,71 @@ public:
     /// Get the number of columns of the board
     int32_t GetNColumns() const;
 
+    /// @return the index of the bit that represents a_coord in the planes of this board
+    int32_t CoordToIndex(const Coordinate &a_coord) const;
+
+    /// @return plane with the squares taken by any player
+    const Bitboard& GetOccupiedPlane() const;
+
+    /// @return plane with the empty squares of the board
+    Bitboard GetEmptyPlane() const;
+
+    /// @return plane with the squares taken by a_player
+    Bitboard GetPlayerPlane(const Player &a_player) const;
+
+    /// @return plane with the squares of the board which share a side with
+    ///         any of the squares set in a_plane
+    Bitboard GetOrthogonalNeighbours(const Bitboard &a_plane) const;
+
+    /// @return plane with the squares of the board which share a corner (and
+    ///         only a corner) with any of the squares set in a_plane
+    Bitboard GetDiagonalNeighbours(const Bitboard &a_plane) const;
+
+    /// @return plane with the squares (row, col) of the board where the square
+    ///         (row + a_rowOffset, col + a_colOffset) is set in a_plane. Squares
+    ///         which would be moved out of the board are lost
+    /// For example, shifting the empty plane by the coords of the squares of a piece
+    /// and and'ing the results gives the coords where that piece fits
+    /// a_colOffset must be in the interval [-BOARD_MAX_PLANE_SHIFT, BOARD_MAX_PLANE_SHIFT]
+    Bitboard GetShiftedPlane(
+            const Bitboard &a_plane,
+            int32_t         a_rowOffset,
+            int32_t         a_colOffset) const;
+
+    /// @brief iterates through the squares set in a_plane from the middle of the board to
+    ///        the edges, the same way Player::GetFirstNucleationPointSpiral does: ring after
+    ///        ring of squares around the middle, each ring row by row
+    /// Squares close to the middle are usually better moves, which makes the search prune
+    /// branches earlier. Use GetNextIndexSpiral to retrieve the rest of the squares
+    /// @param plane whose squares are iterated
+    /// @param ring where the returned square is. It must be passed to GetNextIndexSpiral
+    /// @return the index of the first square (see CoordToIndex), or -1 if a_plane is empty
+    int32_t GetFirstIndexSpiral(const Bitboard &a_plane, int32_t &out_ring) const;
+
+    /// @brief next square set in a_plane after a_index (see GetFirstIndexSpiral)
+    /// @param plane whose squares are iterated
+    /// @param ring of a_index. It will be updated with the ring of the square returned
+    /// @param index returned by the previous call to GetFirstIndexSpiral/GetNextIndexSpiral
+    /// @return the index of the next square, or -1 if there is none left
+    int32_t GetNextIndexSpiral(
+            const Bitboard &a_plane,
+            int32_t        &in_out_ring,
+            int32_t         a_index) const;
+
+    /// @return plane with the squares of the board whose circular weight (see
+    ///         Player::CalculateCircularWeight) has got the bit a_bit set
+    /// Weights are saved in two's complement with BOARD_CIRCULAR_WEIGHT_BITS bits, so
+    /// the sum of the weights of the squares set in a plane is the number of them
+    /// set in the slice a_bit times GetCircularWeightSliceValue(a_bit), added up for
+    /// every slice
+    /// @param bit of the weight. From 0 to BOARD_CIRCULAR_WEIGHT_BITS - 1
+    /// @param true to use the weight divided by 2 (rounded towards 0)
+    const Bitboard& GetCircularWeightSlice(int32_t a_bit, bool a_halved) const;
+
+    /// @return value of a square set in the slice a_bit of the circular weights
+    ///         (see GetCircularWeightSlice)
+    static int32_t GetCircularWeightSliceValue(int32_t a_bit);
+
     /// Print board into the out_stream
     void PrintBoard(std::ostream& a_outStream) const;
 
@@ -76,8 +163,32 @@ public:
     void Reset();
 
 private:
-    /// the actual board
-    char** m_theBoard;
+    /// presentation char of the player that takes every square of the board (or
+    /// m_emptyChar). The square (row, col) is saved in CoordToIndex(row, col)
+    char m_squares[BOARD_MAX_ROWS * BOARD_MAX_COLUMNS];
+    /// squares taken by any player
+    Bitboard m_occupied;
+    /// squares taken by each player. m_playerChars[i] is the presentation char
+    /// of the player whose squares are saved in m_playerPlanes[i]
+    Bitboard m_playerPlanes[BOARD_MAX_PLAYERS];
+    /// presentation char of the players saved in m_playerPlanes
+    char m_playerChars[BOARD_MAX_PLAYERS];
+    /// number of players with a plane assigned
+    int32_t m_nPlayerPlanes;
+    /// every square of the board set to 1
+    Bitboard m_insideMask;
+    /// m_columnMasks[BOARD_MAX_PLANE_SHIFT + i] has got set to 1 the squares (row, col)
+    /// of the board where (col + i) is still a column of the board. They keep squares
+    /// from wrapping around to the previous/next row when planes are shifted
+    Bitboard m_columnMasks[(2 * BOARD_MAX_PLANE_SHIFT) + 1];
+    /// m_spiralRings[i] has got set to 1 the squares which are i rows or columns away
+    /// (whatever is bigger) from the middle of the board (see GetFirstIndexSpiral)
+    Bitboard m_spiralRings[BOARD_MAX_SPIRAL_RINGS];
+    /// number of rings of squares of this board
+    int32_t m_nSpiralRings;
+    /// m_circularWeightSlices[0][i] has got set to 1 the squares whose circular weight
+    /// has got the bit i set. m_circularWeightSlices[1] saves the weight divided by 2
+    Bitboard m_circularWeightSlices[2][BOARD_CIRCULAR_WEIGHT_BITS];
     /// the character that represents an empty place in the board
     char m_emptyChar;
     /// Rows of the board
@@ -85,11 +196,13 @@ private:
     /// Columns of the board
     int32_t m_nColumns;
 
-    /// @brief copy the source Board argument into the current object
-    /// It doesn't delete or allocate any memory, so when used in
-    /// operator= or copy constructor that should be taken care of
-    /// before calling to the function
-    void CopyFromObject(const Board &a_src);
+    /// @return index of the plane of the player represented by a_presentationChar
+    ///         or -1 if that player hasn't got a plane yet
+    int32_t GetPlayerPlaneIndex(char a_presentationChar) const;
+
+    /// @brief sets the square a_index as taken by the player represented by
+    ///        a_presentationChar. A new plane is assigned to that player if needed
+    void SetCharInIndex(int32_t a_index, char a_presentationChar);
 
     // prevent boards to be created without the proper arguments
     Board();
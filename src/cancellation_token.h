@@ -0,0 +1,148 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  cancellation_token.h
+/// @brief Cancellation requests shared by the callers of the solvers and the solvers
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef CANCELLATION_TOKEN_H_
+#define CANCELLATION_TOKEN_H_
+
+#include <stdint.h> // for types
+#include <csignal>  // sig_atomic_t
+#include "assert.h"
+
+/// number of nodes a solver visits between 2 consecutive reads of its
+/// cancellation token. The time it takes a solver to notice it was cancelled
+/// is bounded by the time it takes to visit this many nodes
+const int32_t CANCELLATION_CHECKPOINT_INTERVAL = 1024;
+
+/// @brief a request to cancel a solver (MinMax, GameTotalAllocation::Solve...)
+/// The token is cancelled when its flag is set to non-zero. The flag can be owned
+/// by the token (it is set with Cancel) or by someone else (the flag of a worker
+/// thread, for example). A plain flag can be passed wherever a token is expected.
+/// A token can also be linked to a parent token, and then it is cancelled as soon
+/// as the parent is, which lets a solver stop by itself (a deadline, a solution
+/// found by another thread...) while it still listens to its caller
+///
+/// Reading a token is safe from any thread. Solvers don't read it directly, but
+/// through a CancellationCheckpoint (one per thread)
+class CancellationToken
+{
+public:
+    /// @brief builds a token which owns its flag. It is cancelled with Cancel
+    /// @param optional parent token. The new token is also cancelled when
+    ///        the parent is. The parent must outlive the new token
+    explicit CancellationToken(const CancellationToken* a_parent = NULL);
+
+    /// @brief builds a token cancelled when a_flag is set to non-zero
+    /// Cancel can't be called on this token. a_flag must outlive it
+    CancellationToken(const volatile sig_atomic_t &a_flag);
+
+    /// @brief builds a token which follows the cancellation of a_src
+    /// The new token reads the flag a_src reads (a_src's own flag if it owns it),
+    /// so a_src must outlive it. Cancel can't be called on the copy
+    CancellationToken(const CancellationToken &a_src);
+
+    ~CancellationToken();
+
+    /// @brief cancels the token (and every token linked to it)
+    /// The token must own its flag
+    void Cancel();
+
+    /// @return true if the token (or its parent) has been cancelled
+    bool IsCancelled() const;
+
+private:
+    /// flag set by Cancel if the token owns it
+    volatile sig_atomic_t m_ownFlag;
+
+    /// the flag the token reads. It points to m_ownFlag if the token owns its flag
+    const volatile sig_atomic_t* m_flag;
+
+    /// parent token. NULL if there's none
+    const CancellationToken* m_parent;
+
+    // no operator= allowed
+    CancellationToken& operator=(const CancellationToken &a_src);
+};
+
+/// @brief the point where a solver thread checks for cancellation requests
+/// Solvers call Poll once per node of their search tree. The token is only read
+/// every a_interval calls, and once it is found cancelled the checkpoint remembers
+/// it, so the rest of the search can unwind checking IsCancelled (which doesn't
+/// read the token). Checkpoints are not thread safe. Each thread needs its own
+class CancellationCheckpoint
+{
+public:
+    /// @param token to be checked. It must outlive the checkpoint
+    /// @param number of calls to Poll between 2 consecutive reads of the token
+    CancellationCheckpoint(
+            const CancellationToken &a_token,
+            int32_t                  a_interval = CANCELLATION_CHECKPOINT_INTERVAL);
+    ~CancellationCheckpoint();
+
+    /// @brief counts a node. The token is read if a_interval nodes were
+    ///        counted since the last time it was
+    /// @return true if the token was found cancelled
+    bool Poll();
+
+    /// @brief reads the token right away
+    /// @return true if the token was found cancelled
+    bool Check();
+
+    /// @return true if the token was found cancelled by Poll or Check
+    bool IsCancelled() const;
+
+    /// @return the token checked by this checkpoint
+    const CancellationToken& GetToken() const;
+
+private:
+    /// the token checked
+    const CancellationToken &m_token;
+
+    /// number of calls to Poll between 2 consecutive reads of the token
+    int32_t m_interval;
+
+    /// calls to Poll left until the token is read again
+    int32_t m_countdown;
+
+    /// true once the token was found cancelled
+    bool m_cancelled;
+
+    // a checkpoint can't be built straight from a flag. The temporary token
+    // it would be converted into wouldn't outlive the checkpoint
+    CancellationCheckpoint(
+            const volatile sig_atomic_t &a_flag,
+            int32_t                      a_interval = CANCELLATION_CHECKPOINT_INTERVAL);
+
+    // no copy constructor or operator= allowed
+    CancellationCheckpoint(const CancellationCheckpoint &a_src);
+    CancellationCheckpoint& operator=(const CancellationCheckpoint &a_src);
+};
+
+#include "impl/cancellation_token_impl.h"
+
+#endif /* CANCELLATION_TOKEN_H_ */
@@ -24,6 +24,7 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 11-Sep-2009  Original development
 ///           Faustino Frechilla 02-May-2010  Uninitialised value
+///           agent              17-Oct-2026  No virtual destructor
 /// @endhistory
 ///
 // ============================================================================
@@ -55,8 +56,7 @@ public:
         m_col(a_column)
     {}
 
-    virtual ~Coordinate()
-    {}
+    // no user-declared destructor: coordinates are trivially copyable 8-byte values
 
     /// @brief sets the value of the coordinate
     inline void Set(int32_t a_row, int32_t a_column);
@@ -0,0 +1,148 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  deadline_watchdog.cpp
+/// @brief Implementation of the DeadlineWatchdog class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include "deadline_watchdog.h"
+
+DeadlineWatchdog::DeadlineWatchdog(const CancellationToken &a_parent) :
+    m_token(&a_parent),
+    m_thread(NULL),
+    m_started(false),
+    m_mutex(NULL),
+    m_cond(NULL),
+    m_finished(false)
+{
+}
+
+DeadlineWatchdog::~DeadlineWatchdog()
+{
+    Stop();
+
+    if (m_cond != NULL)
+    {
+        g_cond_free(m_cond);
+    }
+    if (m_mutex != NULL)
+    {
+        g_mutex_free(m_mutex);
+    }
+}
+
+bool DeadlineWatchdog::Start(int32_t a_timeBudgetMs)
+{
+#ifdef DEBUG
+    // it can only be started once
+    assert(m_mutex == NULL);
+#endif
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    g_get_current_time(&m_deadline);
+    g_time_val_add(&m_deadline, static_cast<glong>(a_timeBudgetMs) * 1000);
+
+    m_mutex = g_mutex_new();
+    m_cond  = g_cond_new();
+#ifdef DEBUG
+    assert(m_mutex != NULL);
+    assert(m_cond != NULL);
+#endif
+
+    GError* err = NULL;
+    m_thread = g_thread_create(
+            reinterpret_cast<GThreadFunc>(DeadlineWatchdog::ThreadRoutine),
+            reinterpret_cast<void*>(this),
+            TRUE, // joinable
+            &err);
+
+    if (m_thread == NULL)
+    {
+        g_error_free(err);
+        return false;
+    }
+
+    m_started = true;
+    return true;
+}
+
+void DeadlineWatchdog::Stop()
+{
+    if (m_thread == NULL)
+    {
+        return;
+    }
+
+    g_mutex_lock(m_mutex);
+    m_finished = true;
+    g_cond_signal(m_cond);
+    g_mutex_unlock(m_mutex);
+
+    g_thread_join(m_thread);
+    m_thread = NULL;
+}
+
+bool DeadlineWatchdog::IsStarted() const
+{
+    return m_started;
+}
+
+const CancellationToken& DeadlineWatchdog::GetToken() const
+{
+    return m_token;
+}
+
+void* DeadlineWatchdog::ThreadRoutine(void *a_threadParam)
+{
+    DeadlineWatchdog* watchdog = reinterpret_cast<DeadlineWatchdog*>(a_threadParam);
+
+    g_mutex_lock(watchdog->m_mutex);
+    while (!watchdog->m_finished)
+    {
+        GTimeVal timeNow;
+        g_get_current_time(&timeNow);
+
+        if ( (timeNow.tv_sec > watchdog->m_deadline.tv_sec) ||
+             ( (timeNow.tv_sec == watchdog->m_deadline.tv_sec) &&
+               (timeNow.tv_usec >= watchdog->m_deadline.tv_usec) ) )
+        {
+            // stop the solver
+            watchdog->m_token.Cancel();
+            break;
+        }
+
+        // wake up when the deadline is reached or the solver is finished. There's
+        // no need to check the token of the caller: m_token is linked to it
+        g_cond_timed_wait(watchdog->m_cond, watchdog->m_mutex, &(watchdog->m_deadline));
+    }
+    g_mutex_unlock(watchdog->m_mutex);
+
+    return NULL;
+}
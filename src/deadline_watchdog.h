@@ -0,0 +1,105 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  deadline_watchdog.h
+/// @brief A thread which cancels a CancellationToken when a time budget runs out
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef DEADLINE_WATCHDOG_H_
+#define DEADLINE_WATCHDOG_H_
+
+#include <glib.h>
+#include "cancellation_token.h"
+
+/// @brief cancels its token when a time budget runs out
+/// The token of the watchdog is linked to the token of the caller, so a solver
+/// which checks it stops either when the time runs out or when it is cancelled by
+/// the caller. The budget is controlled by a thread spawned by Start, which sleeps
+/// until the deadline is reached or Stop is called, whatever happens first
+///
+/// Start and Stop must be called by the same thread. The token can be read from any thread
+class DeadlineWatchdog
+{
+public:
+    /// @param token of the caller. The token of the watchdog is also cancelled
+    ///        when it is. It must outlive the watchdog
+    explicit DeadlineWatchdog(const CancellationToken &a_parent);
+
+    /// Stop is called if the watchdog thread is still running
+    ~DeadlineWatchdog();
+
+    /// @brief spawns the watchdog thread. The token will be cancelled
+    ///        a_timeBudgetMs milliseconds after this call
+    /// It can only be called once
+    /// @param time budget (in milliseconds)
+    /// @return true if the thread was spawned. If it couldn't be the token
+    ///         will only be cancelled with the token of the caller
+    bool Start(int32_t a_timeBudgetMs);
+
+    /// @brief tells the watchdog thread the solver is finished, and waits for it to return
+    /// The token is not cancelled after this call unless it already was (or the
+    /// token of the caller is). It doesn't do anything if Start didn't spawn the thread
+    void Stop();
+
+    /// @return true if Start spawned the watchdog thread
+    bool IsStarted() const;
+
+    /// @return the token cancelled when the time budget runs out (or
+    ///         the token of the caller is cancelled)
+    const CancellationToken& GetToken() const;
+
+private:
+    /// cancelled by the watchdog thread when the deadline is reached
+    CancellationToken m_token;
+
+    /// absolute time when the time budget runs out
+    GTimeVal m_deadline;
+
+    /// the watchdog thread. NULL if it wasn't spawned or Stop was already called
+    GThread* m_thread;
+
+    /// true if Start spawned the watchdog thread
+    bool m_started;
+
+    /// protects m_finished
+    GMutex* m_mutex;
+
+    /// signalled when the solver is finished so the watchdog thread returns
+    GCond* m_cond;
+
+    /// set to true by Stop
+    bool m_finished;
+
+    /// The routine run by the watchdog thread. It cancels m_token when the deadline is reached
+    /// @param pointer to the DeadlineWatchdog which spawned the thread
+    /// @return NULL
+    static void* ThreadRoutine(void *a_threadParam);
+
+    // no copy constructor or operator= allowed
+    DeadlineWatchdog(const DeadlineWatchdog &a_src);
+    DeadlineWatchdog& operator=(const DeadlineWatchdog &a_src);
+};
+
+#endif /* DEADLINE_WATCHDOG_H_ */
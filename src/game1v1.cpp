@@ -24,6 +24,25 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 28-Aug-2009  Original development
 ///           Faustino Frechilla 21-Jul-2010  i18n
+///           agent              17-Oct-2026  Parallel root-split MinMax
+///           agent              17-Oct-2026  Transposition table
+///           agent              17-Oct-2026  Iterative deepening with a time budget
+///           agent              17-Oct-2026  NK points recalculated with bit planes
+///           agent              17-Oct-2026  Moves generated with bit planes
+///           agent              17-Oct-2026  Configurations read from PieceConfTable
+///           agent              17-Oct-2026  Squares taken saved into the players
+///           agent              17-Oct-2026  Number of nodes searched
+///           agent              17-Oct-2026  Search statistics
+///           agent              17-Oct-2026  Moves packed into PackedMove_t words
+///           agent              17-Oct-2026  Killer moves and history heuristic
+///           agent              17-Oct-2026  Principal variation search and aspiration windows
+///           agent              17-Oct-2026  Searches cancelled through a CancellationToken
+///           agent              17-Oct-2026  Position keys and switchable progress updates (pondering)
+///           agent              17-Oct-2026  Opening book looked up before searching
+///           agent              17-Oct-2026  Endgame solver
+///           agent              17-Oct-2026  Search specialised for each heuristic at compile time
+///           agent              17-Oct-2026  Exact influence areas kept up to date on request
+///           agent              17-Oct-2026  Pieces removed with an undo record
 /// @endhistory
 ///
 // ============================================================================
@@ -33,8 +52,10 @@
 #include <cstdio> // printf (needed for better i18n)
 #endif
 
+#include <iomanip>   // setw
 #include "gettext.h" // i18n
 #include "game1v1.h"
+#include "deadline_watchdog.h"
 
 /// player1's name
 static const char PLAYER_1_NAME[] = N_("Mr Green");
@@ -68,8 +89,16 @@ Game1v1::Game1v1(
               CHAR_PLAYER2,
               BOARD_1VS1_ROWS,
               BOARD_1VS1_COLUMNS,
-              a_player2StartingCoord)
+              a_player2StartingCoord),
+    m_moveOrdering(true),
+    m_searchMode(e_searchModeAlphaBeta),
+    m_specialisedSearch(true),
+    m_progressUpdate(true),
+    m_openingBook(NULL),
+    m_endgameThreshold(GAME1V1_DEFAULT_ENDGAME_THRESHOLD)
 {
+    ResetSearchStats(m_searchStats);
+
 #ifdef DEBUG
     assert (a_player1StartingCoord.m_row >= 0);
     assert (a_player1StartingCoord.m_row <  BOARD_1VS1_ROWS);
@@ -191,28 +220,33 @@ void Game1v1::RemovePiece(
             const Coordinate &a_coord,
             eGame1v1Player_t a_player)
 {
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
     switch (a_player)
     {
     case e_Game1v1Player1:
     {
+        m_player1.SetPiece(a_piece.GetType());
         Game1v1::RemovePiece(
                 m_board,
                 a_coord,
-                a_piece.GetCurrentConfiguration(),
+                pieceConf,
                 m_player1,
                 m_player2);
-        m_player1.SetPiece(a_piece.GetType());
         break;
     }
     case e_Game1v1Player2:
     {
+        m_player2.SetPiece(a_piece.GetType());
         Game1v1::RemovePiece(
                 m_board,
                 a_coord,
-                a_piece.GetCurrentConfiguration(),
+                pieceConf,
                 m_player2,
                 m_player1);
-        m_player2.SetPiece(a_piece.GetType());
         break;
     }
     default:
@@ -230,28 +264,33 @@ void Game1v1::PutDownPiece(
             const Coordinate &a_coord,
             eGame1v1Player_t a_player)
 {
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
     switch (a_player)
     {
     case e_Game1v1Player1:
     {
+        m_player1.UnsetPiece(a_piece.GetType());
         Game1v1::PutDownPiece(
                 m_board,
                 a_coord,
-                a_piece.GetCurrentConfiguration(),
+                pieceConf,
                 m_player1,
                 m_player2);
-        m_player1.UnsetPiece(a_piece.GetType());
         break;
     }
     case e_Game1v1Player2:
     {
+        m_player2.UnsetPiece(a_piece.GetType());
         Game1v1::PutDownPiece(
                 m_board,
                 a_coord,
-                a_piece.GetCurrentConfiguration(),
+                pieceConf,
                 m_player2,
                 m_player1);
-        m_player2.UnsetPiece(a_piece.GetType());
         break;
     }
     default:
@@ -267,11 +306,14 @@ void Game1v1::PutDownPiece(
 void Game1v1::RemovePiece(
         Board                    &a_theBoard,
         const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf,
+        const PieceConf_t        &a_pieceConf,
         Player                   &a_playerMe,
-        Player                   &a_playerOpponent)
+        Player                   &a_playerOpponent,
+        eInfluenceAreaUpdate_t    a_influenceAreaUpdate)
 {
 #ifdef DEBUG
+    assert(a_influenceAreaUpdate != e_influenceAreaNone);
+
     assert(a_coord.m_row >= 0);
     assert(a_coord.m_row < a_theBoard.GetNRows());
 
@@ -279,20 +321,16 @@ void Game1v1::RemovePiece(
     assert(a_coord.m_col < a_theBoard.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piece first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < a_theBoard.GetNRows()) );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < a_theBoard.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < a_theBoard.GetNRows()) );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < a_theBoard.GetNColumns()) );
 
         assert(a_theBoard.IsPlayerInCoord(
                 thisCoord,
@@ -301,16 +339,16 @@ void Game1v1::RemovePiece(
 
         // remove the current square of the piece from the board
         a_theBoard.BlankCoord(thisCoord);
+        a_playerMe.ToggleHashKeySquare(thisCoord);
+        a_playerMe.RemoveTakenSquare(thisCoord);
     }
 
     // go through the list of squares of the piece again now that
     // the piece has been removed
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 
         // is it now a nucleation point for me or the opponent? (it couldn't be before, as it was occupied by 'me')
         if (rules::IsNucleationPointCompute(
@@ -330,22 +368,21 @@ void Game1v1::RemovePiece(
 
         // is the current coord influenced by the opponent (it couldn't be before as this square
         // was occupied by me)
-        if (rules::IsCoordInfluencedByPlayerFastCompute(
+        if ( (a_influenceAreaUpdate == e_influenceAreaApproximate) &&
+             rules::IsCoordInfluencedByPlayerFastCompute(
                 a_theBoard,
                 thisCoord,
                 a_playerOpponent))
         {
             a_playerOpponent.SetInfluencedCoord(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. Are they still nk points for player 'me'?
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row < 0) || (thisCoord.m_col < 0)     ||
              (thisCoord.m_row >= a_theBoard.GetNRows())         ||
@@ -366,15 +403,13 @@ void Game1v1::RemovePiece(
             // removed
         	a_playerMe.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece that was just removed might also be nk points
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row < 0) || (thisCoord.m_col < 0) ||
              (thisCoord.m_row >= a_theBoard.GetNRows())     ||
@@ -397,18 +432,29 @@ void Game1v1::RemovePiece(
             // this forbidden coord is now a nk point since the piece was removed
         	a_playerMe.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
 
-    // recalculate the influence area around the piece that was just removed
-    rules::RecalculateInfluenceAreaAroundPieceFast(a_theBoard, a_coord, a_pieceConf, a_playerMe);
+    if (a_influenceAreaUpdate == e_influenceAreaExact)
+    {
+        // the squares both players can reach now that the piece is not on the board
+        // (and a_playerMe has got it back)
+        rules::RecalculateInfluenceAreaInBoard(a_theBoard, a_playerMe);
+        rules::RecalculateInfluenceAreaInBoard(a_theBoard, a_playerOpponent);
+    }
+    else
+    {
+        // recalculate the influence area around the piece that was just removed
+        rules::RecalculateInfluenceAreaAroundPieceFast(a_theBoard, a_coord, a_pieceConf, a_playerMe);
+    }
 }
 
 void Game1v1::PutDownPiece(
         Board                    &a_theBoard,
         const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf,
+        const PieceConf_t        &a_pieceConf,
         Player                   &a_playerMe,
-        Player                   &a_playerOpponent)
+        Player                   &a_playerOpponent,
+        eInfluenceAreaUpdate_t    a_influenceAreaUpdate)
 {
 #ifdef DEBUG
     assert(a_coord.m_row >= 0);
@@ -418,20 +464,16 @@ void Game1v1::PutDownPiece(
     assert(a_coord.m_col < a_theBoard.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piece first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < a_theBoard.GetNRows()) );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < a_theBoard.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < a_theBoard.GetNRows()) );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < a_theBoard.GetNColumns()) );
 
         assert(a_theBoard.IsCoordEmpty(thisCoord));
 #endif
@@ -439,24 +481,29 @@ void Game1v1::PutDownPiece(
         a_theBoard.SetPlayerInCoord(
                 thisCoord,
         		a_playerMe);
+        a_playerMe.ToggleHashKeySquare(thisCoord);
+        a_playerMe.AddTakenSquare(thisCoord);
 
         // can't be a nucleation point of player 'me' any more
         a_playerMe.UnsetNucleationPoint(thisCoord);
 
         // this new point is being occupied by the player 'me'. It can't be a nucleation point
-        // or belong to the influence area of the opponent any more
+        // of the opponent any more
         a_playerOpponent.UnsetNucleationPoint(thisCoord);
-        a_playerOpponent.UnsetInfluencedCoord(thisCoord);
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+
+        if (a_influenceAreaUpdate == e_influenceAreaApproximate)
+        {
+            // nor belong to the influence area of the opponent
+            a_playerOpponent.UnsetInfluencedCoord(thisCoord);
+        }
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. If they are inside the board they will be set as
     // nucleation point. No need to compute
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row >= 0)                       &&
              (thisCoord.m_col >= 0)                       &&
@@ -469,15 +516,13 @@ void Game1v1::PutDownPiece(
             // it's ok -and faster- to set it twice
         	a_playerMe.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece can't be a valid nk point any longer
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row >= 0) &&
              (thisCoord.m_col >= 0) &&
@@ -488,10 +533,73 @@ void Game1v1::PutDownPiece(
             // to the forbidden area of the deployed piece
             a_playerMe.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
+
+    switch (a_influenceAreaUpdate)
+    {
+    case e_influenceAreaApproximate:
+    {
+        // recalculate the influence area around the piece that was just put down
+        rules::RecalculateInfluenceAreaAroundPieceFast(a_theBoard, a_coord, a_pieceConf, a_playerMe);
+        break;
+    }
+    case e_influenceAreaExact:
+    {
+        // the squares both players can reach now. The piece can't be reached by the
+        // opponent any more, and a_playerMe can't use it again
+        rules::RecalculateInfluenceAreaInBoard(a_theBoard, a_playerMe);
+        rules::RecalculateInfluenceAreaInBoard(a_theBoard, a_playerOpponent);
+        break;
+    }
+    default:
+        // the search which put down the piece doesn't read them
+        break;
+    } // switch (a_influenceAreaUpdate)
+}
+
+void Game1v1::PutDownPiece(
+        Board                    &a_theBoard,
+        const Coordinate         &a_coord,
+        const PieceConf_t        &a_pieceConf,
+        Player                   &a_playerMe,
+        Player                   &a_playerOpponent,
+        UndoRecord_t             &out_undoRecord,
+        eInfluenceAreaUpdate_t    a_influenceAreaUpdate)
+{
+    a_playerMe.SaveBoardState(out_undoRecord.playerMe);
+    a_playerOpponent.SaveBoardState(out_undoRecord.playerOpponent);
+
+    Game1v1::PutDownPiece(
+            a_theBoard,
+            a_coord,
+            a_pieceConf,
+            a_playerMe,
+            a_playerOpponent,
+            a_influenceAreaUpdate);
+}
+
+void Game1v1::RemovePiece(
+        Board                    &a_theBoard,
+        const Coordinate         &a_coord,
+        const PieceConf_t        &a_pieceConf,
+        const UndoRecord_t       &a_undoRecord,
+        Player                   &a_playerMe,
+        Player                   &a_playerOpponent)
+{
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
+    {
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
+#ifdef DEBUG
+        assert(a_theBoard.IsPlayerInCoord(thisCoord, a_playerMe));
+#endif
+        a_theBoard.BlankCoord(thisCoord);
+    }
 
-    // recalculate the influence area around the piece that was just put down
-    rules::RecalculateInfluenceAreaAroundPieceFast(a_theBoard, a_coord, a_pieceConf, a_playerMe);
+    // nk points, influence areas, their weights and hash keys as they were
+    // before the piece was put down. No need to compute anything
+    a_playerMe.RestoreBoardState(a_undoRecord.playerMe);
+    a_playerOpponent.RestoreBoardState(a_undoRecord.playerOpponent);
 }
 
 int32_t Game1v1::MinMax(
@@ -500,9 +608,129 @@ int32_t Game1v1::MinMax(
         eGame1v1Player_t             a_player,
         Piece                        &out_resultPiece,
         Coordinate                   &out_coord,
-        const volatile sig_atomic_t  &stopProcessingFlag,
+        const CancellationToken      &a_cancelToken,
+        const Coordinate             &a_lastOpponentPieceCoord,
+        const Piece                  &a_lastOpponentPiece,
+        int32_t                      a_nThreads,
+        TranspositionTable           *a_transTable)
+{
+    int32_t bookValue;
+    if (ProbeOpeningBook(
+            a_heuristicMethod, depth, a_player, out_resultPiece, out_coord, bookValue))
+    {
+        // no search tree was needed
+        ResetSearchStats(m_searchStats);
+        return bookValue;
+    }
+
+    if (IsEndgame(a_player))
+    {
+        // so few moves are left that the position can be solved up to the end of the game
+        return MinMaxEndgame(
+                    a_heuristicMethod,
+                    a_player,
+                    out_resultPiece,
+                    out_coord,
+                    a_cancelToken,
+                    a_transTable);
+    }
+
+    return MinMaxWindow(
+                a_heuristicMethod,
+                depth,
+                a_player,
+                out_resultPiece,
+                out_coord,
+                a_cancelToken,
+                a_lastOpponentPieceCoord,
+                a_lastOpponentPiece,
+                a_nThreads,
+                a_transTable,
+                -INFINITE,
+                INFINITE);
+}
+
+int32_t Game1v1::MinMaxWindow(
+        Heuristic::EvalFunction_t    a_heuristicMethod,
+        int32_t                      depth,
+        eGame1v1Player_t             a_player,
+        Piece                        &out_resultPiece,
+        Coordinate                   &out_coord,
+        const CancellationToken      &a_cancelToken,
+        const Coordinate             &a_lastOpponentPieceCoord,
+        const Piece                  &a_lastOpponentPiece,
+        int32_t                      a_nThreads,
+        TranspositionTable           *a_transTable,
+        int32_t                      a_alpha,
+        int32_t                      a_beta)
+{
+#ifdef DEBUG
+    assert(a_alpha < a_beta);
+#endif
+
+    if (depth > GAME1V1_MAX_SEARCH_DEPTH)
+    {
+        // statistics are saved per ply
+        depth = GAME1V1_MAX_SEARCH_DEPTH;
+    }
+
+    ResetSearchStats(m_searchStats);
+    GTimer* timer = g_timer_new();
+
+    // the influence areas saved in the players are the approximation kept by
+    // PutDownPiece. They are calculated exactly at the root if the heuristic needs
+    // them exact, and put back as they were once the search is finished
+    const bool exactInfluenceAreas =
+        (SelectInfluenceAreaUpdate(a_heuristicMethod) == e_influenceAreaExact);
+    Player::BoardState_t player1State;
+    Player::BoardState_t player2State;
+    if (exactInfluenceAreas)
+    {
+        m_player1.SaveBoardState(player1State);
+        m_player2.SaveBoardState(player2State);
+        rules::RecalculateInfluenceAreaInBoard(m_board, m_player1);
+        rules::RecalculateInfluenceAreaInBoard(m_board, m_player2);
+    }
+
+    int32_t rv = MinMaxRoot(
+                    a_heuristicMethod,
+                    depth,
+                    a_player,
+                    out_resultPiece,
+                    out_coord,
+                    a_cancelToken,
+                    a_lastOpponentPieceCoord,
+                    a_lastOpponentPiece,
+                    a_nThreads,
+                    a_transTable,
+                    a_alpha,
+                    a_beta);
+
+    if (exactInfluenceAreas)
+    {
+        m_player1.RestoreBoardState(player1State);
+        m_player2.RestoreBoardState(player2State);
+    }
+
+    m_searchStats.elapsedSeconds = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+    return rv;
+}
+
+int32_t Game1v1::MinMaxRoot(
+        Heuristic::EvalFunction_t    a_heuristicMethod,
+        int32_t                      depth,
+        eGame1v1Player_t             a_player,
+        Piece                        &out_resultPiece,
+        Coordinate                   &out_coord,
+        const CancellationToken      &a_cancelToken,
         const Coordinate             &a_lastOpponentPieceCoord,
-        const Piece                  &a_lastOpponentPiece)
+        const Piece                  &a_lastOpponentPiece,
+        int32_t                      a_nThreads,
+        TranspositionTable           *a_transTable,
+        int32_t                      a_alpha,
+        int32_t                      a_beta)
 {
     Player* playerMe       = NULL;
     Player* playerOpponent = NULL;
@@ -527,6 +755,13 @@ int32_t Game1v1::MinMax(
 #endif
     } // switch (a_player)
 
+    if (a_transTable != NULL)
+    {
+        // values calculated with a different heuristic can't be reused
+        a_transTable->NewSearch(
+            static_cast<uint64_t>(reinterpret_cast<uintptr_t>(a_heuristicMethod)));
+    }
+
 	// putting down the 1st piece is a special case
 	if (playerMe->NumberOfPiecesAvailable() == e_numberOfPieces)
 	{
@@ -539,32 +774,27 @@ int32_t Game1v1::MinMax(
 				out_resultPiece,
 				out_coord);
 	}
-#ifdef DEBUG_PRINT
-    int32_t timesCalled = 1;
-#endif
-    int32_t alpha = -INFINITE;
-    int32_t beta  = INFINITE;
+    // the root of the search tree
+    m_searchStats.nodes++;
+    m_searchStats.nodesPerPly[0]++;
+
+    int32_t alpha = a_alpha;
+    int32_t beta  = a_beta;
 
     // reset output
     out_resultPiece = Piece(e_noPiece);
     out_coord = Coordinate();
 
-    // this set will be used not to place the same piece in the same place more than once
-    // it will be reset every time the piece is rotated/mirrored or the piece is changed
-    Game1v1CoordinateSet_t testedCoords;
-
-    // this set will save the current nucleation points. It will be used in future calls not to
+    // this plane will save the current nucleation points. It will be used in future calls not to
     // check configurations more than once
-    Game1v1CoordinateSet_t nkPointSetMe;
-    Game1v1::GetAllNucleationPoints(*playerMe, nkPointSetMe);
-    //playerMe->GetAllNucleationPoints(nkPointSetMe);
+    Bitboard nkPointsMe = playerMe->GetNucleationPointsPlane();
 
     // declare the array of last pieces and old NK points for me and opponent
     // and clear them out
     ePieceType_t lastPiecesMe[e_numberOfPieces];
     ePieceType_t lastPiecesOpponent[e_numberOfPieces];
-    Game1v1CoordinateSet_t* oldNkPointsMe[e_numberOfPieces];
-    Game1v1CoordinateSet_t* oldNkPointsOpponent[e_numberOfPieces];
+    const Bitboard* oldNkPointsMe[e_numberOfPieces];
+    const Bitboard* oldNkPointsOpponent[e_numberOfPieces];
 
     for (int32_t i = e_minimumPieceIndex ; i < e_numberOfPieces ; i++)
     {
@@ -576,7 +806,7 @@ int32_t Game1v1::MinMax(
 
     // save a pointer to this set in the place (index) reserved for it
     // in this case is 0 (the current depth starting from lower to higher)
-    oldNkPointsMe[0] = &nkPointSetMe;
+    oldNkPointsMe[0] = &nkPointsMe;
 
     // lastPiecesOpponent[0] needs to be set to an empty piece for the algorithm
     // to work even if the depth is set to an even number
@@ -591,28 +821,171 @@ int32_t Game1v1::MinMax(
     if (playerMe->NumberOfPiecesAvailable() == 0)
     {
         // calculate the heuristic of the board to return it, even though the function calculated fuck-all
+        m_searchStats.leafEvaluations++;
         return a_heuristicMethod(m_board, *playerMe, *playerOpponent);
     }
 
+    if (a_nThreads > 1)
+    {
+        // moves at the root of the tree will be split between a bunch of
+        // worker threads
+        return MinMaxParallel(
+                    m_board,
+                    *playerMe,
+                    *playerOpponent,
+                    a_heuristicMethod,
+                    depth,
+                    a_nThreads,
+                    out_resultPiece,
+                    out_coord,
+                    a_cancelToken,
+                    a_transTable,
+                    alpha,
+                    beta);
+    }
+
+    // accesses to the transposition table made by this search
+    TranspositionTable::Stats_t transTableStats;
+    TranspositionTable::ResetStats(transTableStats);
+
+    // lists of moves of every ply, killer moves and history. All the memory the
+    // search needs is allocated here, before it starts
+    MoveOrdering moveOrdering(
+            depth,
+            m_board.GetNRows() * m_board.GetNColumns(),
+            m_moveOrdering);
+
+    // cancellation requests are read once every CANCELLATION_CHECKPOINT_INTERVAL nodes
+    CancellationCheckpoint checkpoint(a_cancelToken);
+
+    // version of the search the tree below each root move is searched with
+    AlphaBetaComputeFunction_t alphaBetaCompute =
+            SelectAlphaBetaCompute(a_heuristicMethod, m_specialisedSearch);
+
+    // influence areas are only kept up to date if the heuristic reads them
+    const eInfluenceAreaUpdate_t influenceAreaUpdate = SelectInfluenceAreaUpdate(a_heuristicMethod);
+
 #ifdef DEBUG_PRINT
     std::cout << _("Nucleation points") << " "
               << playerMe->NumberOfNucleationPoints()
               << std::endl;
 #endif
 
-    // will contain the valid coords per nucleation point
-    std::vector<Coordinate> validCoords(PIECE_MAX_SQUARES);
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    // will contain the valid coords of each piece configuration
+    Bitboard validCoords;
 
     // number of pieces successfully put down
     // if no pieces could be put down the recursive function wasn't called even once,
     // which means the search tree was broken.
     int32_t nBranchesSearchTree = 0;
 
-    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    // best move found so far packed into a word (saved into the transposition table)
+    PackedMove_t bestMove = packedmove::NoMove();
+
+    // true if some move was skipped by the nk points filter below the root (see
+    // MinMaxAlphaBetaCompute). childFiltered is set by each call for a root move
+    bool subtreeFiltered = false;
+    bool childFiltered = false;
+
+    // zobrist key of the current position. The transposition table might save the
+    // best move found for this position by a previous search (the previous iteration
+    // of MinMaxIterativeDeepening, for example). That move is tried out first
+    uint64_t rootHashKey = 0;
+    TranspositionTable::Entry_t rootEntry;
+    rootEntry.move = packedmove::NoMove();
+    const PieceConf_t* rootMoveConf = NULL;
+    Coordinate rootCoord;
+    if (a_transTable != NULL)
+    {
+        rootHashKey = Game1v1::CalculateHashKey(*playerMe, *playerOpponent);
+        if (a_transTable->Probe(rootHashKey, rootEntry, transTableStats))
+        {
+            rootMoveConf = Game1v1::GetTranspositionTableMoveConf(
+                    m_board, *playerMe, rootEntry.move, rootCoord);
+        }
+    }
+
+    if (rootMoveConf != NULL)
+    {
+        playerMe->UnsetPiece(rootMoveConf->pieceType);
+
+        UndoRecord_t undoRecord;
+        Game1v1::PutDownPiece(
+                m_board,
+                rootCoord,
+                *rootMoveConf,
+                *playerMe,
+                *playerOpponent,
+                undoRecord,
+                influenceAreaUpdate);
+
+        lastPiecesMe[0] = rootMoveConf->pieceType;
+
+        nBranchesSearchTree++;
+        m_searchStats.movesTried++;
+
+        int32_t maxValue = -alphaBetaCompute(
+                                m_board,
+                                *playerOpponent,
+                                oldNkPointsOpponent,
+                                lastPiecesOpponent,
+                                *playerMe,
+                                oldNkPointsMe,
+                                lastPiecesMe,
+                                a_heuristicMethod,
+                                depth,
+                                depth - 1,
+                                -beta,
+                                -alpha,
+                                a_transTable,
+                                transTableStats,
+                                checkpoint,
+                                m_searchMode,
+                                moveOrdering,
+                                m_searchStats,
+                                childFiltered);
+
+        subtreeFiltered = subtreeFiltered || childFiltered;
+
+        if (maxValue > alpha)
+        {
+            bestMove = rootEntry.move;
+            alpha    = maxValue;
+        }
+
+        Game1v1::RemovePiece(
+                m_board,
+                rootCoord,
+                *rootMoveConf,
+                undoRecord,
+                *playerMe,
+                *playerOpponent);
+
+        playerMe->SetPiece(rootMoveConf->pieceType);
+
+        if (checkpoint.IsCancelled())
+        {
+            // " (...) output or returned value will have unexpected
+            //   undescribed values "
+            return 0;
+        }
+    }
+
+    // set to true if a move of the root is not worse than beta (the root
+    // was searched with an aspiration window which was too low)
+    bool failHigh = (alpha >= beta);
+
+    for (int8_t i = e_numberOfPieces - 1 ; (i >= e_minimumPieceIndex) && !failHigh ; i--)
     {
         // notify possible listeners the progress update
-        m_signal_progress.emit(
-            static_cast<float>(e_numberOfPieces - i) / e_numberOfPieces);
+        if (m_progressUpdate)
+        {
+            m_signal_progress.emit(
+                static_cast<float>(e_numberOfPieces - i) / e_numberOfPieces);
+        }
 #ifdef DEBUG_PRINT
         std::cout <<".";
         std::cout.flush(); // fflush(stdout);
@@ -635,189 +1008,1154 @@ int32_t Game1v1::MinMax(
 
         playerMe->UnsetPiece(static_cast<ePieceType_t>(i));
 
-        const std::list<PieceConfiguration> &pieceConfList =
-            playerMe->m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
-            bool nkExists;
-            Coordinate thisNkPoint;
-            Player::SpiralIterator nkIterator;
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
 
-            nkExists = playerMe->GetFirstNucleationPointSpiral(nkIterator, thisNkPoint);
-            while(nkExists)
+            // retrieve all the valid coords of this piece configuration at once
+            rules::CalculateValidCoordsInBoard(
+                m_board,
+                *playerMe,
+                pieceConf,
+                nkPointsMe,
+                validCoords);
+            m_searchStats.movesGenerated += validCoords.PopCount();
+
+            // from the middle of the board to the edges
+            int32_t ring;
+            for (int32_t index = m_board.GetFirstIndexSpiral(validCoords, ring);
+                 index >= 0;
+                 index = m_board.GetNextIndexSpiral(validCoords, ring, index))
             {
-                // retrieve the valid coords of this piece in the current nk point
-                int32_t nValidCoords = rules::CalculateValidCoordsInNucleationPoint(
-                                            m_board,
-                                            *playerMe,
-                                            thisNkPoint,
-                                            *pieceConfIt,
-                                            validCoords);
-
-                for (int32_t k = 0 ; k < nValidCoords ; k++)
+                if ( (rootMoveConf == &pieceConf) &&
+                     (packedmove::GetSquareIndex(rootEntry.move) == index) )
                 {
-                    if (!testedCoords.isPresent(validCoords[k]))
-                    {
-                        testedCoords.insert(validCoords[k]);
+                    // this move was already tried out before the loop
+                    continue;
+                }
 
-                        Game1v1::PutDownPiece(
-                                m_board,
-                                validCoords[k],
-                                *pieceConfIt,
-                                *playerMe,
-                                *playerOpponent);
-
-                        // save a pointer to this piece in the place (index) reserved for it
-                        lastPiecesMe[0] = playerMe->m_pieces[i].GetType();
-
-                        // number of branches searched at this level of the tree
-                        nBranchesSearchTree++;
-
-                        int32_t maxValue = -Game1v1::MinMaxAlphaBetaCompute(
-                                                m_board,
-                                                *playerOpponent,
-                                                oldNkPointsOpponent,
-                                                lastPiecesOpponent,
-                                                *playerMe,
-                                                oldNkPointsMe,
-                                                lastPiecesMe,
-                                                a_heuristicMethod,
-                                                depth,
-                                                depth - 1,
-                                                -beta,
-                                                -alpha,
-                                                stopProcessingFlag
-#ifdef DEBUG_PRINT
-                                                ,timesCalled
-#endif
-                                                );
+                Coordinate thisCoord;
+                Bitboard::IndexToCoord(index, m_board.GetNColumns(), thisCoord);
 
-                        if (maxValue > alpha)
-                        {
-                            if (out_resultPiece.GetType() != playerMe->m_pieces[i].GetType())
-                            {
-                                out_resultPiece = playerMe->m_pieces[i];
-                            }
-                            out_resultPiece.SetCurrentConfiguration(*pieceConfIt);
+                UndoRecord_t undoRecord;
+                Game1v1::PutDownPiece(
+                        m_board,
+                        thisCoord,
+                        pieceConf,
+                        *playerMe,
+                        *playerOpponent,
+                        undoRecord,
+                        influenceAreaUpdate);
 
-                            out_coord.m_row = validCoords[k].m_row;
-                            out_coord.m_col = validCoords[k].m_col;
+                // save a pointer to this piece in the place (index) reserved for it
+                lastPiecesMe[0] = playerMe->m_pieces[i].GetType();
 
-                            alpha = maxValue;
-                        }
+                // number of branches searched at this level of the tree
+                nBranchesSearchTree++;
+                m_searchStats.movesTried++;
 
-                        Game1v1::RemovePiece(
-                                m_board,
-                                validCoords[k],
-                                *pieceConfIt,
-                                *playerMe,
-                                *playerOpponent);
+                // the full window is used if this move needs its exact value
+                bool fullWindow = true;
+                int32_t maxValue;
 
-                        if (stopProcessingFlag)
-                        {
-                            // something happened and we were told to stop
-                            // processing (that is probably why MinMaxAlphaBetaCompute
-                            // returned. This function just returns as it is described on
-                            // the description of the function:
-                            // " (...) output or returned value will have unexpected
-                            //   undescribed values "
-                            return 0;
-                        }
+                if ( (m_searchMode == e_searchModePVS) && (nBranchesSearchTree > 1) )
+                {
+                    // prove this move is not better than the best one so far
+                    // with a null window. It is much cheaper than the full one
+                    maxValue = -alphaBetaCompute(
+                                    m_board,
+                                    *playerOpponent,
+                                    oldNkPointsOpponent,
+                                    lastPiecesOpponent,
+                                    *playerMe,
+                                    oldNkPointsMe,
+                                    lastPiecesMe,
+                                    a_heuristicMethod,
+                                    depth,
+                                    depth - 1,
+                                    -alpha - 1,
+                                    -alpha,
+                                    a_transTable,
+                                    transTableStats,
+                                    checkpoint,
+                                    m_searchMode,
+                                    moveOrdering,
+                                    m_searchStats,
+                                    childFiltered);
+
+                    subtreeFiltered = subtreeFiltered || childFiltered;
+
+                    // the value of a leaf is always exact
+                    fullWindow = (maxValue > alpha) && (maxValue < beta) && (depth > 1) &&
+                                 !checkpoint.IsCancelled();
+                    if (fullWindow)
+                    {
+                        m_searchStats.nullWindowResearches++;
+                    }
+                }
 
-#ifdef DEBUG
-                        assert(beta > alpha);
-#endif
-                    } // if (it == testedCoords.end())
-                } // for (int32_t k = 0 ; k < nValidCoords ; k++)
+                if (fullWindow)
+                {
+                    maxValue = -alphaBetaCompute(
+                                    m_board,
+                                    *playerOpponent,
+                                    oldNkPointsOpponent,
+                                    lastPiecesOpponent,
+                                    *playerMe,
+                                    oldNkPointsMe,
+                                    lastPiecesMe,
+                                    a_heuristicMethod,
+                                    depth,
+                                    depth - 1,
+                                    -beta,
+                                    -alpha,
+                                    a_transTable,
+                                    transTableStats,
+                                    checkpoint,
+                                    m_searchMode,
+                                    moveOrdering,
+                                    m_searchStats,
+                                    childFiltered);
+
+                    subtreeFiltered = subtreeFiltered || childFiltered;
+                }
+
+                if (maxValue > alpha)
+                {
+                    bestMove = packedmove::Pack(
+                                pieceConf.pieceType, pieceConf.confIndex, index);
+                    alpha    = maxValue;
+                }
+
+                Game1v1::RemovePiece(
+                        m_board,
+                        thisCoord,
+                        pieceConf,
+                        undoRecord,
+                        *playerMe,
+                        *playerOpponent);
+
+                if (checkpoint.IsCancelled())
+                {
+                    // something happened and we were told to stop
+                    // processing (that is probably why MinMaxAlphaBetaCompute
+                    // returned. This function just returns as it is described on
+                    // the description of the function:
+                    // " (...) output or returned value will have unexpected
+                    //   undescribed values "
+                    return 0;
+                }
 
-                nkExists = playerMe->GetNextNucleationPointSpiral(nkIterator, thisNkPoint);
-            } // while(nkExists)
+                if (alpha >= beta)
+                {
+                    // the value of the position is not smaller than beta. The
+                    // caller will have to search it again with a wider window
+                    failHigh = true;
+                    break;
+                }
+            } // for (int32_t index = ...GetFirstIndexSpiral(validCoords, ring);
 
-            testedCoords.clear();
-        } // for (pieceConfIt = pieceConfList.begin()
+            if (failHigh)
+            {
+                break;
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
 
         playerMe->SetPiece(static_cast<ePieceType_t>(i));
     } // for (int i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
 
 #ifdef DEBUG_PRINT
     // http://www.gnu.org/software/gettext/manual/gettext.html#Plural-forms
-    // i18n %d represents the amount of times the function has been called
+    // i18n %lld represents the amount of times the function has been called
     printf(ngettext ("Minimax function called once\n",
-                     "Minimax function called %d times\n", timesCalled),
-           timesCalled);
+                     "Minimax function called %lld times\n", m_searchStats.nodes),
+           static_cast<long long>(m_searchStats.nodes));
 #endif
 
-    return alpha;
-}
-
-int32_t Game1v1::ComputeFirstPiece(
-        Board            &a_board,
-        Player           &a_playerMe,
-        Player           &a_playerOpponent,
-        const Coordinate &a_lastOpponentPieceCoord,
-        const Piece      &a_lastOpponentPiece,
-        Piece            &out_resultPiece,
-        Coordinate       &out_coord)
-{
-    // try to calculate a 'smart' first move quickly
-    if ( (a_playerMe.NumberOfPiecesAvailable() == e_numberOfPieces) &&
-         (a_lastOpponentPiece.GetType() != e_noPiece) &&
-         (a_lastOpponentPiece.GetNSquares() == 5) &&
-         (a_playerOpponent.NumberOfNucleationPoints() > 5) )
+    // the best move is only copied into the output pieces once the search is over.
+    // Pieces are not plain data, and copying them might allocate memory
+    if (packedmove::IsNoMove(bestMove) == false)
     {
-        // this is the 1st move. The opponent put down a 5-square piece
-        // creating more than 5 nk points. We'll be cheeky and copy the move
-        out_resultPiece = a_lastOpponentPiece;
-        out_resultPiece.RotateRight();
-        out_resultPiece.RotateRight();
+        const PieceConf_t &bestConf = packedmove::GetConf(bestMove, confTable);
 
-        out_coord.m_row = a_board.GetNRows()    - a_lastOpponentPieceCoord.m_row - 1;
-        out_coord.m_col = a_board.GetNColumns() - a_lastOpponentPieceCoord.m_col - 1;
+        out_resultPiece = playerMe->m_pieces[bestConf.pieceType];
+        out_resultPiece.SetCurrentConfiguration(*(bestConf.pieceConf));
+        packedmove::ToCoordinate(bestMove, m_board.GetNColumns(), out_coord);
     }
-    else
+
+    if (a_transTable != NULL)
     {
-        // we shouldn't copy the 1st user's move, because it was shit
-        // Do an acceptable 1st move (quick and dirty solution).
-        // The following piece of code will put the cross in a 'good'
-        // place, for example in 9,8 -if starting coord is (9,9)-
-        // or 5,6 if starting coord is (4,4).
-        // (4,4) and (9,9) are the standard starting coords
-        out_resultPiece = Piece(e_5Piece_Cross);
-        Coordinate startingCoord = a_playerMe.GetStartingCoordinate();
-        if ((a_board.GetNColumns() / 2) > startingCoord.m_col)
-        {
-            out_coord.m_col = startingCoord.m_col + 1;
-        }
-        else if ((a_board.GetNColumns() / 2) < startingCoord.m_col)
-        {
-            out_coord.m_col = startingCoord.m_col - 1;
-        }
-        else
+        if (out_resultPiece.GetType() != e_noPiece)
         {
-            out_coord.m_col = startingCoord.m_col;
+            // the value of this position is exact unless it failed high. If it
+            // failed low there is no move, and nothing is saved. Only the best
+            // move is saved if the value depends on the path taken to reach some
+            // position of the tree
+            if (subtreeFiltered)
+            {
+                a_transTable->Store(
+                        rootHashKey,
+                        depth,
+                        -INFINITE,
+                        TranspositionTable::e_boundLower,
+                        bestMove);
+            }
+            else
+            {
+                a_transTable->Store(
+                        rootHashKey,
+                        depth,
+                        alpha,
+                        failHigh ? TranspositionTable::e_boundLower :
+                                   TranspositionTable::e_boundExact,
+                        bestMove);
+            }
         }
 
-        out_coord.m_row = startingCoord.m_row;
+        a_transTable->AddStats(transTableStats);
     }
 
-    // check out now if the move calculated in the previous step is valid
-    if (!rules::IsPieceDeployableInStartingPoint(
-            a_board,
-            out_resultPiece.GetCurrentConfiguration(),
-            out_coord,
-            a_playerMe.GetStartingCoordinate()) )
-    {
-        // move wasn't valid. calculate a new one (if it is possible)
+    return alpha;
+}
 
-        // new move. Restart variables which save the calculated move
-        out_resultPiece = Piece(e_noPiece);
-        out_coord = Coordinate();
+int32_t Game1v1::MinMaxParallel(
+        const Board                 &a_board,
+        const Player                &a_playerMe,
+        const Player                &a_playerOpponent,
+        Heuristic::EvalFunction_t    a_heuristicMethod,
+        int32_t                      depth,
+        int32_t                      a_nThreads,
+        Piece                       &out_resultPiece,
+        Coordinate                  &out_coord,
+        const CancellationToken     &a_cancelToken,
+        TranspositionTable          *a_transTable,
+        int32_t                      a_alpha,
+        int32_t                      a_beta)
+{
+    // reset output
+    out_resultPiece = Piece(e_noPiece);
+    out_coord = Coordinate();
 
-        int32_t heuristicValue = -INFINITE;
+    if (a_nThreads > GAME1V1_MAX_SEARCH_THREADS)
+    {
+        a_nThreads = GAME1V1_MAX_SEARCH_THREADS;
+    }
+
+    // calculate first the list of moves at the root of the tree. They must be
+    // saved in the same order MinMax tries them out, so the parallel version
+    // can pick the same move in case there are 2 (or more) equally good moves
+    std::vector<PackedMove_t> rootMoves;
+    PackedMove_t thisMove;
+
+    // nucleation points the pieces must touch
+    const Bitboard &nkPointsMe = a_playerMe.GetNucleationPointsPlane();
+
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    // will contain the valid coords of each piece configuration
+    Bitboard validCoords;
+
+    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    {
+        if ( (a_playerMe.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false) ||
+             ( (a_playerMe.m_pieces[i].GetNSquares() < 5) &&
+               (a_playerMe.NumberOfPiecesAvailable() > (e_numberOfPieces - MIN_5SQUARE_PIECES_AT_START)) &&
+               (rootMoves.size() > 0) ) )
+        {
+            // piece is not available OR it should be ignored (same rule as
+            // the one applied by MinMax)
+            continue;
+        }
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            // retrieve all the valid coords of this piece configuration at once
+            rules::CalculateValidCoordsInBoard(
+                a_board,
+                a_playerMe,
+                pieceConf,
+                nkPointsMe,
+                validCoords);
+
+            // from the middle of the board to the edges
+            int32_t ring;
+            for (int32_t index = a_board.GetFirstIndexSpiral(validCoords, ring);
+                 index >= 0;
+                 index = a_board.GetNextIndexSpiral(validCoords, ring, index))
+            {
+                rootMoves.push_back(
+                    packedmove::Pack(pieceConf.pieceType, pieceConf.confIndex, index));
+            } // for (int32_t index = ...GetFirstIndexSpiral(validCoords, ring);
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
+    } // for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+
+    m_searchStats.movesGenerated += rootMoves.size();
+
+    if (rootMoves.size() == 0)
+    {
+        // no piece can be put down. Same result as the 1-thread MinMax
+        return a_alpha;
+    }
+
+    // zobrist key of the current position. The best move saved for it in the
+    // transposition table (by a previous search) will be evaluated first
+    uint64_t rootHashKey = 0;
+    if (a_transTable != NULL)
+    {
+        TranspositionTable::Stats_t transTableStats;
+        TranspositionTable::ResetStats(transTableStats);
+
+        rootHashKey = Game1v1::CalculateHashKey(a_playerMe, a_playerOpponent);
+
+        TranspositionTable::Entry_t rootEntry;
+        if (a_transTable->Probe(rootHashKey, rootEntry, transTableStats))
+        {
+            for (uint32_t i = 0; i < rootMoves.size(); i++)
+            {
+                if (rootMoves[i] == rootEntry.move)
+                {
+                    thisMove = rootMoves[i];
+                    rootMoves.erase(rootMoves.begin() + i);
+                    rootMoves.insert(rootMoves.begin(), thisMove);
+                    break;
+                }
+            }
+        }
+
+        // worker threads haven't been spawned yet
+        a_transTable->AddStats(transTableStats);
+    }
+
+    if (a_nThreads > static_cast<int32_t>(rootMoves.size()))
+    {
+        // no point on spawning threads that won't have anything to do
+        a_nThreads = static_cast<int32_t>(rootMoves.size());
+    }
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    ParallelSearchData_t searchData;
+    searchData.board              = &a_board;
+    searchData.playerMe           = &a_playerMe;
+    searchData.playerOpponent     = &a_playerOpponent;
+    searchData.heuristicMethod    = a_heuristicMethod;
+    searchData.alphaBetaCompute   = SelectAlphaBetaCompute(a_heuristicMethod, m_specialisedSearch);
+    searchData.depth              = depth;
+    searchData.cancelToken        = &a_cancelToken;
+    searchData.rootMoves          = &rootMoves;
+    searchData.transTable         = a_transTable;
+    searchData.moveOrdering       = m_moveOrdering;
+    searchData.searchMode         = m_searchMode;
+    searchData.beta               = a_beta;
+    searchData.mutex              = g_mutex_new();
+    searchData.cond               = g_cond_new();
+    searchData.nextMove           = 0;
+    searchData.nMovesDone         = 0;
+    searchData.nThreadsDone       = 0;
+    searchData.bestValue          = a_alpha;
+    searchData.bestMove           = -1;
+    searchData.subtreeFiltered    = false;
+    searchData.searchStats        = &m_searchStats;
+
+#ifdef DEBUG
+    assert(searchData.mutex != NULL);
+    assert(searchData.cond != NULL);
+#endif
+
+    GThread* workerThreads[GAME1V1_MAX_SEARCH_THREADS];
+    int32_t nThreadsCreated = 0;
+    for (int32_t i = 0; i < a_nThreads; i++)
+    {
+        GError* err = NULL;
+        workerThreads[nThreadsCreated] = g_thread_create(
+                reinterpret_cast<GThreadFunc>(Game1v1::MinMaxParallelThreadRoutine),
+                reinterpret_cast<void*>(&searchData),
+                TRUE, // joinable
+                &err);
+
+        if (workerThreads[nThreadsCreated] == NULL)
+        {
+            // the rest of threads will have to do the job of this one
+            g_error_free(err);
+            continue;
+        }
+
+        nThreadsCreated++;
+    }
+
+    if (nThreadsCreated == 0)
+    {
+        // no thread could be created. Current thread will do all the work
+        MinMaxParallelThreadRoutine(reinterpret_cast<void*>(&searchData));
+    }
+
+    // wait for the worker threads to finish processing. Progress updates
+    // are notified from this thread so listeners don't have to deal with
+    // several threads emitting the signal at the same time
+    g_mutex_lock(searchData.mutex);
+    while (searchData.nThreadsDone < nThreadsCreated)
+    {
+        g_cond_wait(searchData.cond, searchData.mutex);
+
+        float progress = static_cast<float>(searchData.nMovesDone) / rootMoves.size();
+        g_mutex_unlock(searchData.mutex);
+
+        // notify possible listeners the progress update
+        if (m_progressUpdate)
+        {
+            m_signal_progress.emit(progress);
+        }
+
+        g_mutex_lock(searchData.mutex);
+    }
+    g_mutex_unlock(searchData.mutex);
+
+    for (int32_t i = 0; i < nThreadsCreated; i++)
+    {
+        g_thread_join(workerThreads[i]);
+    }
+
+    g_cond_free(searchData.cond);
+    g_mutex_free(searchData.mutex);
+
+    if (a_cancelToken.IsCancelled())
+    {
+        // something happened and we were told to stop processing
+        // " (...) output or returned value will have unexpected
+        //   undescribed values "
+        return 0;
+    }
+
+    if (searchData.bestMove >= 0)
+    {
+        const PackedMove_t bestMove = rootMoves[searchData.bestMove];
+        const PieceConf_t &bestConf = packedmove::GetConf(bestMove, confTable);
+
+        out_resultPiece = a_playerMe.m_pieces[bestConf.pieceType];
+        out_resultPiece.SetCurrentConfiguration(*(bestConf.pieceConf));
+        packedmove::ToCoordinate(bestMove, a_board.GetNColumns(), out_coord);
+
+        if (a_transTable != NULL)
+        {
+            // same as the 1-thread MinMax. The value of the position is exact
+            // unless it failed high or some move was filtered below the root
+            if (searchData.subtreeFiltered)
+            {
+                a_transTable->Store(
+                        rootHashKey,
+                        depth,
+                        -INFINITE,
+                        TranspositionTable::e_boundLower,
+                        bestMove);
+            }
+            else
+            {
+                a_transTable->Store(
+                        rootHashKey,
+                        depth,
+                        searchData.bestValue,
+                        (searchData.bestValue >= a_beta) ? TranspositionTable::e_boundLower :
+                                                           TranspositionTable::e_boundExact,
+                        bestMove);
+            }
+        }
+    }
+
+    return searchData.bestValue;
+}
+
+void* Game1v1::MinMaxParallelThreadRoutine(void *a_threadParam)
+{
+    ParallelSearchData_t* searchData =
+            reinterpret_cast<ParallelSearchData_t*>(a_threadParam);
+
+    // local copies of the board and the players. They will be modified
+    // while this thread explores the search tree
+    Board  localBoard(*(searchData->board));
+    Player localMe(*(searchData->playerMe));
+    Player localOpponent(*(searchData->playerOpponent));
+
+    // root moves are not taken back by this thread. Local copies are refreshed
+    // before every root move instead, and move ordering data is cleared so the
+    // result doesn't depend on how moves were handed out to the threads
+    bool refreshLocalCopies = false;
+
+    // statistics of the part of the search tree visited by this thread
+    SearchStats_t searchStats;
+    ResetSearchStats(searchStats);
+
+    // lists of moves, killer moves and history of this thread. They are
+    // cleared before every root move for the same reason local copies are refreshed
+    MoveOrdering moveOrdering(
+            searchData->depth,
+            localBoard.GetNRows() * localBoard.GetNColumns(),
+            searchData->moveOrdering);
+
+    // cancellation requests are read once every CANCELLATION_CHECKPOINT_INTERVAL nodes
+    // of the search tree, and before every root move
+    CancellationCheckpoint checkpoint(*(searchData->cancelToken));
+
+    // declare the array of last pieces and old NK points for me and opponent
+    // and clear them out. Same as MinMax does, but per thread
+    Bitboard nkPointsMe = localMe.GetNucleationPointsPlane();
+
+    ePieceType_t lastPiecesMe[e_numberOfPieces];
+    ePieceType_t lastPiecesOpponent[e_numberOfPieces];
+    const Bitboard* oldNkPointsMe[e_numberOfPieces];
+    const Bitboard* oldNkPointsOpponent[e_numberOfPieces];
+
+    for (int32_t i = e_minimumPieceIndex ; i < e_numberOfPieces ; i++)
+    {
+        lastPiecesMe[i]  = e_noPiece;
+        oldNkPointsMe[i] = NULL;
+        lastPiecesOpponent[i]  = e_noPiece;
+        oldNkPointsOpponent[i] = NULL;
+    }
+    oldNkPointsMe[0] = &nkPointsMe;
+
+    const std::vector<PackedMove_t> &rootMoves = *(searchData->rootMoves);
+    const int32_t nRootMoves = static_cast<int32_t>(rootMoves.size());
+
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    // accesses to the transposition table made by this thread
+    TranspositionTable::Stats_t transTableStats;
+    TranspositionTable::ResetStats(transTableStats);
+
+    while (!checkpoint.Check())
+    {
+        // get next move to be evaluated and the alpha to evaluate it with
+        g_mutex_lock(searchData->mutex);
+        int32_t thisMoveIndex = searchData->nextMove++;
+        int32_t alpha = searchData->bestValue;
+        g_mutex_unlock(searchData->mutex);
+
+        if ( (thisMoveIndex >= nRootMoves) || (alpha >= searchData->beta) )
+        {
+            // no more moves to be evaluated, or the value of the root is
+            // already known not to be smaller than beta
+            break;
+        }
+
+        // alpha is decremented by 1 so a move as good as the current best
+        // one gets its exact value. The 1-thread MinMax picks the first move
+        // (in rootMoves order) with the best value. The parallel version
+        // keeps that behaviour even if moves are not evaluated in order
+        if (alpha > -INFINITE)
+        {
+            alpha--;
+        }
+
+        if (refreshLocalCopies)
+        {
+            localBoard    = *(searchData->board);
+            localMe       = *(searchData->playerMe);
+            localOpponent = *(searchData->playerOpponent);
+            moveOrdering.Clear();
+        }
+        refreshLocalCopies = true;
+
+        const PackedMove_t thisMove = rootMoves[thisMoveIndex];
+        const PieceConf_t &thisConf = packedmove::GetConf(thisMove, confTable);
+        Coordinate thisCoord;
+        packedmove::ToCoordinate(thisMove, localBoard.GetNColumns(), thisCoord);
+
+        localMe.UnsetPiece(thisConf.pieceType);
+        Game1v1::PutDownPiece(
+                localBoard,
+                thisCoord,
+                thisConf,
+                localMe,
+                localOpponent,
+                SelectInfluenceAreaUpdate(searchData->heuristicMethod));
+
+        // save a pointer to this piece in the place (index) reserved for it
+        lastPiecesMe[0] = thisConf.pieceType;
+        searchStats.movesTried++;
+
+        // the full window is used if this move needs its exact value
+        bool fullWindow = true;
+        int32_t maxValue;
+
+        // true if some move was skipped by the nk points filter below this root move
+        bool subtreeFiltered = false;
+        bool childFiltered = false;
+
+        if ( (searchData->searchMode == e_searchModePVS) && (alpha > -INFINITE) )
+        {
+            // prove this move is not better than the best one so far with a null window
+            maxValue = -searchData->alphaBetaCompute(
+                            localBoard,
+                            localOpponent,
+                            oldNkPointsOpponent,
+                            lastPiecesOpponent,
+                            localMe,
+                            oldNkPointsMe,
+                            lastPiecesMe,
+                            searchData->heuristicMethod,
+                            searchData->depth,
+                            searchData->depth - 1,
+                            -alpha - 1,
+                            -alpha,
+                            searchData->transTable,
+                            transTableStats,
+                            checkpoint,
+                            searchData->searchMode,
+                            moveOrdering,
+                            searchStats,
+                            childFiltered);
+
+            subtreeFiltered = subtreeFiltered || childFiltered;
+
+            // the value of a leaf is always exact
+            fullWindow = (maxValue > alpha) && (maxValue < searchData->beta) &&
+                         (searchData->depth > 1) && !checkpoint.IsCancelled();
+            if (fullWindow)
+            {
+                searchStats.nullWindowResearches++;
+            }
+        }
+
+        if (fullWindow)
+        {
+            maxValue = -searchData->alphaBetaCompute(
+                            localBoard,
+                            localOpponent,
+                            oldNkPointsOpponent,
+                            lastPiecesOpponent,
+                            localMe,
+                            oldNkPointsMe,
+                            lastPiecesMe,
+                            searchData->heuristicMethod,
+                            searchData->depth,
+                            searchData->depth - 1,
+                            -(searchData->beta),
+                            -alpha,
+                            searchData->transTable,
+                            transTableStats,
+                            checkpoint,
+                            searchData->searchMode,
+                            moveOrdering,
+                            searchStats,
+                            childFiltered);
+
+            subtreeFiltered = subtreeFiltered || childFiltered;
+        }
+
+        g_mutex_lock(searchData->mutex);
+        // maxValue is only an upper bound if it is not bigger than alpha
+        if ( !checkpoint.IsCancelled() &&
+             (maxValue > alpha) &&
+             ( (maxValue > searchData->bestValue) ||
+               ( (maxValue == searchData->bestValue) &&
+                 (thisMoveIndex < searchData->bestMove) ) ) )
+        {
+            searchData->bestValue = maxValue;
+            searchData->bestMove  = thisMoveIndex;
+        }
+        searchData->subtreeFiltered = searchData->subtreeFiltered || subtreeFiltered;
+        searchData->nMovesDone++;
+        g_cond_signal(searchData->cond);
+        g_mutex_unlock(searchData->mutex);
+    } // while (!checkpoint.Check())
+
+    g_mutex_lock(searchData->mutex);
+    if (searchData->transTable != NULL)
+    {
+        searchData->transTable->AddStats(transTableStats);
+    }
+    Game1v1::AddSearchStats(searchStats, *(searchData->searchStats));
+    searchData->nThreadsDone++;
+    g_cond_signal(searchData->cond);
+    g_mutex_unlock(searchData->mutex);
+
+    return NULL;
+}
+
+int32_t Game1v1::MinMaxIterativeDeepening(
+        Heuristic::EvalFunction_t    a_heuristicMethod,
+        int32_t                      a_maxDepth,
+        int32_t                      a_timeBudgetMs,
+        eGame1v1Player_t             a_player,
+        Piece                        &out_resultPiece,
+        Coordinate                   &out_coord,
+        int32_t                      &out_depthReached,
+        const CancellationToken      &a_cancelToken,
+        const Coordinate             &a_lastOpponentPieceCoord,
+        const Piece                  &a_lastOpponentPiece,
+        int32_t                      a_nThreads,
+        TranspositionTable           *a_transTable)
+{
+    if (a_maxDepth > GAME1V1_MAX_SEARCH_DEPTH)
+    {
+        a_maxDepth = GAME1V1_MAX_SEARCH_DEPTH;
+    }
+    else if (a_maxDepth < 1)
+    {
+        a_maxDepth = 1;
+    }
+
+    int32_t bookValue;
+    if (ProbeOpeningBook(
+            a_heuristicMethod, a_maxDepth, a_player, out_resultPiece, out_coord, bookValue))
+    {
+        // no search tree was needed. The move is as good as the book's
+        ResetSearchStats(m_searchStats);
+        out_depthReached = m_openingBook->GetDepth();
+        return bookValue;
+    }
+
+    const Player &playerMe       = GetPlayer(a_player);
+    const Player &playerOpponent = GetOpponent(a_player);
+
+    // the transposition table is the one that passes the principal variation
+    // from an iteration to the next one. A local one is used if the caller
+    // didn't provide any
+    TranspositionTable  localTransTable(0);
+    TranspositionTable* transTable = a_transTable;
+    if (transTable == NULL)
+    {
+        localTransTable.Resize(GAME1V1_ITERATIVE_DEEPENING_TABLE_SIZE_MB);
+        transTable = &localTransTable;
+    }
+
+    // the whole tree is searched at once by the endgame solver. There's no point
+    // on deepening the search progressively, but depth 1 is still searched first
+    // so there's a move to fall back on if the time runs out before it's solved
+    const bool endgame = IsEndgame(a_player);
+    if (endgame)
+    {
+        a_maxDepth = 2;
+    }
+
+    // accesses to the table made by all the iterations but the last one
+    // (MinMax resets the statistics of the table each time it is called)
+    TranspositionTable::Stats_t previousStats;
+    TranspositionTable::ResetStats(previousStats);
+
+    // the watchdog cancels its token when the time runs out, which cancels the
+    // iteration being calculated at that moment. The token is linked to the one
+    // of the caller, so the iteration is also cancelled with it
+    DeadlineWatchdog watchdog(a_cancelToken);
+    if ( (a_timeBudgetMs > 0) && (a_maxDepth > 1) )
+    {
+        if (!watchdog.Start(a_timeBudgetMs))
+        {
+            // deeper iterations couldn't be cancelled when the time runs out.
+            // Only depth 1 will be searched so the budget is not blown
+            a_maxDepth = 1;
+        }
+    }
+
+    // measures how long each iteration takes
+    GTimer* timer = g_timer_new();
+
+    // reset output
+    out_resultPiece  = Piece(e_noPiece);
+    out_coord        = Coordinate();
+    out_depthReached = 0;
+
+    // statistics of all the iterations, the cancelled one included
+    SearchStats_t searchStats;
+    ResetSearchStats(searchStats);
+
+    bool cancelled = false;
+    int32_t rv = -INFINITE;
+
+    // value of the latest completed iteration of even and odd depth (aspiration windows)
+    int32_t iterationValues[2] = {-INFINITE, -INFINITE};
+
+    for (int32_t depth = 1; depth <= a_maxDepth; depth++)
+    {
+        if (depth > 1)
+        {
+            const TranspositionTable::Stats_t &stats = transTable->GetStats();
+            previousStats.hits       += stats.hits;
+            previousStats.misses     += stats.misses;
+            previousStats.collisions += stats.collisions;
+        }
+
+        gdouble iterationStart = g_timer_elapsed(timer, NULL);
+
+        // depth 1 is always completed. Deeper iterations can be cancelled by the watchdog
+        const CancellationToken &iterationToken =
+            ( (depth == 1) || !watchdog.IsStarted() ) ?
+                    a_cancelToken : watchdog.GetToken();
+
+        Piece thisPiece(e_noPiece);
+        Coordinate thisCoord;
+        int32_t thisValue = 0;
+
+        // the principal variation search looks first for a value close to the
+        // one of the previous iteration with the same parity (the value of odd
+        // and even depths is calculated after a move of different players, and
+        // they are usually far apart). The window is only widened if it fails
+        bool fullWindow = !endgame;
+        const int32_t previousValue = iterationValues[depth % 2];
+        if (endgame)
+        {
+            // MinMax would solve the position at any depth
+            if (depth == 1)
+            {
+                thisValue = MinMaxWindow(
+                                a_heuristicMethod,
+                                depth,
+                                a_player,
+                                thisPiece,
+                                thisCoord,
+                                iterationToken,
+                                a_lastOpponentPieceCoord,
+                                a_lastOpponentPiece,
+                                a_nThreads,
+                                transTable,
+                                -INFINITE,
+                                INFINITE);
+            }
+            else
+            {
+                thisValue = MinMaxEndgame(
+                                a_heuristicMethod,
+                                a_player,
+                                thisPiece,
+                                thisCoord,
+                                iterationToken,
+                                transTable);
+            }
+            AddSearchStats(m_searchStats, searchStats);
+        }
+        else if ( (m_searchMode == e_searchModePVS) &&
+                  (depth > 2) &&
+                  (previousValue > (-INFINITE + GAME1V1_ASPIRATION_WINDOW)) &&
+                  (previousValue < (INFINITE - GAME1V1_ASPIRATION_WINDOW)) )
+        {
+            int32_t aspirationAlpha = previousValue - GAME1V1_ASPIRATION_WINDOW;
+            int32_t aspirationBeta  = previousValue + GAME1V1_ASPIRATION_WINDOW;
+
+            thisValue = MinMaxWindow(
+                            a_heuristicMethod,
+                            depth,
+                            a_player,
+                            thisPiece,
+                            thisCoord,
+                            iterationToken,
+                            a_lastOpponentPieceCoord,
+                            a_lastOpponentPiece,
+                            a_nThreads,
+                            transTable,
+                            aspirationAlpha,
+                            aspirationBeta);
+            AddSearchStats(m_searchStats, searchStats);
+
+            fullWindow = !iterationToken.IsCancelled() &&
+                         ( (thisValue <= aspirationAlpha) || (thisValue >= aspirationBeta) );
+            if (fullWindow)
+            {
+                // the value is only a bound. The search is repeated with the full window
+                searchStats.aspirationResearches++;
+
+                const TranspositionTable::Stats_t &stats = transTable->GetStats();
+                previousStats.hits       += stats.hits;
+                previousStats.misses     += stats.misses;
+                previousStats.collisions += stats.collisions;
+            }
+        }
+
+        if (fullWindow)
+        {
+            thisValue = MinMax(
+                            a_heuristicMethod,
+                            depth,
+                            a_player,
+                            thisPiece,
+                            thisCoord,
+                            iterationToken,
+                            a_lastOpponentPieceCoord,
+                            a_lastOpponentPiece,
+                            a_nThreads,
+                            transTable);
+            AddSearchStats(m_searchStats, searchStats);
+        }
+
+        if (a_cancelToken.IsCancelled())
+        {
+            // " (...) output or returned value will have unexpected
+            //   undescribed values "
+            cancelled = true;
+            break;
+        }
+
+        if (iterationToken.IsCancelled())
+        {
+            // the time ran out before this iteration was completed.
+            // Its result is discarded
+            break;
+        }
+
+        rv               = thisValue;
+        iterationValues[depth % 2] = thisValue;
+        out_resultPiece  = thisPiece;
+        out_coord        = thisCoord;
+        out_depthReached = depth;
+
+        if (endgame && (depth > 1))
+        {
+            // solved up to the end of the game
+            out_depthReached = playerMe.NumberOfPiecesAvailable() +
+                               playerOpponent.NumberOfPiecesAvailable();
+            break;
+        }
+
+        if ( (thisPiece.GetType() == e_noPiece) ||
+             (playerMe.NumberOfPiecesAvailable() == e_numberOfPieces) )
+        {
+            // no piece can be put down or it is the first piece (which is
+            // not calculated with a search tree). Deeper searches won't change that
+            break;
+        }
+
+        if ( (depth >= (2 * playerMe.NumberOfPiecesAvailable())) &&
+             (depth >= (2 * playerOpponent.NumberOfPiecesAvailable())) )
+        {
+            // this search already put down all the pieces left
+            break;
+        }
+
+        if (watchdog.IsStarted())
+        {
+            // the next iteration will take longer than this one. There's no point
+            // on starting it if there isn't at least that much time left
+            gdouble elapsed = g_timer_elapsed(timer, NULL);
+            if (((2 * elapsed) - iterationStart) * 1000 >= a_timeBudgetMs)
+            {
+                break;
+            }
+        }
+    } // for (int32_t depth = 1; depth <= a_maxDepth; depth++)
+
+    g_timer_destroy(timer);
+    watchdog.Stop();
+
+    // statistics of the table will include the accesses made by all iterations
+    transTable->AddStats(previousStats);
+    m_searchStats = searchStats;
+
+    if (cancelled)
+    {
+        return 0;
+    }
+
+    return rv;
+}
+
+void Game1v1::ResetSearchStats(SearchStats_t &out_stats)
+{
+    out_stats.nodes = 0;
+    for (int32_t i = 0; i < GAME1V1_SEARCH_STATS_PLIES; i++)
+    {
+        out_stats.nodesPerPly[i]       = 0;
+        out_stats.betaCutoffsPerPly[i] = 0;
+    }
+    out_stats.leafEvaluations   = 0;
+    out_stats.transTableCutoffs = 0;
+    for (int32_t i = 0; i < GAME1V1_SEARCH_STATS_CUTOFF_INDEXES; i++)
+    {
+        out_stats.cutoffMoveIndex[i] = 0;
+    }
+    out_stats.movesGenerated           = 0;
+    out_stats.movesTried               = 0;
+    out_stats.duplicatePiecesSkipped   = 0;
+    out_stats.duplicateNkPointsSkipped = 0;
+    out_stats.nullWindowResearches     = 0;
+    out_stats.aspirationResearches     = 0;
+    out_stats.endgameTerminals         = 0;
+    out_stats.elapsedSeconds           = 0.0;
+}
+
+void Game1v1::AddSearchStats(const SearchStats_t &a_stats, SearchStats_t &in_out_stats)
+{
+    in_out_stats.nodes += a_stats.nodes;
+    for (int32_t i = 0; i < GAME1V1_SEARCH_STATS_PLIES; i++)
+    {
+        in_out_stats.nodesPerPly[i]       += a_stats.nodesPerPly[i];
+        in_out_stats.betaCutoffsPerPly[i] += a_stats.betaCutoffsPerPly[i];
+    }
+    in_out_stats.leafEvaluations   += a_stats.leafEvaluations;
+    in_out_stats.transTableCutoffs += a_stats.transTableCutoffs;
+    for (int32_t i = 0; i < GAME1V1_SEARCH_STATS_CUTOFF_INDEXES; i++)
+    {
+        in_out_stats.cutoffMoveIndex[i] += a_stats.cutoffMoveIndex[i];
+    }
+    in_out_stats.movesGenerated           += a_stats.movesGenerated;
+    in_out_stats.movesTried               += a_stats.movesTried;
+    in_out_stats.duplicatePiecesSkipped   += a_stats.duplicatePiecesSkipped;
+    in_out_stats.duplicateNkPointsSkipped += a_stats.duplicateNkPointsSkipped;
+    in_out_stats.nullWindowResearches     += a_stats.nullWindowResearches;
+    in_out_stats.aspirationResearches     += a_stats.aspirationResearches;
+    in_out_stats.endgameTerminals         += a_stats.endgameTerminals;
+    in_out_stats.elapsedSeconds           += a_stats.elapsedSeconds;
+}
+
+uint64_t Game1v1::NodesPerSecond(const SearchStats_t &a_stats)
+{
+    if (a_stats.elapsedSeconds <= 0.0)
+    {
+        return 0;
+    }
+
+    return static_cast<uint64_t>(a_stats.nodes / a_stats.elapsedSeconds);
+}
+
+void Game1v1::PrintSearchStats(const SearchStats_t &a_stats, std::ostream &a_outStream)
+{
+    // nodes which are not leaves and whose value was not taken from the
+    // transposition table. Moves were generated (and tried out) in them
+    uint64_t innerNodes = a_stats.nodes - a_stats.leafEvaluations - a_stats.transTableCutoffs;
+
+    // i18n TRANSLATORS: These strings describe the search tree explored by the
+    // i18n minimax engine: how many nodes it visited, how many moves it generated
+    // i18n and tried out, and how many branches were pruned (cutoffs)
+    // i18n Thank you for contributing to this project
+    a_outStream << _("Nodes")              << ": " << a_stats.nodes
+                << " (" << NodesPerSecond(a_stats) << " " << _("nodes/s") << ")"
+                << std::endl;
+    a_outStream << _("Leaf evaluations")   << ": " << a_stats.leafEvaluations
+                << ", " << _("transposition table cutoffs") << ": " << a_stats.transTableCutoffs
+                << std::endl;
+    a_outStream << _("Moves generated")    << ": " << a_stats.movesGenerated
+                << ", " << _("tried")      << ": " << a_stats.movesTried;
+    if (innerNodes > 0)
+    {
+        a_outStream << " (" << _("branching factor") << ": "
+                    << std::fixed << std::setprecision(2)
+                    << static_cast<double>(a_stats.movesTried) / innerNodes
+                    << ")";
+        a_outStream.unsetf(std::ios::floatfield);
+    }
+    a_outStream << std::endl;
+    a_outStream << _("Duplicate filter")   << ": "
+                << a_stats.duplicatePiecesSkipped   << " " << _("pieces") << ", "
+                << a_stats.duplicateNkPointsSkipped << " " << _("nucleation points skipped")
+                << std::endl;
+    a_outStream << _("Re-searches")        << ": "
+                << a_stats.nullWindowResearches << " " << _("null window") << ", "
+                << a_stats.aspirationResearches << " " << _("aspiration window")
+                << std::endl;
+    if (a_stats.endgameTerminals > 0)
+    {
+        a_outStream << _("Endgame solved") << ": "
+                    << a_stats.endgameTerminals << " " << _("finished games scored")
+                    << std::endl;
+    }
+
+    a_outStream << std::setw(5)  << _("Ply")
+                << std::setw(14) << _("Nodes")
+                << std::setw(14) << _("Cutoffs")
+                << std::endl;
+    for (int32_t i = 0; i < GAME1V1_SEARCH_STATS_PLIES; i++)
+    {
+        if (a_stats.nodesPerPly[i] == 0)
+        {
+            continue;
+        }
+
+        a_outStream << std::setw(5)  << i
+                    << std::setw(14) << a_stats.nodesPerPly[i]
+                    << std::setw(14) << a_stats.betaCutoffsPerPly[i]
+                    << std::endl;
+    }
+
+    a_outStream << _("Cutoffs per move index") << ":";
+    for (int32_t i = 0; i < GAME1V1_SEARCH_STATS_CUTOFF_INDEXES; i++)
+    {
+        a_outStream << " " << (i + 1);
+        if (i == (GAME1V1_SEARCH_STATS_CUTOFF_INDEXES - 1))
+        {
+            a_outStream << "+";
+        }
+        a_outStream << "=" << a_stats.cutoffMoveIndex[i];
+    }
+    a_outStream << std::endl;
+}
+
+int32_t Game1v1::ComputeFirstPiece(
+        Board            &a_board,
+        Player           &a_playerMe,
+        Player           &a_playerOpponent,
+        const Coordinate &a_lastOpponentPieceCoord,
+        const Piece      &a_lastOpponentPiece,
+        Piece            &out_resultPiece,
+        Coordinate       &out_coord)
+{
+    // try to calculate a 'smart' first move quickly
+    if ( (a_playerMe.NumberOfPiecesAvailable() == e_numberOfPieces) &&
+         (a_lastOpponentPiece.GetType() != e_noPiece) &&
+         (a_lastOpponentPiece.GetNSquares() == 5) &&
+         (a_playerOpponent.NumberOfNucleationPoints() > 5) )
+    {
+        // this is the 1st move. The opponent put down a 5-square piece
+        // creating more than 5 nk points. We'll be cheeky and copy the move
+        out_resultPiece = a_lastOpponentPiece;
+        out_resultPiece.RotateRight();
+        out_resultPiece.RotateRight();
+
+        out_coord.m_row = a_board.GetNRows()    - a_lastOpponentPieceCoord.m_row - 1;
+        out_coord.m_col = a_board.GetNColumns() - a_lastOpponentPieceCoord.m_col - 1;
+    }
+    else
+    {
+        // we shouldn't copy the 1st user's move, because it was shit
+        // Do an acceptable 1st move (quick and dirty solution).
+        // The following piece of code will put the cross in a 'good'
+        // place, for example in 9,8 -if starting coord is (9,9)-
+        // or 5,6 if starting coord is (4,4).
+        // (4,4) and (9,9) are the standard starting coords
+        out_resultPiece = Piece(e_5Piece_Cross);
+        Coordinate startingCoord = a_playerMe.GetStartingCoordinate();
+        if ((a_board.GetNColumns() / 2) > startingCoord.m_col)
+        {
+            out_coord.m_col = startingCoord.m_col + 1;
+        }
+        else if ((a_board.GetNColumns() / 2) < startingCoord.m_col)
+        {
+            out_coord.m_col = startingCoord.m_col - 1;
+        }
+        else
+        {
+            out_coord.m_col = startingCoord.m_col;
+        }
+
+        out_coord.m_row = startingCoord.m_row;
+    }
+
+    // check out now if the move calculated in the previous step is valid
+    if (!rules::IsPieceDeployableInStartingPoint(
+            a_board,
+            out_resultPiece.GetCurrentConfiguration(),
+            out_coord,
+            a_playerMe.GetStartingCoordinate()) )
+    {
+        // move wasn't valid. calculate a new one (if it is possible)
+
+        // new move. Restart variables which save the calculated move
+        out_resultPiece = Piece(e_noPiece);
+        out_coord = Coordinate();
+
+        int32_t heuristicValue = -INFINITE;
+
+        // precalculated configurations of all the pieces
+        const PieceConfTable &confTable = PieceConfTable::Instance();
 
         // will contain the valid coords per nucleation point
         std::vector<Coordinate> validCoords(PIECE_MAX_SQUARES);
@@ -831,28 +2169,29 @@ int32_t Game1v1::ComputeFirstPiece(
                 continue;
             }
 
-            const std::list<PieceConfiguration> &pieceConfList =
-                a_playerMe.m_pieces[i].GetPrecalculatedConfs();
-
-            std::list<PieceConfiguration>::const_iterator pieceConfIt;
-            for (pieceConfIt  = pieceConfList.begin();
-                 pieceConfIt != pieceConfList.end();
-                 pieceConfIt++)
+            for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                         confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                         confIt++)
             {
+                const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
                 int32_t nValidCoords = rules::CalculateValidCoordsInStartingPoint(
                                             a_board,
                                             a_playerMe.GetStartingCoordinate(),
-                                            *pieceConfIt,
+                                            *(pieceConf.pieceConf),
                                             validCoords);
 
                 for (int32_t k = 0 ; k < nValidCoords ; k++)
                 {
+                    UndoRecord_t undoRecord;
                     Game1v1::PutDownPiece(
                             a_board,
                             validCoords[k],
-                            *pieceConfIt,
+                            pieceConf,
                             a_playerMe,
-                            a_playerOpponent);
+                            a_playerOpponent,
+                            undoRecord,
+                            e_influenceAreaNone);
 
                     // taking over the center of the board is pretty important. Use
                     // nk weighted heuristic to try to calculate alternative 1st move
@@ -867,74 +2206,686 @@ int32_t Game1v1::ComputeFirstPiece(
                         {
                             out_resultPiece = a_playerMe.m_pieces[i];
                         }
-                        out_resultPiece.SetCurrentConfiguration(*pieceConfIt);
+                        out_resultPiece.SetCurrentConfiguration(*(pieceConf.pieceConf));
                         out_coord = validCoords[k];
                     }
 
                     Game1v1::RemovePiece(
                             a_board,
                             validCoords[k],
-                            *pieceConfIt,
+                            pieceConf,
+                            undoRecord,
                             a_playerMe,
                             a_playerOpponent);
 
                 } // for (int32_t k = 0 ; k < nValidCoords ; k++)
-            } // for (pieceConfIt = pieceConfList.begin()
+            } // for (int32_t confIt = confTable.GetFirstConf(i)
         } // for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
     } // if (!rules::IsPieceDeployableInStartingPoint(
 
 	return 0;
 }
 
+bool Game1v1::ProbeOpeningBook(
+        Heuristic::EvalFunction_t  a_heuristicMethod,
+        int32_t                    a_depth,
+        eGame1v1Player_t           a_player,
+        Piece                     &out_resultPiece,
+        Coordinate                &out_coord,
+        int32_t                   &out_value) const
+{
+    if (m_openingBook == NULL)
+    {
+        return false;
+    }
+
+    if ( (a_heuristicMethod ==
+            Heuristic::m_heuristicData[Heuristic::e_heuristicRandom].m_evalFunction) ||
+         (a_heuristicMethod !=
+            Heuristic::m_heuristicData[m_openingBook->GetHeuristicType()].m_evalFunction) ||
+         (a_depth != m_openingBook->GetDepth()) )
+    {
+        // the moves of the book are the ones a search with its heuristic and depth
+        // would return. Random searches must not be predictable either
+        return false;
+    }
+
+    const Player &playerMe       = GetPlayer(a_player);
+    const Player &playerOpponent = GetOpponent(a_player);
+    if (playerMe.NumberOfPiecesAvailable() == e_numberOfPieces)
+    {
+        // the 1st piece is calculated by ComputeFirstPiece, which takes into
+        // account the piece put down by the opponent
+        return false;
+    }
+
+    OpeningBook::Entry_t entry;
+    if (!m_openingBook->Lookup(CalculateHashKey(playerMe, playerOpponent), entry))
+    {
+        return false;
+    }
+
+    Coordinate bookCoord;
+    const PieceConf_t* bookMoveConf = Game1v1::GetTranspositionTableMoveConf(
+                                            m_board, playerMe, entry.move, bookCoord);
+    if (bookMoveConf == NULL)
+    {
+        return false;
+    }
+
+    out_resultPiece = playerMe.m_pieces[bookMoveConf->pieceType];
+    out_resultPiece.SetCurrentConfiguration(*(bookMoveConf->pieceConf));
+    out_coord = bookCoord;
+    out_value = entry.value;
+
+    return true;
+}
+
+bool Game1v1::IsEndgame(eGame1v1Player_t a_player) const
+{
+    if (m_endgameThreshold <= 0)
+    {
+        return false;
+    }
+
+    const Player &playerMe       = GetPlayer(a_player);
+    const Player &playerOpponent = GetOpponent(a_player);
+    if ( (playerMe.NumberOfPiecesAvailable() == e_numberOfPieces) ||
+         (playerOpponent.NumberOfPiecesAvailable() == e_numberOfPieces) )
+    {
+        // 1st pieces are calculated by ComputeFirstPiece. They can't be
+        // put down on nucleation points anyway
+        return false;
+    }
+
+    int32_t nMoves = rules::CountValidMoves(m_board, playerMe);
+    if (nMoves >= m_endgameThreshold)
+    {
+        return false;
+    }
+
+    nMoves += rules::CountValidMoves(m_board, playerOpponent);
+    return (nMoves < m_endgameThreshold);
+}
+
+int32_t Game1v1::MinMaxEndgame(
+        Heuristic::EvalFunction_t    a_heuristicMethod,
+        eGame1v1Player_t             a_player,
+        Piece                        &out_resultPiece,
+        Coordinate                   &out_coord,
+        const CancellationToken      &a_cancelToken,
+        TranspositionTable           *a_transTable)
+{
+    Player* playerMe       = NULL;
+    Player* playerOpponent = NULL;
+
+    switch (a_player)
+    {
+    case e_Game1v1Player1:
+    {
+        playerMe       = &m_player1;
+        playerOpponent = &m_player2;
+        break;
+    }
+    case e_Game1v1Player2:
+    {
+        playerMe       = &m_player2;
+        playerOpponent = &m_player1;
+        break;
+    }
+#ifdef DEBUG
+    default:
+        assert(0);
+#endif
+    } // switch (a_player)
+
+    ResetSearchStats(m_searchStats);
+    GTimer* timer = g_timer_new();
+
+    if (a_transTable != NULL)
+    {
+        // same identifier as the one of the searches that use the evaluation function.
+        // Solved positions are saved with different keys, so entries of both kinds
+        // can be kept in the table
+        a_transTable->NewSearch(
+            static_cast<uint64_t>(reinterpret_cast<uintptr_t>(a_heuristicMethod)));
+    }
+
+    // accesses to the transposition table made by this search
+    TranspositionTable::Stats_t transTableStats;
+    TranspositionTable::ResetStats(transTableStats);
+
+    // every ply which generates moves puts down a piece, so there can't be
+    // more lists of moves than pieces are left
+    int32_t nPiecesLeft = playerMe->NumberOfPiecesAvailable() +
+                          playerOpponent->NumberOfPiecesAvailable();
+    MoveOrdering moveOrdering(
+            (nPiecesLeft > 0) ? nPiecesLeft : 1,
+            m_board.GetNRows() * m_board.GetNColumns(),
+            m_moveOrdering);
+
+    CancellationCheckpoint checkpoint(a_cancelToken);
+
+    // reset output
+    out_resultPiece = Piece(e_noPiece);
+    out_coord = Coordinate();
+
+    PackedMove_t bestMove;
+    int32_t rv = Game1v1::EndgameAlphaBetaCompute(
+                    m_board,
+                    *playerMe,
+                    *playerOpponent,
+                    false,
+                    0,
+                    -INFINITE,
+                    INFINITE,
+                    a_transTable,
+                    transTableStats,
+                    checkpoint,
+                    moveOrdering,
+                    m_searchStats,
+                    bestMove);
+
+    if (!checkpoint.IsCancelled())
+    {
+        // the move might come from the transposition table. It is checked as
+        // any other move read from it before being returned
+        Coordinate bestCoord;
+        const PieceConf_t* bestConf = Game1v1::GetTranspositionTableMoveConf(
+                                            m_board, *playerMe, bestMove, bestCoord);
+        if (bestConf != NULL)
+        {
+            out_resultPiece = playerMe->m_pieces[bestConf->pieceType];
+            out_resultPiece.SetCurrentConfiguration(*(bestConf->pieceConf));
+            out_coord = bestCoord;
+        }
+    }
+
+    if (a_transTable != NULL)
+    {
+        a_transTable->AddStats(transTableStats);
+    }
+
+    m_searchStats.elapsedSeconds = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+    return rv;
+}
+
+int32_t Game1v1::EndgameAlphaBetaCompute(
+        Board                       &a_board,
+        Player                      &a_playerMe,
+        Player                      &a_playerOpponent,
+        bool                         a_opponentPassed,
+        int32_t                      a_nPiecesPutDown,
+        int32_t                      alpha,
+        int32_t                      beta,
+        TranspositionTable          *a_transTable,
+        TranspositionTable::Stats_t &a_transTableStats,
+        CancellationCheckpoint      &in_out_checkpoint,
+        MoveOrdering                &in_out_moveOrdering,
+        SearchStats_t               &in_out_searchStats,
+        PackedMove_t                &out_bestMove)
+{
+#ifdef DEBUG
+    assert(a_nPiecesPutDown < GAME1V1_SEARCH_STATS_PLIES);
+#endif
+
+    // the ply of the lists of moves. Passes don't put down any piece
+    const int32_t ply = a_nPiecesPutDown;
+
+    out_bestMove = packedmove::NoMove();
+
+    in_out_searchStats.nodes++;
+    in_out_searchStats.nodesPerPly[ply]++;
+
+    if (in_out_checkpoint.Poll())
+    {
+        // the search was cancelled. The value returned here will be discarded
+        // by the caller anyway
+        return 0;
+    }
+
+    // alpha as it was received. Needed to know what kind of value is
+    // saved into the transposition table
+    const int32_t originalAlpha = alpha;
+
+    // zobrist key of the current position (different to the one used by searches
+    // which call the evaluation function)
+    uint64_t hashKey = 0;
+
+    TranspositionTable::Entry_t ttEntry;
+    ttEntry.move = packedmove::NoMove();
+
+    if (a_transTable != NULL)
+    {
+        hashKey = Game1v1::CalculateHashKey(a_playerMe, a_playerOpponent) ^
+                  zobrist::EndgameKey();
+
+        if (a_transTable->Probe(hashKey, ttEntry, a_transTableStats))
+        {
+            // every value saved with this key was calculated up to the end of
+            // the game, whatever the depth saved with it is
+            if ( (ttEntry.bound == TranspositionTable::e_boundExact) ||
+                 ( (ttEntry.bound == TranspositionTable::e_boundLower) &&
+                   (ttEntry.value >= beta) ) ||
+                 ( (ttEntry.bound == TranspositionTable::e_boundUpper) &&
+                   (ttEntry.value <= alpha) ) )
+            {
+                in_out_searchStats.transTableCutoffs++;
+                out_bestMove = ttEntry.move;
+
+                if (ttEntry.value <= alpha)
+                {
+                    return alpha;
+                }
+                else if (ttEntry.value >= beta)
+                {
+                    return beta;
+                }
+                return ttEntry.value;
+            }
+        }
+        else
+        {
+            ttEntry.move = packedmove::NoMove();
+        }
+    }
+
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    // the best move saved in the transposition table is tried out first
+    Coordinate ttCoord;
+    const PieceConf_t* ttMoveConf =
+        Game1v1::GetTranspositionTableMoveConf(a_board, a_playerMe, ttEntry.move, ttCoord);
+
+    // every valid move of this node (but the one of the transposition table)
+    int32_t nMoves = 0;
+    if (a_playerMe.NumberOfPiecesAvailable() > 0)
+    {
+        const Bitboard &nkPointsMe = a_playerMe.GetNucleationPointsPlane();
+        Bitboard validCoords;
+
+        in_out_moveOrdering.ClearMoves(ply);
+        for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+        {
+            if (a_playerMe.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false)
+            {
+                continue;
+            }
+
+            for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                         confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                         confIt++)
+            {
+                const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+                rules::CalculateValidCoordsInBoard(
+                    a_board,
+                    a_playerMe,
+                    pieceConf,
+                    nkPointsMe,
+                    validCoords);
+                in_out_searchStats.movesGenerated += validCoords.PopCount();
+
+                int32_t ring;
+                for (int32_t index = a_board.GetFirstIndexSpiral(validCoords, ring);
+                     index >= 0;
+                     index = a_board.GetNextIndexSpiral(validCoords, ring, index))
+                {
+                    PackedMove_t thisMove = packedmove::Pack(
+                            static_cast<ePieceType_t>(i), pieceConf.confIndex, index);
+
+                    if ( (ttMoveConf != NULL) && (thisMove == ttEntry.move) )
+                    {
+                        continue;
+                    }
+
+                    in_out_moveOrdering.AddMove(ply, thisMove);
+                }
+            } // for (int32_t confIt = confTable.GetFirstConf(i)
+        } // for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+
+        in_out_moveOrdering.SortMoves(ply);
+        nMoves = in_out_moveOrdering.GetNMoves(ply);
+    }
+
+    // killer moves and history are weighted by the pieces left, which is
+    // the maximum depth of the subtree below this node
+    const int32_t depthLeft = a_playerMe.NumberOfPiecesAvailable() +
+                              a_playerOpponent.NumberOfPiecesAvailable();
+
+    int32_t nBranchesSearchTree = 0;
+    PackedMove_t bestMove = packedmove::NoMove();
+    PackedMove_t childBestMove;
+
+    // index -1 is the move of the transposition table
+    for (int32_t moveIt = (ttMoveConf != NULL) ? -1 : 0; moveIt < nMoves; moveIt++)
+    {
+        PackedMove_t thisMove;
+        const PieceConf_t* pieceConf;
+        Coordinate thisCoord;
+        if (moveIt < 0)
+        {
+            thisMove  = ttEntry.move;
+            pieceConf = ttMoveConf;
+            thisCoord = ttCoord;
+        }
+        else
+        {
+            thisMove  = in_out_moveOrdering.GetMove(ply, moveIt);
+            pieceConf = &(packedmove::GetConf(thisMove, confTable));
+            packedmove::ToCoordinate(thisMove, a_board.GetNColumns(), thisCoord);
+        }
+
+        a_playerMe.UnsetPiece(pieceConf->pieceType);
+
+        UndoRecord_t undoRecord;
+        Game1v1::PutDownPiece(
+                a_board,
+                thisCoord,
+                *pieceConf,
+                a_playerMe,
+                a_playerOpponent,
+                undoRecord,
+                e_influenceAreaNone);
+
+        nBranchesSearchTree++;
+        in_out_searchStats.movesTried++;
+
+        int32_t value = -Game1v1::EndgameAlphaBetaCompute(
+                            a_board,
+                            a_playerOpponent,
+                            a_playerMe,
+                            false,
+                            a_nPiecesPutDown + 1,
+                            -beta,
+                            -alpha,
+                            a_transTable,
+                            a_transTableStats,
+                            in_out_checkpoint,
+                            in_out_moveOrdering,
+                            in_out_searchStats,
+                            childBestMove);
+
+        Game1v1::RemovePiece(
+                a_board,
+                thisCoord,
+                *pieceConf,
+                undoRecord,
+                a_playerMe,
+                a_playerOpponent);
+
+        a_playerMe.SetPiece(pieceConf->pieceType);
+
+        if (in_out_checkpoint.IsCancelled())
+        {
+            // " (...) output or returned value will have unexpected
+            //   undescribed values "
+            return 0;
+        }
+
+        if (value > alpha)
+        {
+            alpha    = value;
+            bestMove = thisMove;
+        }
+
+        if (beta <= alpha)
+        {
+            // this branch can be safely be pruned
+            in_out_searchStats.betaCutoffsPerPly[ply]++;
+            if (nBranchesSearchTree < GAME1V1_SEARCH_STATS_CUTOFF_INDEXES)
+            {
+                in_out_searchStats.cutoffMoveIndex[nBranchesSearchTree - 1]++;
+            }
+            else
+            {
+                in_out_searchStats.cutoffMoveIndex[GAME1V1_SEARCH_STATS_CUTOFF_INDEXES - 1]++;
+            }
+
+            in_out_moveOrdering.SaveCutoff(ply, thisMove, depthLeft);
+            break;
+        }
+    } // for (int32_t moveIt = ...; moveIt < nMoves; moveIt++)
+
+    if (nBranchesSearchTree == 0)
+    {
+        if (a_opponentPassed)
+        {
+            // neither player can put down a piece. The game is over
+            in_out_searchStats.endgameTerminals++;
+            return CalculateSquaresLeft(a_playerOpponent) - CalculateSquaresLeft(a_playerMe);
+        }
+
+        // this player passes. The opponent keeps on putting down pieces
+        int32_t value = -Game1v1::EndgameAlphaBetaCompute(
+                            a_board,
+                            a_playerOpponent,
+                            a_playerMe,
+                            true,
+                            a_nPiecesPutDown,
+                            -beta,
+                            -alpha,
+                            a_transTable,
+                            a_transTableStats,
+                            in_out_checkpoint,
+                            in_out_moveOrdering,
+                            in_out_searchStats,
+                            childBestMove);
+
+        if (in_out_checkpoint.IsCancelled())
+        {
+            return 0;
+        }
+
+        if (value > alpha)
+        {
+            alpha = value;
+        }
+    }
+
+    if (a_transTable != NULL)
+    {
+        TranspositionTable::eBound_t bound = TranspositionTable::e_boundExact;
+        if (alpha >= beta)
+        {
+            bound = TranspositionTable::e_boundLower;
+        }
+        else if (alpha <= originalAlpha)
+        {
+            bound = TranspositionTable::e_boundUpper;
+        }
+
+        a_transTable->Store(
+                hashKey,
+                GAME1V1_ENDGAME_TABLE_DEPTH,
+                alpha,
+                bound,
+                bestMove);
+    }
+
+    out_bestMove = bestMove;
+    return alpha;
+}
+
+int32_t Game1v1::CalculateSquaresLeft(const Player &a_player)
+{
+    int32_t squaresLeft = 0;
+    for (int8_t i = e_minimumPieceIndex ; i < e_numberOfPieces; i++)
+    {
+        if (a_player.IsPieceAvailable(static_cast<ePieceType_t>(i)))
+        {
+            squaresLeft += a_player.m_pieces[i].GetNSquares();
+        }
+    }
+
+    return squaresLeft;
+}
+
+const PieceConf_t* Game1v1::GetTranspositionTableMoveConf(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        PackedMove_t  a_move,
+        Coordinate   &out_coord)
+{
+    ePieceType_t pieceType = packedmove::GetPieceType(a_move);
+    if ( (pieceType >= e_numberOfPieces) ||
+         (a_playerMe.IsPieceAvailable(pieceType) == false) )
+    {
+        return NULL;
+    }
+
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    if (packedmove::GetConfIndex(a_move) >= confTable.GetNConfs(pieceType))
+    {
+        return NULL;
+    }
+
+    if (packedmove::GetSquareIndex(a_move) >= (a_board.GetNRows() * a_board.GetNColumns()))
+    {
+        return NULL;
+    }
+
+    const PieceConf_t &pieceConf = packedmove::GetConf(a_move, confTable);
+    packedmove::ToCoordinate(a_move, a_board.GetNColumns(), out_coord);
+
+    // the zobrist key could have collided with some other position's.
+    // The move must be checked before being put down
+    if (rules::IsPieceDeployableCompute(
+                a_board,
+                *(pieceConf.pieceConf),
+                out_coord,
+                a_playerMe))
+    {
+        return &pieceConf;
+    }
+
+    return NULL;
+}
+
+template<class EVALUATOR>
 int32_t Game1v1::MinMaxAlphaBetaCompute(
         Board                       &a_board,
         Player                      &a_playerMe,
-        Game1v1CoordinateSet_t*      a_oldNkPointsMe[e_numberOfPieces],
+        const Bitboard*              a_oldNkPointsMe[e_numberOfPieces],
         ePieceType_t                 a_lastPiecesMe[e_numberOfPieces],
         Player                      &a_playerOpponent,
-        Game1v1CoordinateSet_t*      a_oldNkPointsOpponent[e_numberOfPieces],
+        const Bitboard*              a_oldNkPointsOpponent[e_numberOfPieces],
         ePieceType_t                 a_lastPiecesOpponent[e_numberOfPieces],
         Heuristic::EvalFunction_t    a_heuristicMethod,
         int32_t                      originalDepth,
         int32_t                      depth,
         int32_t                      alpha,
         int32_t                      beta,
-        const volatile sig_atomic_t &stopProcessingFlag
-#ifdef DEBUG_PRINT
-        ,int32_t                      &times
-#endif
-        )
+        TranspositionTable          *a_transTable,
+        TranspositionTable::Stats_t &a_transTableStats,
+        CancellationCheckpoint      &in_out_checkpoint,
+        eSearchMode_t                a_searchMode,
+        MoveOrdering                &in_out_moveOrdering,
+        SearchStats_t               &in_out_searchStats,
+        bool                        &out_subtreeFiltered)
 {
-#ifdef DEBUG_PRINT
-    times++;
-#endif
+    // ply of this node. The root of the search tree is ply 0
+    const int32_t ply = originalDepth - depth;
+
+    // values saved into the transposition table never depend on the path
+    // taken to reach a position (see below), so a cutoff doesn't either
+    out_subtreeFiltered = false;
+
+    in_out_searchStats.nodes++;
+    in_out_searchStats.nodesPerPly[ply]++;
+
+    if (in_out_checkpoint.Poll())
+    {
+        // the search was cancelled. The value returned here will be discarded
+        // by the caller anyway
+        return 0;
+    }
 
     if ( (depth <= 0) || (a_playerMe.NumberOfPiecesAvailable() == 0) )
     {
+        in_out_searchStats.leafEvaluations++;
+
         // If the heuristic is to be calculated, it should be done using the opponent as 'me'
         // (and me as the 'opponent') for the call to Calculate
         // Why is this? This is because when this call was made 'me' and 'opponent' were
         // interchanged for the next iteration in the MiniMax algorithm, but we want
         // to calculate the heuristic based on the latest player to put a piece, that is
         // the 'opponent' in this call, 'me' in the previous node of the minimax tree
-        return -a_heuristicMethod(a_board, a_playerOpponent, a_playerMe);
+        return -EVALUATOR::Evaluate(a_heuristicMethod, a_board, a_playerOpponent, a_playerMe);
+    }
+
+    // alpha as it was received. Needed to know what kind of value is
+    // saved into the transposition table
+    const int32_t originalAlpha = alpha;
+
+    // true if a node below this one skipped some nucleation points (see
+    // nkPointsFiltered). childFiltered is set by each call for a child node
+    bool descendantsFiltered = false;
+    bool childFiltered = false;
+
+    // zobrist key of the current position
+    uint64_t hashKey = 0;
+
+    // entry of the current position in the transposition table. Its best move
+    // (if any) will be tried out before the rest
+    TranspositionTable::Entry_t ttEntry;
+    ttEntry.move = packedmove::NoMove();
+
+    if (a_transTable != NULL)
+    {
+        hashKey = Game1v1::CalculateHashKey(a_playerMe, a_playerOpponent);
+
+        if (a_transTable->Probe(hashKey, ttEntry, a_transTableStats))
+        {
+            if (ttEntry.depth >= depth)
+            {
+                // this position was already searched at least as deep as it
+                // would be now. The value saved might be enough to return
+                if ( (ttEntry.bound == TranspositionTable::e_boundExact) ||
+                     ( (ttEntry.bound == TranspositionTable::e_boundLower) &&
+                       (ttEntry.value >= beta) ) ||
+                     ( (ttEntry.bound == TranspositionTable::e_boundUpper) &&
+                       (ttEntry.value <= alpha) ) )
+                {
+                    in_out_searchStats.transTableCutoffs++;
+
+                    // values returned by this function are always inside
+                    // the alpha-beta window
+                    if (ttEntry.value <= alpha)
+                    {
+                        return alpha;
+                    }
+                    else if (ttEntry.value >= beta)
+                    {
+                        return beta;
+                    }
+                    return ttEntry.value;
+                }
+            }
+        }
+        else
+        {
+            ttEntry.move = packedmove::NoMove();
+        }
     }
-    // this set will be used not to place the same piece in the same place more than once
-    // it will be reset every time the piece is rotated/mirrored or the piece is changed
-    Game1v1CoordinateSet_t testedCoords;
-    // will contain the valid coords per nucleation point
-    std::vector<Coordinate> validCoords(PIECE_MAX_SQUARES);
 
-    // this set will save the current nucleation points. It will be used in future calls not to
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    // will contain the valid coords of each piece configuration
+    Bitboard validCoords;
+
+    // this plane will save the current nucleation points. It will be used in future calls not to
     // check configurations more than once
-    Game1v1CoordinateSet_t nkPointSetMe;
-    Game1v1::GetAllNucleationPoints(a_playerMe, nkPointSetMe);
-    //a_playerMe.GetAllNucleationPoints(nkPointSetMe);
+    Bitboard nkPointsMe = a_playerMe.GetNucleationPointsPlane();
 
-    // save a pointer to this set in the place (index) reserved for it
+    // save a pointer to this plane in the place (index) reserved for it
     // (originalDepth / 2) - (depth / 2) represents this level of relative depth
     // to the pieces put by 'me'
-    a_oldNkPointsMe[(originalDepth / 2) - (depth / 2)] = &nkPointSetMe;
+    a_oldNkPointsMe[(originalDepth / 2) - (depth / 2)] = &nkPointsMe;
 
     // reset the value of last pieces deployed in this level (they might have been set by
     // previous iterations of this very same function)
@@ -945,162 +2896,383 @@ int32_t Game1v1::MinMaxAlphaBetaCompute(
     // which means the search tree was broken.
     int32_t nBranchesSearchTree = 0;
 
+    // best move found so far (the one that raised alpha)
+    PackedMove_t bestMove = packedmove::NoMove();
+
+    // influence areas are only kept up to date if the heuristic reads them
+    const eInfluenceAreaUpdate_t influenceAreaUpdate = SelectInfluenceAreaUpdate(a_heuristicMethod);
+
+    // configuration of the best move saved in the transposition table (and the
+    // coord where it is put down). NULL if there's no move saved or it can't be put down
+    Coordinate ttCoord;
+    const PieceConf_t* ttMoveConf =
+        Game1v1::GetTranspositionTableMoveConf(a_board, a_playerMe, ttEntry.move, ttCoord);
+
+    if (ttMoveConf != NULL)
+    {
+        // try out the best move saved in the transposition table before any other.
+        // It will probably be the best one again, and the rest of moves will be
+        // pruned sooner
+        a_playerMe.UnsetPiece(ttMoveConf->pieceType);
+
+        UndoRecord_t undoRecord;
+        Game1v1::PutDownPiece(
+                a_board,
+                ttCoord,
+                *ttMoveConf,
+                a_playerMe,
+                a_playerOpponent,
+                undoRecord,
+                influenceAreaUpdate);
+
+        a_lastPiecesMe[(originalDepth / 2) - (depth / 2)] = ttMoveConf->pieceType;
+
+        nBranchesSearchTree++;
+        in_out_searchStats.movesTried++;
+
+        int32_t maxValue = -Game1v1::MinMaxAlphaBetaCompute<EVALUATOR>(
+                                a_board,
+                                a_playerOpponent,
+                                a_oldNkPointsOpponent,
+                                a_lastPiecesOpponent,
+                                a_playerMe,
+                                a_oldNkPointsMe,
+                                a_lastPiecesMe,
+                                a_heuristicMethod,
+                                originalDepth,
+                                depth - 1,
+                                -beta,
+                                -alpha,
+                                a_transTable,
+                                a_transTableStats,
+                                in_out_checkpoint,
+                                a_searchMode,
+                                in_out_moveOrdering,
+                                in_out_searchStats,
+                                childFiltered);
+
+        if (childFiltered)
+        {
+            descendantsFiltered = true;
+            out_subtreeFiltered = true;
+        }
+
+        if (maxValue > alpha)
+        {
+            alpha    = maxValue;
+            bestMove = ttEntry.move;
+        }
+
+        Game1v1::RemovePiece(
+                a_board,
+                ttCoord,
+                *ttMoveConf,
+                undoRecord,
+                a_playerMe,
+                a_playerOpponent);
+
+        a_playerMe.SetPiece(ttMoveConf->pieceType);
+
+        if (in_out_checkpoint.IsCancelled())
+        {
+            // " (...) output or returned value will have unexpected
+            //   undescribed values "
+            return 0;
+        }
+
+        if (beta <= alpha)
+        {
+            // this branch can be safely be pruned
+            in_out_searchStats.betaCutoffsPerPly[ply]++;
+            in_out_searchStats.cutoffMoveIndex[0]++;
+            in_out_moveOrdering.SaveCutoff(ply, ttEntry.move, depth);
+
+            if (a_transTable != NULL)
+            {
+                // alpha is only a lower bound of the value of this position.
+                // Not even that if it was calculated by a filtered subtree
+                a_transTable->Store(
+                        hashKey,
+                        depth,
+                        descendantsFiltered ? -INFINITE : alpha,
+                        TranspositionTable::e_boundLower,
+                        bestMove);
+            }
+
+            return alpha;
+        }
+    }
+
+    // every move of this node is saved into the list of this ply before any of them
+    // is tried out, so they can be sorted. The best move saved in the transposition
+    // table was already tried out, so it is not added
+    in_out_moveOrdering.ClearMoves(ply);
+
+    // true if some nucleation points were skipped because a previous level of the
+    // search tree already tried them out. The value of this node depends then on the
+    // path taken to reach it: it is only a lower bound of the value of the position
+    bool nkPointsFiltered = false;
+
 	for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
 	{
         if ( (a_playerMe.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false) ||
              ( (a_playerMe.m_pieces[i].GetNSquares() < 5) &&
                (a_playerMe.NumberOfPiecesAvailable() > (e_numberOfPieces - MIN_5SQUARE_PIECES_AT_START)) &&
-               (nBranchesSearchTree > 0) ) )
+               ((nBranchesSearchTree + in_out_moveOrdering.GetNMoves(ply)) > 0) ) )
         {
             // piece is not available OR it should be ignored
-            // if at least one 5-square piece has been put down before this non 5-square piece
+            // if at least one 5-square piece can be put down before this non 5-square piece
             // do not try to put down the piece
             continue;
         }
 
-        a_playerMe.UnsetPiece(static_cast<ePieceType_t>(i));
+        // before putting down the piece test if the future configuration
+        // could be tested by some other level in the backtrack tree
+        // using originalDepth/2 and depth/2 because there are 2 arrays, one
+        // for pieces set by 'me' and one for pieces set by the opponent
+        // -1 is used because (originalDepth / 2) - (depth / 2) represents
+        // the current level
+        // if the current piece's index is bigger than the old piece deployed on
+        // the board, put down the piece only touching nucleation points which don't
+        // belong to the old nucleation point's set
+        // both old piece and old nk points set correspond to this particular
+        // level of the backtrack tree
+        Bitboard mustTouchPlane = nkPointsMe;
+        bool mustTouchPlaneFiltered = false;
+        for (int32_t thisLevel = (originalDepth / 2) - (depth / 2) - 1;
+             thisLevel >= 0;
+             thisLevel--)
+        {
+            if (i >= a_lastPiecesMe[thisLevel])
+            {
+                mustTouchPlane &= ~(*a_oldNkPointsMe[thisLevel]);
+                mustTouchPlaneFiltered = true;
+            }
+        }
 
-        const std::list<PieceConfiguration> &pieceConfList =
-            a_playerMe.m_pieces[i].GetPrecalculatedConfs();
+        if (mustTouchPlaneFiltered)
+        {
+            int32_t nSkipped = nkPointsMe.PopCount() - mustTouchPlane.PopCount();
+            in_out_searchStats.duplicateNkPointsSkipped += nSkipped;
+            if (nSkipped > 0)
+            {
+                nkPointsFiltered    = true;
+                out_subtreeFiltered = true;
+            }
+        }
 
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        if (mustTouchPlane.IsEmpty())
         {
-            bool nkExists;
-            Coordinate thisNkPoint;
-            Player::SpiralIterator nkIterator;
+            // every nucleation point was already tried out by a previous level
+            in_out_searchStats.duplicatePiecesSkipped++;
+            continue;
+        }
 
-            nkExists = a_playerMe.GetFirstNucleationPointSpiral(nkIterator, thisNkPoint);
-            while(nkExists)
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            // retrieve all the valid coords of this piece configuration at once
+            rules::CalculateValidCoordsInBoard(
+                a_board,
+                a_playerMe,
+                pieceConf,
+                mustTouchPlane,
+                validCoords);
+            in_out_searchStats.movesGenerated += validCoords.PopCount();
+
+            // from the middle of the board to the edges. It is the order moves
+            // with the same score are tried out
+            int32_t ring;
+            for (int32_t index = a_board.GetFirstIndexSpiral(validCoords, ring);
+                 index >= 0;
+                 index = a_board.GetNextIndexSpiral(validCoords, ring, index))
             {
-                // before putting down the piece test if the future configuration
-                // could be tested by some other level in the backtrack tree
-                // using originalDepth/2 and depth/2 because there are 2 arrays, one
-                // for pieces set by 'me' and one for pieces set by the opponent
-                // -1 is used because (originalDepth / 2) - (depth / 2) represents
-                // the current level
-                int32_t thisLevel;
-                for (thisLevel = (originalDepth / 2) - (depth / 2) - 1;
-                     thisLevel >= 0;
-                     thisLevel--)
-                {
-                    // if the current piece's index is bigger than the old piece deployed on
-                    // the board, put down the piece only if this nucleation doesn't belong to the
-                    // old nucleation point's set
-                    // both old piece and old nk points set correspond to this particular
-                    // level of the backtrack tree
-                    if (i >= a_lastPiecesMe[thisLevel])
-                    {
-                        if (a_oldNkPointsMe[thisLevel]->isPresent(thisNkPoint))
-                        {
-                            nkExists = a_playerMe.GetNextNucleationPointSpiral(nkIterator, thisNkPoint);
-                            break;
-                        }
-                    }
-                } // for (thisLevel = (originalDepth / 2) - (depth / 2) - 1;
+                PackedMove_t thisMove = packedmove::Pack(
+                        static_cast<ePieceType_t>(i), pieceConf.confIndex, index);
 
-                if (thisLevel >= 0)
+                if ( (ttMoveConf != NULL) && (thisMove == ttEntry.move) )
                 {
-                    // the previous loop called break before the end
+                    // this move was already tried out before the loop
                     continue;
                 }
 
-                // retrieve the valid coords of this piece in the current nk point
-                int32_t nValidCoords = rules::CalculateValidCoordsInNucleationPoint(
-                                            a_board,
-                                            a_playerMe,
-                                            thisNkPoint,
-                                            *pieceConfIt,
-                                            validCoords);
+                in_out_moveOrdering.AddMove(ply, thisMove);
+            } // for (int32_t index = ...GetFirstIndexSpiral(validCoords, ring);
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
+	} // for (int i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
 
-                for (int32_t k = 0 ; k < nValidCoords ; k++)
-                {
-                    if (!testedCoords.isPresent(validCoords[k]))
-                    {
-                        testedCoords.insert(validCoords[k]);
+    // killer moves first, then the rest of them by history
+    in_out_moveOrdering.SortMoves(ply);
 
-                        Game1v1::PutDownPiece(
-                                a_board,
-                                validCoords[k],
-                                *pieceConfIt,
-                                a_playerMe,
-                                a_playerOpponent);
-
-                        // save a pointer to this piece in the place (index) reserved for it
-                        a_lastPiecesMe[(originalDepth / 2) - (depth / 2)] = a_playerMe.m_pieces[i].GetType();
-
-                        // number of branches searched at this level of the tree
-                        nBranchesSearchTree++;
-
-                        int32_t maxValue = -Game1v1::MinMaxAlphaBetaCompute(
-                                                a_board,
-                                                a_playerOpponent,
-                                                a_oldNkPointsOpponent,
-                                                a_lastPiecesOpponent,
-                                                a_playerMe,
-                                                a_oldNkPointsMe,
-                                                a_lastPiecesMe,
-                                                a_heuristicMethod,
-                                                originalDepth,
-                                                depth - 1,
-                                                -beta,
-                                                -alpha,
-                                                stopProcessingFlag
-#ifdef DEBUG_PRINT
-                                                ,times
-#endif
-                                                );
+    for (int32_t moveIt = 0; moveIt < in_out_moveOrdering.GetNMoves(ply); moveIt++)
+    {
+        PackedMove_t thisMove = in_out_moveOrdering.GetMove(ply, moveIt);
+        const PieceConf_t &pieceConf = packedmove::GetConf(thisMove, confTable);
 
-                        if (maxValue > alpha)
-                        {
-                            alpha = maxValue;
-                        }
+        Coordinate thisCoord;
+        packedmove::ToCoordinate(thisMove, a_board.GetNColumns(), thisCoord);
 
-                        Game1v1::RemovePiece(
-                                a_board,
-                                validCoords[k],
-                                *pieceConfIt,
-                                a_playerMe,
-                                a_playerOpponent);
+        a_playerMe.UnsetPiece(pieceConf.pieceType);
 
-                        if (stopProcessingFlag)
-                        {
-                            // something happened and we were told to stop
-                            // processing (that is probably why MinMaxAlphaBetaCompute
-                            // returned. This function just returns as it is described on
-                            // the description of the function:
-                            // " (...) output or returned value will have unexpected
-                            //   undescribed values "
-                            return 0;
-                        }
+        UndoRecord_t undoRecord;
+        Game1v1::PutDownPiece(
+                a_board,
+                thisCoord,
+                pieceConf,
+                a_playerMe,
+                a_playerOpponent,
+                undoRecord,
+                influenceAreaUpdate);
 
-                        if (beta <= alpha)
-                        {
-                            // this branch can be safely be pruned
-                            // set the piece again to available and reset it
-                            a_playerMe.SetPiece(static_cast<ePieceType_t>(i));
-                            return alpha;
-                        }
-                    } // if (it == testedCoords.end())
-                } // for (int32_t k = 0 ; k < nValidCoords ; k++)
+        // save a pointer to this piece in the place (index) reserved for it
+        a_lastPiecesMe[(originalDepth / 2) - (depth / 2)] = pieceConf.pieceType;
 
-                nkExists = a_playerMe.GetNextNucleationPointSpiral(nkIterator, thisNkPoint);
-            } // while(nkExists)
+        // number of branches searched at this level of the tree
+        nBranchesSearchTree++;
+        in_out_searchStats.movesTried++;
 
-            testedCoords.clear();
-        } // for (pieceConfIt = pieceConfList.begin()
+        // the full window is used if this move needs its exact value
+        bool fullWindow = true;
+        int32_t maxValue;
 
-        a_playerMe.SetPiece(static_cast<ePieceType_t>(i));
-	} // for (int i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+        if ( (a_searchMode == e_searchModePVS) && (nBranchesSearchTree > 1) )
+        {
+            // prove this move is not better than the best one so far
+            // with a null window. It is much cheaper than the full one
+            maxValue = -Game1v1::MinMaxAlphaBetaCompute<EVALUATOR>(
+                            a_board,
+                            a_playerOpponent,
+                            a_oldNkPointsOpponent,
+                            a_lastPiecesOpponent,
+                            a_playerMe,
+                            a_oldNkPointsMe,
+                            a_lastPiecesMe,
+                            a_heuristicMethod,
+                            originalDepth,
+                            depth - 1,
+                            -alpha - 1,
+                            -alpha,
+                            a_transTable,
+                            a_transTableStats,
+                            in_out_checkpoint,
+                            a_searchMode,
+                            in_out_moveOrdering,
+                            in_out_searchStats,
+                            childFiltered);
+
+            if (childFiltered)
+            {
+                descendantsFiltered = true;
+                out_subtreeFiltered = true;
+            }
+
+            // the value of a leaf is always exact
+            fullWindow = (maxValue > alpha) && (maxValue < beta) && (depth > 1) &&
+                         !in_out_checkpoint.IsCancelled();
+            if (fullWindow)
+            {
+                in_out_searchStats.nullWindowResearches++;
+            }
+        }
+
+        if (fullWindow)
+        {
+            maxValue = -Game1v1::MinMaxAlphaBetaCompute<EVALUATOR>(
+                            a_board,
+                            a_playerOpponent,
+                            a_oldNkPointsOpponent,
+                            a_lastPiecesOpponent,
+                            a_playerMe,
+                            a_oldNkPointsMe,
+                            a_lastPiecesMe,
+                            a_heuristicMethod,
+                            originalDepth,
+                            depth - 1,
+                            -beta,
+                            -alpha,
+                            a_transTable,
+                            a_transTableStats,
+                            in_out_checkpoint,
+                            a_searchMode,
+                            in_out_moveOrdering,
+                            in_out_searchStats,
+                            childFiltered);
+
+            if (childFiltered)
+            {
+                descendantsFiltered = true;
+                out_subtreeFiltered = true;
+            }
+        }
+
+        if (maxValue > alpha)
+        {
+            alpha    = maxValue;
+            bestMove = thisMove;
+        }
+
+        Game1v1::RemovePiece(
+                a_board,
+                thisCoord,
+                pieceConf,
+                undoRecord,
+                a_playerMe,
+                a_playerOpponent);
+
+        a_playerMe.SetPiece(pieceConf.pieceType);
+
+        if (in_out_checkpoint.IsCancelled())
+        {
+            // something happened and we were told to stop
+            // processing (that is probably why MinMaxAlphaBetaCompute
+            // returned. This function just returns as it is described on
+            // the description of the function:
+            // " (...) output or returned value will have unexpected
+            //   undescribed values "
+            return 0;
+        }
+
+        if (beta <= alpha)
+        {
+            // this branch can be safely be pruned
+            in_out_searchStats.betaCutoffsPerPly[ply]++;
+            if (nBranchesSearchTree < GAME1V1_SEARCH_STATS_CUTOFF_INDEXES)
+            {
+                in_out_searchStats.cutoffMoveIndex[nBranchesSearchTree - 1]++;
+            }
+            else
+            {
+                in_out_searchStats.cutoffMoveIndex[GAME1V1_SEARCH_STATS_CUTOFF_INDEXES - 1]++;
+            }
+
+            // this move will be tried out sooner by the next nodes
+            in_out_moveOrdering.SaveCutoff(ply, thisMove, depth);
+
+            if (a_transTable != NULL)
+            {
+                // alpha is only a lower bound of the value of this position.
+                // Not even that if it was calculated by a filtered subtree
+                a_transTable->Store(
+                        hashKey,
+                        depth,
+                        descendantsFiltered ? -INFINITE : alpha,
+                        TranspositionTable::e_boundLower,
+                        bestMove);
+            }
+
+            return alpha;
+        }
+    } // for (int32_t moveIt = 0; moveIt < in_out_moveOrdering.GetNMoves(ply); moveIt++)
 
 	if (nBranchesSearchTree == 0)
 	{
 	    // no pieces were put down (the player can't put down any piece at this level
 	    // of the search tree). Call the algorithm with no piece put down
 	    a_lastPiecesMe[(originalDepth / 2) - (depth / 2)] = e_noPiece;
-        int32_t maxValue = -Game1v1::MinMaxAlphaBetaCompute(
+        int32_t maxValue = -Game1v1::MinMaxAlphaBetaCompute<EVALUATOR>(
                                 a_board,
                                 a_playerOpponent,
                                 a_oldNkPointsOpponent,
@@ -1113,13 +3285,21 @@ int32_t Game1v1::MinMaxAlphaBetaCompute(
                                 depth - 1,
                                 -beta,
                                 -alpha,
-                                stopProcessingFlag
-#ifdef DEBUG_PRINT
-                                ,times
-#endif
-                                );
+                                a_transTable,
+                                a_transTableStats,
+                                in_out_checkpoint,
+                                a_searchMode,
+                                in_out_moveOrdering,
+                                in_out_searchStats,
+                                childFiltered);
+
+        if (childFiltered)
+        {
+            descendantsFiltered = true;
+            out_subtreeFiltered = true;
+        }
 
-        if (stopProcessingFlag)
+        if (in_out_checkpoint.IsCancelled())
         {
             // something happened and we were told to stop
             // processing (that is probably why MinMaxAlphaBetaCompute
@@ -1136,40 +3316,133 @@ int32_t Game1v1::MinMaxAlphaBetaCompute(
         }
 	}
 
+    if (a_transTable != NULL)
+    {
+        // alpha is exact if a move raised it (without failing high). If every
+        // move failed low it is only an upper bound of the value of this position
+        TranspositionTable::eBound_t bound = TranspositionTable::e_boundExact;
+        if (alpha >= beta)
+        {
+            bound = TranspositionTable::e_boundLower;
+        }
+        else if (alpha <= originalAlpha)
+        {
+            bound = TranspositionTable::e_boundUpper;
+        }
+
+        if (descendantsFiltered)
+        {
+            // the value of some node below this one depends on the path taken
+            // to reach it, and so does alpha. Only the best move is useful
+            if (packedmove::IsNoMove(bestMove) == false)
+            {
+                a_transTable->Store(
+                        hashKey,
+                        depth,
+                        -INFINITE,
+                        TranspositionTable::e_boundLower,
+                        bestMove);
+            }
+        }
+        else if (!nkPointsFiltered)
+        {
+            a_transTable->Store(
+                    hashKey,
+                    depth,
+                    alpha,
+                    bound,
+                    bestMove);
+        }
+        else if (bound != TranspositionTable::e_boundUpper)
+        {
+            // moves skipped by the filter could be better than the ones tried
+            // out. An exact value is only a lower bound then, and nothing is
+            // known for sure about this position if every move failed low
+            a_transTable->Store(
+                    hashKey,
+                    depth,
+                    alpha,
+                    TranspositionTable::e_boundLower,
+                    bestMove);
+        }
+    }
+
     return alpha;
 }
 
-
-void Game1v1::RecalculateNKInAllBoard()
+Game1v1::AlphaBetaComputeFunction_t Game1v1::SelectAlphaBetaCompute(
+        Heuristic::EvalFunction_t a_heuristicMethod,
+        bool                      a_specialised)
 {
-    Coordinate thisCoord(0, 0);
-    for (thisCoord.m_row = 0 ;
-         thisCoord.m_row < m_board.GetNRows();
-         thisCoord.m_row++)
+    // a search specialised for each one of the heuristics. They must be in
+    // the same order they are described in Heuristic::m_heuristicData
+    static const struct
     {
-        for (thisCoord.m_col = 0 ;
-             thisCoord.m_col < m_board.GetNColumns();
-             thisCoord.m_col++)
+        Heuristic::EvalFunction_t  evalFunction;
+        AlphaBetaComputeFunction_t alphaBetaCompute;
+    } specialisedSearch[Heuristic::e_heuristicCount] =
+    {
+        {Heuristic::CalculateInfluenceAreaWeighted,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateInfluenceAreaWeighted> >},
+        {Heuristic::CalculateInfluenceAreaWeightedEastwood,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateInfluenceAreaWeightedEastwood> >},
+        {Heuristic::CalculateNKWeightedv1,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateNKWeightedv1> >},
+        {Heuristic::CalculateCentreFocused,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateCentreFocused> >},
+        {Heuristic::CalculateSimple,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateSimple> >},
+        {Heuristic::CalculateRandom,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateRandom> >},
+        {Heuristic::CalculateWeightedAreas,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateWeightedAreas> >},
+        {Heuristic::CalculateInfluenceAreaExact,
+         MinMaxAlphaBetaCompute< Heuristic::StaticEvaluator<Heuristic::CalculateInfluenceAreaExact> >},
+    };
+
+    if (a_specialised)
+    {
+        for (int32_t i = Heuristic::e_heuristicStartCount; i < Heuristic::e_heuristicCount; i++)
         {
-            if (rules::IsNucleationPointCompute(m_board, m_player1, thisCoord))
-            {
-                m_player1.SetNucleationPoint(thisCoord);
-            }
-            else
-            {
-                m_player1.UnsetNucleationPoint(thisCoord);
-            }
-
-            if (rules::IsNucleationPointCompute(m_board, m_player2, thisCoord))
-            {
-                m_player2.SetNucleationPoint(thisCoord);
-            }
-            else
+#ifdef DEBUG
+            assert(specialisedSearch[i].evalFunction == Heuristic::m_heuristicData[i].m_evalFunction);
+#endif
+            if (Heuristic::m_heuristicData[i].m_evalFunction == a_heuristicMethod)
             {
-                m_player2.UnsetNucleationPoint(thisCoord);
+                return specialisedSearch[i].alphaBetaCompute;
             }
         }
     }
+
+    // not one of the heuristics of Heuristic::m_heuristicData (or specialised
+    // searches are disabled)
+    return MinMaxAlphaBetaCompute<Heuristic::PointerEvaluator>;
+}
+
+Game1v1::eInfluenceAreaUpdate_t Game1v1::SelectInfluenceAreaUpdate(
+        Heuristic::EvalFunction_t a_heuristicMethod)
+{
+    if (Heuristic::ReadsExactInfluenceAreas(a_heuristicMethod))
+    {
+        return e_influenceAreaExact;
+    }
+    else if (Heuristic::ReadsInfluenceAreas(a_heuristicMethod))
+    {
+        return e_influenceAreaApproximate;
+    }
+
+    return e_influenceAreaNone;
+}
+
+void Game1v1::RecalculateNKInAllBoard()
+{
+    Bitboard nkPoints;
+
+    rules::CalculateNucleationPointsCompute(m_board, m_player1, nkPoints);
+    m_player1.SetNucleationPointsPlane(nkPoints);
+
+    rules::CalculateNucleationPointsCompute(m_board, m_player2, nkPoints);
+    m_player2.SetNucleationPointsPlane(nkPoints);
 }
 
 void Game1v1::RecalculateInflueceAreasInAllBoard()
@@ -1183,7 +3456,9 @@ void Game1v1::RecalculateInflueceAreasInAllBoard()
     // supposed to be called many times
 
     // tmp baby Piece
-    Piece babyPiece(e_1Piece_BabyPiece);
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    const PieceConf_t &babyPieceConf =
+        confTable.GetConf(confTable.GetFirstConf(e_1Piece_BabyPiece));
 
     Coordinate thisCoord(0, 0);
     for (thisCoord.m_row = 0 ;
@@ -1197,18 +3472,70 @@ void Game1v1::RecalculateInflueceAreasInAllBoard()
             rules::RecalculateInfluenceAreaAroundPieceFast(
                     m_board,
                     thisCoord,
-                    babyPiece.GetCurrentConfiguration(),
+                    babyPieceConf,
                     m_player1);
 
             rules::RecalculateInfluenceAreaAroundPieceFast(
                     m_board,
                     thisCoord,
-                    babyPiece.GetCurrentConfiguration(),
+                    babyPieceConf,
                     m_player2);
         }
     }
 }
 
+void Game1v1::RecalculateHashKeys()
+{
+    m_player1.ResetHashKey();
+    m_player2.ResetHashKey();
+
+    Coordinate thisCoord(0, 0);
+    for (thisCoord.m_row = 0 ;
+         thisCoord.m_row < m_board.GetNRows();
+         thisCoord.m_row++)
+    {
+        for (thisCoord.m_col = 0 ;
+             thisCoord.m_col < m_board.GetNColumns();
+             thisCoord.m_col++)
+        {
+            if (m_board.IsPlayerInCoord(thisCoord, m_player1))
+            {
+                m_player1.ToggleHashKeySquare(thisCoord);
+            }
+            else if (m_board.IsPlayerInCoord(thisCoord, m_player2))
+            {
+                m_player2.ToggleHashKeySquare(thisCoord);
+            }
+        }
+    }
+}
+
+void Game1v1::RecalculateTakenSquares()
+{
+    m_player1.ResetTakenSquares();
+    m_player2.ResetTakenSquares();
+
+    Coordinate thisCoord(0, 0);
+    for (thisCoord.m_row = 0 ;
+         thisCoord.m_row < m_board.GetNRows();
+         thisCoord.m_row++)
+    {
+        for (thisCoord.m_col = 0 ;
+             thisCoord.m_col < m_board.GetNColumns();
+             thisCoord.m_col++)
+        {
+            if (m_board.IsPlayerInCoord(thisCoord, m_player1))
+            {
+                m_player1.AddTakenSquare(thisCoord);
+            }
+            else if (m_board.IsPlayerInCoord(thisCoord, m_player2))
+            {
+                m_player2.AddTakenSquare(thisCoord);
+            }
+        }
+    }
+}
+
 void Game1v1::Reset(
     const Coordinate &a_player1StartingCoord,
     const Coordinate &a_player2StartingCoord)
@@ -1275,9 +3602,12 @@ bool Game1v1::LoadGame(std::istream& a_inStream)
         }
     }
 
-    // reload player's properties (nk points and influence areas)
+    // reload player's properties (nk points, influence areas, hash keys
+    // and squares taken)
     RecalculateNKInAllBoard();
     RecalculateInflueceAreasInAllBoard();
+    RecalculateHashKeys();
+    RecalculateTakenSquares();
 
     return true;
 }
@@ -23,6 +23,23 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 28-Aug-2009  Original development
+///           agent              17-Oct-2026  Parallel root-split MinMax
+///           agent              17-Oct-2026  Transposition table
+///           agent              17-Oct-2026  Iterative deepening with a time budget
+///           agent              17-Oct-2026  Moves generated with bit planes
+///           agent              17-Oct-2026  Configurations read from PieceConfTable
+///           agent              17-Oct-2026  Squares taken saved into the players
+///           agent              17-Oct-2026  Number of nodes searched
+///           agent              17-Oct-2026  Search statistics
+///           agent              17-Oct-2026  Moves packed into PackedMove_t words
+///           agent              17-Oct-2026  Killer moves and history heuristic
+///           agent              17-Oct-2026  Principal variation search and aspiration windows
+///           agent              17-Oct-2026  Searches cancelled through a CancellationToken
+///           agent              17-Oct-2026  Position keys and switchable progress updates (pondering)
+///           agent              17-Oct-2026  Opening book looked up before searching
+///           agent              17-Oct-2026  Endgame solver
+///           agent              17-Oct-2026  Search specialised for each heuristic at compile time
+///           agent              17-Oct-2026  Pieces removed with an undo record
 /// @endhistory
 ///
 // ============================================================================
@@ -33,6 +50,8 @@
 #include <istream>
 #include <ostream>
 #include <csignal>         // atomic_t
+#include <vector>
+#include <glib.h>          // glib-2.0/glib.h (threads used by parallel MinMax)
 #include <sigc++/signal.h> // sigc++-2.0/sigc++
 #include "piece.h"
 #include "player.h"
@@ -41,6 +60,12 @@
 #include "rules.h"
 #include "coordinate.h"
 #include "coordinate_set.h"
+#include "transposition_table.h"
+#include "packed_move.h"
+#include "move_ordering.h"
+#include "cancellation_token.h"
+#include "opening_book.h"
+#include "zobrist.h"
 
 /// our own version of INFINITE
 const int32_t INFINITE = 2147483647;
@@ -58,6 +83,37 @@ static const int32_t DEFAULT_STARTING_COL_PLAYER2 = 9;
 static const int32_t DEFAULT_STARTING_ROW_PLAYER1 = 4;
 static const int32_t DEFAULT_STARTING_COL_PLAYER1 = 4;
 
+/// maximum number of threads a single MinMax search can be split into
+const int32_t GAME1V1_MAX_SEARCH_THREADS = 64;
+
+/// maximum depth of the search tree. MinMax keeps per-level data in arrays
+/// of e_numberOfPieces elements, which can't hold deeper trees
+const int32_t GAME1V1_MAX_SEARCH_DEPTH = (2 * e_numberOfPieces) - 1;
+
+/// number of plies of the search tree the search statistics are kept for.
+/// Ply 0 is the root of the tree
+const int32_t GAME1V1_SEARCH_STATS_PLIES = GAME1V1_MAX_SEARCH_DEPTH + 1;
+
+/// size of the histogram of the index of the moves which caused a beta cutoff.
+/// The last position counts every move tried out after the previous ones
+const int32_t GAME1V1_SEARCH_STATS_CUTOFF_INDEXES = 8;
+
+/// size (in MB) of the transposition table used by MinMaxIterativeDeepening
+/// when the caller doesn't provide one
+const int32_t GAME1V1_ITERATIVE_DEEPENING_TABLE_SIZE_MB = 4;
+
+/// half the size of the aspiration window used by MinMaxIterativeDeepening
+/// around the value of a previous iteration (principal variation search only)
+const int32_t GAME1V1_ASPIRATION_WINDOW = 16;
+
+/// default number of valid moves (both players' added up) below which positions
+/// are solved up to the end of the game (see Game1v1::SetEndgameThreshold)
+const int32_t GAME1V1_DEFAULT_ENDGAME_THRESHOLD = 40;
+
+/// depth saved into the transposition table with the value of positions solved
+/// up to the end of the game. It is deeper than any depth-limited search
+const int32_t GAME1V1_ENDGAME_TABLE_DEPTH = 2 * e_numberOfPieces;
+
 
 /// @brief contains the definition of a game 1vs1 of blockem
 /// This class is meant to contain all the rules about blockem 1vs1
@@ -75,6 +131,21 @@ public:
 
     } eGame1v1Player_t;
 
+    /// algorithms MinMax can search the tree with. Both of them return the same value
+    typedef enum
+    {
+        /// alpha-beta pruning. Every move is searched with the full (alpha, beta) window
+        e_searchModeAlphaBeta = 0,
+        /// principal variation search. The first move of each node is searched with
+        /// the full window, the rest of them with a null window (alpha, alpha + 1)
+        /// which only proves they are not better than the first one. Moves which fail
+        /// high are searched again with the full window. MinMaxIterativeDeepening also
+        /// searches the root of each iteration with an aspiration window around the
+        /// value of a previous one
+        e_searchModePVS,
+
+    } eSearchMode_t;
+
     /// @brief the customised set that is used in Game1v1. It is a typedef so it can
     ///        be swapped easily if a new faster method is found
     typedef CoordinateSet16x16 Game1v1CoordinateSet_t; // 1-2% faster than the one below
@@ -110,6 +181,14 @@ public:
     ///     void YourClass::YourMethod(float)
     sigc::signal<void, float>& SignalProgressUpdate();
 
+    /// @brief enables or disables the progress updates of this instance
+    /// Copies of a game share the connections to its progress signal, so a copy
+    /// used for background searches (pondering) must disable them. Enabled by default
+    void SetProgressUpdate(bool a_enabled);
+
+    /// @return true if searches run on this instance issue progress updates
+    bool IsProgressUpdateEnabled() const;
+
     /// @returns a const reference to the player passed as parameter
 	/// If a_playerType is invalid Player returned is undefined
     const Player& GetPlayer(eGame1v1Player_t a_playerType) const;
@@ -122,6 +201,11 @@ public:
     /// if that player doesn't belong to the Game, player type returned will be undefined
     eGame1v1Player_t GetPlayerType(const Player &a_player) const;
 
+    /// @return the zobrist hash key of the current position with a_playerToMove as
+    ///         the next player to move. Positions reached through different move
+    ///         orders have the same key
+    uint64_t GetPositionKey(eGame1v1Player_t a_playerToMove) const;
+
 	/// @brief sets the player colour
 	void SetPlayerColour(
 	        eGame1v1Player_t a_player,
@@ -148,35 +232,216 @@ public:
 			const Coordinate &a_coord,
 			eGame1v1Player_t a_player);
 
+    /// @brief statistics of a MinMax search
+    /// They are always updated (it costs a few increments per node), so the
+    /// performance of the search can be measured in any build
+    typedef struct
+    {
+        /// nodes of the search tree visited (the root included)
+        uint64_t nodes;
+        /// nodes visited at each ply of the tree. Ply 0 is the root
+        uint64_t nodesPerPly[GAME1V1_SEARCH_STATS_PLIES];
+        /// calls to the evaluation function
+        uint64_t leafEvaluations;
+        /// nodes whose value was taken from the transposition table
+        uint64_t transTableCutoffs;
+        /// beta cutoffs at each ply of the tree
+        uint64_t betaCutoffsPerPly[GAME1V1_SEARCH_STATS_PLIES];
+        /// beta cutoffs caused by the 1st, 2nd, 3rd... move tried out at a node
+        uint64_t cutoffMoveIndex[GAME1V1_SEARCH_STATS_CUTOFF_INDEXES];
+        /// moves found by the move generator
+        uint64_t movesGenerated;
+        /// moves put down on the board and searched
+        uint64_t movesTried;
+        /// pieces not tried out at all by a node because every nucleation point
+        /// they could touch was already tried out by a previous level of the tree
+        uint64_t duplicatePiecesSkipped;
+        /// nucleation points removed by that filter from the ones a piece must touch
+        /// (moves touching only those points are not generated again)
+        uint64_t duplicateNkPointsSkipped;
+        /// null window searches which failed high and were searched again
+        /// with the full window (principal variation search only)
+        uint64_t nullWindowResearches;
+        /// iterations whose value fell outside their aspiration window, and were
+        /// searched again with the full window (MinMaxIterativeDeepening only)
+        uint64_t aspirationResearches;
+        /// positions where the game was over scored by the endgame solver with
+        /// the squares left to each player (instead of an evaluation function)
+        uint64_t endgameTerminals;
+        /// time the search took (in seconds)
+        double   elapsedSeconds;
+    } SearchStats_t;
+
     /// @brief calculates the next piece to be put down by player 'me' using the heuristic passed as parameter
     /// It uses the minimax algorithm with the alpha beta pruning
 	/// @param the heuristic method for the min max algorithm
-	/// @param maximum depth for the search tree
+	/// @param maximum depth for the search tree. Capped to GAME1V1_MAX_SEARCH_DEPTH
     /// @param Player whose move will be calculated by MinMAx algorithm
 	/// @param a reference to a piece where the result will be stored
 	/// @param a reference to a Coordinate where the result will be stored
-    /// @param parameter with a reference to a variable that could be set
-    ///        to non-zero by a different thread indicating to the thread currently stuck
-    ///        in the calculation algorithm to stop. If the current thread notices
-    ///        this flag variable is set to non-zero it will stop immediately, which means
-    ///        every reference used as an output or returned value will have unexpected
-    ///        undescribed values.
+    /// @param token that could be cancelled by a different thread indicating to the
+    ///        thread currently stuck in the calculation algorithm to stop. A plain flag
+    ///        set to non-zero by the other thread can be passed as well. The search
+    ///        notices it within CANCELLATION_CHECKPOINT_INTERVAL nodes (per search
+    ///        thread) and returns straight away, which means every reference used as an
+    ///        output or returned value will have unexpected undescribed values.
     /// @param optional parameter with the coordinate where the
     ///        opponent put down the latest piece
 	/// @param optional parameter with the latest piece put down by the opponent
 	///        if this param is set to Piece(e_noPiece) MinMax won't be able to take into
 	///        account the latest opponent's move to compute the next move. it can also
 	///        be used to add a bit of randomness to the AI behaviour
-	/// @return value calculated by the evaluation function for the selected configuration
+    /// @param optional parameter with the number of threads the search will be split into.
+    ///        If it is bigger than 1 moves at the root of the search tree are handed out
+    ///        to that many worker threads, each one of them with its own copy of the board
+    ///        and the players. It is capped to GAME1V1_MAX_SEARCH_THREADS. The move returned
+    ///        doesn't depend on the number of threads, but it might be different to the
+    ///        one returned by the 1-thread search when several moves get a very similar
+    ///        value (move ordering data is not shared by the threads)
+    /// @param optional parameter with the transposition table to be used by the search.
+    ///        NULL means no transposition table. Entries saved by previous searches
+    ///        are reused if the heuristic is the same. Its statistics are reset at the
+    ///        beginning of the search, and they can be read with
+    ///        TranspositionTable::GetStats once MinMax returns. When it is shared by
+    ///        several threads the move returned might depend on the number of threads
+	/// @return value calculated by the evaluation function for the selected configuration.
+    ///         If the position is solved by the endgame solver (see SetEndgameThreshold)
+    ///         it is the exact result of the game instead: squares left to the opponent
+    ///         minus squares left to a_player once both of them play perfectly
     int32_t MinMax(
             Heuristic::EvalFunction_t    a_heuristicMethod,
             int32_t                      depth,
             eGame1v1Player_t             a_player,
             Piece                        &out_resultPiece,
             Coordinate                   &out_coord,
-            const volatile sig_atomic_t  &stopProcessingFlag,
+            const CancellationToken      &a_cancelToken,
             const Coordinate             &a_lastOpponentPieceCoord = Coordinate(),
-            const Piece                  &a_lastOpponentPiece = Piece(e_noPiece));
+            const Piece                  &a_lastOpponentPiece = Piece(e_noPiece),
+            int32_t                      a_nThreads = 1,
+            TranspositionTable           *a_transTable = NULL);
+
+    /// @brief calculates the next piece to be put down by player 'me' within a time budget
+    /// It calls MinMax with depth 1, 2, 3... until a_maxDepth is reached or a_timeBudgetMs
+    /// milliseconds have elapsed. The search which is running when the time runs out is
+    /// cancelled and the move calculated by the last completed one is returned. The best
+    /// move of each iteration is saved into the transposition table, so the next (deeper)
+    /// one tries out the moves of the previous principal variation first
+    /// Depth 1 is always completed, even if it takes longer than a_timeBudgetMs
+    /// If the search mode is e_searchModePVS the root of every iteration deeper than 2
+    /// is searched with an aspiration window of GAME1V1_ASPIRATION_WINDOW around the
+    /// value of the iteration 2 plies shallower (values of odd and even depths are
+    /// usually far apart). It is searched again with the full window if its value
+    /// doesn't fall inside it
+    /// progress updates are notified per iteration (from 0.0 to 1.0 for each one of them)
+    /// @param the heuristic method for the min max algorithm
+    /// @param maximum depth for the search tree. Capped to GAME1V1_MAX_SEARCH_DEPTH
+    /// @param time budget in milliseconds. 0 (or negative) means there is no time limit
+    /// @param Player whose move will be calculated by MinMAx algorithm
+    /// @param a reference to a piece where the result will be stored
+    /// @param a reference to a Coordinate where the result will be stored
+    /// @param a reference to an int32_t where the depth of the last completed search will be stored
+    /// @param token that could be cancelled by a different thread to cancel the
+    ///        search. Same behaviour as MinMax's (outputs will be undefined)
+    /// @param optional parameter with the coordinate where the opponent put down the latest piece
+    /// @param optional parameter with the latest piece put down by the opponent (see MinMax)
+    /// @param optional parameter with the number of threads every search will be split into
+    /// @param optional parameter with the transposition table to be used by the search. If it
+    ///        is NULL a table of GAME1V1_ITERATIVE_DEEPENING_TABLE_SIZE_MB MB is created for this
+    ///        search, since the table is what passes the principal variation from one iteration
+    ///        to the next. Its statistics include the accesses made by all the iterations
+    /// If the position is solved by the endgame solver (see SetEndgameThreshold) it is
+    /// solved once, whatever the maximum depth is, right after depth 1. out_depthReached
+    /// is set to the number of pieces left to both players then. The solver is cancelled
+    /// as any other iteration if the time runs out, and the move of depth 1 is returned
+    /// @return value calculated by the evaluation function for the selected configuration
+    ///         (or the exact result of the game, as it happens with MinMax)
+    int32_t MinMaxIterativeDeepening(
+            Heuristic::EvalFunction_t    a_heuristicMethod,
+            int32_t                      a_maxDepth,
+            int32_t                      a_timeBudgetMs,
+            eGame1v1Player_t             a_player,
+            Piece                        &out_resultPiece,
+            Coordinate                   &out_coord,
+            int32_t                      &out_depthReached,
+            const CancellationToken      &a_cancelToken,
+            const Coordinate             &a_lastOpponentPieceCoord = Coordinate(),
+            const Piece                  &a_lastOpponentPiece = Piece(e_noPiece),
+            int32_t                      a_nThreads = 1,
+            TranspositionTable           *a_transTable = NULL);
+
+    /// @return statistics of the latest call to MinMax (all its threads included) or
+    ///         MinMaxIterativeDeepening (all its iterations included). The first move of
+    ///         a player and moves read from the opening book are not calculated with a
+    ///         search tree, so their statistics are all 0
+    const SearchStats_t& GetSearchStats() const;
+
+    /// @brief enables or disables move ordering (killer moves and history heuristic)
+    /// Moves are tried out in a fixed order if it is disabled. The value returned by
+    /// the search is the same, but it usually visits many more nodes. Enabled by default
+    void SetMoveOrdering(bool a_enabled);
+
+    /// @return true if the search sorts its moves using killer moves and history
+    bool IsMoveOrderingEnabled() const;
+
+    /// @brief sets the algorithm the search tree will be searched with
+    /// e_searchModeAlphaBeta by default
+    void SetSearchMode(eSearchMode_t a_searchMode);
+
+    /// @return the algorithm the search tree is searched with
+    eSearchMode_t GetSearchMode() const;
+
+    /// @brief enables or disables the search specialised for each heuristic
+    /// If it is enabled, heuristics described in Heuristic::m_heuristicData are
+    /// searched with a version of MinMaxAlphaBetaCompute compiled for them, which
+    /// calls the evaluation function directly. Otherwise (and with any other heuristic)
+    /// the evaluation function is called through its pointer. The result of the search
+    /// is the same. Enabled by default
+    void SetSpecialisedSearch(bool a_enabled);
+
+    /// @return true if heuristics are searched with their specialised search
+    bool IsSpecialisedSearchEnabled() const;
+
+    /// @brief sets the opening book MinMax and MinMaxIterativeDeepening look up
+    /// before searching. If the position is in the book its move is returned straight
+    /// away (with the value the book was built with) and no search is run. The book is
+    /// only used by searches with the same heuristic and depth it was built with (the
+    /// maximum depth in MinMaxIterativeDeepening), and never with the random heuristic.
+    /// The first piece of a player is never taken from the book. NULL (the default) disables it
+    /// @param the book. It must outlive this game (and its copies)
+    void SetOpeningBook(const OpeningBook* a_openingBook);
+
+    /// @return the opening book looked up before searching. NULL if there's none
+    const OpeningBook* GetOpeningBook() const;
+
+    /// @brief sets when MinMax and MinMaxIterativeDeepening stop searching with the
+    /// evaluation function and solve the position up to the end of the game instead
+    /// It happens once the valid moves of both players added up are less than
+    /// a_nMoves. The depth of the search is ignored then (the tree is searched till
+    /// neither player can put down a piece) and terminal positions are scored with
+    /// the real result of the game, so the evaluation function is not called at all.
+    /// The solver uses the transposition table passed to the search (if any) and
+    /// runs in 1 thread. GAME1V1_DEFAULT_ENDGAME_THRESHOLD by default. 0 disables it
+    void SetEndgameThreshold(int32_t a_nMoves);
+
+    /// @return number of valid moves below which positions are solved up to the end of the game
+    int32_t GetEndgameThreshold() const;
+
+    /// @return true if the position of a_player would be solved up to the end of
+    ///         the game by MinMax (see SetEndgameThreshold)
+    bool IsEndgame(eGame1v1Player_t a_player) const;
+
+    /// @brief resets a search statistics structure
+    static void ResetSearchStats(SearchStats_t &out_stats);
+
+    /// @brief adds the counters of a_stats (elapsed time included) to in_out_stats
+    static void AddSearchStats(const SearchStats_t &a_stats, SearchStats_t &in_out_stats);
+
+    /// @return nodes searched per second by the search described by a_stats
+    static uint64_t NodesPerSecond(const SearchStats_t &a_stats);
+
+    /// @brief prints out a_stats in a human readable format
+    /// Plies of the search tree with no nodes are not printed
+    static void PrintSearchStats(const SearchStats_t &a_stats, std::ostream &a_outStream);
 
     /// @brief Blanks out the board and reset the players so they have all the pieces available
     /// it can be used to restart the game (to start in a new blank game)
@@ -208,6 +473,81 @@ public:
     bool SaveGame(std::ostream& a_outStream);
 
 protected:
+    /// @brief pointer to a version of MinMaxAlphaBetaCompute (see SelectAlphaBetaCompute)
+    typedef int32_t (*AlphaBetaComputeFunction_t)(
+            Board &,
+            Player &,
+            const Bitboard* [e_numberOfPieces],
+            ePieceType_t [e_numberOfPieces],
+            Player &,
+            const Bitboard* [e_numberOfPieces],
+            ePieceType_t [e_numberOfPieces],
+            Heuristic::EvalFunction_t,
+            int32_t,
+            int32_t,
+            int32_t,
+            int32_t,
+            TranspositionTable *,
+            TranspositionTable::Stats_t &,
+            CancellationCheckpoint &,
+            eSearchMode_t,
+            MoveOrdering &,
+            SearchStats_t &,
+            bool &);
+
+    /// @brief data shared by all the worker threads of a parallel MinMax
+    /// everything below m_mutex (included) must be accessed holding the mutex
+    typedef struct
+    {
+        /// board of the game. Each worker thread copies it before starting
+        const Board*                 board;
+        /// player whose move is being calculated. Copied by each worker thread
+        const Player*                playerMe;
+        /// opponent of playerMe. Copied by each worker thread
+        const Player*                playerOpponent;
+        /// the heuristic method for the min max algorithm
+        Heuristic::EvalFunction_t    heuristicMethod;
+        /// version of MinMaxAlphaBetaCompute the tree below each root move is searched with
+        AlphaBetaComputeFunction_t   alphaBetaCompute;
+        /// maximum depth for the search tree
+        int32_t                      depth;
+        /// cancelled by another thread to stop processing. Each worker
+        /// thread checks it through its own CancellationCheckpoint
+        const CancellationToken*     cancelToken;
+        /// list of moves at the root of the tree in the same order they are
+        /// tried out by the 1-thread search
+        const std::vector<PackedMove_t>* rootMoves;
+        /// transposition table shared by all threads. NULL if there's none
+        TranspositionTable*          transTable;
+        /// true if moves are sorted (each thread uses its own MoveOrdering)
+        bool                         moveOrdering;
+        /// algorithm the tree below each root move is searched with
+        eSearchMode_t                searchMode;
+        /// beta of the root of the tree (INFINITE unless there's an aspiration window)
+        int32_t                      beta;
+
+        /// protects the rest of the members of the structure
+        GMutex*                      mutex;
+        /// worker threads signal it each time a root move is evaluated
+        GCond*                       cond;
+        /// index of the next root move to be handed out
+        int32_t                      nextMove;
+        /// number of root moves already evaluated
+        int32_t                      nMovesDone;
+        /// number of worker threads that returned
+        int32_t                      nThreadsDone;
+        /// best value found so far. It is the alpha shared by all threads. It
+        /// starts off as the alpha of the root of the tree
+        int32_t                      bestValue;
+        /// index (in rootMoves) of the move which got bestValue. -1 if none
+        int32_t                      bestMove;
+        /// true if some move was skipped by the nk points filter below any
+        /// of the root moves (see MinMaxAlphaBetaCompute)
+        bool                         subtreeFiltered;
+        /// statistics of the search. Every thread adds its own ones
+        SearchStats_t*               searchStats;
+    } ParallelSearchData_t;
+
     /// The blockem board where the game will be played
 	Board m_board;
 
@@ -225,39 +565,181 @@ protected:
     /// signal to be sent when the computing is finished
     sigc::signal<void, const Piece&, const Coordinate&, Game1v1::eGame1v1Player_t, int32_t> m_signal_computingFinished;
 
+    /// statistics of the latest search (see GetSearchStats)
+    SearchStats_t m_searchStats;
+
+    /// true if searches sort their moves (see SetMoveOrdering)
+    bool m_moveOrdering;
+
+    /// algorithm the search tree is searched with (see SetSearchMode)
+    eSearchMode_t m_searchMode;
+
+    /// true if heuristics are searched with their specialised search (see SetSpecialisedSearch)
+    bool m_specialisedSearch;
+
+    /// true if searches emit m_signal_progress (see SetProgressUpdate)
+    bool m_progressUpdate;
+
+    /// opening book looked up before searching. NULL if there's none
+    const OpeningBook* m_openingBook;
+
+    /// positions with fewer valid moves are solved up to the end of the game
+    int32_t m_endgameThreshold;
+
     /// @brief recalculate the nucleation points using the whole blockem board and save them into the players
     void RecalculateNKInAllBoard();
 
     /// @brief recalculate the influence area (for both player1 and 2) in the wholse board
     void RecalculateInflueceAreasInAllBoard();
 
+    /// @brief recalculate the zobrist hash keys of player1 and 2 using the whole board
+    void RecalculateHashKeys();
+
+    /// @brief recalculate the squares taken by player1 and 2 (and their weight)
+    /// using the whole board
+    void RecalculateTakenSquares();
+
+    /// @brief how PutDownPiece and RemovePiece update the influence areas of the players
+    typedef enum
+    {
+        /// they are not updated. They will be out of date until the piece is removed
+        /// with an undo record. Searches whose heuristic doesn't read them save the time
+        e_influenceAreaNone = 0,
+        /// only the squares around the piece are updated (see
+        /// rules::RecalculateInfluenceAreaAroundPieceFast). Cheap, but it is an
+        /// approximation of the squares each player can really reach
+        e_influenceAreaApproximate,
+        /// both areas are calculated again with rules::RecalculateInfluenceAreaInBoard
+        /// (the squares each player can reach with the pieces it has got left). Much
+        /// slower. Only searches with Heuristic::CalculateInfluenceAreaExact use it
+        e_influenceAreaExact,
+    } eInfluenceAreaUpdate_t;
+
+    /// @brief what PutDownPiece changes in both players. It is saved before the piece is
+    /// put down, so RemovePiece can restore the players exactly as they were instead of
+    /// calculating again the nk points and influence areas around the piece. The squares
+    /// of the board taken by the piece are known from the coord and the configuration
+    typedef struct
+    {
+        Player::BoardState_t playerMe;
+        Player::BoardState_t playerOpponent;
+    } UndoRecord_t;
+
     /// remove a piece from the board. The user is supposed to check if the piece was there
     /// before calling this function since it just will set to empty the squares
+    /// With e_influenceAreaExact the piece must have been given back to the player
+    /// (Player::SetPiece) already, since the areas are calculated with the pieces available
 	/// @param the board
     /// @param the ABSOLUTE coord
     /// @param the piece configuration
     /// @param the player that owns the piece to be removed
 	/// @param the opponent of the player that owns the piece
+    /// @param how the influence areas of the players are updated. It can't be e_influenceAreaNone
     static void RemovePiece(
             Board                    &a_theBoard,
             const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf,
+            const PieceConf_t        &a_pieceConf,
             Player                   &a_playerMe,
-            Player                   &a_playerOpponent);
+            Player                   &a_playerOpponent,
+            eInfluenceAreaUpdate_t    a_influenceAreaUpdate = e_influenceAreaApproximate);
 
     /// put down a piece on the board. The user is supposed to check if there is space for it before calling
+    /// With e_influenceAreaExact the piece must have been taken from the player
+    /// (Player::UnsetPiece) already, since the areas are calculated with the pieces available
     /// @param the board
     /// @param the ABSOLUTE coord
     /// @param the piece configuration
     /// @param the player that owns the piece to be removed
     /// @param the opponent of the player that owns the piece
+    /// @param how the influence areas of the players are updated (see SelectInfluenceAreaUpdate)
+    static void PutDownPiece(
+            Board                    &a_theBoard,
+            const Coordinate         &a_coord,
+            const PieceConf_t        &a_pieceConf,
+            Player                   &a_playerMe,
+            Player                   &a_playerOpponent,
+            eInfluenceAreaUpdate_t    a_influenceAreaUpdate = e_influenceAreaApproximate);
+
+    /// @brief same as PutDownPiece, but what it changes in the players is saved into
+    /// out_undoRecord first, so the piece can be removed with the RemovePiece below
     static void PutDownPiece(
             Board                    &a_theBoard,
             const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf,
+            const PieceConf_t        &a_pieceConf,
+            Player                   &a_playerMe,
+            Player                   &a_playerOpponent,
+            UndoRecord_t             &out_undoRecord,
+            eInfluenceAreaUpdate_t    a_influenceAreaUpdate = e_influenceAreaApproximate);
+
+    /// @brief removes a piece put down with the PutDownPiece above. The squares of the
+    /// piece are blanked out and both players are restored from a_undoRecord, so the board
+    /// and the players end up exactly as they were before the piece was put down. The
+    /// pieces available must be the same as when the piece was put down
+    static void RemovePiece(
+            Board                    &a_theBoard,
+            const Coordinate         &a_coord,
+            const PieceConf_t        &a_pieceConf,
+            const UndoRecord_t       &a_undoRecord,
             Player                   &a_playerMe,
             Player                   &a_playerOpponent);
 
+    /// @brief MinMax searching the root of the tree with the (a_alpha, a_beta) window
+    /// If the value of the position is not inside the window the value returned is
+    /// only a bound: a_alpha if no move is better than it (no move is returned then),
+    /// or a value not smaller than a_beta (the move returned is the one that proved it)
+    /// If the heuristic needs exact influence areas (see SelectInfluenceAreaUpdate) they
+    /// are calculated for the root position first, and restored when the search returns
+    /// See MinMax for a description of the rest of parameters
+    int32_t MinMaxWindow(
+            Heuristic::EvalFunction_t    a_heuristicMethod,
+            int32_t                      depth,
+            eGame1v1Player_t             a_player,
+            Piece                        &out_resultPiece,
+            Coordinate                   &out_coord,
+            const CancellationToken      &a_cancelToken,
+            const Coordinate             &a_lastOpponentPieceCoord,
+            const Piece                  &a_lastOpponentPiece,
+            int32_t                      a_nThreads,
+            TranspositionTable           *a_transTable,
+            int32_t                      a_alpha,
+            int32_t                      a_beta);
+
+    /// @brief MinMaxWindow once its statistics are reset and the timer is started
+    /// See MinMaxWindow for a description of the parameters
+    int32_t MinMaxRoot(
+            Heuristic::EvalFunction_t    a_heuristicMethod,
+            int32_t                      depth,
+            eGame1v1Player_t             a_player,
+            Piece                        &out_resultPiece,
+            Coordinate                   &out_coord,
+            const CancellationToken      &a_cancelToken,
+            const Coordinate             &a_lastOpponentPieceCoord,
+            const Piece                  &a_lastOpponentPiece,
+            int32_t                      a_nThreads,
+            TranspositionTable           *a_transTable,
+            int32_t                      a_alpha,
+            int32_t                      a_beta);
+
+    /// @brief looks up the position of a_player in the opening book
+    /// The book is only read by searches with the heuristic and depth it was built
+    /// with, and never by searches with the random heuristic
+    /// @param heuristic of the search
+    /// @param depth of the search
+    /// @param Player whose move is looked up
+    /// @param piece saved in the book. Only set if the position is found
+    /// @param ABSOLUTE coord of the piece. Only set if the position is found
+    /// @param value of the evaluation function saved in the book. Only set if
+    ///        the position is found
+    /// @return true if there's a book for this search, the position is in it and
+    ///         its move can be put down by a_player
+    bool ProbeOpeningBook(
+            Heuristic::EvalFunction_t  a_heuristicMethod,
+            int32_t                    a_depth,
+            eGame1v1Player_t           a_player,
+            Piece                     &out_resultPiece,
+            Coordinate                &out_coord,
+            int32_t                   &out_value) const;
+
     /// @brief calculate the first piece to be put in the board
     /// a_board, a_playerMe and a_playerOpponent are not const references, but they
     /// are not modified after this method is run
@@ -276,30 +758,175 @@ protected:
     /// or the algorithm won't work correctly (those are the default values for the call)
     /// It'll call iself recursively until depth is lower or equal 0
     ///
-    /// stopProcessingFlag is a reference to a variable that could be set
-    /// to non-zero by a different thread indicating to the thread currently stuck
-    /// in the calculation algorithm to stop. If the current thread notices
-    /// this flag variable is set to non-zero it will stop immediately, which means
+    /// if a_transTable is not NULL positions are looked up in it before being searched.
+    /// The best move saved in the table is tried out first, and the result of the
+    /// search is saved into the table afterwards. Accesses to the table are counted
+    /// in a_transTableStats
+    ///
+    /// Valid moves of every piece configuration are calculated at once with
+    /// rules::CalculateValidCoordsInBoard and saved into the list of this ply in
+    /// in_out_moveOrdering, which sorts them (killer moves first, then by history).
+    /// Moves which prune the rest of the branches are saved back into it as killer
+    /// moves and increase their history. If a_searchMode is e_searchModePVS every move
+    /// but the first one is searched with a null window first (see eSearchMode_t).
+    /// a_oldNkPointsMe/a_oldNkPointsOpponent save the nk points of
+    /// each player in the previous levels of the tree, so moves already tried out
+    /// by another branch aren't searched again. out_subtreeFiltered is set to true
+    /// if this node or any node below it skipped some of those moves. The value of
+    /// a node is then only a lower bound if it skipped them itself, and it depends
+    /// on the path taken to reach it if a node below it did. Only its best move is
+    /// saved into the transposition table in the latter case (as a lower bound
+    /// of -INFINITE, which is always true)
+    ///
+    /// in_out_checkpoint is polled once per node. If the token it checks was
+    /// cancelled by a different thread the search stops immediately, which means
     /// every reference used as an output or returned value will have unexpected
     /// undescribed values.
+    ///
+    /// in_out_searchStats is updated with every node of the search tree visited
+    ///
+    /// Leaves are evaluated with EVALUATOR::Evaluate (see Heuristic::PointerEvaluator
+    /// and Heuristic::StaticEvaluator), so there's a version of the search for each
+    /// heuristic. It is instantiated in game1v1.cpp only, through SelectAlphaBetaCompute
+    template<class EVALUATOR>
     static int32_t MinMaxAlphaBetaCompute(
             Board                       &a_board,
             Player                      &a_playerMe,
-            Game1v1CoordinateSet_t*      a_oldNkPointsMe[e_numberOfPieces],
+            const Bitboard*              a_oldNkPointsMe[e_numberOfPieces],
             ePieceType_t                 a_lastPiecesMe[e_numberOfPieces],
             Player                      &a_playerOpponent,
-            Game1v1CoordinateSet_t*      a_oldNkPointsOpponent[e_numberOfPieces],
+            const Bitboard*              a_oldNkPointsOpponent[e_numberOfPieces],
             ePieceType_t                 a_lastPiecesOpponent[e_numberOfPieces],
             Heuristic::EvalFunction_t    a_heuristicMethod,
             int32_t                      originalDepth,
             int32_t                      depth,
             int32_t                      alpha,  //  = -INFINITE (in the 1st call)
             int32_t                      beta,   //  = INFINITE  (in the 1st call)
-            const volatile sig_atomic_t &stopProcessingFlag
-#ifdef DEBUG_PRINT
-            ,int32_t                      &times
-#endif
-    );
+            TranspositionTable          *a_transTable,
+            TranspositionTable::Stats_t &a_transTableStats,
+            CancellationCheckpoint      &in_out_checkpoint,
+            eSearchMode_t                a_searchMode,
+            MoveOrdering                &in_out_moveOrdering,
+            SearchStats_t               &in_out_searchStats,
+            bool                        &out_subtreeFiltered);
+
+    /// @return the version of MinMaxAlphaBetaCompute a_heuristicMethod must be searched with.
+    ///         If a_specialised is true and a_heuristicMethod is one of the heuristics of
+    ///         Heuristic::m_heuristicData it is the one specialised for that heuristic.
+    ///         Otherwise it calls a_heuristicMethod through its pointer
+    static AlphaBetaComputeFunction_t SelectAlphaBetaCompute(
+            Heuristic::EvalFunction_t a_heuristicMethod,
+            bool                      a_specialised);
+
+    /// @return how a search evaluated with a_heuristicMethod must update the influence
+    ///         areas while pieces are put down: exactly if the heuristic needs them exact
+    ///         (Heuristic::ReadsExactInfluenceAreas), approximately if it reads them
+    ///         (Heuristic::ReadsInfluenceAreas), and not at all otherwise
+    static eInfluenceAreaUpdate_t SelectInfluenceAreaUpdate(
+            Heuristic::EvalFunction_t a_heuristicMethod);
+
+    /// @brief solves the position of a_player up to the end of the game
+    /// See MinMax for a description of the parameters. The heuristic is only used
+    /// to identify the search in the transposition table (a_transTable is shared with
+    /// the searches which use it)
+    /// @return squares left to the opponent minus squares left to a_player
+    int32_t MinMaxEndgame(
+            Heuristic::EvalFunction_t    a_heuristicMethod,
+            eGame1v1Player_t             a_player,
+            Piece                        &out_resultPiece,
+            Coordinate                   &out_coord,
+            const CancellationToken      &a_cancelToken,
+            TranspositionTable           *a_transTable);
+
+    /// @brief alpha-beta search of the position of a_playerMe up to the end of the game
+    /// Every valid move of every node is tried out (no move is filtered as it happens
+    /// in MinMaxAlphaBetaCompute). A player who can't put down any piece passes, and
+    /// the game is over once both players pass in a row. Positions where the game is
+    /// over are scored with the squares left to each player.
+    ///
+    /// Positions are saved into a_transTable (if it is not NULL) with their zobrist
+    /// key xor'ed with zobrist::EndgameKey and depth GAME1V1_ENDGAME_TABLE_DEPTH.
+    /// Moves are sorted by in_out_moveOrdering, which must keep the moves of
+    /// as many plies as pieces are left to both players added up
+    /// @param the board
+    /// @param the player who moves
+    /// @param the opponent
+    /// @param true if the opponent couldn't put down any piece in the previous ply
+    /// @param number of pieces put down since the root of the tree. It is the
+    ///        ply of the lists of moves of in_out_moveOrdering
+    /// @param alpha
+    /// @param beta
+    /// @param transposition table. NULL if there's none
+    /// @param accesses to the transposition table are counted here
+    /// @param polled once per node (see MinMaxAlphaBetaCompute)
+    /// @param move ordering of the search
+    /// @param statistics of the search
+    /// @param the best move is saved here (packedmove::NoMove() if a_playerMe passes
+    ///        or no move raised alpha)
+    /// @return squares left to the opponent minus squares left to a_playerMe,
+    ///         inside the (alpha, beta) window
+    static int32_t EndgameAlphaBetaCompute(
+            Board                       &a_board,
+            Player                      &a_playerMe,
+            Player                      &a_playerOpponent,
+            bool                         a_opponentPassed,
+            int32_t                      a_nPiecesPutDown,
+            int32_t                      alpha,
+            int32_t                      beta,
+            TranspositionTable          *a_transTable,
+            TranspositionTable::Stats_t &a_transTableStats,
+            CancellationCheckpoint      &in_out_checkpoint,
+            MoveOrdering                &in_out_moveOrdering,
+            SearchStats_t               &in_out_searchStats,
+            PackedMove_t                &out_bestMove);
+
+    /// @return number of squares of the pieces still available to a_player
+    static int32_t CalculateSquaresLeft(const Player &a_player);
+
+    /// @brief parallel version of the MinMax algorithm
+    /// moves at the root of the search tree are calculated first and handed
+    /// out to a_nThreads worker threads. Every worker has got its own copy of
+    /// the board and the players, and each one of them uses the best value
+    /// found so far by any thread as its alpha.
+    /// a_board, a_playerMe and a_playerOpponent are not modified
+    /// See MinMaxWindow for a description of the rest of parameters
+    int32_t MinMaxParallel(
+            const Board                 &a_board,
+            const Player                &a_playerMe,
+            const Player                &a_playerOpponent,
+            Heuristic::EvalFunction_t    a_heuristicMethod,
+            int32_t                      depth,
+            int32_t                      a_nThreads,
+            Piece                       &out_resultPiece,
+            Coordinate                  &out_coord,
+            const CancellationToken     &a_cancelToken,
+            TranspositionTable          *a_transTable,
+            int32_t                      a_alpha,
+            int32_t                      a_beta);
+
+    /// The routine run by each one of the worker threads of MinMaxParallel
+    /// @param pointer to the ParallelSearchData_t shared by all worker threads
+    static void* MinMaxParallelThreadRoutine(void *a_threadParam);
+
+    /// @return the configuration of a_move (the best move saved in a transposition
+    ///         table entry or in the opening book), or NULL if there's no move saved or it can't be put
+    ///         down by a_playerMe on a_board (zobrist keys of 2 different positions
+    ///         could collide)
+    /// @param the move read from the transposition table
+    /// @param ABSOLUTE coord where a_move puts down its piece. Only set if the
+    ///        returned configuration is not NULL
+    static const PieceConf_t* GetTranspositionTableMoveConf(
+            const Board  &a_board,
+            const Player &a_playerMe,
+            PackedMove_t  a_move,
+            Coordinate   &out_coord);
+
+    /// @return the zobrist hash key of the position with a_playerMe as the next player to move
+    /// the key represents the squares taken by both players, the pieces they have already
+    /// used and which one of them is next to move
+    inline static uint64_t CalculateHashKey(
+            const Player &a_playerMe,
+            const Player &a_playerOpponent);
 
     /// Get all the nucleation points in the board. Save the results in a special kind of set
     /// without memory allocation on the heap.
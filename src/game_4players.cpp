@@ -23,6 +23,9 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 15-Nov-2010  Original development
+///           agent              17-Oct-2026  NK points recalculated with bit planes
+///           agent              17-Oct-2026  Influence area calculated with PieceConf_t
+///           agent              17-Oct-2026  Paranoid search (MinMax) with iterative deepening
 /// @endhistory
 ///
 // ============================================================================
@@ -31,6 +34,7 @@
 #include "gettext.h" // i18n
 #include "game_4players.h"
 #include "rules.h"
+#include "deadline_watchdog.h"
 
 /// player1's name
 static const char PLAYER_1_NAME[] = N_("Mr Green");
@@ -52,6 +56,14 @@ static const char CHAR_PLAYER3 = '+';
 /// it will be used as the character for 'player4' in the board
 static const char CHAR_PLAYER4 = '-';
 
+/// the game1v1 module has its own INFINITE. This one is the same value, so
+/// both searches can be compared
+static const int32_t GAME4_INFINITE = 2147483647;
+
+/// the smallest pieces are not tried out at the start of the game if a bigger one
+/// fits. Same rule as the one applied by the 1vs1 search
+static const int8_t MIN_5SQUARE_PIECES_AT_START = 5;
+
 static const int32_t GAME_4_PLAYERS_DEFAULT_BOARD_ROWS = 20;
 static const int32_t GAME_4_PLAYERS_DEFAULT_BOARD_COLS = 20;
 
@@ -100,12 +112,39 @@ Game4Players::Game4Players() :
     m_players(DEFAULT_PLAYERS_ARRAY)
 {
     ResetOpponentLists();
+    ResetSearchStats(m_searchStats);
+}
+
+Game4Players::Game4Players(const Game4Players &a_src) :
+    m_board(a_src.m_board),
+    m_players(a_src.m_players),
+    m_searchStats(a_src.m_searchStats)
+{
+    // the opponent lists of a_src point to the players of a_src
+    ResetOpponentLists();
 }
 
 Game4Players::~Game4Players()
 {
 }
 
+Game4Players& Game4Players::operator=(const Game4Players &a_src)
+{
+    if (this != &a_src)
+    {
+        m_board = a_src.m_board;
+        for (int32_t i = e_Game4_Player1; i < e_Game4_PlayersCount; i++)
+        {
+            m_players[i] = a_src.m_players[i];
+        }
+        m_searchStats = a_src.m_searchStats;
+
+        // opponent lists already point to the players of this object
+    }
+
+    return *this;
+}
+
 void Game4Players::ResetOpponentLists()
 {
     m_playerOpponentLists[e_Game4_Player1].clear();
@@ -183,51 +222,11 @@ void Game4Players::SetPlayerColour(
 
 void Game4Players::RecalculateNKInAllBoard()
 {
-    Coordinate thisCoord;
-    for (thisCoord.m_row = 0 ;
-         thisCoord.m_row < m_board.GetNRows();
-         thisCoord.m_row++)
-    {
-        for (thisCoord.m_col = 0 ;
-             thisCoord.m_col < m_board.GetNColumns();
-             thisCoord.m_col++)
-        {
-            if (rules::IsNucleationPointCompute(m_board, m_players[e_Game4_Player1], thisCoord))
-            {
-                m_players[e_Game4_Player1].SetNucleationPoint(thisCoord);
-            }
-            else
-            {
-                m_players[e_Game4_Player1].UnsetNucleationPoint(thisCoord);
-            }
-            
-            if (rules::IsNucleationPointCompute(m_board, m_players[e_Game4_Player2], thisCoord))
-            {
-                m_players[e_Game4_Player2].SetNucleationPoint(thisCoord);
-            }
-            else
-            {
-                m_players[e_Game4_Player2].UnsetNucleationPoint(thisCoord);
-            }
-            
-            if (rules::IsNucleationPointCompute(m_board, m_players[e_Game4_Player3], thisCoord))
-            {
-                m_players[e_Game4_Player3].SetNucleationPoint(thisCoord);
-            }
-            else
-            {
-                m_players[e_Game4_Player3].UnsetNucleationPoint(thisCoord);
-            }
-            
-            if (rules::IsNucleationPointCompute(m_board, m_players[e_Game4_Player4], thisCoord))
-            {
-                m_players[e_Game4_Player4].SetNucleationPoint(thisCoord);
-            }
-            else
-            {
-                m_players[e_Game4_Player4].UnsetNucleationPoint(thisCoord);
-            }
-        }
+    Bitboard nkPoints;
+    for (int32_t i = e_Game4_Player1; i < e_Game4_PlayersCount; i++)
+    {
+        rules::CalculateNucleationPointsCompute(m_board, m_players[i], nkPoints);
+        m_players[i].SetNucleationPointsPlane(nkPoints);
     }
 }
 
@@ -308,11 +307,16 @@ void Game4Players::RemovePiece(
 #ifdef DEBUG
     assert(a_player >= e_Game4_Player1 && a_player <= e_Game4_Player4);        
 #endif
-    
+
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
     Game4Players::RemovePiece(
         m_board,
         a_coord,
-        a_piece.GetCurrentConfiguration(),
+        pieceConf,
         m_players[a_player],
         m_playerOpponentLists[a_player]);
 
@@ -328,11 +332,16 @@ void Game4Players::PutDownPiece(
 #ifdef DEBUG
     assert(a_player >= e_Game4_Player1 && a_player <= e_Game4_Player4);        
 #endif
-    
+
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
     Game4Players::PutDownPiece(
         m_board,
         a_coord,
-        a_piece.GetCurrentConfiguration(),
+        pieceConf,
         m_players[a_player],
         m_playerOpponentLists[a_player]);
 
@@ -343,7 +352,7 @@ void Game4Players::PutDownPiece(
 void Game4Players::RemovePiece(
         Board                    &a_theBoard,
         const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf,
+        const PieceConf_t        &a_pieceConf,
         Player                   &a_playerMe,
         std::list<Player*>       &a_opponentList)
 {
@@ -355,20 +364,16 @@ void Game4Players::RemovePiece(
     assert(a_coord.m_col < a_theBoard.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piece first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < a_theBoard.GetNRows()) );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < a_theBoard.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < a_theBoard.GetNRows()) );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < a_theBoard.GetNColumns()) );
 
         assert(a_theBoard.IsPlayerInCoord(
                 thisCoord,
@@ -377,16 +382,16 @@ void Game4Players::RemovePiece(
 
         // remove the current square of the piece from the board
         a_theBoard.BlankCoord(thisCoord);
+        a_playerMe.ToggleHashKeySquare(thisCoord);
+        a_playerMe.RemoveTakenSquare(thisCoord);
     }
 
     // go through the list of squares of the piece again now that
     // the piece has been removed
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 
         // is it now a nucleation point for me or the opponents? 
         // (it couldn't be before, as it was occupied by 'me')
@@ -421,15 +426,13 @@ void Game4Players::RemovePiece(
             }
         } // for std::list<Player*>::iterator player_it
 
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. Are they still nk points for player 'me'?
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row < 0) || (thisCoord.m_col < 0)     ||
              (thisCoord.m_row >= a_theBoard.GetNRows())         ||
@@ -450,15 +453,13 @@ void Game4Players::RemovePiece(
             // removed
         	a_playerMe.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece that was just removed might also be nk points
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row < 0) || (thisCoord.m_col < 0) ||
              (thisCoord.m_row >= a_theBoard.GetNRows())     ||
@@ -481,7 +482,7 @@ void Game4Players::RemovePiece(
             // this forbidden coord is now a nk point since the piece was removed
         	a_playerMe.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
 
     // recalculate the influence area around the piece that was just removed
     rules::RecalculateInfluenceAreaAroundPieceFast(a_theBoard, a_coord, a_pieceConf, a_playerMe);
@@ -490,7 +491,7 @@ void Game4Players::RemovePiece(
 void Game4Players::PutDownPiece(
         Board                    &a_theBoard,
         const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf,
+        const PieceConf_t        &a_pieceConf,
         Player                   &a_playerMe,
         std::list<Player*>       &a_opponentList)
 {
@@ -502,20 +503,16 @@ void Game4Players::PutDownPiece(
     assert(a_coord.m_col < a_theBoard.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piece first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < a_theBoard.GetNRows()) );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < a_theBoard.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < a_theBoard.GetNRows()) );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < a_theBoard.GetNColumns()) );
 
         assert(a_theBoard.IsCoordEmpty(thisCoord));
 #endif
@@ -523,6 +520,8 @@ void Game4Players::PutDownPiece(
         a_theBoard.SetPlayerInCoord(
                 thisCoord,
         		a_playerMe);
+        a_playerMe.ToggleHashKeySquare(thisCoord);
+        a_playerMe.AddTakenSquare(thisCoord);
 
         // can't be a nucleation point of player 'me' any more
         a_playerMe.UnsetNucleationPoint(thisCoord);
@@ -537,16 +536,14 @@ void Game4Players::PutDownPiece(
             (*player_it)->UnsetInfluencedCoord(thisCoord);
         } // for std::list<Player*>::iterator player_it
         
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. If they are inside the board they will be set as
     // nucleation point. No need to compute
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row >= 0)                       &&
              (thisCoord.m_col >= 0)                       &&
@@ -559,15 +556,13 @@ void Game4Players::PutDownPiece(
             // it's ok -and faster- to set it twice
         	a_playerMe.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece can't be a valid nk point any longer
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row >= 0) &&
              (thisCoord.m_col >= 0) &&
@@ -578,12 +573,68 @@ void Game4Players::PutDownPiece(
             // to the forbidden area of the deployed piece
             a_playerMe.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
 
     // recalculate the influence area around the piece that was just put down
     rules::RecalculateInfluenceAreaAroundPieceFast(a_theBoard, a_coord, a_pieceConf, a_playerMe);
 }
 
+void Game4Players::PutDownPiece(
+        Board                    &a_theBoard,
+        const Coordinate         &a_coord,
+        const PieceConf_t        &a_pieceConf,
+        Player                   &a_playerMe,
+        std::list<Player*>       &a_opponentList,
+        UndoRecord_t             &out_undoRecord)
+{
+#ifdef DEBUG
+    assert(a_opponentList.size() <= (e_Game4_PlayersCount - 1));
+#endif
+
+    a_playerMe.SaveBoardState(out_undoRecord.playerMe);
+
+    int32_t opponentIndex = 0;
+    for (std::list<Player*>::const_iterator player_it = a_opponentList.begin();
+         player_it != a_opponentList.end();
+         player_it++)
+    {
+        (*player_it)->SaveBoardState(out_undoRecord.opponents[opponentIndex++]);
+    }
+
+    Game4Players::PutDownPiece(a_theBoard, a_coord, a_pieceConf, a_playerMe, a_opponentList);
+}
+
+void Game4Players::RemovePiece(
+        Board                    &a_theBoard,
+        const Coordinate         &a_coord,
+        const PieceConf_t        &a_pieceConf,
+        const UndoRecord_t       &a_undoRecord,
+        Player                   &a_playerMe,
+        std::list<Player*>       &a_opponentList)
+{
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
+    {
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
+#ifdef DEBUG
+        assert(a_theBoard.IsPlayerInCoord(thisCoord, a_playerMe));
+#endif
+        a_theBoard.BlankCoord(thisCoord);
+    }
+
+    // nk points, influence areas, their weights and hash keys as they were
+    // before the piece was put down. No need to compute anything
+    a_playerMe.RestoreBoardState(a_undoRecord.playerMe);
+
+    int32_t opponentIndex = 0;
+    for (std::list<Player*>::iterator player_it = a_opponentList.begin();
+         player_it != a_opponentList.end();
+         player_it++)
+    {
+        (*player_it)->RestoreBoardState(a_undoRecord.opponents[opponentIndex++]);
+    }
+}
+
 Game4Players::eGame4_Player_t Game4Players::GetNextPlayerType(eGame4_Player_t &a_player)
 {
 #ifdef DEBUG
@@ -615,3 +666,645 @@ Game4Players::eGame4_Player_t Game4Players::GetNextPlayerType(eGame4_Player_t &a
         return e_Game4_NoPlayer;
     }
 }
+
+int32_t Game4Players::MinMax(
+        Heuristic::EvalFunction_t a_heuristicMethod,
+        int32_t                   a_depth,
+        eGame4_Player_t           a_player,
+        Piece                    &out_resultPiece,
+        Coordinate               &out_coord,
+        const CancellationToken  &a_cancelToken,
+        int32_t                   a_nThreads)
+{
+#ifdef DEBUG
+    assert(a_player >= e_Game4_Player1 && a_player <= e_Game4_Player4);
+#endif
+
+    // reset output
+    out_resultPiece = Piece(e_noPiece);
+    out_coord = Coordinate();
+
+    ResetSearchStats(m_searchStats);
+    GTimer* timer = g_timer_new();
+
+    if (a_depth > GAME4PLAYERS_MAX_SEARCH_DEPTH)
+    {
+        a_depth = GAME4PLAYERS_MAX_SEARCH_DEPTH;
+    }
+    else if (a_depth < 1)
+    {
+        a_depth = 1;
+    }
+
+    if (a_nThreads > GAME4PLAYERS_MAX_SEARCH_THREADS)
+    {
+        a_nThreads = GAME4PLAYERS_MAX_SEARCH_THREADS;
+    }
+    else if (a_nThreads < 1)
+    {
+        a_nThreads = 1;
+    }
+
+    // calculate first the list of moves at the root of the tree. They are
+    // tried out in the same order no matter the number of threads, so the
+    // same move is picked in case there are 2 (or more) equally good moves
+    MoveOrdering rootMoveList(1, m_board.GetNRows() * m_board.GetNColumns(), false);
+    int32_t nRootMoves = GenerateMoves(a_player, 0, rootMoveList);
+
+    std::vector<PackedMove_t> rootMoves;
+    rootMoves.reserve(nRootMoves);
+    for (int32_t i = 0; i < nRootMoves; i++)
+    {
+        rootMoves.push_back(rootMoveList.GetMove(0, i));
+    }
+
+    m_searchStats.nodes++;
+    m_searchStats.movesGenerated += nRootMoves;
+
+    if (nRootMoves == 0)
+    {
+        // a_player can't put down any piece
+        m_searchStats.passes++;
+        m_searchStats.elapsedSeconds = g_timer_elapsed(timer, NULL);
+        g_timer_destroy(timer);
+
+        return -GAME4_INFINITE;
+    }
+
+    if (a_nThreads > nRootMoves)
+    {
+        // no point on spawning threads that won't have anything to do
+        a_nThreads = nRootMoves;
+    }
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    ParallelSearchData_t searchData;
+    searchData.game            = this;
+    searchData.heuristicMethod = a_heuristicMethod;
+    searchData.depth           = a_depth;
+    searchData.player          = a_player;
+    searchData.cancelToken     = &a_cancelToken;
+    searchData.rootMoves       = &rootMoves;
+    searchData.mutex           = g_mutex_new();
+    searchData.nextMove        = 0;
+    searchData.bestValue       = -GAME4_INFINITE;
+    searchData.bestMove        = -1;
+    searchData.searchStats     = &m_searchStats;
+
+#ifdef DEBUG
+    assert(searchData.mutex != NULL);
+#endif
+
+    GThread* workerThreads[GAME4PLAYERS_MAX_SEARCH_THREADS];
+    int32_t nThreadsCreated = 0;
+    if (a_nThreads > 1)
+    {
+        for (int32_t i = 0; i < a_nThreads; i++)
+        {
+            GError* err = NULL;
+            workerThreads[nThreadsCreated] = g_thread_create(
+                    reinterpret_cast<GThreadFunc>(Game4Players::MinMaxParallelThreadRoutine),
+                    reinterpret_cast<void*>(&searchData),
+                    TRUE, // joinable
+                    &err);
+
+            if (workerThreads[nThreadsCreated] == NULL)
+            {
+                // the rest of threads will have to do the job of this one
+                g_error_free(err);
+                continue;
+            }
+
+            nThreadsCreated++;
+        }
+    }
+
+    if (nThreadsCreated == 0)
+    {
+        // 1-thread search (or no thread could be created). Current thread
+        // will do all the work
+        MinMaxParallelThreadRoutine(reinterpret_cast<void*>(&searchData));
+    }
+
+    for (int32_t i = 0; i < nThreadsCreated; i++)
+    {
+        g_thread_join(workerThreads[i]);
+    }
+
+    g_mutex_free(searchData.mutex);
+
+    m_searchStats.elapsedSeconds = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+    if (a_cancelToken.IsCancelled())
+    {
+        // something happened and we were told to stop processing
+        // " (...) output or returned value will have unexpected
+        //   undescribed values "
+        return 0;
+    }
+
+    if (searchData.bestMove >= 0)
+    {
+        const PackedMove_t bestMove = rootMoves[searchData.bestMove];
+        const PieceConf_t &bestConf =
+            packedmove::GetConf(bestMove, PieceConfTable::Instance());
+
+        out_resultPiece = m_players[a_player].m_pieces[bestConf.pieceType];
+        out_resultPiece.SetCurrentConfiguration(*(bestConf.pieceConf));
+        packedmove::ToCoordinate(bestMove, m_board.GetNColumns(), out_coord);
+    }
+
+    return searchData.bestValue;
+}
+
+void* Game4Players::MinMaxParallelThreadRoutine(void *a_threadParam)
+{
+    ParallelSearchData_t* searchData =
+            reinterpret_cast<ParallelSearchData_t*>(a_threadParam);
+
+    // local copy of the game. It will be modified while this thread explores
+    // the search tree, and restored after every root move
+    Game4Players localGame(*(searchData->game));
+
+    // statistics of the part of the search tree visited by this thread
+    SearchStats_t searchStats;
+    ResetSearchStats(searchStats);
+
+    // lists of moves, killer moves and history of this thread
+    MoveOrdering moveOrdering(
+            searchData->depth,
+            localGame.m_board.GetNRows() * localGame.m_board.GetNColumns());
+
+    // cancellation requests are read once every CANCELLATION_CHECKPOINT_INTERVAL nodes
+    // of the search tree, and before every root move
+    CancellationCheckpoint checkpoint(*(searchData->cancelToken));
+
+    eGame4_Player_t rootPlayer = searchData->player;
+    eGame4_Player_t nextPlayer = GetNextPlayerType(rootPlayer);
+
+    const std::vector<PackedMove_t> &rootMoves = *(searchData->rootMoves);
+    const int32_t nRootMoves = static_cast<int32_t>(rootMoves.size());
+
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    while (!checkpoint.Check())
+    {
+        // get next move to be evaluated and the alpha to evaluate it with
+        g_mutex_lock(searchData->mutex);
+        int32_t thisMoveIndex = searchData->nextMove++;
+        int32_t alpha = searchData->bestValue;
+        g_mutex_unlock(searchData->mutex);
+
+        if (thisMoveIndex >= nRootMoves)
+        {
+            // no more moves to be evaluated
+            break;
+        }
+
+        // alpha is decremented by 1 so a move as good as the current best
+        // one gets its exact value. The first move (in rootMoves order) with
+        // the best value is picked even if moves are not evaluated in order
+        if (alpha > -GAME4_INFINITE)
+        {
+            alpha--;
+        }
+
+        const PackedMove_t thisMove = rootMoves[thisMoveIndex];
+        const PieceConf_t &thisConf = packedmove::GetConf(thisMove, confTable);
+        Coordinate thisCoord;
+        packedmove::ToCoordinate(thisMove, localGame.m_board.GetNColumns(), thisCoord);
+
+        localGame.m_players[rootPlayer].UnsetPiece(thisConf.pieceType);
+
+        UndoRecord_t undoRecord;
+        Game4Players::PutDownPiece(
+                localGame.m_board,
+                thisCoord,
+                thisConf,
+                localGame.m_players[rootPlayer],
+                localGame.m_playerOpponentLists[rootPlayer],
+                undoRecord);
+        searchStats.movesTried++;
+
+        int32_t value = localGame.ParanoidAlphaBetaCompute(
+                            searchData->heuristicMethod,
+                            rootPlayer,
+                            nextPlayer,
+                            1,
+                            searchData->depth - 1,
+                            0,
+                            alpha,
+                            GAME4_INFINITE,
+                            checkpoint,
+                            moveOrdering,
+                            searchStats);
+
+        Game4Players::RemovePiece(
+                localGame.m_board,
+                thisCoord,
+                thisConf,
+                undoRecord,
+                localGame.m_players[rootPlayer],
+                localGame.m_playerOpponentLists[rootPlayer]);
+        localGame.m_players[rootPlayer].SetPiece(thisConf.pieceType);
+
+        g_mutex_lock(searchData->mutex);
+        // value is only an upper bound if it is not bigger than alpha
+        if ( !checkpoint.IsCancelled() &&
+             (value > alpha) &&
+             ( (value > searchData->bestValue) ||
+               ( (value == searchData->bestValue) &&
+                 (thisMoveIndex < searchData->bestMove) ) ) )
+        {
+            searchData->bestValue = value;
+            searchData->bestMove  = thisMoveIndex;
+        }
+        g_mutex_unlock(searchData->mutex);
+    } // while (!checkpoint.Check())
+
+    g_mutex_lock(searchData->mutex);
+    Game4Players::AddSearchStats(searchStats, *(searchData->searchStats));
+    g_mutex_unlock(searchData->mutex);
+
+    return NULL;
+}
+
+int32_t Game4Players::ParanoidAlphaBetaCompute(
+        Heuristic::EvalFunction_t a_heuristicMethod,
+        eGame4_Player_t           a_rootPlayer,
+        eGame4_Player_t           a_player,
+        int32_t                   a_ply,
+        int32_t                   a_depth,
+        int32_t                   a_nPasses,
+        int32_t                   alpha,
+        int32_t                   beta,
+        CancellationCheckpoint   &in_out_checkpoint,
+        MoveOrdering             &in_out_moveOrdering,
+        SearchStats_t            &in_out_searchStats)
+{
+    in_out_searchStats.nodes++;
+
+    if (in_out_checkpoint.Poll())
+    {
+        // the search was cancelled. The value returned here will be discarded
+        // by the caller anyway
+        return 0;
+    }
+
+    if ( (a_depth <= 0) || (a_nPasses >= e_Game4_PlayersCount) )
+    {
+        // end of the tree, or none of the players can put down a piece
+        in_out_searchStats.leafEvaluations += e_Game4_PlayersCount - 1;
+        return Evaluate(a_heuristicMethod, a_rootPlayer);
+    }
+
+    eGame4_Player_t nextPlayer = GetNextPlayerType(a_player);
+
+    int32_t nMoves = GenerateMoves(a_player, a_ply, in_out_moveOrdering);
+    in_out_searchStats.movesGenerated += nMoves;
+
+    if (nMoves == 0)
+    {
+        // this player must pass. The next one moves in the next level of the tree
+        in_out_searchStats.passes++;
+        return ParanoidAlphaBetaCompute(
+                    a_heuristicMethod,
+                    a_rootPlayer,
+                    nextPlayer,
+                    a_ply + 1,
+                    a_depth - 1,
+                    a_nPasses + 1,
+                    alpha,
+                    beta,
+                    in_out_checkpoint,
+                    in_out_moveOrdering,
+                    in_out_searchStats);
+    }
+
+    in_out_moveOrdering.SortMoves(a_ply);
+
+    // the player the search is run for maximises. Its opponents minimise
+    const bool maxNode = (a_player == a_rootPlayer);
+
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    for (int32_t moveIt = 0; moveIt < nMoves; moveIt++)
+    {
+        PackedMove_t thisMove = in_out_moveOrdering.GetMove(a_ply, moveIt);
+        const PieceConf_t &thisConf = packedmove::GetConf(thisMove, confTable);
+        Coordinate thisCoord;
+        packedmove::ToCoordinate(thisMove, m_board.GetNColumns(), thisCoord);
+
+        m_players[a_player].UnsetPiece(thisConf.pieceType);
+
+        UndoRecord_t undoRecord;
+        Game4Players::PutDownPiece(
+                m_board,
+                thisCoord,
+                thisConf,
+                m_players[a_player],
+                m_playerOpponentLists[a_player],
+                undoRecord);
+        in_out_searchStats.movesTried++;
+
+        int32_t value = ParanoidAlphaBetaCompute(
+                            a_heuristicMethod,
+                            a_rootPlayer,
+                            nextPlayer,
+                            a_ply + 1,
+                            a_depth - 1,
+                            0,
+                            alpha,
+                            beta,
+                            in_out_checkpoint,
+                            in_out_moveOrdering,
+                            in_out_searchStats);
+
+        Game4Players::RemovePiece(
+                m_board,
+                thisCoord,
+                thisConf,
+                undoRecord,
+                m_players[a_player],
+                m_playerOpponentLists[a_player]);
+        m_players[a_player].SetPiece(thisConf.pieceType);
+
+        if (in_out_checkpoint.IsCancelled())
+        {
+            // the value of this subtree is not valid
+            return 0;
+        }
+
+        if (maxNode && (value > alpha))
+        {
+            alpha = value;
+            if (alpha >= beta)
+            {
+                in_out_searchStats.cutoffs++;
+                in_out_moveOrdering.SaveCutoff(a_ply, thisMove, a_depth);
+                return beta;
+            }
+        }
+        else if (!maxNode && (value < beta))
+        {
+            beta = value;
+            if (beta <= alpha)
+            {
+                in_out_searchStats.cutoffs++;
+                in_out_moveOrdering.SaveCutoff(a_ply, thisMove, a_depth);
+                return alpha;
+            }
+        }
+    } // for (int32_t moveIt = 0; moveIt < nMoves; moveIt++)
+
+    return maxNode ? alpha : beta;
+}
+
+int32_t Game4Players::GenerateMoves(
+        eGame4_Player_t  a_player,
+        int32_t          a_ply,
+        MoveOrdering    &a_moveOrdering) const
+{
+    const Player &player = m_players[a_player];
+
+    a_moveOrdering.ClearMoves(a_ply);
+
+    if (player.NumberOfPiecesAvailable() == 0)
+    {
+        return 0;
+    }
+
+    // the piece must touch a nk point or the starting point (as long
+    // as nobody has put down a piece on it)
+    Bitboard mustTouchPlane = player.GetNucleationPointsPlane();
+    const Coordinate &startingCoord = player.GetStartingCoordinate();
+    if (startingCoord.Initialised() && m_board.IsCoordEmpty(startingCoord))
+    {
+        mustTouchPlane.Set(m_board.CoordToIndex(startingCoord));
+    }
+
+    if (mustTouchPlane.IsEmpty())
+    {
+        return 0;
+    }
+
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    // will contain the valid coords of each piece configuration
+    Bitboard validCoords;
+
+    int32_t nMoves = 0;
+    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    {
+        if ( (player.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false) ||
+             ( (player.m_pieces[i].GetNSquares() < 5) &&
+               (player.NumberOfPiecesAvailable() > (e_numberOfPieces - MIN_5SQUARE_PIECES_AT_START)) &&
+               (nMoves > 0) ) )
+        {
+            // piece is not available OR it should be ignored (small pieces
+            // are not put down at the start of the game)
+            continue;
+        }
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            // retrieve all the valid coords of this piece configuration at once
+            rules::CalculateValidCoordsInBoard(
+                m_board,
+                player,
+                pieceConf,
+                mustTouchPlane,
+                validCoords);
+
+            // from the middle of the board to the edges
+            int32_t ring;
+            for (int32_t index = m_board.GetFirstIndexSpiral(validCoords, ring);
+                 index >= 0;
+                 index = m_board.GetNextIndexSpiral(validCoords, ring, index))
+            {
+                a_moveOrdering.AddMove(
+                    a_ply,
+                    packedmove::Pack(pieceConf.pieceType, pieceConf.confIndex, index));
+                nMoves++;
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
+    } // for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+
+    return nMoves;
+}
+
+int32_t Game4Players::Evaluate(
+        Heuristic::EvalFunction_t a_heuristicMethod,
+        eGame4_Player_t           a_rootPlayer) const
+{
+    int32_t value = 0;
+    for (std::list<Player*>::const_iterator player_it = m_playerOpponentLists[a_rootPlayer].begin();
+         player_it != m_playerOpponentLists[a_rootPlayer].end();
+         player_it++)
+    {
+        value += a_heuristicMethod(m_board, m_players[a_rootPlayer], *(*player_it));
+    }
+
+    return value;
+}
+
+int32_t Game4Players::MinMaxIterativeDeepening(
+        Heuristic::EvalFunction_t a_heuristicMethod,
+        int32_t                   a_maxDepth,
+        int32_t                   a_timeBudgetMs,
+        eGame4_Player_t           a_player,
+        Piece                    &out_resultPiece,
+        Coordinate               &out_coord,
+        int32_t                  &out_depthReached,
+        const CancellationToken  &a_cancelToken,
+        int32_t                   a_nThreads)
+{
+    if (a_maxDepth > GAME4PLAYERS_MAX_SEARCH_DEPTH)
+    {
+        a_maxDepth = GAME4PLAYERS_MAX_SEARCH_DEPTH;
+    }
+    else if (a_maxDepth < 1)
+    {
+        a_maxDepth = 1;
+    }
+
+    // the watchdog cancels its token when the time runs out, which cancels the
+    // iteration being calculated at that moment. The token is linked to the one
+    // of the caller, so the iteration is also cancelled with it
+    DeadlineWatchdog watchdog(a_cancelToken);
+    if ( (a_timeBudgetMs > 0) && (a_maxDepth > 1) )
+    {
+        if (!watchdog.Start(a_timeBudgetMs))
+        {
+            // deeper iterations couldn't be cancelled when the time runs out.
+            // Only depth 1 will be searched so the budget is not blown
+            a_maxDepth = 1;
+        }
+    }
+
+    // measures how long each iteration takes
+    GTimer* timer = g_timer_new();
+
+    // reset output
+    out_resultPiece  = Piece(e_noPiece);
+    out_coord        = Coordinate();
+    out_depthReached = 0;
+
+    // statistics of all the iterations, the cancelled one included
+    SearchStats_t searchStats;
+    ResetSearchStats(searchStats);
+
+    bool cancelled = false;
+    int32_t rv = -GAME4_INFINITE;
+
+    for (int32_t depth = 1; depth <= a_maxDepth; depth++)
+    {
+        gdouble iterationStart = g_timer_elapsed(timer, NULL);
+
+        // depth 1 is always completed. Deeper iterations can be cancelled by the watchdog
+        const CancellationToken &iterationToken =
+            ( (depth == 1) || !watchdog.IsStarted() ) ?
+                    a_cancelToken : watchdog.GetToken();
+
+        Piece thisPiece(e_noPiece);
+        Coordinate thisCoord;
+        int32_t thisValue = MinMax(
+                                a_heuristicMethod,
+                                depth,
+                                a_player,
+                                thisPiece,
+                                thisCoord,
+                                iterationToken,
+                                a_nThreads);
+        AddSearchStats(m_searchStats, searchStats);
+
+        if (a_cancelToken.IsCancelled())
+        {
+            // " (...) output or returned value will have unexpected
+            //   undescribed values "
+            cancelled = true;
+            break;
+        }
+
+        if (iterationToken.IsCancelled())
+        {
+            // the time ran out before this iteration was completed.
+            // Its result is discarded
+            break;
+        }
+
+        rv               = thisValue;
+        out_resultPiece  = thisPiece;
+        out_coord        = thisCoord;
+        out_depthReached = depth;
+
+        if (thisPiece.GetType() == e_noPiece)
+        {
+            // no piece can be put down. Deeper searches won't change that
+            break;
+        }
+
+        if (watchdog.IsStarted())
+        {
+            // the next iteration will take longer than this one. There's no point
+            // on starting it if there isn't at least that much time left
+            gdouble elapsed = g_timer_elapsed(timer, NULL);
+            if (((2 * elapsed) - iterationStart) * 1000 >= a_timeBudgetMs)
+            {
+                break;
+            }
+        }
+    } // for (int32_t depth = 1; depth <= a_maxDepth; depth++)
+
+    g_timer_destroy(timer);
+    watchdog.Stop();
+
+    m_searchStats = searchStats;
+
+    if (cancelled)
+    {
+        return 0;
+    }
+
+    return rv;
+}
+
+const Game4Players::SearchStats_t& Game4Players::GetSearchStats() const
+{
+    return m_searchStats;
+}
+
+void Game4Players::ResetSearchStats(SearchStats_t &out_stats)
+{
+    out_stats.nodes           = 0;
+    out_stats.leafEvaluations = 0;
+    out_stats.cutoffs         = 0;
+    out_stats.movesGenerated  = 0;
+    out_stats.movesTried      = 0;
+    out_stats.passes          = 0;
+    out_stats.elapsedSeconds  = 0.0;
+}
+
+void Game4Players::AddSearchStats(const SearchStats_t &a_stats, SearchStats_t &in_out_stats)
+{
+    in_out_stats.nodes           += a_stats.nodes;
+    in_out_stats.leafEvaluations += a_stats.leafEvaluations;
+    in_out_stats.cutoffs         += a_stats.cutoffs;
+    in_out_stats.movesGenerated  += a_stats.movesGenerated;
+    in_out_stats.movesTried      += a_stats.movesTried;
+    in_out_stats.passes          += a_stats.passes;
+    in_out_stats.elapsedSeconds  += a_stats.elapsedSeconds;
+}
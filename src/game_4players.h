@@ -23,6 +23,7 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 15-Nov-2010  Original development
+///           agent              17-Oct-2026  Paranoid search (MinMax) with iterative deepening
 /// @endhistory
 ///
 // ============================================================================
@@ -30,10 +31,24 @@
 #ifndef __GAME_4PLAYERS_H__
 #define __GAME_4PLAYERS_H__
 
+#include <list>
+#include <vector>
+#include <glib.h>   // glib-2.0/glib.h (threads used by parallel MinMax)
 #include "player.h"
 #include "board.h"
 #include "coordinate.h"
 #include "blockem_challenge.h"
+#include "heuristic.h"
+#include "packed_move.h"
+#include "move_ordering.h"
+#include "cancellation_token.h"
+
+/// maximum number of threads a single 4 players MinMax search can be split into
+const int32_t GAME4PLAYERS_MAX_SEARCH_THREADS = 64;
+
+/// maximum depth of the 4 players search tree (every player puts down all
+/// their pieces). MinMax keeps per-level data in arrays of this size
+const int32_t GAME4PLAYERS_MAX_SEARCH_DEPTH = 4 * e_numberOfPieces;
 
 /// @brief A Game in which 4 players try to allocate all their pieces
 class Game4Players
@@ -53,11 +68,36 @@ public:
         e_Game4_PlayersCount = e_Game4_NoPlayer,
     } eGame4_Player_t;
 
+    /// @brief statistics of a 4 players MinMax search
+    typedef struct
+    {
+        /// nodes of the search tree visited (the root included)
+        uint64_t nodes;
+        /// calls to the evaluation function (one per opponent of the
+        /// player the search is run for)
+        uint64_t leafEvaluations;
+        /// cutoffs (max and min nodes)
+        uint64_t cutoffs;
+        /// moves found by the move generator
+        uint64_t movesGenerated;
+        /// moves put down on the board and searched
+        uint64_t movesTried;
+        /// nodes where the player to move couldn't put down any piece
+        uint64_t passes;
+        /// time the search took (in seconds)
+        double   elapsedSeconds;
+    } SearchStats_t;
+
 	/// @brief builds the game
 	/// It creates a board and a 4 players
     Game4Players();
+    /// copy constructor. The opponent lists of the new object point to its own players
+    Game4Players(const Game4Players &a_src);
     virtual ~Game4Players();
 
+    /// operator=. The opponent lists of the object point to its own players
+    Game4Players& operator=(const Game4Players &a_src);
+
 	/// @returns the board of the game
 	inline const Board& GetBoard() const
 	{
@@ -124,7 +164,101 @@ public:
     /// lead to unexpected behaviour
     static eGame4_Player_t GetNextPlayerType(eGame4_Player_t &a_player);
 
+    /// @brief calculates the next piece to be put down by a_player using the paranoid
+    ///        version of the minimax algorithm (with alpha beta pruning)
+    /// a_player maximises the value of the positions, and the 3 opponents are supposed
+    /// to play together against it, minimising it. Positions are evaluated by calling
+    /// the heuristic once per opponent (a_player as 'me' and the opponent as 'opponent')
+    /// and adding up the results. Players move in the order set by GetNextPlayerType,
+    /// and a player who can't put down any piece passes (it takes up one level of the
+    /// tree). Nucleation points and influence areas are updated incrementally as
+    /// pieces are put down, and restored from an undo record when they are removed
+    /// @param the heuristic method positions are evaluated with
+    /// @param maximum depth for the search tree. Capped to GAME4PLAYERS_MAX_SEARCH_DEPTH
+    /// @param player whose move is to be calculated
+    /// @param the piece to be put down. e_noPiece if a_player can't put down any piece
+    /// @param ABSOLUTE coord where the piece should be put down
+    /// @param cancelled by another thread to stop processing. Output and returned
+    ///        value will be undefined if that happens
+    /// @param number of threads the root of the tree is split into. Capped to
+    ///        GAME4PLAYERS_MAX_SEARCH_THREADS. The result doesn't depend on it
+    /// @return the value of the move (-INFINITE if no piece can be put down)
+    int32_t MinMax(
+            Heuristic::EvalFunction_t a_heuristicMethod,
+            int32_t                   a_depth,
+            eGame4_Player_t           a_player,
+            Piece                    &out_resultPiece,
+            Coordinate               &out_coord,
+            const CancellationToken  &a_cancelToken,
+            int32_t                   a_nThreads = 1);
+
+    /// @brief MinMax with iterative deepening limited by a time budget
+    /// It calls MinMax with depth 1, 2, 3... until a_maxDepth is reached or a_timeBudgetMs
+    /// runs out. The move of the deepest completed iteration is returned. Depth 1 is
+    /// always completed. Deeper iterations are cancelled when the time runs out
+    /// @param the heuristic method positions are evaluated with
+    /// @param maximum depth for the search tree. Capped to GAME4PLAYERS_MAX_SEARCH_DEPTH
+    /// @param time budget (in milliseconds). 0 or less means no limit
+    /// @param player whose move is to be calculated
+    /// @param the piece to be put down. e_noPiece if a_player can't put down any piece
+    /// @param ABSOLUTE coord where the piece should be put down
+    /// @param depth of the deepest completed iteration
+    /// @param cancelled by another thread to stop processing (see MinMax)
+    /// @param number of threads the root of each iteration is split into
+    /// @return the value of the move returned
+    int32_t MinMaxIterativeDeepening(
+            Heuristic::EvalFunction_t a_heuristicMethod,
+            int32_t                   a_maxDepth,
+            int32_t                   a_timeBudgetMs,
+            eGame4_Player_t           a_player,
+            Piece                    &out_resultPiece,
+            Coordinate               &out_coord,
+            int32_t                  &out_depthReached,
+            const CancellationToken  &a_cancelToken,
+            int32_t                   a_nThreads = 1);
+
+    /// @return statistics of the latest call to MinMax (all its threads included) or
+    ///         MinMaxIterativeDeepening (all its iterations included)
+    const SearchStats_t& GetSearchStats() const;
+
+    /// @brief sets all the counters of out_stats to 0
+    static void ResetSearchStats(SearchStats_t &out_stats);
+
+    /// @brief adds the counters of a_stats to in_out_stats
+    static void AddSearchStats(const SearchStats_t &a_stats, SearchStats_t &in_out_stats);
+
 private:
+    /// @brief data shared by all the worker threads of MinMax
+    /// everything below m_mutex (included) must be accessed holding the mutex
+    typedef struct
+    {
+        /// the game whose move is being calculated. Copied by each worker thread
+        const Game4Players*              game;
+        /// the heuristic method for the min max algorithm
+        Heuristic::EvalFunction_t        heuristicMethod;
+        /// maximum depth for the search tree
+        int32_t                          depth;
+        /// player whose move is being calculated
+        eGame4_Player_t                  player;
+        /// cancelled by another thread to stop processing. Each worker
+        /// thread checks it through its own CancellationCheckpoint
+        const CancellationToken*         cancelToken;
+        /// list of moves at the root of the tree in the same order they are
+        /// tried out by the 1-thread search
+        const std::vector<PackedMove_t>* rootMoves;
+
+        /// protects the rest of the members of the structure
+        GMutex*                          mutex;
+        /// index of the next root move to be handed out
+        int32_t                          nextMove;
+        /// best value found so far. It is the alpha shared by all threads
+        int32_t                          bestValue;
+        /// index (in rootMoves) of the move which got bestValue. -1 if none
+        int32_t                          bestMove;
+        /// statistics of the search. Every thread adds its own ones
+        SearchStats_t*                   searchStats;
+    } ParallelSearchData_t;
+
     /// The blockem board where the game will be played
     Board m_board;
 
@@ -134,6 +268,9 @@ private:
     
     /// list of opponents for each one of the players
     std::list<Player*> m_playerOpponentLists[4];
+
+    /// statistics of the latest search (see GetSearchStats)
+    SearchStats_t m_searchStats;
     
     /// @brief recalculate the nucleation points using the whole board
     /// Save each nk point found into the corresponding player
@@ -142,6 +279,62 @@ private:
     /// @brief loads opponent lists with pointers to player instances
     void ResetOpponentLists();
 
+    /// @brief saves into a_moveOrdering (list of a_ply) all the moves a_player can make
+    /// Pieces are tried from the biggest to the smallest, and the coords of each
+    /// configuration from the middle of the board to the edges. Pieces smaller than
+    /// 5 squares are skipped at the start of the game if a bigger one fits
+    /// @return number of moves saved
+    int32_t GenerateMoves(
+            eGame4_Player_t  a_player,
+            int32_t          a_ply,
+            MoveOrdering    &a_moveOrdering) const;
+
+    /// @brief the paranoid alpha beta algorithm (see MinMax)
+    /// It is run on a copy of the game, which is modified while the tree is explored
+    /// and restored before returning
+    /// @param the heuristic method positions are evaluated with
+    /// @param player the search is run for (max nodes)
+    /// @param player who puts down a piece in this node
+    /// @param ply of this node. The root of the search tree is ply 0
+    /// @param depth left
+    /// @param number of players in a row who passed right before this node
+    /// @param alpha and beta. Values returned are always inside [alpha, beta]
+    /// @param polled once per node to know if the search was cancelled
+    /// @param lists of moves, killer moves and history
+    /// @param statistics of the search
+    int32_t ParanoidAlphaBetaCompute(
+            Heuristic::EvalFunction_t a_heuristicMethod,
+            eGame4_Player_t           a_rootPlayer,
+            eGame4_Player_t           a_player,
+            int32_t                   a_ply,
+            int32_t                   a_depth,
+            int32_t                   a_nPasses,
+            int32_t                   alpha,
+            int32_t                   beta,
+            CancellationCheckpoint   &in_out_checkpoint,
+            MoveOrdering             &in_out_moveOrdering,
+            SearchStats_t            &in_out_searchStats);
+
+    /// @return the value of the current position for a_rootPlayer (the result of
+    ///         the heuristic against each one of its opponents added up)
+    int32_t Evaluate(
+            Heuristic::EvalFunction_t a_heuristicMethod,
+            eGame4_Player_t           a_rootPlayer) const;
+
+    /// The routine run by each one of the worker threads of MinMax
+    /// @param pointer to the ParallelSearchData_t shared by all worker threads
+    static void* MinMaxParallelThreadRoutine(void *a_threadParam);
+
+    /// @brief what PutDownPiece changes in the players. It is saved before the piece is
+    /// put down, so RemovePiece can restore the players exactly as they were instead of
+    /// calculating again the nk points and influence areas around the piece. The states
+    /// of the opponents are saved in the same order they are in the list of opponents
+    typedef struct
+    {
+        Player::BoardState_t playerMe;
+        Player::BoardState_t opponents[e_Game4_PlayersCount - 1];
+    } UndoRecord_t;
+
     /// remove a piece from the board. The user is supposed to check if the piece was there
     /// before calling this function since it just will set to empty the squares
 	/// @param the board
@@ -152,7 +345,7 @@ private:
     static void RemovePiece(
             Board                    &a_theBoard,
             const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf,
+            const PieceConf_t        &a_pieceConf,
             Player                   &a_playerMe,
             std::list<Player*>       &a_opponentList);
      
@@ -166,7 +359,30 @@ private:
     static void PutDownPiece(
             Board                    &a_theBoard,
             const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf,
+            const PieceConf_t        &a_pieceConf,
+            Player                   &a_playerMe,
+            std::list<Player*>       &a_opponentList);
+
+    /// @brief same as PutDownPiece, but what it changes in the players is saved into
+    /// out_undoRecord first, so the piece can be removed with the RemovePiece below
+    static void PutDownPiece(
+            Board                    &a_theBoard,
+            const Coordinate         &a_coord,
+            const PieceConf_t        &a_pieceConf,
+            Player                   &a_playerMe,
+            std::list<Player*>       &a_opponentList,
+            UndoRecord_t             &out_undoRecord);
+
+    /// @brief removes a piece put down with the PutDownPiece above. The squares of the
+    /// piece are blanked out and every player is restored from a_undoRecord, so the board
+    /// and the players end up exactly as they were before the piece was put down. The
+    /// pieces available and the list of opponents must be the same as when the piece
+    /// was put down
+    static void RemovePiece(
+            Board                    &a_theBoard,
+            const Coordinate         &a_coord,
+            const PieceConf_t        &a_pieceConf,
+            const UndoRecord_t       &a_undoRecord,
             Player                   &a_playerMe,
             std::list<Player*>       &a_opponentList);
 };
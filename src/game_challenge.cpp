@@ -23,6 +23,8 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 08-Oct-2010  Original development
+///           agent              17-Oct-2026  NK points recalculated with bit planes
+///           agent              17-Oct-2026  Parallel Solve with pruning of unreachable regions
 /// @endhistory
 ///
 // ============================================================================
@@ -31,6 +33,7 @@
 #include "gettext.h" // i18n
 #include "game_challenge.h"
 #include "rules.h"
+#include "deadline_watchdog.h"
 
 /// challenger's name
 static const char PLAYER_CHALLENGER_NAME[] = N_("Mr Green");
@@ -66,6 +69,10 @@ GameChallenge::GameChallenge(
             a_challenge.GetBoardColumns(),
             Coordinate())
 {
+    m_solverStats.nodes       = 0;
+    m_solverStats.prunedNodes = 0;
+    m_solverStats.completed   = false;
+
     // load challenge data into this object attributes
     LoadChallenge(a_challenge);
 }
@@ -163,25 +170,9 @@ void GameChallenge::LoadChallenge(const BlockemChallenge& a_challenge)
 
 void GameChallenge::RecalculateNKInAllBoard()
 {
-    Coordinate thisCoord;
-    for (thisCoord.m_row = 0 ;
-         thisCoord.m_row < m_board.GetNRows();
-         thisCoord.m_row++)
-    {
-        for (thisCoord.m_col = 0 ;
-             thisCoord.m_col < m_board.GetNColumns();
-             thisCoord.m_col++)
-        {
-            if (rules::IsNucleationPointCompute(m_board, m_challenger, thisCoord))
-            {
-                m_challenger.SetNucleationPoint(thisCoord);
-            }
-            else
-            {
-                m_challenger.UnsetNucleationPoint(thisCoord);
-            }
-        }
-    }
+    Bitboard nkPoints;
+    rules::CalculateNucleationPointsCompute(m_board, m_challenger, nkPoints);
+    m_challenger.SetNucleationPointsPlane(nkPoints);
 }
 
 void GameChallenge::Reset(const BlockemChallenge& a_challenge)
@@ -228,9 +219,12 @@ void GameChallenge::RemovePiece(
         const Piece      &a_piece,
         const Coordinate &a_coord)
 {
-    RemovePiece(
-        a_coord,
-        a_piece.GetCurrentConfiguration());
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
+    RemovePiece(a_coord, pieceConf);
 
     // piece is again available
     m_challenger.SetPiece(a_piece.GetType());
@@ -240,17 +234,20 @@ void GameChallenge::PutDownPiece(
         const Piece      &a_piece,
         const Coordinate &a_coord)
 {
-    PutDownPiece(
-        a_coord,
-        a_piece.GetCurrentConfiguration());
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
+    PutDownPiece(a_coord, pieceConf);
 
     // piece is not available now
     m_challenger.UnsetPiece(a_piece.GetType());
 }
 
 void GameChallenge::RemovePiece(
-        const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf)
+        const Coordinate  &a_coord,
+        const PieceConf_t &a_pieceConf)
 {
 #ifdef DEBUG
     assert(a_coord.m_row >= 0);
@@ -260,20 +257,16 @@ void GameChallenge::RemovePiece(
     assert(a_coord.m_col < m_board.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piece first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < m_board.GetNRows())    );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < m_board.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < m_board.GetNRows())    );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < m_board.GetNColumns()) );
 
         assert(m_board.IsPlayerInCoord(thisCoord, m_challenger));
 #endif
@@ -283,12 +276,10 @@ void GameChallenge::RemovePiece(
 
     // go through the list of squares of the piece again, now that
     // the piece has been removed
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 
         // thisCoord is now empty
         // is it now a nucleation point for player? (it couldn't be before, as it was occupied)
@@ -299,15 +290,13 @@ void GameChallenge::RemovePiece(
         {
         	m_challenger.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. Are they still nk points for m_challenger?
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row < 0) ||(thisCoord.m_col < 0)    ||
              (thisCoord.m_row >= m_board.GetNRows())          ||
@@ -328,15 +317,13 @@ void GameChallenge::RemovePiece(
             // removed
         	m_challenger.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece that was just removed might also be nk points
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row < 0) || (thisCoord.m_col < 0) ||
              (thisCoord.m_row >= m_board.GetNRows())        ||
@@ -359,12 +346,12 @@ void GameChallenge::RemovePiece(
             // this forbidden coord is now a nk point since the piece was removed
         	m_challenger.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
 }
 
 void GameChallenge::PutDownPiece(
-        const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf)
+        const Coordinate  &a_coord,
+        const PieceConf_t &a_pieceConf)
 {
 #ifdef DEBUG
     assert(a_coord.m_row >= 0);
@@ -374,36 +361,30 @@ void GameChallenge::PutDownPiece(
     assert(a_coord.m_col < m_board.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piecee first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < m_board.GetNRows())    );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < m_board.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < m_board.GetNRows())    );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < m_board.GetNColumns()) );
 
         assert(m_board.IsCoordEmpty(thisCoord));
 #endif
 
         m_board.SetPlayerInCoord(thisCoord,	m_challenger);
         m_challenger.UnsetNucleationPoint(thisCoord);
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. If they are inside the board they will 
     // be checked in case they are touching challenger's pieces
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row >= 0)                    &&
              (thisCoord.m_col >= 0)                    &&
@@ -416,15 +397,13 @@ void GameChallenge::PutDownPiece(
             // it's ok -and faster- to set it twice
         	m_challenger.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece can't be a valid nk point any longer
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row >= 0)                    &&
              (thisCoord.m_col >= 0)                    &&
@@ -435,5 +414,497 @@ void GameChallenge::PutDownPiece(
             // to the forbidden area of the deployed piece
             m_challenger.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
+}
+
+bool GameChallenge::Solve(
+        int32_t                  a_nThreads,
+        int32_t                  a_timeBudgetMs,
+        const CancellationToken &a_cancelToken)
+{
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    m_solverStats.nodes       = 0;
+    m_solverStats.prunedNodes = 0;
+    m_solverStats.completed   = true;
+
+    if (m_challenger.NumberOfPiecesAvailable() == 0)
+    {
+        // nothing to be put down. Challenge is already solved
+        return true;
+    }
+
+    if (a_nThreads > GAME_CHALLENGE_MAX_THREADS)
+    {
+        a_nThreads = GAME_CHALLENGE_MAX_THREADS;
+    }
+
+    // the first piece must be put down on the nk points of the squares already
+    // taken by the challenger. If there are none of them it must be put down on the
+    // starting coordinate, or anywhere on the board if there isn't a starting coordinate
+    const Bitboard rootNkPoints = m_challenger.GetNucleationPointsPlane();
+    Bitboard mustTouchPlane;
+    if (!m_board.GetPlayerPlane(m_challenger).IsEmpty())
+    {
+        mustTouchPlane = rootNkPoints;
+    }
+    else if (m_challenger.GetStartingCoordinate().Initialised())
+    {
+        if (m_board.IsCoordEmpty(m_challenger.GetStartingCoordinate()))
+        {
+            mustTouchPlane.Set(m_board.CoordToIndex(m_challenger.GetStartingCoordinate()));
+        }
+    }
+    else
+    {
+        mustTouchPlane = m_board.GetEmptyPlane();
+    }
+
+    if (!IsRegionBigEnough(mustTouchPlane))
+    {
+        m_solverStats.prunedNodes++;
+        return false;
+    }
+
+    // list of placements of the first piece. Since valid coords are calculated all
+    // at once for the whole board the same placement can't be saved twice
+    std::vector<rules::Move_t> rootMoves;
+    Bitboard validCoords;
+    for (int32_t currentPiece = e_numberOfPieces - 1;
+         currentPiece >= e_minimumPieceIndex;
+         currentPiece--)
+    {
+        if (!m_challenger.IsPieceAvailable(static_cast<ePieceType_t>(currentPiece)))
+        {
+            continue;
+        }
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            rules::CalculateValidCoordsInBoard(
+                    m_board,
+                    m_challenger,
+                    pieceConf,
+                    mustTouchPlane,
+                    validCoords);
+
+            for (int32_t index = validCoords.NextSetBit(0);
+                 index >= 0;
+                 index = validCoords.NextSetBit(index + 1))
+            {
+                rules::Move_t thisMove;
+                thisMove.pieceType = static_cast<ePieceType_t>(currentPiece);
+                thisMove.confIndex = pieceConf.confIndex;
+                thisMove.pieceConf = &pieceConf;
+                Bitboard::IndexToCoord(index, m_board.GetNColumns(), thisMove.coord);
+
+                rootMoves.push_back(thisMove);
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(currentPiece)
+    } // for (int32_t currentPiece = e_numberOfPieces - 1;
+
+    if (a_nThreads > static_cast<int32_t>(rootMoves.size()))
+    {
+        // no point on spawning threads that won't have anything to do
+        a_nThreads = static_cast<int32_t>(rootMoves.size());
+    }
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    // the watchdog cancels its token when the time runs out. The token is
+    // linked to the one of the caller, so the search is also cancelled with it.
+    // If the watchdog can't be started the search will run till it is finished
+    // (or cancelled by the caller)
+    DeadlineWatchdog watchdog(a_cancelToken);
+    if ( (a_timeBudgetMs > 0) && (!rootMoves.empty()) )
+    {
+        watchdog.Start(a_timeBudgetMs);
+    }
+
+    // cancelled by the first worker thread to find a solution. It is linked to
+    // the deadline token so the search can be stopped from outside too
+    CancellationToken solveToken(&(watchdog.GetToken()));
+
+    ParallelSolveData_t solveData;
+    solveData.rootMoves          = &rootMoves;
+    solveData.rootNkPoints       = &rootNkPoints;
+    solveData.cancelToken        = &solveToken;
+    solveData.mutex              = g_mutex_new();
+    solveData.game               = this;
+    solveData.nextMove           = 0;
+    solveData.solved             = false;
+    solveData.stats.nodes        = 0;
+    solveData.stats.prunedNodes  = 0;
+
+#ifdef DEBUG
+    assert(solveData.mutex != NULL);
+#endif
+
+    GThread* workerThreads[GAME_CHALLENGE_MAX_THREADS];
+    int32_t nThreadsCreated = 0;
+    // a 1-thread search is run in the calling thread
+    for (int32_t i = 0; (a_nThreads > 1) && (i < a_nThreads); i++)
+    {
+        GError* err = NULL;
+        workerThreads[nThreadsCreated] = g_thread_create(
+                reinterpret_cast<GThreadFunc>(GameChallenge::SolveThreadRoutine),
+                reinterpret_cast<void*>(&solveData),
+                TRUE, // joinable
+                &err);
+
+        if (workerThreads[nThreadsCreated] == NULL)
+        {
+            // the rest of threads will have to do the job of this one
+            g_error_free(err);
+            continue;
+        }
+
+        nThreadsCreated++;
+    }
+
+    if (nThreadsCreated == 0)
+    {
+        // no thread was created. Current thread will do all the work
+        SolveThreadRoutine(reinterpret_cast<void*>(&solveData));
+    }
+
+    for (int32_t i = 0; i < nThreadsCreated; i++)
+    {
+        g_thread_join(workerThreads[i]);
+    }
+
+    g_mutex_free(solveData.mutex);
+
+    watchdog.Stop();
+
+    m_solverStats.nodes       += solveData.stats.nodes;
+    m_solverStats.prunedNodes += solveData.stats.prunedNodes;
+    // the solve token is also cancelled when a solution is found
+    m_solverStats.completed    = solveData.solved || !watchdog.GetToken().IsCancelled();
+
+    return solveData.solved;
+}
+
+void* GameChallenge::SolveThreadRoutine(void *a_threadParam)
+{
+    ParallelSolveData_t* solveData =
+            reinterpret_cast<ParallelSolveData_t*>(a_threadParam);
+
+    // local copy of the game. It will be modified while this thread
+    // explores the search tree. The mutex is held since another thread
+    // could be writing its solution into the original game
+    g_mutex_lock(solveData->mutex);
+    GameChallenge localGame(*(solveData->game));
+    g_mutex_unlock(solveData->mutex);
+
+    // pieces put down and nk points of each level of the search tree. The nk
+    // points of the root are the ones of the squares taken by the challenger
+    // before the search started
+    ePieceType_t lastPieces[e_numberOfPieces];
+    Bitboard oldNkPoints[e_numberOfPieces];
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        lastPieces[i]  = e_noPiece;
+        oldNkPoints[i] = *(solveData->rootNkPoints);
+    }
+
+    // search tree explored by this thread. Added up to the shared stats at the end
+    SolverStats_t localStats;
+    localStats.nodes       = 0;
+    localStats.prunedNodes = 0;
+
+    const std::vector<rules::Move_t> &rootMoves = *(solveData->rootMoves);
+    const int32_t nRootMoves = static_cast<int32_t>(rootMoves.size());
+
+    // the token is read once every CANCELLATION_CHECKPOINT_INTERVAL nodes of
+    // the search tree, and before every root move
+    CancellationCheckpoint checkpoint(*(solveData->cancelToken));
+
+    while (!checkpoint.Check())
+    {
+        g_mutex_lock(solveData->mutex);
+        int32_t thisMoveIndex = solveData->nextMove++;
+        g_mutex_unlock(solveData->mutex);
+
+        if (thisMoveIndex >= nRootMoves)
+        {
+            // no more moves to be tried out
+            break;
+        }
+
+        const rules::Move_t &thisMove = rootMoves[thisMoveIndex];
+
+        localGame.m_challenger.UnsetPiece(thisMove.pieceType);
+        localGame.PutDownPiece(thisMove.coord, *(thisMove.pieceConf));
+
+        // save current deployed piece in the lastPieces array
+        lastPieces[0] = thisMove.pieceType;
+
+        if (localGame.AllocateAllPieces(
+                1,
+                lastPieces,
+                oldNkPoints,
+                checkpoint,
+                localStats))
+        {
+            g_mutex_lock(solveData->mutex);
+            if (!solveData->solved)
+            {
+                solveData->solved = true;
+                solveData->cancelToken->Cancel();
+
+                solveData->game->m_board      = localGame.m_board;
+                solveData->game->m_challenger = localGame.m_challenger;
+            }
+            g_mutex_unlock(solveData->mutex);
+
+            break;
+        }
+
+        if (checkpoint.IsCancelled())
+        {
+            // another thread found a solution (or the caller cancelled the search).
+            // The local copy of the game is not consistent anymore
+            break;
+        }
+
+        localGame.RemovePiece(thisMove.coord, *(thisMove.pieceConf));
+        localGame.m_challenger.SetPiece(thisMove.pieceType);
+    } // while (!checkpoint.Check())
+
+    g_mutex_lock(solveData->mutex);
+    solveData->stats.nodes       += localStats.nodes;
+    solveData->stats.prunedNodes += localStats.prunedNodes;
+    g_mutex_unlock(solveData->mutex);
+
+    return NULL;
+}
+
+bool GameChallenge::AllocateAllPieces(
+        int32_t                  a_level,
+        ePieceType_t             a_lastPieces[e_numberOfPieces],
+        Bitboard                 a_oldNkPoints[e_numberOfPieces],
+        CancellationCheckpoint  &in_out_checkpoint,
+        SolverStats_t           &in_out_stats)
+{
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    // plane where the valid coords of each configuration will be saved
+    Bitboard validCoords;
+    // plane with the nk points the current piece will be put down on
+    Bitboard mustTouchPlane;
+
+    // a new piece has just been put down on the board
+    in_out_stats.nodes++;
+
+    if (m_challenger.NumberOfPiecesAvailable() == 0)
+    {
+        return true;
+    }
+
+    if (in_out_checkpoint.Poll())
+    {
+        // something happened and we were told to stop processing
+        return false;
+    }
+
+    if (!IsRegionBigEnough(m_challenger.GetNucleationPointsPlane()))
+    {
+        // the pieces left can't be put down on the squares still reachable
+        in_out_stats.prunedNodes++;
+        return false;
+    }
+
+#ifdef DEBUG
+    assert(a_level > 0);
+    assert(a_level < e_numberOfPieces);
+#endif
+
+    // save current nk points. They will be used in deeper levels not to check
+    // the same set of pieces more than once
+    a_oldNkPoints[a_level] = m_challenger.GetNucleationPointsPlane();
+    const Bitboard &nkPoints = a_oldNkPoints[a_level];
+
+    for (int32_t currentPiece = e_numberOfPieces - 1;
+         currentPiece >= e_minimumPieceIndex;
+         currentPiece--)
+    {
+        if (!m_challenger.IsPieceAvailable(static_cast<ePieceType_t>(currentPiece)))
+        {
+            continue;
+        }
+
+        // the current piece can't be put down touching only nk points that already
+        // existed when a piece of lower type was put down in a previous level.
+        // That placement was tried out in that level before the lower piece
+        // (pieces are tried out from the highest type down)
+        mustTouchPlane = nkPoints;
+        for (int32_t thisLevel = a_level - 1; thisLevel >= 0; thisLevel--)
+        {
+            if (currentPiece > a_lastPieces[thisLevel])
+            {
+                mustTouchPlane &= ~a_oldNkPoints[thisLevel];
+            }
+        }
+
+        if (mustTouchPlane.IsEmpty())
+        {
+            continue;
+        }
+
+        m_challenger.UnsetPiece(static_cast<ePieceType_t>(currentPiece));
+
+        // save current deployed piece in the lastPieces array
+        a_lastPieces[a_level] = static_cast<ePieceType_t>(currentPiece);
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            // retrieve the valid coords of this piece in all the nk points at once
+            // the same coord can't be tested twice for the same configuration
+            rules::CalculateValidCoordsInBoard(
+                    m_board,
+                    m_challenger,
+                    pieceConf,
+                    mustTouchPlane,
+                    validCoords);
+
+            for (int32_t index = validCoords.NextSetBit(0);
+                 index >= 0;
+                 index = validCoords.NextSetBit(index + 1))
+            {
+                Coordinate thisCoord;
+                Bitboard::IndexToCoord(index, m_board.GetNColumns(), thisCoord);
+
+                PutDownPiece(thisCoord, pieceConf);
+
+                if (AllocateAllPieces(
+                        a_level + 1,
+                        a_lastPieces,
+                        a_oldNkPoints,
+                        in_out_checkpoint,
+                        in_out_stats))
+                {
+                    return true;
+                }
+
+                if (in_out_checkpoint.IsCancelled())
+                {
+                    // the search was stopped. Board and challenger are left
+                    // as they are
+                    return false;
+                }
+
+                RemovePiece(thisCoord, pieceConf);
+            } // for (int32_t index = validCoords.NextSetBit(0)
+        } // for (int32_t confIt = confTable.GetFirstConf(currentPiece)
+
+        m_challenger.SetPiece(static_cast<ePieceType_t>(currentPiece));
+    } // for (int32_t currentPiece = e_numberOfPieces - 1;
+
+    return false;
+}
+
+bool GameChallenge::IsRegionBigEnough(const Bitboard &a_seedPlane) const
+{
+    // number of squares of the pieces left, and the size of the smallest and the
+    // biggest of them
+    int32_t squaresLeft  = 0;
+    int32_t smallestSize = PIECE_MAX_SQUARES;
+    int32_t biggestSize  = 0;
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        if (m_challenger.IsPieceAvailable(static_cast<ePieceType_t>(i)))
+        {
+            int32_t nSquares = m_challenger.m_pieces[i].GetNSquares();
+
+            squaresLeft += nSquares;
+            if (nSquares < smallestSize)
+            {
+                smallestSize = nSquares;
+            }
+            if (nSquares > biggestSize)
+            {
+                biggestSize = nSquares;
+            }
+        }
+    }
+
+    // squares where the challenger can still put down pieces. Squares sharing
+    // a side with its pieces will never be available
+    Bitboard usable = m_board.GetEmptyPlane();
+    usable &= ~m_board.GetOrthogonalNeighbours(m_board.GetPlayerPlane(m_challenger));
+
+    if (usable.PopCount() < squaresLeft)
+    {
+        return false;
+    }
+
+    // every piece put down from now on touches the nk points or a square of a
+    // piece put down after them by a corner. Grow the seed through usable
+    // squares sharing a side or a corner
+    Bitboard unreached = usable;
+    Bitboard frontier  = a_seedPlane & usable;
+    Bitboard reached   = frontier;
+    unreached ^= frontier;
+    while (!frontier.IsEmpty())
+    {
+        frontier  = m_board.GetOrthogonalNeighbours(frontier) |
+                    m_board.GetDiagonalNeighbours(frontier);
+        frontier &= unreached;
+
+        unreached ^= frontier;
+        reached   |= frontier;
+    }
+
+    if (reached.PopCount() < squaresLeft)
+    {
+        return false;
+    }
+
+    // each piece has to fit in an area of reached squares sharing a side. Areas
+    // smaller than the smallest piece left can't hold any of them
+    int32_t usefulSquares = 0;
+    int32_t biggestArea   = 0;
+    for (int32_t index = reached.NextSetBit(0);
+         index >= 0;
+         index = reached.NextSetBit(index + 1))
+    {
+        Bitboard area;
+        area.Set(index);
+        reached.Unset(index);
+
+        frontier = area;
+        while (!frontier.IsEmpty())
+        {
+            frontier  = m_board.GetOrthogonalNeighbours(frontier);
+            frontier &= reached;
+
+            reached ^= frontier;
+            area    |= frontier;
+        }
+
+        int32_t areaSize = area.PopCount();
+        if (areaSize >= smallestSize)
+        {
+            usefulSquares += areaSize;
+        }
+        if (areaSize > biggestArea)
+        {
+            biggestArea = areaSize;
+        }
+    } // for (int32_t index = reached.NextSetBit(0)
+
+    return ( (usefulSquares >= squaresLeft) && (biggestArea >= biggestSize) );
 }
@@ -23,6 +23,7 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 08-Oct-2010  Original development
+///           agent              17-Oct-2026  Parallel Solve with pruning of unreachable regions
 /// @endhistory
 ///
 // ============================================================================
@@ -30,10 +31,18 @@
 #ifndef __GAME_CHALLENGE_H__
 #define __GAME_CHALLENGE_H__
 
+#include <vector>
+#include <glib.h>  // glib-2.0/glib.h (threads used by the parallel Solve)
 #include "player.h"
 #include "board.h"
+#include "bitboard.h"
+#include "rules.h"
 #include "coordinate.h"
 #include "blockem_challenge.h"
+#include "cancellation_token.h"
+
+/// maximum number of threads Solve can split the search into
+const int32_t GAME_CHALLENGE_MAX_THREADS = 64;
 
 /// @brief A Game in which 1 player tries to allocate all the pieces on a board
 ///        Described by a challenge (see blockem challenge doc)
@@ -102,6 +111,47 @@ public:
 			const Piece      &a_piece,
 			const Coordinate &a_coord);
 
+    /// @brief size of the search tree explored by the latest call to Solve
+    typedef struct
+    {
+        /// number of nodes visited (pieces put down on the board)
+        uint64_t nodes;
+        /// number of nodes whose subtree was discarded because the pieces left
+        /// couldn't fit in the region of the board the challenger can still reach
+        uint64_t prunedNodes;
+        /// false if the search was stopped (time budget ran out or it was cancelled)
+        /// before it could find a solution or prove there is none
+        bool     completed;
+    } SolverStats_t;
+
+    /// @brief a backtracking algorithm will try to put down all the pieces of the
+    /// challenger on the board. It works like GameTotalAllocation::Solve, but the
+    /// search starts from the squares already taken by the challenger (if any), and
+    /// branches whose pieces left can't fit in the empty squares the challenger
+    /// can still reach are discarded
+    /// The placements of the first piece are shared out among a_nThreads worker
+    /// threads, each of them working on its own copy of the game. The first one to
+    /// find a solution stops the rest of them
+    /// If the challenge is solved board and challenger of this instance will contain
+    /// the solution. They are left untouched otherwise
+    /// @param number of threads. 1 (or less) means the search is run in the calling thread
+    /// @param time budget in milliseconds. The search is stopped when it runs out.
+    ///        0 (or less) means there is no time limit
+    /// @param the search stops as soon as this token is cancelled. Solve returns
+    ///        false then, leaving board and challenger untouched
+    /// @return true if the challenge was solved. False if there is no solution to the
+    ///         challenge or the search was stopped (see SolverStats_t::completed)
+    bool Solve(
+            int32_t                  a_nThreads = 1,
+            int32_t                  a_timeBudgetMs = 0,
+            const CancellationToken &a_cancelToken = CancellationToken());
+
+    /// @return size of the search tree explored by the latest call to Solve
+    inline const SolverStats_t& GetSolverStats() const
+    {
+        return m_solverStats;
+    }
+
 private:
     /// The blockem board where the game will be played
     Board m_board;
@@ -113,6 +163,9 @@ private:
     /// a few squares on the board to make it difficult for the challenger to
     /// allocate all its pieces
     Player m_disturber;
+
+    /// size of the search tree explored by the latest call to Solve
+    SolverStats_t m_solverStats;
     
     /// @brief load challenge data into this object attributes
     /// @param a const reference to the challenge
@@ -127,16 +180,78 @@ private:
     /// @param the ABSOLUTE coord
     /// @param the piece configuration
     void RemovePiece(
-            const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf);
+            const Coordinate  &a_coord,
+            const PieceConf_t &a_pieceConf);
 
     /// put down a piece on the board. The user is supposed to check if there is space for
     /// it before calling. It doesn't unset the piece from player
     /// @param the ABSOLUTE coord
     /// @param the piece configuration
     void PutDownPiece(
-            const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf);
+            const Coordinate  &a_coord,
+            const PieceConf_t &a_pieceConf);
+
+    /// @brief tries to put down all the pieces left on the nk points of the challenger
+    /// Like GameTotalAllocation::AllocateAllPieces, a piece is not put down touching only
+    /// nk points which already existed when a piece of lower type was put down in a
+    /// previous level of the search tree (it would have been tried out there first)
+    /// @param level of the search tree (number of pieces put down by Solve so far)
+    /// @param piece types put down in each one of the previous levels
+    /// @param planes with the nk points of each previous level. The plane of the
+    ///        current level is written into it
+    /// @param checkpoint of the token that stops the search. Polled once per node of
+    ///        the search tree. If the token is cancelled this function returns false
+    ///        leaving board and challenger with unexpected values
+    /// @param nodes visited and pruned are added up here
+    /// @return true if it succeeded. False otherwise
+    bool AllocateAllPieces(
+            int32_t                  a_level,
+            ePieceType_t             a_lastPieces[e_numberOfPieces],
+            Bitboard                 a_oldNkPoints[e_numberOfPieces],
+            CancellationCheckpoint  &in_out_checkpoint,
+            SolverStats_t           &in_out_stats);
+
+    /// @brief checks if the pieces left could fit in the empty squares the
+    ///        challenger can still reach
+    /// Pieces can only be put down on empty squares which don't share a side with
+    /// the challenger's pieces, and every one of them must be connected to the
+    /// current nk points through a chain of squares touching by a corner. Each piece
+    /// must also fit in one of the areas made up by those squares sharing a side
+    /// @param plane where the region starts from (normally the nk points of the challenger)
+    /// @return false if the pieces left can't fit in the reachable region for sure
+    bool IsRegionBigEnough(const Bitboard &a_seedPlane) const;
+
+    /// @brief data shared by all the worker threads of a parallel Solve
+    /// everything below m_mutex (included) must be accessed holding the mutex
+    typedef struct
+    {
+        /// list of placements of the first piece in the same order they are
+        /// tried out by the 1-thread search
+        const std::vector<rules::Move_t>* rootMoves;
+        /// nk points of the challenger before the first piece is put down
+        const Bitboard*                   rootNkPoints;
+        /// cancelled as soon as a solution is found. It is linked to the token
+        /// of the caller of Solve
+        CancellationToken*                cancelToken;
+
+        /// protects the rest of the members of the structure
+        GMutex*                           mutex;
+        /// game being solved. Worker threads copy it before starting, and the
+        /// first one to find a solution copies board and challenger back into it
+        GameChallenge*                    game;
+        /// index of the next root move to be handed out
+        int32_t                           nextMove;
+        /// true once a worker thread saved its solution into game
+        bool                              solved;
+        /// size of the search tree explored by all the worker threads
+        SolverStats_t                     stats;
+    } ParallelSolveData_t;
+
+    /// The routine run by the worker threads of Solve. It tries out the root
+    /// moves handed out one by one till there are no more of them or a solution is found
+    /// @param pointer to a ParallelSolveData_t structure
+    /// @return NULL
+    static void* SolveThreadRoutine(void *a_threadParam);
 
     // prevent this class to be instantiated without the proper arguments
     GameChallenge();
@@ -25,6 +25,9 @@
 ///           Faustino Frechilla 13-Sep-2009  Original development
 ///           Faustino Frechilla 21-Jul-2010  i18n
 ///           Faustino Frechilla 06-Oct-2010  starting coordinate not mandatory
+///           agent              17-Oct-2026  Configurations read from PieceConfTable
+///           agent              17-Oct-2026  Parallel Solve. Nk point sets saved in bitboards
+///           agent              17-Oct-2026  Solve cancelled through a CancellationToken
 /// @endhistory
 ///
 // ============================================================================
@@ -93,9 +96,12 @@ void GameTotalAllocation::RemovePiece(
         const Piece      &a_piece,
         const Coordinate &a_coord)
 {
-    RemovePiece(
-        a_coord,
-        a_piece.GetCurrentConfiguration());
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
+    RemovePiece(a_coord, pieceConf);
 
     m_player.SetPiece(a_piece.GetType());
 }
@@ -104,16 +110,19 @@ void GameTotalAllocation::PutDownPiece(
         const Piece      &a_piece,
         const Coordinate &a_coord)
 {
-    PutDownPiece(
-        a_coord,
-        a_piece.GetCurrentConfiguration());
+    // the current configuration of a_piece doesn't need to be
+    // one of the configurations saved in PieceConfTable
+    PieceConf_t pieceConf;
+    PieceConfTable::Pack(a_piece.GetCurrentConfiguration(), a_piece.GetType(), pieceConf);
+
+    PutDownPiece(a_coord, pieceConf);
 
     m_player.UnsetPiece(a_piece.GetType());
 }
 
 void GameTotalAllocation::RemovePiece(
-        const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf)
+        const Coordinate  &a_coord,
+        const PieceConf_t &a_pieceConf)
 {
 #ifdef DEBUG
     assert(a_coord.m_row >= 0);
@@ -123,20 +132,16 @@ void GameTotalAllocation::RemovePiece(
     assert(a_coord.m_col < m_board.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piecee first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < m_board.GetNRows())    );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < m_board.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < m_board.GetNRows())    );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < m_board.GetNColumns()) );
 
         assert(m_board.IsPlayerInCoord(thisCoord, m_player));
 #endif
@@ -146,12 +151,10 @@ void GameTotalAllocation::RemovePiece(
 
     // go through the list of squares of the piece again, now that
     // the piece has been removed
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 
         // thisCoord is now empty
         // is it now a nucleation point for player? (it couldn't be before, as it was occupied)
@@ -162,15 +165,13 @@ void GameTotalAllocation::RemovePiece(
         {
         	m_player.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. Are they still nk points for m_player?
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row < 0) ||(thisCoord.m_col < 0)    ||
              (thisCoord.m_row >= m_board.GetNRows())          ||
@@ -191,15 +192,13 @@ void GameTotalAllocation::RemovePiece(
             // removed
         	m_player.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece that was just removed might also be nk points
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row < 0) || (thisCoord.m_col < 0) ||
              (thisCoord.m_row >= m_board.GetNRows())        ||
@@ -222,12 +221,12 @@ void GameTotalAllocation::RemovePiece(
             // this forbidden coord is now a nk point since the piece was removed
         	m_player.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
 }
 
 void GameTotalAllocation::PutDownPiece(
-        const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf)
+        const Coordinate  &a_coord,
+        const PieceConf_t &a_pieceConf)
 {
 #ifdef DEBUG
     assert(a_coord.m_row >= 0);
@@ -237,36 +236,30 @@ void GameTotalAllocation::PutDownPiece(
     assert(a_coord.m_col < m_board.GetNColumns());
 #endif
 
-    PieceConfigurationContainer_t::const_iterator it;
-
     // go through the list of squares of the piecee first
-    for (it  = a_pieceConf.m_pieceSquares.begin();
-         it != a_pieceConf.m_pieceSquares.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.squareRows[i],
+                             a_coord.m_col + a_pieceConf.squareCols[i]);
 #ifdef DEBUG
-        assert( ((a_coord.m_row + it->m_row) >= 0) &&
-        		((a_coord.m_row + it->m_row) < m_board.GetNRows())    );
-        assert( ((a_coord.m_col + it->m_col) >= 0) &&
-        		((a_coord.m_col + it->m_col) < m_board.GetNColumns()) );
+        assert( (thisCoord.m_row >= 0) &&
+        		(thisCoord.m_row < m_board.GetNRows())    );
+        assert( (thisCoord.m_col >= 0) &&
+        		(thisCoord.m_col < m_board.GetNColumns()) );
 
         assert(m_board.IsCoordEmpty(thisCoord));
 #endif
 
         m_board.SetPlayerInCoord(thisCoord,	m_player);
         m_player.UnsetNucleationPoint(thisCoord);
-    } // for (it  = a_pieceConf.m_pieceSquares.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
 
     // now check the nk points of the piece. If they are inside the board they will be set as
     // nucleation point. No need to compute
-    for (it  = a_pieceConf.m_nkPoints.begin();
-         it != a_pieceConf.m_nkPoints.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.nkRows[i],
+                             a_coord.m_col + a_pieceConf.nkCols[i]);
 
         if ( (thisCoord.m_row >= 0)                    &&
              (thisCoord.m_col >= 0)                    &&
@@ -279,15 +272,13 @@ void GameTotalAllocation::PutDownPiece(
             // it's ok -and faster- to set it twice
         	m_player.SetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_nkPoints.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nNkPoints; i++)
 
     // forbidden areas around the piece can't be a valid nk point any longer
-    for (it  = a_pieceConf.m_forbiddenArea.begin();
-         it != a_pieceConf.m_forbiddenArea.end();
-         it++)
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
     {
-        Coordinate thisCoord(a_coord.m_row + it->m_row,
-                             a_coord.m_col + it->m_col);
+        Coordinate thisCoord(a_coord.m_row + a_pieceConf.forbiddenRows[i],
+                             a_coord.m_col + a_pieceConf.forbiddenCols[i]);
 
         if ( (thisCoord.m_row >= 0)                    &&
              (thisCoord.m_col >= 0)                    &&
@@ -298,137 +289,256 @@ void GameTotalAllocation::PutDownPiece(
             // to the forbidden area of the deployed piece
             m_player.UnsetNucleationPoint(thisCoord);
         }
-    } // for (it  = a_pieceConf.m_forbiddenArea.begin();
+    } // for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
 }
 
-bool GameTotalAllocation::Solve()
+bool GameTotalAllocation::Solve(
+        int32_t                  a_nThreads,
+        const CancellationToken &a_cancelToken)
 {
-    std::vector<Coordinate> validCoords(PIECE_MAX_SQUARES);
-
-	// declare the array of last pieces and old NK points and clear them out
-	ePieceType_t lastPieces[e_numberOfPieces];
-	// pointers to the stack, it is a bad idea, but they won't be used badly I promise
-	STLCoordinateSet_t* oldNkPoints[e_numberOfPieces];
+    const PieceConfTable &confTable = PieceConfTable::Instance();
 
-	for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
-	{
-		lastPieces[i]  = e_noPiece;
-		oldNkPoints[i] = NULL;
-	}
+    if (a_nThreads > GAME_TOTAL_ALLOCATION_MAX_THREADS)
+    {
+        a_nThreads = GAME_TOTAL_ALLOCATION_MAX_THREADS;
+    }
 
-	STLCoordinateSet_t emptySet;
-	oldNkPoints[0] = &emptySet;
+    // the first piece must be put down on the starting coordinate. If there's
+    // none it can be put down anywhere on the board
+    Bitboard mustTouchPlane;
+    if (m_startingCoord.Initialised())
+    {
+        if (m_board.IsCoordEmpty(m_startingCoord))
+        {
+            mustTouchPlane.Set(
+                Bitboard::CoordToIndex(m_startingCoord, m_board.GetNColumns()));
+        }
+    }
+    else
+    {
+        mustTouchPlane = m_board.GetEmptyPlane();
+    }
 
+    // list of placements of the first piece. Since valid coords are calculated all
+    // at once for the whole board the same placement can't be saved twice
+    std::vector<rules::Move_t> rootMoves;
+    Bitboard validCoords;
     for (int32_t currentPiece = e_numberOfPieces - 1;
          currentPiece >= e_minimumPieceIndex;
          currentPiece--)
     {
-		if (!m_player.IsPieceAvailable(static_cast<ePieceType_t>(currentPiece)))
-		{
-		    continue;
-		}
+        if (!m_player.IsPieceAvailable(static_cast<ePieceType_t>(currentPiece)))
+        {
+            continue;
+        }
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            rules::CalculateValidCoordsInBoard(
+                    m_board,
+                    m_player,
+                    pieceConf,
+                    mustTouchPlane,
+                    validCoords);
+
+            for (int32_t index = validCoords.NextSetBit(0);
+                 index >= 0;
+                 index = validCoords.NextSetBit(index + 1))
+            {
+                rules::Move_t thisMove;
+                thisMove.pieceType = static_cast<ePieceType_t>(currentPiece);
+                thisMove.confIndex = pieceConf.confIndex;
+                thisMove.pieceConf = &pieceConf;
+                Bitboard::IndexToCoord(index, m_board.GetNColumns(), thisMove.coord);
+
+                rootMoves.push_back(thisMove);
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(currentPiece)
+    } // for (int32_t currentPiece = e_numberOfPieces - 1;
 
-    	m_player.UnsetPiece(static_cast<ePieceType_t>(currentPiece));
+    if (a_nThreads > static_cast<int32_t>(rootMoves.size()))
+    {
+        // no point on spawning threads that won't have anything to do
+        a_nThreads = static_cast<int32_t>(rootMoves.size());
+    }
 
-        // save current deployed piece in the lastPieces array
-        lastPieces[0] = m_player.m_pieces[currentPiece].GetType();
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
 
-    	const std::list<PieceConfiguration> &pieceConfList =
-            m_player.m_pieces[currentPiece].GetPrecalculatedConfs();
+    // cancelled by the first worker thread to find a solution. It is linked to
+    // the token of the caller so the search can be stopped from outside too
+    CancellationToken solveToken(&a_cancelToken);
 
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+    ParallelSolveData_t solveData;
+    solveData.rootMoves          = &rootMoves;
+    solveData.cancelToken        = &solveToken;
+    solveData.mutex              = g_mutex_new();
+    solveData.game               = this;
+    solveData.nextMove           = 0;
+    solveData.solved             = false;
+
+#ifdef DEBUG
+    assert(solveData.mutex != NULL);
+#endif
+
+    GThread* workerThreads[GAME_TOTAL_ALLOCATION_MAX_THREADS];
+    int32_t nThreadsCreated = 0;
+    // a 1-thread search is run in the calling thread
+    for (int32_t i = 0; (a_nThreads > 1) && (i < a_nThreads); i++)
+    {
+        GError* err = NULL;
+        workerThreads[nThreadsCreated] = g_thread_create(
+                reinterpret_cast<GThreadFunc>(GameTotalAllocation::SolveThreadRoutine),
+                reinterpret_cast<void*>(&solveData),
+                TRUE, // joinable
+                &err);
+
+        if (workerThreads[nThreadsCreated] == NULL)
         {
-            if (m_startingCoord.Initialised())
-            {
-                int32_t nValidCoords = rules::CalculateValidCoordsInStartingPoint(
-                                                  m_board,
-                                                  m_startingCoord,
-                                                  *pieceConfIt,
-                                                  validCoords);
+            // the rest of threads will have to do the job of this one
+            g_error_free(err);
+            continue;
+        }
 
-                for (int32_t k = 0 ; k < nValidCoords ; k++)
-                {
-                    PutDownPiece(validCoords[k], *pieceConfIt);
+        nThreadsCreated++;
+    }
+
+    if (nThreadsCreated == 0)
+    {
+        // no thread was created. Current thread will do all the work
+        SolveThreadRoutine(reinterpret_cast<void*>(&solveData));
+    }
+
+    for (int32_t i = 0; i < nThreadsCreated; i++)
+    {
+        g_thread_join(workerThreads[i]);
+    }
 
-                    if (AllocateAllPieces(lastPieces, oldNkPoints))
-                    {
-                        return true;
-                    }
+    g_mutex_free(solveData.mutex);
 
-                    RemovePiece(validCoords[k], *pieceConfIt);
-                }
-            } // if (m_startingCoord.Initialised())
-            else
+    // if the game wasn't solved we couldn't put down the pieces in the board. Pity
+    return solveData.solved;
+}
+
+void* GameTotalAllocation::SolveThreadRoutine(void *a_threadParam)
+{
+    ParallelSolveData_t* solveData =
+            reinterpret_cast<ParallelSolveData_t*>(a_threadParam);
+
+    // local copy of the game. It will be modified while this thread
+    // explores the search tree. The mutex is held since another thread
+    // could be writing its solution into the original game
+    g_mutex_lock(solveData->mutex);
+    GameTotalAllocation localGame(*(solveData->game));
+    g_mutex_unlock(solveData->mutex);
+
+    // declare the array of last pieces and old NK points and clear them out
+    ePieceType_t lastPieces[e_numberOfPieces];
+    Bitboard oldNkPoints[e_numberOfPieces];
+
+    // nk points of levels previous to the first piece are not taken into account
+    // (Bitboard's constructor leaves the planes empty)
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        lastPieces[i] = e_noPiece;
+    }
+
+    const std::vector<rules::Move_t> &rootMoves = *(solveData->rootMoves);
+    const int32_t nRootMoves = static_cast<int32_t>(rootMoves.size());
+
+    // the token is read once every CANCELLATION_CHECKPOINT_INTERVAL nodes of
+    // the search tree, and before every root move
+    CancellationCheckpoint checkpoint(*(solveData->cancelToken));
+
+    while (!checkpoint.Check())
+    {
+        g_mutex_lock(solveData->mutex);
+        int32_t thisMoveIndex = solveData->nextMove++;
+        g_mutex_unlock(solveData->mutex);
+
+        if (thisMoveIndex >= nRootMoves)
+        {
+            // no more moves to be tried out
+            break;
+        }
+
+        const rules::Move_t &thisMove = rootMoves[thisMoveIndex];
+
+        localGame.m_player.UnsetPiece(thisMove.pieceType);
+        localGame.PutDownPiece(thisMove.coord, *(thisMove.pieceConf));
+
+        // save current deployed piece in the lastPieces array
+        lastPieces[0] = thisMove.pieceType;
+
+        if (localGame.AllocateAllPieces(
+                lastPieces,
+                oldNkPoints,
+                checkpoint))
+        {
+            g_mutex_lock(solveData->mutex);
+            if (!solveData->solved)
             {
-                // try to start from everywhere in the board till a solution
-                // is found
-                Coordinate thisStartingCoord(0, 0);
-                for (thisStartingCoord.m_row = 0;
-                    thisStartingCoord.m_row < m_board.GetNRows();
-                    thisStartingCoord.m_row++)
-                {
-                    for (thisStartingCoord.m_col = 0;
-                        thisStartingCoord.m_col < m_board.GetNColumns();
-                        thisStartingCoord.m_col++)
-                    {
-                        int32_t nValidCoords = rules::CalculateValidCoordsInStartingPoint(
-                                                          m_board,
-                                                          thisStartingCoord,
-                                                          *pieceConfIt,
-                                                          validCoords);
-
-                        for (int32_t k = 0 ; k < nValidCoords ; k++)
-                        {
-                            PutDownPiece(validCoords[k], *pieceConfIt);
-
-                            if (AllocateAllPieces(lastPieces, oldNkPoints))
-                            {
-                                return true;
-                            }
-
-                            RemovePiece(validCoords[k], *pieceConfIt);
-                        }
-
-                    } // for (thisStartingCoord.m_col = 0;
-                } // for (thisStartingCoord.m_row = 0;
-            } // else
-
-        } // for (pieceConfIt = pieceConfList.begin()
+                solveData->solved = true;
+                solveData->cancelToken->Cancel();
 
-        m_player.SetPiece(static_cast<ePieceType_t>(currentPiece));
-    } // for (int32_t currentPiece = e_numberOfPieces - 1;
+                solveData->game->m_board  = localGame.m_board;
+                solveData->game->m_player = localGame.m_player;
+            }
+            g_mutex_unlock(solveData->mutex);
 
-    // if we got here we couldn't put down the pieces in the board. Pity
-    return false;
+            break;
+        }
+
+        if (checkpoint.IsCancelled())
+        {
+            // another thread found a solution (or the caller cancelled the search).
+            // The local copy of the game is not consistent anymore
+            break;
+        }
+
+        localGame.RemovePiece(thisMove.coord, *(thisMove.pieceConf));
+        localGame.m_player.SetPiece(thisMove.pieceType);
+    } // while (!checkpoint.Check())
+
+    return NULL;
 }
 
 bool GameTotalAllocation::AllocateAllPieces(
-        ePieceType_t        a_lastPieces[e_numberOfPieces],
-		STLCoordinateSet_t* a_oldNkPoints[e_numberOfPieces])
+        ePieceType_t                 a_lastPieces[e_numberOfPieces],
+        Bitboard                     a_oldNkPoints[e_numberOfPieces],
+        CancellationCheckpoint      &in_out_checkpoint)
 {
-    // vector to be sued to save the valid coords in each nk point
-    std::vector<Coordinate> validCoords(PIECE_MAX_SQUARES);
-	// this set will be used not to place the same piece in the same place more than once
-    // it will be reset every time the piece is rotated/mirrored or the piece is changed
-    STLCoordinateSet_t testedCoords;
-    // this set will save the current nucleation points
-    STLCoordinateSet_t nkPointSet;
+    // precalculated configurations of all the pieces
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    // plane where the valid coords of each configuration will be saved
+    Bitboard validCoords;
+    // plane with the nk points the current piece will be put down on
+    Bitboard mustTouchPlane;
 
     if (m_player.NumberOfPiecesAvailable() == 0)
     {
         return true;
     }
 
-    // retrieve current nk points. It will be used in future calls not to check configurations more than once
-    m_player.GetAllNucleationPoints(nkPointSet);
+    if (in_out_checkpoint.Poll())
+    {
+        // something happened and we were told to stop processing
+        return false;
+    }
 
-    // save a pointer to this set in the place (index) reserved for it
-    // the index is the level of depth in the search tree, so if 1 piece has been set
-    // the current level will be 1
-    a_oldNkPoints[e_numberOfPieces - m_player.NumberOfPiecesAvailable()] = &nkPointSet;
+    // save current nk points in the place (index) reserved for them. They will be used
+    // in future calls not to check configurations more than once. The index is the
+    // level of depth in the search tree, so if 1 piece has been set the current level will be 1
+    const int32_t currentLevel = e_numberOfPieces - m_player.NumberOfPiecesAvailable();
+    a_oldNkPoints[currentLevel] = m_player.GetNucleationPointsPlane();
+    const Bitboard &nkPoints = a_oldNkPoints[currentLevel];
 
 	for (int32_t currentPiece = e_numberOfPieces - 1;
          currentPiece >= e_minimumPieceIndex;
@@ -439,88 +549,71 @@ bool GameTotalAllocation::AllocateAllPieces(
 		    continue;
 		}
 
+        // before putting down the piece remove the nk points whose configurations
+        // could be tested by some other level in the backtrack tree. The current
+        // level is not taken into account, and there's no need for using level 0 either
+        mustTouchPlane = nkPoints;
+        for (int32_t thisLevel = currentLevel - 1; thisLevel > 0; thisLevel--)
+        {
+            // if the current piece's index is bigger than the old piece deployed on
+            // the board, put down the piece only in nk points that don't belong to the
+            // old nucleation point's plane
+            // both old piece and old nk points plane correspond to this particular
+            // level of the backtrack tree
+            if (currentPiece >= a_lastPieces[thisLevel])
+            {
+                mustTouchPlane &= ~a_oldNkPoints[thisLevel];
+            }
+        }
+
+        if (mustTouchPlane.IsEmpty())
+        {
+            continue;
+        }
+
 		m_player.UnsetPiece(static_cast<ePieceType_t>(currentPiece));
 
         // save current deployed piece in the lastPieces array
-        a_lastPieces[e_numberOfPieces - m_player.NumberOfPiecesAvailable()] =
-            m_player.m_pieces[currentPiece].GetType();
-
-    	const std::list<PieceConfiguration> &pieceConfList =
-            m_player.m_pieces[currentPiece].GetPrecalculatedConfs();
+        a_lastPieces[currentLevel + 1] = static_cast<ePieceType_t>(currentPiece);
 
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(currentPiece));
+                     confIt++)
         {
-            STLCoordinateSet_t::iterator nkIterator = nkPointSet.begin();
-            while(nkIterator != nkPointSet.end())
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            // retrieve the valid coords of this piece in all the nk points at once
+            // the same coord can't be tested twice for the same configuration
+            rules::CalculateValidCoordsInBoard(
+                    m_board,
+                    m_player,
+                    pieceConf,
+                    mustTouchPlane,
+                    validCoords);
+
+            for (int32_t index = validCoords.NextSetBit(0);
+                 index >= 0;
+                 index = validCoords.NextSetBit(index + 1))
             {
-                // before putting down the piece test if the future configuration
-                // could be tested by some other level in the backtrack tree
-                // using (e_numberOfPieces - m_player.NumberOfPiecesAvailable() - 2)
-                // because m_player.NumberOfPiecesAvailable() - 1 is this current level in the tree
-                // and we don't want to use it. No need for using the level 0 either
-                int32_t thisLevel;
-                for (thisLevel = e_numberOfPieces - m_player.NumberOfPiecesAvailable() - 2;
-                     thisLevel > 0;
-                     thisLevel--)
-                {
-                    // if the current piece's index is bigger than the old piece deployed on
-                    // the board, put down the piece only if this nucleation doesn't belong to the
-                    // old nucleation point's set
-                    // both old piece and old nk points set correspond to this particular
-                    // level of the backtrack tree
-                    if (currentPiece >= a_lastPieces[thisLevel])
-                    {
-                        STLCoordinateSet_t::iterator it;
-                        it = a_oldNkPoints[thisLevel]->find(*nkIterator);
-                        if (it != a_oldNkPoints[thisLevel]->end())
-                        {
-                            nkIterator++;
-                            break;
-                        }
-                    }
-                }
+                Coordinate thisCoord;
+                Bitboard::IndexToCoord(index, m_board.GetNColumns(), thisCoord);
+
+                PutDownPiece(thisCoord, pieceConf);
 
-                if (thisLevel > 0)
+                if (AllocateAllPieces(a_lastPieces, a_oldNkPoints, in_out_checkpoint))
                 {
-                    // the previous loop called break before the end
-                    continue;
+                    return true;
                 }
 
-                // retrieve the valid coords of this piece in the current nk point
-                int32_t nValidCoords = rules::CalculateValidCoordsInNucleationPoint(
-                                                    m_board,
-                                                    m_player,
-                                                    *nkIterator,
-                                                    *pieceConfIt,
-                                                    validCoords);
-
-                for (int32_t k = 0; k < nValidCoords; k++)
+                if (in_out_checkpoint.IsCancelled())
                 {
-                    STLCoordinateSet_t::iterator it =
-                        testedCoords.find(validCoords[k]);
-                    if (it == testedCoords.end())
-                    {
-                        testedCoords.insert(validCoords[k]);
-
-                        PutDownPiece(validCoords[k], *pieceConfIt);
-
-                        if (AllocateAllPieces(a_lastPieces, a_oldNkPoints))
-                        {
-                            return true;
-                        }
-
-                        RemovePiece(validCoords[k], *pieceConfIt);
-                    }
-                } // for (int32_t k = 0; k < nValidCoords; k++)
-
-                nkIterator++;
-            } // while(nkIterator != nkPointSet.end())
+                    // something happened and we were told to stop processing
+                    return false;
+                }
 
-            testedCoords.clear();
-        } // for (pieceConfIt = pieceConfList.begin()
+                RemovePiece(thisCoord, pieceConf);
+            } // for (int32_t index = validCoords.NextSetBit(0);
+        } // for (int32_t confIt = confTable.GetFirstConf(currentPiece)
 
         m_player.SetPiece(static_cast<ePieceType_t>(currentPiece));
 
@@ -23,6 +23,9 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 13-Sep-2009  Original development
+///           agent              17-Oct-2026  Configurations read from PieceConfTable
+///           agent              17-Oct-2026  Parallel Solve. Nk point sets saved in bitboards
+///           agent              17-Oct-2026  Solve cancelled through a CancellationToken
 /// @endhistory
 ///
 // ============================================================================
@@ -30,9 +33,18 @@
 #ifndef GAMETOTALALLOCATION_H_
 #define GAMETOTALALLOCATION_H_
 
+#include <csignal> // atomic_t
+#include <vector>
+#include <glib.h>  // glib-2.0/glib.h (threads used by the parallel Solve)
 #include "player.h"
 #include "board.h"
+#include "bitboard.h"
+#include "rules.h"
 #include "coordinate.h"
+#include "cancellation_token.h"
+
+/// maximum number of threads Solve can split the search into
+const int32_t GAME_TOTAL_ALLOCATION_MAX_THREADS = 64;
 
 /// @brief A Game in which 1 player tries to allocate all the pieces in the board
 ///        No opponent. Just one player, one board and the pieces
@@ -96,10 +108,20 @@ public:
 			const Coordinate &a_coord);
 
     /// @brief a backtracking algorithm will try to put all the pieces in the board.
-    /// It will modify the player and board objects inside this instance
-    /// They will contain how the calculations ended
-    /// @return true if the game was solved. False if there is no solution to the problem
-    bool Solve();
+    /// The placements of the first piece (every available piece, configuration and
+    /// coord where it can be put down) are shared out among a_nThreads worker threads,
+    /// each of them working on its own copy of the game. The first one to find a
+    /// solution stops the rest of them
+    /// If the game is solved board and player of this instance will contain the
+    /// solution. They are left untouched otherwise
+    /// @param number of threads. 1 (or less) means the search is run in the calling thread
+    /// @param the search stops as soon as this token is cancelled. Solve returns
+    ///        false then, leaving board and player untouched
+    /// @return true if the game was solved. False if there is no solution to the
+    ///         problem or the search was cancelled
+    bool Solve(
+            int32_t                  a_nThreads = 1,
+            const CancellationToken &a_cancelToken = CancellationToken());
 
 protected:
     /// The blockem board where the game will be played
@@ -118,27 +140,60 @@ protected:
     /// @param the ABSOLUTE coord
     /// @param the piece configuration
     void RemovePiece(
-            const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf);
+            const Coordinate  &a_coord,
+            const PieceConf_t &a_pieceConf);
 
     /// put down a piece on the board. The user is supposed to check if there is space for
     /// it before calling. It doesn't unset the piece from player
     /// @param the ABSOLUTE coord
     /// @param the piece configuration
     void PutDownPiece(
-            const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf);
+            const Coordinate  &a_coord,
+            const PieceConf_t &a_pieceConf);
 
     /// once there is at least one piece put down in the board this function
     /// will try to put down all the pieces in the existing nk points in the board
     /// @param an array with piece types of the latest pieces set in previous
     ///        iterations of the game
-    /// @param an array with pointers to sets with the nucleation points of the previous
-    ///        itearations of the game
+    /// @param an array with the planes with the nucleation points of the previous
+    ///        itearations of the game. The plane of the current level is written into it
+    /// @param checkpoint of the token that stops the search (another thread could
+    ///        have found a solution). Polled once per node of the search tree. If the
+    ///        token is cancelled this function returns false leaving board and player
+    ///        with unexpected values
     /// @return true if it succeeded. False otherwise
     bool AllocateAllPieces(
-            ePieceType_t        a_lastPieces[e_numberOfPieces],
-            STLCoordinateSet_t* a_oldNkPoints[e_numberOfPieces]);
+            ePieceType_t                 a_lastPieces[e_numberOfPieces],
+            Bitboard                     a_oldNkPoints[e_numberOfPieces],
+            CancellationCheckpoint      &in_out_checkpoint);
+
+    /// @brief data shared by all the worker threads of a parallel Solve
+    /// everything below m_mutex (included) must be accessed holding the mutex
+    typedef struct
+    {
+        /// list of placements of the first piece in the same order they are
+        /// tried out by the 1-thread search
+        const std::vector<rules::Move_t>* rootMoves;
+        /// cancelled as soon as a solution is found. It is linked to the token
+        /// of the caller of Solve
+        CancellationToken*                cancelToken;
+
+        /// protects the rest of the members of the structure
+        GMutex*                           mutex;
+        /// game being solved. Worker threads copy it before starting, and the
+        /// first one to find a solution copies board and player back into it
+        GameTotalAllocation*              game;
+        /// index of the next root move to be handed out
+        int32_t                           nextMove;
+        /// true once a worker thread saved its solution into game
+        bool                              solved;
+    } ParallelSolveData_t;
+
+    /// The routine run by the worker threads of Solve. It tries out the root
+    /// moves handed out one by one till there are no more of them or a solution is found
+    /// @param pointer to a ParallelSolveData_t structure
+    /// @return NULL
+    static void* SolveThreadRoutine(void *a_threadParam);
 
     // prevent this class to be instantiated without the proper arguments
     GameTotalAllocation();
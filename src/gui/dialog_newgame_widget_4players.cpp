@@ -24,21 +24,44 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 22-Nov-2010  Original development. Moved from gui_dialog_newgame.cpp
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Board size limited to BOARD_MAX_ROWS x BOARD_MAX_COLUMNS
+///           agent              17-Oct-2026  Type of player (human or computer)
 /// @endhistory
 ///
 // ============================================================================
 
 #include "gui/dialog_newgame_widget_4players.h"
 #include "gettext.h" // i18n
+#include "board.h"
 #include "game_4players.h"
 #include "gui/game_4players_config.h"
 #include "gui/glade_defs.h"
 
 // maximum and minimum values for size of the total allocation board
 static const double MINIMUM_4PLAYERS_BOARD_NROWS = 4;
-static const double MAXIMUM_4PLAYERS_BOARD_NROWS = 99;
+static const double MAXIMUM_4PLAYERS_BOARD_NROWS = BOARD_MAX_ROWS;
 static const double MINIMUM_4PLAYERS_BOARD_NCOLS = 4;
-static const double MAXIMUM_4PLAYERS_BOARD_NCOLS = 99;
+static const double MAXIMUM_4PLAYERS_BOARD_NCOLS = BOARD_MAX_COLUMNS;
+
+// strings to be shown in the player type combo boxes
+static const char COMBO_PLAYER_TYPE_HUMAN[]    = N_("Human");
+static const char COMBO_PLAYER_TYPE_COMPUTER[] = N_("Computer");
+
+// glade names of the tables and type labels of each player
+static const char* const TABLE_PLAYER_NAMES[Game4Players::e_Game4_PlayersCount] =
+{
+    GUI_NEWGAME_4PLAYERS_TABLE_PLAYER1,
+    GUI_NEWGAME_4PLAYERS_TABLE_PLAYER2,
+    GUI_NEWGAME_4PLAYERS_TABLE_PLAYER3,
+    GUI_NEWGAME_4PLAYERS_TABLE_PLAYER4,
+};
+static const char* const TYPE_LABEL_NAMES[Game4Players::e_Game4_PlayersCount] =
+{
+    GUI_NEWGAME_4PLAYERS_PLAYER1_TYPE_LABEL,
+    GUI_NEWGAME_4PLAYERS_PLAYER2_TYPE_LABEL,
+    GUI_NEWGAME_4PLAYERS_PLAYER3_TYPE_LABEL,
+    GUI_NEWGAME_4PLAYERS_PLAYER4_TYPE_LABEL,
+};
 
 NewGameTable4Players::NewGameTable4Players(
     BaseObjectType* cobject,
@@ -217,10 +240,53 @@ NewGameTable4Players::NewGameTable4Players(
     {
         throw new GUIException(e_GUIException_GTKBuilderErr, __FILE__, __LINE__);
     }
+    for (int32_t i = 0; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        m_gtkBuilder->get_widget(TYPE_LABEL_NAMES[i], m_typeLabel[i]);
+        if (m_typeLabel[i] == NULL)
+        {
+            throw new GUIException(e_GUIException_GTKBuilderErr, __FILE__, __LINE__);
+        }
+
+        m_gtkBuilder->get_widget(TABLE_PLAYER_NAMES[i], m_tablePlayer[i]);
+        if (m_tablePlayer[i] == NULL)
+        {
+            throw new GUIException(e_GUIException_GTKBuilderErr, __FILE__, __LINE__);
+        }
+    }
 
     // this call will work in different ways depending on the current platform
     ForceTranslationOfWidgets();
 
+    // type combo boxes (not present in the .glade file). They are attached
+    // on the 2nd row of the table of each player
+    for (int32_t i = 0; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        m_comboTypePlayer[i].insert_text( 0, _(COMBO_PLAYER_TYPE_HUMAN) );
+        m_comboTypePlayer[i].append_text( _(COMBO_PLAYER_TYPE_COMPUTER) );
+        if (Game4PlayersConfig::Instance().IsPlayerComputer(
+                static_cast<Game4Players::eGame4_Player_t>(i)))
+        {
+            m_comboTypePlayer[i].set_active_text( _(COMBO_PLAYER_TYPE_COMPUTER) );
+        }
+        else
+        {
+            m_comboTypePlayer[i].set_active_text( _(COMBO_PLAYER_TYPE_HUMAN) );
+        }
+
+        m_tablePlayer[i]->attach(
+                m_comboTypePlayer[i],
+                1,
+                4,
+                1,
+                2,
+                Gtk::FILL | Gtk::EXPAND,
+                Gtk::EXPAND,
+                0,
+                0);
+        m_comboTypePlayer[i].show();
+    }
+
     // adjustments for spinbuttons
     m_spinbuttonNRows->set_adjustment(m_spinbuttonNRowsAdj);
     m_spinbuttonNCols->set_adjustment(m_spinbuttonNColsAdj);
@@ -526,6 +592,11 @@ void NewGameTable4Players::UpdateStartingCoordValue(
     }
 }
 
+bool NewGameTable4Players::IsPlayerTypeComputer(Game4Players::eGame4_Player_t a_player) const
+{
+    return (m_comboTypePlayer[a_player].get_active_text().compare(_(COMBO_PLAYER_TYPE_COMPUTER)) == 0);
+}
+
 void NewGameTable4Players::SaveCurrentConfigIntoGlobalSettings() const
 {
     // retrieve user settings from dialog and use them to set up global configuration
@@ -543,6 +614,19 @@ void NewGameTable4Players::SaveCurrentConfigIntoGlobalSettings() const
             static_cast<int32_t>(m_spinbuttonNRowsAdj.get_value()));
     Game4PlayersConfig::Instance().SetNColumns(
         static_cast<int32_t>(m_spinbuttonNColsAdj.get_value()));
+
+    for (int32_t i = 0; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        Game4Players::eGame4_Player_t player = static_cast<Game4Players::eGame4_Player_t>(i);
+        if (this->IsPlayerTypeComputer(player))
+        {
+            Game4PlayersConfig::Instance().SetPlayerType(player, Game4PlayersConfig::e_playerComputer);
+        }
+        else
+        {
+            Game4PlayersConfig::Instance().SetPlayerType(player, Game4PlayersConfig::e_playerHuman);
+        }
+    }
 }
 
 void NewGameTable4Players::LoadCurrentConfigFromGlobalSettings()
@@ -583,6 +667,19 @@ void NewGameTable4Players::LoadCurrentConfigFromGlobalSettings()
         m_spinbuttonStartingColumnPlayer4Adj.set_value(
                 Game4PlayersConfig::Instance().GetStartingCoord(Game4Players::e_Game4_Player4).m_col + 1);
     }
+
+    for (int32_t i = 0; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        if (Game4PlayersConfig::Instance().IsPlayerComputer(
+                static_cast<Game4Players::eGame4_Player_t>(i)))
+        {
+            m_comboTypePlayer[i].set_active_text( _(COMBO_PLAYER_TYPE_COMPUTER) );
+        }
+        else
+        {
+            m_comboTypePlayer[i].set_active_text( _(COMBO_PLAYER_TYPE_HUMAN) );
+        }
+    }
 }
 
 #ifdef WIN32
@@ -615,6 +712,10 @@ void NewGameTable4Players::ForceTranslationOfWidgets()
     m_startingColLabel3->set_text(_(m_startingColLabel3->get_text().c_str()));
     m_startingRowLabel4->set_text(_(m_startingRowLabel4->get_text().c_str()));
     m_startingColLabel4->set_text(_(m_startingColLabel4->get_text().c_str()));
+    for (int32_t i = 0; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        m_typeLabel[i]->set_text(_(m_typeLabel[i]->get_text().c_str()));
+    }
 }
 #else
 void NewGameTable4Players::ForceTranslationOfWidgets()
@@ -24,6 +24,7 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 22-Nov-2010  Original development. Moved from gui_dialog_newgame.h
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Type of player (human or computer)
 /// @endhistory
 ///
 // ============================================================================
@@ -35,6 +36,7 @@
 #include "gui/dialog_newgame_widget.h"
 #include "gui/gui_exception.h"
 #include "coordinate.h"
+#include "game_4players.h"
 
 /// @brief table to be shown on the new game dialog when the user selects
 ///        a 4 players game
@@ -129,6 +131,16 @@ private:
     Gtk::Label* m_startingColLabel3;
     Gtk::Label* m_startingRowLabel4;
     Gtk::Label* m_startingColLabel4;
+    Gtk::Label* m_typeLabel[Game4Players::e_Game4_PlayersCount];
+
+    /// tables where the player settings are shown. The type combo boxes are attached to them
+    Gtk::Table* m_tablePlayer[Game4Players::e_Game4_PlayersCount];
+
+    /// type of each player (human or computer)
+    Gtk::ComboBoxText m_comboTypePlayer[Game4Players::e_Game4_PlayersCount];
+
+    /// @return true if the type combo box of a_player is set to computer
+    bool IsPlayerTypeComputer(Game4Players::eGame4_Player_t a_player) const;
 
     /// @brief callback for whenever the spinbutton for the number of rows is changed
     void SpinButtonNRows_SignalValueChanged();
@@ -24,12 +24,14 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 22-Nov-2010  Original development. Moved from gui_dialog_newgame.cpp
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Board size limited to BOARD_MAX_ROWS x BOARD_MAX_COLUMNS
 /// @endhistory
 ///
 // ============================================================================
 
 #include "gui/dialog_newgame_widget_totalallocation.h"
 #include "gettext.h" // i18n
+#include "board.h"
 #include "game_total_allocation.h"
 #include "gui/game_total_allocation_config.h"
 #include "gui/glade_defs.h"
@@ -37,9 +39,9 @@
 
 // maximum and minimum values for size of the total allocation board
 static const double MINIMUM_TOTAL_ALLOC_BOARD_NROWS = 1;
-static const double MAXIMUM_TOTAL_ALLOC_BOARD_NROWS = 99;
+static const double MAXIMUM_TOTAL_ALLOC_BOARD_NROWS = BOARD_MAX_ROWS;
 static const double MINIMUM_TOTAL_ALLOC_BOARD_NCOLS = 1;
-static const double MAXIMUM_TOTAL_ALLOC_BOARD_NCOLS = 99;
+static const double MAXIMUM_TOTAL_ALLOC_BOARD_NCOLS = BOARD_MAX_COLUMNS;
 
 NewGameTableTotalAllocation::NewGameTableTotalAllocation(
     BaseObjectType* cobject,
@@ -25,6 +25,11 @@
 ///           Faustino Frechilla 29-Apr-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
 ///           Faustino Frechilla 26-Nov-2010  Renamed to game_1v1_config.cpp
+///           agent              17-Oct-2026  Number of threads used by MinMax
+///           agent              17-Oct-2026  Size of the transposition table
+///           agent              17-Oct-2026  Time budget of autoadjusted searches
+///           agent              17-Oct-2026  Pondering
+///           agent              17-Oct-2026  Opening book
 /// @endhistory
 ///
 // ============================================================================
@@ -47,6 +52,11 @@ Game1v1Config::Game1v1Config() :
     m_player2Type(DEFAULT_PLAYER2_TYPE),
     m_minimaxDepthPlayer1(DEFAULT_MINIMAX_DEPTH),
     m_minimaxDepthPlayer2(DEFAULT_MINIMAX_DEPTH),
+    m_minimaxTimeBudget(DEFAULT_MINIMAX_TIME_BUDGET),
+    m_minimaxThreads(DEFAULT_MINIMAX_THREADS),
+    m_transTableSize(DEFAULT_TRANS_TABLE_SIZE),
+    m_pondering(DEFAULT_PONDERING),
+    m_openingBook(NULL),
     m_player1Red(DEFAULT_PLAYER1_COLOUR_R),
     m_player1Green(DEFAULT_PLAYER1_COLOUR_G),
     m_player1Blue(DEFAULT_PLAYER1_COLOUR_B),
@@ -92,6 +102,31 @@ int32_t Game1v1Config::GetMinimaxDepthPlayer2() const
     return m_minimaxDepthPlayer2;
 }
 
+int32_t Game1v1Config::GetMinimaxTimeBudget() const
+{
+    return m_minimaxTimeBudget;
+}
+
+int32_t Game1v1Config::GetMinimaxThreads() const
+{
+    return m_minimaxThreads;
+}
+
+int32_t Game1v1Config::GetTranspositionTableSize() const
+{
+    return m_transTableSize;
+}
+
+bool Game1v1Config::IsPonderingEnabled() const
+{
+    return m_pondering;
+}
+
+const OpeningBook* Game1v1Config::GetOpeningBook() const
+{
+    return m_openingBook;
+}
+
 void Game1v1Config::GetPlayer1Colour(uint8_t &red, uint8_t &green, uint8_t &blue) const
 {
     red   = m_player1Red;
@@ -170,6 +205,60 @@ void Game1v1Config::SetMinimaxDepthPlayer2(int32_t a_depth)
     }
 }
 
+void Game1v1Config::SetMinimaxTimeBudget(int32_t a_timeBudgetMs)
+{
+    if (a_timeBudgetMs <= 0)
+    {
+        m_minimaxTimeBudget = DEFAULT_MINIMAX_TIME_BUDGET;
+    }
+    else
+    {
+        m_minimaxTimeBudget = a_timeBudgetMs;
+    }
+}
+
+void Game1v1Config::SetMinimaxThreads(int32_t a_nThreads)
+{
+    if (a_nThreads <= 0)
+    {
+        m_minimaxThreads = 1;
+    }
+    else if (a_nThreads > GAME1V1_MAX_SEARCH_THREADS)
+    {
+        m_minimaxThreads = GAME1V1_MAX_SEARCH_THREADS;
+    }
+    else
+    {
+        m_minimaxThreads = a_nThreads;
+    }
+}
+
+void Game1v1Config::SetTranspositionTableSize(int32_t a_sizeMB)
+{
+    if (a_sizeMB <= 0)
+    {
+        m_transTableSize = 0;
+    }
+    else if (a_sizeMB > TRANSPOSITION_TABLE_MAX_SIZE_MB)
+    {
+        m_transTableSize = TRANSPOSITION_TABLE_MAX_SIZE_MB;
+    }
+    else
+    {
+        m_transTableSize = a_sizeMB;
+    }
+}
+
+void Game1v1Config::SetPondering(bool a_enabled)
+{
+    m_pondering = a_enabled;
+}
+
+void Game1v1Config::SetOpeningBook(const OpeningBook* a_openingBook)
+{
+    m_openingBook = a_openingBook;
+}
+
 void Game1v1Config::SetPlayer1StartingCoord(const Coordinate &a_startingCoord)
 {
     m_player1StartingCoord = a_startingCoord;
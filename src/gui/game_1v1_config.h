@@ -25,6 +25,11 @@
 ///           Faustino Frechilla 29-Apr-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
 ///           Faustino Frechilla 26-Nov-2010  Renamed to game_1v1_config.h
+///           agent              17-Oct-2026  Number of threads used by MinMax
+///           agent              17-Oct-2026  Size of the transposition table
+///           agent              17-Oct-2026  Time budget of autoadjusted searches
+///           agent              17-Oct-2026  Pondering
+///           agent              17-Oct-2026  Opening book
 /// @endhistory
 ///
 // ============================================================================
@@ -59,6 +64,12 @@ public:
     static const Game1v1Config::ePlayerType_t DEFAULT_PLAYER1_TYPE      = Game1v1Config::e_playerHuman;
     static const Game1v1Config::ePlayerType_t DEFAULT_PLAYER2_TYPE      = Game1v1Config::e_playerComputer;
     static const int32_t                      DEFAULT_MINIMAX_DEPTH     = GAME1V1CONFIG_DEPTH_AUTOADJUST;
+    // the parallel search is slower than the 1-thread one on a single core, and its
+    // speedup on several cores hasn't been measured yet (see scripts/do_benchmark_threads.sh)
+    static const int32_t                      DEFAULT_MINIMAX_THREADS   = 1;
+    static const int32_t                      DEFAULT_TRANS_TABLE_SIZE  = TRANSPOSITION_TABLE_DEFAULT_SIZE_MB;
+    static const int32_t                      DEFAULT_MINIMAX_TIME_BUDGET = 2000;
+    static const bool                         DEFAULT_PONDERING         = true;
     static const int32_t                      DEFAULT_STARTING_ROW_1    = DEFAULT_STARTING_ROW_PLAYER1;
     static const int32_t                      DEFAULT_STARTING_COL_1    = DEFAULT_STARTING_COL_PLAYER1;
     static const int32_t                      DEFAULT_STARTING_ROW_2    = DEFAULT_STARTING_ROW_PLAYER2;
@@ -73,11 +84,27 @@ public:
     /// @brief returns true if player2 is set to computer type
     bool IsPlayer2Computer() const;
     /// @brief returns the minimax depth for player1
-    /// GAME1V1CONFIG_DEPTH_AUTOADJUST means autoadjust value depending on complexity of search tree
+    /// GAME1V1CONFIG_DEPTH_AUTOADJUST means the search will go as deep as it can
+    /// within the time budget (see GetMinimaxTimeBudget)
     int32_t GetMinimaxDepthPlayer1() const;
     /// @brief returns the minimax depth for player1
-    /// GAME1V1CONFIG_DEPTH_AUTOADJUST means autoadjust value depending on complexity of search tree
+    /// GAME1V1CONFIG_DEPTH_AUTOADJUST means the search will go as deep as it can
+    /// within the time budget (see GetMinimaxTimeBudget)
     int32_t GetMinimaxDepthPlayer2() const;
+    /// @brief returns the time (in milliseconds) a search whose depth is set to
+    /// GAME1V1CONFIG_DEPTH_AUTOADJUST is allowed to take
+    int32_t GetMinimaxTimeBudget() const;
+    /// @brief returns the number of threads the minimax search will be split into
+    int32_t GetMinimaxThreads() const;
+    /// @brief returns the size (in MB) of the transposition table used by the minimax search
+    /// 0 means the transposition table is disabled
+    int32_t GetTranspositionTableSize() const;
+    /// @brief returns true if the computer keeps on searching while a human
+    /// opponent thinks of their move (see MainWindowWorkerThread::ComputeMove)
+    bool IsPonderingEnabled() const;
+    /// @brief returns the opening book 1vs1 games read their first moves from
+    /// NULL if there's none
+    const OpeningBook* GetOpeningBook() const;
     /// @brief gets the colour of player1
     /// saves the values in the 3 paremeter references
     void GetPlayer1Colour(uint8_t &red, uint8_t &green, uint8_t &blue) const;
@@ -105,6 +132,23 @@ public:
     /// if a_depth is lower or equal to 0, minimax depth will be set to GAME1V1CONFIG_DEPTH_AUTOADJUST,
     /// which means autoadjust value depending on complexity of search tree
     void SetMinimaxDepthPlayer2(int32_t a_depth);
+    /// @brief sets the time (in milliseconds) a search whose depth is set to
+    /// GAME1V1CONFIG_DEPTH_AUTOADJUST is allowed to take
+    /// if a_timeBudgetMs is lower or equal to 0 it will be set to DEFAULT_MINIMAX_TIME_BUDGET
+    void SetMinimaxTimeBudget(int32_t a_timeBudgetMs);
+    /// @brief sets the number of threads the minimax search will be split into
+    /// if a_nThreads is lower or equal to 0 it will be set to 1. It is capped to
+    /// GAME1V1_MAX_SEARCH_THREADS
+    void SetMinimaxThreads(int32_t a_nThreads);
+    /// @brief sets the size (in MB) of the transposition table used by the minimax search
+    /// 0 (or a negative value) disables it. It is capped to TRANSPOSITION_TABLE_MAX_SIZE_MB
+    void SetTranspositionTableSize(int32_t a_sizeMB);
+    /// @brief enables or disables pondering (searching on the human opponent's time)
+    void SetPondering(bool a_enabled);
+    /// @brief sets the opening book 1vs1 games read their first moves from
+    /// The book is not copied, so it must be valid while this configuration
+    /// is in use. NULL disables it
+    void SetOpeningBook(const OpeningBook* a_openingBook);
     /// @brief set player1's starting coordinate
     void SetPlayer1StartingCoord(const Coordinate &a_startingCoord);
     /// @brief set player2's starting coordinate
@@ -119,10 +163,20 @@ private:
     ePlayerType_t m_player1Type;
     /// type of player of player2
     ePlayerType_t m_player2Type;
-    /// depth for the minimax algorithm for player1. GAME1V1CONFIG_DEPTH_AUTOADJUST means autoadjust
+    /// depth for the minimax algorithm for player1. GAME1V1CONFIG_DEPTH_AUTOADJUST means time budgeted
     int32_t m_minimaxDepthPlayer1;
-    /// depth for the minimax algorithm for player2. GAME1V1CONFIG_DEPTH_AUTOADJUST means autoadjust
+    /// depth for the minimax algorithm for player2. GAME1V1CONFIG_DEPTH_AUTOADJUST means time budgeted
     int32_t m_minimaxDepthPlayer2;
+    /// time budget (in ms) of searches with depth set to GAME1V1CONFIG_DEPTH_AUTOADJUST
+    int32_t m_minimaxTimeBudget;
+    /// number of threads used by the minimax algorithm (for both players)
+    int32_t m_minimaxThreads;
+    /// size (in MB) of the transposition table used by the minimax algorithm
+    int32_t m_transTableSize;
+    /// true if the computer searches while a human opponent thinks
+    bool m_pondering;
+    /// opening book used by the computer (NULL if there's none)
+    const OpeningBook* m_openingBook;
     /// red channel of player1's colour
     uint8_t m_player1Red;
     /// green channel of player1's colour
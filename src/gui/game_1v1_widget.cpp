@@ -25,6 +25,10 @@
 ///           Faustino Frechilla 05-Oct-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
 ///           Faustino Frechilla 26-Nov-2010  Renamed to game_1v1_widget.cpp
+///           agent              17-Oct-2026  Time budgeted search replaces autoadjusted depth
+///           agent              17-Oct-2026  Search statistics shown in the status bar
+///           agent              17-Oct-2026  Pondering while the human opponent thinks
+///           agent              17-Oct-2026  Opening book
 /// @endhistory
 ///
 // ============================================================================
@@ -83,6 +87,9 @@ Game1v1Widget::Game1v1Widget():
     Game1v1Config::Instance().GetPlayer2Colour(red, green, blue);
     m_the1v1Game.SetPlayerColour(Game1v1::e_Game1v1Player2, red, green, blue);
 
+    // the computer will read its first moves from the opening book (if any)
+    m_the1v1Game.SetOpeningBook(Game1v1Config::Instance().GetOpeningBook());
+
     // configure the widgets
     m_hBoxEditPieces.set_spacing(10);
     m_hBoxEditPieces.set_size_request(-1, 200);
@@ -262,13 +269,10 @@ void Game1v1Widget::ShowOpponentsPieces(bool a_showPieces)
 
 void Game1v1Widget::LaunchNewGame()
 {
-    if (m_workerThread.IsThreadComputingMove())
-    {
-        // stop worker thread. Current calculation won't be needed in the new game
-        // this call blocks the current thread until the worker thread is ready to
-        // calculate next move
-        m_workerThread.CancelComputing();
-    }
+    // stop worker thread. Current calculation (or pondering) won't be needed in
+    // the new game. This call blocks the current thread until the worker thread
+    // is ready to calculate next move. It does nothing if the thread is idle
+    m_workerThread.CancelComputing();
 
     // clear old moves from the move queue. They belong to the old game
     while (!m_moveQueue.IsEmpty())
@@ -314,6 +318,7 @@ void Game1v1Widget::LaunchNewGame()
         s_computingCurrentProgress = 0.0;
     G_UNLOCK(s_computingCurrentProgress);
     m_statusBar.SetFraction(0.0);
+    m_statusBar.ClearSearchStats();
 
     // Start player1's timer
     m_statusBar.ContinueStopwatch(1);
@@ -518,24 +523,24 @@ void Game1v1Widget::RequestThreadToComputeNextMove(
 
     const Heuristic::sHeuristicData_t &heuristicData = Heuristic::m_heuristicData[heuristicType];
     const Player &currentPlayer = m_the1v1Game.GetPlayer(a_whoMoves);
-    const Player &opponent = m_the1v1Game.GetOpponent(a_whoMoves);
 
-    // search tree depth. If it is set to GAME1V1CONFIG_DEPTH_AUTOADJUST
-    // its value will be set here to a sensible value
+    // search tree depth. If it is set to GAME1V1CONFIG_DEPTH_AUTOADJUST the
+    // search will go as deep as it can within the configured time budget
+    int32_t timeBudgetMs = 0;
     if (searchTreeDepth == GAME1V1CONFIG_DEPTH_AUTOADJUST)
     {
-        searchTreeDepth = 3;
-
-        //TODO 14 is a magic number
-        if ( (currentPlayer.NumberOfPiecesAvailable() < 14) &&
-             (rules::CanPlayerGo(m_the1v1Game.GetBoard(), opponent) ) )
-        {
-            // if the opponent cannot go there is no point on setting the depth to 5.
-            // 3 should be good enough in that case
-            searchTreeDepth = 5;
-        }
+        searchTreeDepth = GAME1V1_MAX_SEARCH_DEPTH;
+        timeBudgetMs    = Game1v1Config::Instance().GetMinimaxTimeBudget();
     }
 
+    // the computer thinks on its opponent's time if it is a human being. It
+    // would be cancelled straight away by the next request otherwise
+    bool ponder = Game1v1Config::Instance().IsPonderingEnabled() &&
+        ( ( (a_whoMoves == Game1v1::e_Game1v1Player1) &&
+            !Game1v1Config::Instance().IsPlayer2Computer() ) ||
+          ( (a_whoMoves == Game1v1::e_Game1v1Player2) &&
+            !Game1v1Config::Instance().IsPlayer1Computer() ) );
+
     bool computeMoveSucceded;
     if ( (currentPlayer.NumberOfPiecesAvailable() == e_numberOfPieces) &&
          (g_rand_int_range(m_randomizer, 0, 2) == 0) )
@@ -547,6 +552,10 @@ void Game1v1Widget::RequestThreadToComputeNextMove(
                                     a_whoMoves,
                                     heuristicData.m_evalFunction,
                                     searchTreeDepth,
+                                    timeBudgetMs,
+                                    Game1v1Config::Instance().GetMinimaxThreads(),
+                                    Game1v1Config::Instance().GetTranspositionTableSize(),
+                                    ponder,
                                     a_blockCall);
     }
     else
@@ -558,6 +567,10 @@ void Game1v1Widget::RequestThreadToComputeNextMove(
                                     a_whoMoves,
                                     heuristicData.m_evalFunction,
                                     searchTreeDepth,
+                                    timeBudgetMs,
+                                    Game1v1Config::Instance().GetMinimaxThreads(),
+                                    Game1v1Config::Instance().GetTranspositionTableSize(),
+                                    ponder,
                                     a_blockCall,
                                     a_coordinate,
                                     a_piece);
@@ -587,7 +600,8 @@ void Game1v1Widget::WorkerThread_computingFinished(
         const Piece              &a_piece,
         const Coordinate         &a_coord,
         Game1v1::eGame1v1Player_t a_playerToMove,
-        int32_t                   a_returnValue)
+        int32_t                   a_returnValue,
+        const Game1v1::SearchStats_t &a_searchStats)
 {
     // WARNING: this method is run by another thread.
     // once the m_signal_moveComputed signal is emited the
@@ -596,6 +610,8 @@ void Game1v1Widget::WorkerThread_computingFinished(
     thisMove.piece = a_piece;
     thisMove.coord = a_coord;
     thisMove.playerToMove = a_playerToMove;
+    thisMove.computed = true;
+    thisMove.searchStats = a_searchStats;
 
     // if the queue is full this call might block, but there aren't that many moves really...
     m_moveQueue.Push(thisMove);
@@ -657,6 +673,7 @@ void Game1v1Widget::BoardDrawingArea_BoardClicked(
     thisMove.piece = a_piece;
     thisMove.coord = a_coord;
     thisMove.playerToMove =  m_the1v1Game.GetPlayerType(a_player);
+    thisMove.computed = false;
 
     // main thread cannot get blocked, if it fails inserting the element in
     // the queue just do nothing
@@ -730,6 +747,12 @@ void Game1v1Widget::NotifyMoveComputed()
         latestCoord        = currentMove.coord;
         latestPlayerToMove = currentMove.playerToMove;
 
+        if (currentMove.computed)
+        {
+            // show how the computer calculated its move
+            m_statusBar.SetSearchStats(currentMove.searchStats);
+        }
+
         if (latestPiece.GetType() != e_noPiece)
         {
             m_the1v1Game.PutDownPiece(
@@ -25,6 +25,7 @@
 ///           Faustino Frechilla 05-Oct-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
 ///           Faustino Frechilla 26-Nov-2010  Renamed to game_1v1_widget.h
+///           agent              17-Oct-2026  Search statistics shown in the status bar
 /// @endhistory
 ///
 // ============================================================================
@@ -140,6 +141,10 @@ private:
         Piece                     piece;
         Coordinate                coord;
         Game1v1::eGame1v1Player_t playerToMove;
+        /// true if the move was calculated by MinMax (searchStats are valid)
+        bool                      computed;
+        /// statistics of the search which calculated the move
+        Game1v1::SearchStats_t    searchStats;
     } CalculatedMove_t;
 
     /// @brief current game is finished. It is set to false at the beginning of a game
@@ -215,7 +220,8 @@ private:
             const Piece              &a_piece,
             const Coordinate         &a_coord,
             Game1v1::eGame1v1Player_t a_playerToMove,
-            int32_t                   a_returnValue);
+            int32_t                   a_returnValue,
+            const Game1v1::SearchStats_t &a_searchStats);
 
     /// @brief requests the worker thread to compute a move
     /// It finishes the app if there's an error communicating with this thread
@@ -24,6 +24,7 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 17-Nov-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Computer players
 /// @endhistory
 ///
 // ============================================================================
@@ -60,7 +61,11 @@ static const Coordinate PLAYER4_DEFAULT_STARTING_COORD =
 Game4PlayersConfig::Game4PlayersConfig() :
     Singleton<Game4PlayersConfig>(),
     m_nRows(DEFAULT_NROWS),
-    m_nColumns(DEFAULT_NCOLS)
+    m_nColumns(DEFAULT_NCOLS),
+    m_currentHeuristic(DEFAULT_CURRENT_HEURISTIC),
+    m_minimaxDepth(DEFAULT_MINIMAX_DEPTH),
+    m_minimaxTimeBudget(DEFAULT_MINIMAX_TIME_BUDGET),
+    m_minimaxThreads(DEFAULT_MINIMAX_THREADS)
 {
     // set default starting coords
     m_startingCoords[0] = PLAYER1_DEFAULT_STARTING_COORD;
@@ -84,6 +89,12 @@ Game4PlayersConfig::Game4PlayersConfig() :
     m_redArray[3]   = DEFAULT_PLAYER4_COLOUR_R;
     m_greenArray[3] = DEFAULT_PLAYER4_COLOUR_G;
     m_blueArray[3]  = DEFAULT_PLAYER4_COLOUR_B;
+
+    // player1 is a human being. The rest are played by the computer
+    m_playerTypes[0] = DEFAULT_PLAYER1_TYPE;
+    m_playerTypes[1] = DEFAULT_OPPONENTS_TYPE;
+    m_playerTypes[2] = DEFAULT_OPPONENTS_TYPE;
+    m_playerTypes[3] = DEFAULT_OPPONENTS_TYPE;
 }
 
 Game4PlayersConfig::~Game4PlayersConfig()
@@ -144,6 +155,88 @@ void Game4PlayersConfig::SetNColumns(int32_t a_nColumns)
     m_nColumns = a_nColumns;
 }
 
+bool Game4PlayersConfig::IsPlayerComputer(
+    Game4Players::eGame4_Player_t a_player) const
+{
+    return (m_playerTypes[GetInternalIndex(a_player)] == e_playerComputer);
+}
+
+Heuristic::eHeuristicType_t Game4PlayersConfig::GetHeuristicType() const
+{
+    return m_currentHeuristic;
+}
+
+int32_t Game4PlayersConfig::GetMinimaxDepth() const
+{
+    return m_minimaxDepth;
+}
+
+int32_t Game4PlayersConfig::GetMinimaxTimeBudget() const
+{
+    return m_minimaxTimeBudget;
+}
+
+int32_t Game4PlayersConfig::GetMinimaxThreads() const
+{
+    return m_minimaxThreads;
+}
+
+void Game4PlayersConfig::SetPlayerType(
+        Game4Players::eGame4_Player_t a_player,
+        ePlayerType_t                 a_playerType)
+{
+    m_playerTypes[GetInternalIndex(a_player)] = a_playerType;
+}
+
+void Game4PlayersConfig::SetHeuristicType(Heuristic::eHeuristicType_t a_heuristic)
+{
+    m_currentHeuristic = a_heuristic;
+}
+
+void Game4PlayersConfig::SetMinimaxDepth(int32_t a_depth)
+{
+    if (a_depth <= 0)
+    {
+        m_minimaxDepth = GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST;
+    }
+    else if (a_depth > GAME4PLAYERS_MAX_SEARCH_DEPTH)
+    {
+        m_minimaxDepth = GAME4PLAYERS_MAX_SEARCH_DEPTH;
+    }
+    else
+    {
+        m_minimaxDepth = a_depth;
+    }
+}
+
+void Game4PlayersConfig::SetMinimaxTimeBudget(int32_t a_timeBudgetMs)
+{
+    if (a_timeBudgetMs <= 0)
+    {
+        m_minimaxTimeBudget = DEFAULT_MINIMAX_TIME_BUDGET;
+    }
+    else
+    {
+        m_minimaxTimeBudget = a_timeBudgetMs;
+    }
+}
+
+void Game4PlayersConfig::SetMinimaxThreads(int32_t a_nThreads)
+{
+    if (a_nThreads <= 0)
+    {
+        m_minimaxThreads = 1;
+    }
+    else if (a_nThreads > GAME4PLAYERS_MAX_SEARCH_THREADS)
+    {
+        m_minimaxThreads = GAME4PLAYERS_MAX_SEARCH_THREADS;
+    }
+    else
+    {
+        m_minimaxThreads = a_nThreads;
+    }
+}
+
 int32_t Game4PlayersConfig::GetInternalIndex(
     Game4Players::eGame4_Player_t a_player) const
 {
@@ -24,6 +24,7 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 17-Nov-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Computer players
 /// @endhistory
 ///
 // ============================================================================
@@ -32,15 +33,50 @@
 #define __GUI_GAME_4PLAYERS_CONFIG__
 
 #include "singleton.h"
+#include "heuristic.h"
 #include "coordinate.h"
 #include "game_4players.h" // eGame4_Player_t
 
+/// depth should be set to this value whenever search tree depth is
+/// left up to the Application
+const int32_t GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST = 0;
 
 /// singleton which stores the configuration to apply to 4players games
 class Game4PlayersConfig :
     public Singleton<Game4PlayersConfig>
 {
-public:    
+public:
+    // types of players. Human being and computer
+    typedef enum
+    {
+        e_playerComputer,
+        e_playerHuman,
+    } ePlayerType_t;
+
+    // consts used to set default values of 4players games. They are declared here
+    // so they can be accesed from other files/classes
+    static const Heuristic::eHeuristicType_t       DEFAULT_CURRENT_HEURISTIC   = Heuristic::e_heuristicInfluenceArea;
+    static const Game4PlayersConfig::ePlayerType_t DEFAULT_PLAYER1_TYPE        = Game4PlayersConfig::e_playerHuman;
+    static const Game4PlayersConfig::ePlayerType_t DEFAULT_OPPONENTS_TYPE      = Game4PlayersConfig::e_playerComputer;
+    static const int32_t                           DEFAULT_MINIMAX_DEPTH       = GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST;
+    static const int32_t                           DEFAULT_MINIMAX_THREADS     = 1;
+    static const int32_t                           DEFAULT_MINIMAX_TIME_BUDGET = 2000;
+
+    /// @return true if a_player is played by the computer
+    /// If a_player is not e_Game4_Player[1-4] info returned is undefined
+    bool IsPlayerComputer(Game4Players::eGame4_Player_t a_player) const;
+    /// @return heuristic the computer players evaluate positions with. It can be
+    ///         used as the index for Heuristic::m_heuristicData
+    Heuristic::eHeuristicType_t GetHeuristicType() const;
+    /// @brief returns the minimax depth of the computer players
+    /// GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST means the search will go as deep as it can
+    /// within the time budget (see GetMinimaxTimeBudget)
+    int32_t GetMinimaxDepth() const;
+    /// @brief returns the time (in milliseconds) a search whose depth is set to
+    /// GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST is allowed to take
+    int32_t GetMinimaxTimeBudget() const;
+    /// @brief returns the number of threads the minimax search will be split into
+    int32_t GetMinimaxThreads() const;
 
     /// If uninitialised game could start from anywhere in the board
     /// If a_player is not e_Game4_Player[1-4] info returned is undefined
@@ -78,6 +114,25 @@ public:
     void SetNRows(int32_t a_nRows);
     /// @brief set amount of columns of this game's board
     void SetNColumns(int32_t a_nColumns);
+    /// @brief sets the type of a_player (human or computer)
+    /// If a_player is not e_Game4_Player[1-4] behaviour is undefined
+    void SetPlayerType(
+        Game4Players::eGame4_Player_t a_player,
+        ePlayerType_t                 a_playerType);
+    /// @brief sets the heuristic the computer players evaluate positions with
+    void SetHeuristicType(Heuristic::eHeuristicType_t a_heuristic);
+    /// @brief sets the minimax depth of the computer players
+    /// if a_depth is lower or equal to 0, minimax depth will be set to
+    /// GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST. It is capped to GAME4PLAYERS_MAX_SEARCH_DEPTH
+    void SetMinimaxDepth(int32_t a_depth);
+    /// @brief sets the time (in milliseconds) a search whose depth is set to
+    /// GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST is allowed to take
+    /// if a_timeBudgetMs is lower or equal to 0 it will be set to DEFAULT_MINIMAX_TIME_BUDGET
+    void SetMinimaxTimeBudget(int32_t a_timeBudgetMs);
+    /// @brief sets the number of threads the minimax search will be split into
+    /// if a_nThreads is lower or equal to 0 it will be set to 1. It is capped to
+    /// GAME4PLAYERS_MAX_SEARCH_THREADS
+    void SetMinimaxThreads(int32_t a_nThreads);
 
 private:
     /// number of rows of the board
@@ -94,9 +149,20 @@ private:
     uint8_t m_greenArray[4];
     /// array of 4 uint8_t which saves the blue colour for each player
     uint8_t m_blueArray[4];
+
+    /// type of each player
+    ePlayerType_t m_playerTypes[4];
+    /// heuristic of the computer players
+    Heuristic::eHeuristicType_t m_currentHeuristic;
+    /// depth of the searches of the computer players
+    int32_t m_minimaxDepth;
+    /// time budget (in milliseconds) of the autoadjusted searches
+    int32_t m_minimaxTimeBudget;
+    /// number of threads of the searches
+    int32_t m_minimaxThreads;
     
     /// @return internal index that corresponds to a_player to be used with:
-    ///         m_startingCoords, m_redArray, m_greenArray and m_blueArray
+    ///         m_startingCoords, m_redArray, m_greenArray, m_blueArray and m_playerTypes
     int32_t GetInternalIndex(Game4Players::eGame4_Player_t a_player) const;
 
     friend class Singleton<Game4PlayersConfig>;
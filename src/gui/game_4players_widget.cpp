@@ -24,6 +24,7 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 17-Nov-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Computer players (worker thread)
 /// @endhistory
 ///
 // ============================================================================
@@ -34,6 +35,8 @@
 #include <iomanip>   // setw
 #endif
 
+#include <sstream>
+
 #include "gettext.h" // i18n
 #include "gui/game_4players_widget.h"
 #include "gui/game_4players_config.h"
@@ -47,8 +50,10 @@ static const uint32_t GAME_FINISHED_BUFFER_LENGTH = 512;
 Game4PlayersWidget::Game4PlayersWidget():
     Gtk::VBox(), //Calls the base class constructor
     m_currentGameFinished(false),
+    m_moveQueue(),
     m_currentMovingPlayer(Game4Players::e_Game4_Player1),
     m_the4PlayersGame(),
+    m_workerThread(),
     m_boardDrawingArea(m_the4PlayersGame.GetBoard()),
     m_pickPiecesDrawingArea(     // player1 shown as current player
         m_the4PlayersGame.GetPlayer(Game4Players::e_Game4_Player1),
@@ -74,6 +79,15 @@ Game4PlayersWidget::Game4PlayersWidget():
     m_boardDrawingArea.signal_boardPicked().connect(
             sigc::mem_fun(*this, &Game4PlayersWidget::BoardDrawingArea_BoardClicked));
 
+    // connect the interthread communication (GLib::Dispatcher) to process
+    // the moves calculated by the worker thread
+    m_signal_moveComputed.connect(
+            sigc::mem_fun(*this, &Game4PlayersWidget::NotifyMoveComputed));
+
+    // connect the worker thread signal
+    m_workerThread.signal_computingFinished().connect(
+            sigc::mem_fun(*this, &Game4PlayersWidget::WorkerThread_computingFinished));
+
     // initialise the list of players of the board drawing area
     m_boardDrawingArea.AddPlayerToList(m_the4PlayersGame.GetPlayer(Game4Players::e_Game4_Player1));
     m_boardDrawingArea.AddPlayerToList(m_the4PlayersGame.GetPlayer(Game4Players::e_Game4_Player2));
@@ -102,6 +116,8 @@ Game4PlayersWidget::Game4PlayersWidget():
 
 Game4PlayersWidget::~Game4PlayersWidget()
 {
+    // delete the worker thread
+    m_workerThread.Join();
 }
 
 void Game4PlayersWidget::hide_all()
@@ -213,6 +229,18 @@ void Game4PlayersWidget::BuildGUI()
             sigc::mem_fun(m_boardDrawingArea, &DrawingAreaBoard::SetCurrentPiece));
 }
 
+void Game4PlayersWidget::CancelComputing()
+{
+    // reset the cursor and cancel the worker thread
+    ResetCursor();
+    m_workerThread.CancelComputing();
+}
+
+bool Game4PlayersWidget::IsComputingMove()
+{
+    return m_workerThread.IsThreadComputingMove();
+}
+
 DrawingAreaBoard& Game4PlayersWidget::BoardDrawingArea()
 {
     return m_boardDrawingArea;
@@ -284,6 +312,15 @@ void Game4PlayersWidget::ShowOpponentsPieces(bool a_showPieces)
 
 void Game4PlayersWidget::LaunchNewGame()
 {
+    // cancel the move the worker thread might be calculating and remove
+    // the moves which might be waiting to be processed
+    CancelComputing();
+    while (!m_moveQueue.IsEmpty())
+    {
+        CalculatedMove_t dummy;
+        m_moveQueue.Pop(dummy);
+    }
+
     m_the4PlayersGame.Reset(
         Game4PlayersConfig::Instance().GetNRows(),
         Game4PlayersConfig::Instance().GetNColumns(),
@@ -340,6 +377,18 @@ void Game4PlayersWidget::LaunchNewGame()
 
     // new game just started. It can't be finished!
     m_currentGameFinished = false;
+
+    if (Game4PlayersConfig::Instance().IsPlayerComputer(Game4Players::e_Game4_Player1))
+    {
+        // computer's go. Disallow editing the edit piece area
+        m_editPieceTable.set_sensitive(false);
+
+        RequestThreadToComputeNextMove(Game4Players::e_Game4_Player1);
+    }
+    else
+    {
+        m_editPieceTable.set_sensitive(true);
+    }
 }
 
 void Game4PlayersWidget::BoardDrawingArea_BoardClicked(
@@ -347,6 +396,17 @@ void Game4PlayersWidget::BoardDrawingArea_BoardClicked(
     const Piece &a_piece,
     const Player &a_player)
 {
+    if (m_workerThread.IsThreadComputingMove() ||
+        Game4PlayersConfig::Instance().IsPlayerComputer(m_currentMovingPlayer))
+    {
+#ifdef DEBUG_PRINT
+        std::cout
+            << "Worker thread is busy. Please be patient while it is calculating next move"
+            << std::endl;
+#endif
+        return;
+    }
+
     if (a_player.NumberOfPiecesAvailable() == e_numberOfPieces)
     {
         if ( ( (!a_player.GetStartingCoordinate().Initialised()) &&
@@ -385,22 +445,151 @@ void Game4PlayersWidget::BoardDrawingArea_BoardClicked(
         }
     }
 
-    // get type of player who clicked on the board
-    Game4Players::eGame4_Player_t thisPlayerType =
-        m_the4PlayersGame.GetPlayerType(a_player);
+    // don't save the move directly in the board. Use the same interface as the worker thread
+    // The game will be only be modified in NotifyMoveComputed
+    CalculatedMove_t thisMove;
+    thisMove.piece = a_piece;
+    thisMove.coord = a_coord;
+    thisMove.playerToMove = m_the4PlayersGame.GetPlayerType(a_player);
+
+    // main thread cannot get blocked, if it fails inserting the element in
+    // the queue just do nothing
+    if (m_moveQueue.TryPush(thisMove) == false)
+    {
+#ifdef DEBUG_PRINT
+        std::cout << "Human move could not be added to the queue" << std::endl;
+#endif
+        return;
+    }
+
+    // both worker thread and human user use the same interface. There's no
+    // need to emit the interthread signal here though
+    NotifyMoveComputed();
+}
+
+void Game4PlayersWidget::WorkerThread_computingFinished(
+        const Piece                   &a_piece,
+        const Coordinate              &a_coord,
+        Game4Players::eGame4_Player_t  a_playerToMove,
+        int32_t                        a_returnValue)
+{
+    // WARNING: this method is run by another thread.
+    // once the m_signal_moveComputed signal is emited the
+    // main thread will update the GUI widgets
+    CalculatedMove_t thisMove;
+    thisMove.piece = a_piece;
+    thisMove.coord = a_coord;
+    thisMove.playerToMove = a_playerToMove;
+
+    // if the queue is full this call might block, but there aren't that many moves really...
+    m_moveQueue.Push(thisMove);
+
+#ifdef DEBUG_PRINT
+    if (a_piece.GetType() == e_noPiece)
+    {
+        std::cout << "Computer can't move" << std::endl;
+    }
+#endif
+
+    // GTK is not thread safe. The main thread will process the move
+    m_signal_moveComputed.emit();
+}
+
+void Game4PlayersWidget::RequestThreadToComputeNextMove(
+    Game4Players::eGame4_Player_t a_whoMoves)
+{
+    // set the cursor to busy in the board drawing area, so the user
+    // won't get (very) nervous while the computer is processing the next move
+    SetWaitCursor();
+
+    const Heuristic::sHeuristicData_t &heuristicData =
+        Heuristic::m_heuristicData[Game4PlayersConfig::Instance().GetHeuristicType()];
+
+    // search tree depth. If it is set to GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST the
+    // search will go as deep as it can within the configured time budget
+    int32_t searchTreeDepth = Game4PlayersConfig::Instance().GetMinimaxDepth();
+    int32_t timeBudgetMs = 0;
+    if (searchTreeDepth == GAME4PLAYERSCONFIG_DEPTH_AUTOADJUST)
+    {
+        searchTreeDepth = GAME4PLAYERS_MAX_SEARCH_DEPTH;
+        timeBudgetMs    = Game4PlayersConfig::Instance().GetMinimaxTimeBudget();
+    }
+
+    // block till the job is transfered to the worker thread
+    bool computeMoveSucceded = m_workerThread.ComputeMove(
+                                    m_the4PlayersGame,
+                                    a_whoMoves,
+                                    heuristicData.m_evalFunction,
+                                    searchTreeDepth,
+                                    timeBudgetMs,
+                                    Game4PlayersConfig::Instance().GetMinimaxThreads(),
+                                    true);
+    if (!computeMoveSucceded)
+    {
+#ifdef DEBUG_PRINT
+        std::cout
+            << "Error while telling the thread to start computing. Worker thread is busy"
+            << std::endl;
+#endif
+        std::stringstream theMessage;
+        // i18n TRANSLATORS: Please, leave <b> and </b> tags sorrounding the translation of "Fatal error"
+        // i18n Thank you for contributing to this project
+        theMessage << _("<b>Fatal Error:</b> Could not communicate with worker thread. Application will exit now!");
+
+        // stop worker thread
+        CancelComputing();
+
+        // Notify the fatal error. They can't be handled
+        signal_fatalError().emit(theMessage.str());
+    }
+}
+
+void Game4PlayersWidget::NotifyMoveComputed()
+{
+    // there should be only one move in the queue, but in case
+    // there were more only the latest one is shown as deployed
+    Piece latestPiece(e_noPiece);
+    Coordinate latestCoord;
+    Game4Players::eGame4_Player_t thisPlayerType = m_currentMovingPlayer;
+
+    CalculatedMove_t currentMove;
+    bool moveQueueEmpty = true;
+    while(m_moveQueue.TryPop(currentMove))
+    {
+        moveQueueEmpty = false;
+
+        latestPiece    = currentMove.piece;
+        latestCoord    = currentMove.coord;
+        thisPlayerType = currentMove.playerToMove;
 #ifdef DEBUG
-    assert(thisPlayerType == m_currentMovingPlayer);
+        assert(thisPlayerType == m_currentMovingPlayer);
 #endif
 
-    // put down current piece before anything else
-    m_the4PlayersGame.PutDownPiece(
-        a_piece,
-        a_coord,
-        thisPlayerType);
+        if (latestPiece.GetType() != e_noPiece)
+        {
+            // put down current piece before anything else
+            m_the4PlayersGame.PutDownPiece(
+                latestPiece,
+                latestCoord,
+                thisPlayerType);
+        }
+    }
+
+    if (moveQueueEmpty)
+    {
+        // there were no moves stored in the queue. Nothing can be done
+        return;
+    }
 
-    // invalidate the board drawing area to show the new moves
-    // activating the latest piece deployed glowing effect
-    m_boardDrawingArea.Invalidate(a_piece, a_coord, a_player);
+    if (latestPiece.GetType() != e_noPiece)
+    {
+        // invalidate the board drawing area to show the new moves
+        // activating the latest piece deployed glowing effect
+        m_boardDrawingArea.Invalidate(
+            latestPiece,
+            latestCoord,
+            m_the4PlayersGame.GetPlayer(thisPlayerType));
+    }
 
 	// update score after this piece has been put down
     UpdateScoreStatus();
@@ -546,6 +735,25 @@ void Game4PlayersWidget::BoardDrawingArea_BoardClicked(
 #endif
     }
     } // switch (thisPlayerType)
+
+    if (Game4PlayersConfig::Instance().IsPlayerComputer(m_currentMovingPlayer))
+    {
+        // next player is the computer. Disallow editing the edit piece
+        // area while computer is processing next move
+        m_editPieceTable.set_sensitive(false);
+
+        RequestThreadToComputeNextMove(m_currentMovingPlayer);
+    }
+    else
+    {
+        // allow next player to edit the piece to put down on the board
+        // 'cos it's a human being
+        m_editPieceTable.set_sensitive(true);
+
+        // restore the mouse cursor so the human being who has to put down next piece
+        // can do it
+        ResetCursor();
+    }
 }
 
 void Game4PlayersWidget::GameFinished()
@@ -558,6 +766,9 @@ void Game4PlayersWidget::GameFinished()
     }
     m_currentGameFinished = true;
 
+    // reset the cursor (even if it's been already done)
+    ResetCursor();
+
     // stop stopwatches (even if it was already done)
     m_statusBar.StopAllStopwatches();
 
@@ -705,3 +916,25 @@ void Game4PlayersWidget::UpdateScoreStatus()
     m_statusBar.SetScoreStatus(3, m_the4PlayersGame.GetPlayer(Game4Players::e_Game4_Player3));
     m_statusBar.SetScoreStatus(4, m_the4PlayersGame.GetPlayer(Game4Players::e_Game4_Player4));
 }
+
+void Game4PlayersWidget::SetWaitCursor()
+{
+    Glib::RefPtr<Gdk::Window> topLevelWindow;
+    topLevelWindow = this->get_window();
+    if (topLevelWindow)
+    {
+        // set the cursor to busy
+        topLevelWindow->set_cursor(Gdk::Cursor(Gdk::WATCH));
+    }
+}
+
+void Game4PlayersWidget::ResetCursor()
+{
+    Glib::RefPtr<Gdk::Window> topLevelWindow;
+    topLevelWindow = this->get_window();
+    if (topLevelWindow)
+    {
+        // set the cursor to default
+        topLevelWindow->set_cursor();
+    }
+}
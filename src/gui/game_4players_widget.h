@@ -25,6 +25,7 @@
 ///           Faustino Frechilla 17-Nov-2010  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
 ///           Faustino Frechilla 12-Jan-2010  non-moving players' pieces shown around the board
+///           agent              17-Oct-2026  Computer players (worker thread)
 /// @endhistory
 ///
 // ============================================================================
@@ -36,8 +37,10 @@
 #include <exception>
 #include <gtkmm.h>
 
+#include "g_blocking_queue.h"
 #include "gui/drawing_area_show_pieces.h"
 #include "gui/drawing_area_board.h"
+#include "gui/game_4players_worker_thread.h"
 #include "gui/stop_watch_label.h"
 #include "gui/table_edit_piece.h"
 #include "gui/statusbar_game.h"
@@ -64,6 +67,12 @@ public:
     /// WARNING: resets the game completely
     void LaunchNewGame();
 
+    /// cancels the computing process of the worker thread
+    void CancelComputing();
+
+    /// @return true if the worker thread is calculating the move of a computer player
+    bool IsComputingMove();
+
     /// @return a reference to the drawing area shown by this widget
     DrawingAreaBoard& BoardDrawingArea();
 
@@ -101,17 +110,32 @@ public:
 
 private:
 
+    /// struct which contains the info that stores a move (piece + where + who)
+    typedef struct
+    {
+        Piece                         piece;
+        Coordinate                    coord;
+        Game4Players::eGame4_Player_t playerToMove;
+    } CalculatedMove_t;
+
     /// @brief current game is finished. It is set to false at the beginning of a game
     ///        in LaunchNewGame and set to true whenever GameFinished is called
     /// it prevents GameFinished code to run twice for the same game
     bool m_currentGameFinished;
 
+    /// a thread safe queue to save moves calculated by worker thread
+    /// for the main thread to retrieve them
+    BlockingQueue<CalculatedMove_t> m_moveQueue;
+
     /// this variables contains whose go it is
     Game4Players::eGame4_Player_t m_currentMovingPlayer;
 
     /// @brief the total allocation game which will be represented in the window
     Game4Players m_the4PlayersGame;
 
+    /// @brief the worker thread which calculates the moves of the computer players
+    Game4PlayersWorkerThread m_workerThread;
+
     /// @brief the drawing area responsible for showing the state of the board
     DrawingAreaBoard m_boardDrawingArea;
 
@@ -155,6 +179,10 @@ private:
     /// @brief hbox which serves as status bar
     StatusBarGame m_statusBar;
 
+    /// thread-safe signal object for inter-thread communication to
+    /// notify the next move has been computed
+    Glib::Dispatcher m_signal_moveComputed;
+
     /// Signal object to notify fatal errors
     sigc::signal<void, const std::string&> m_signal_fatalError;
 
@@ -170,9 +198,33 @@ private:
     /// @brief callback to be called when a button is pressed inside the board
     void BoardDrawingArea_BoardClicked(const Coordinate &, const Piece &, const Player &);
 
+    /// @brief callback to be called whenever the worker thread finishes computing a move
+    void WorkerThread_computingFinished(
+            const Piece                   &a_piece,
+            const Coordinate              &a_coord,
+            Game4Players::eGame4_Player_t  a_playerToMove,
+            int32_t                        a_returnValue);
+
+    /// @brief requests the worker thread to compute the move of a computer player
+    /// It finishes the app if there's an error communicating with this thread
+    /// @param player whose move will be calculated by the worker thread
+    void RequestThreadToComputeNextMove(Game4Players::eGame4_Player_t a_whoMoves);
+
+    /// Do all the stuff that needs to be done when a move has been put down (by
+    /// a human being or by the worker thread). It is responsible for changing
+    /// turns between players and launching the worker thread if the next player
+    /// is a computer. It can be used with Glib::Dispatcher
+    void NotifyMoveComputed();
+
     /// updates the score shown in the status bar
     void UpdateScoreStatus();
 
+    /// sets mouse cursor to a watch to indicate computer is "thinking"
+    void SetWaitCursor();
+
+    /// sets mouse cursor to the default pointer
+    void ResetCursor();
+
     // prevent the default constructors to be used
     Game4PlayersWidget(const Game4PlayersWidget &a_src);
     Game4PlayersWidget& operator=(const Game4PlayersWidget &a_src);
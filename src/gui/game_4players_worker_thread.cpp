@@ -0,0 +1,307 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file game_4players_worker_thread.cpp
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include "gettext.h" // i18n
+#include "gui/game_4players_worker_thread.h"
+
+// values m_threadStatus can hold. Same state machine as the one of the 1vs1
+// worker thread (MainWindowWorkerThread) without the PONDERING state:
+//
+//                        Join +---------+ Join
+//                 +----------*|   DIE   |*---------+
+//                 |           +---------+          |
+//                 |                * Join          |
+//            +---------+           |           +--------+
+//            | WAITING |*----------+-----------|  STOP  |
+//            +---------+ Thread    |           +--------+
+//      Thread *   |      Routine   |            *
+//     Routine |   |           +---------+ Cancel|
+//             |   +----------*| ACTIVE  |-------+
+//             |   ComputeMove +---------+
+//             |                    |
+//             +--------------------+
+//
+// m_threadStatus is set to PROCESSING_DIE when the thread is told to kill itself
+#define PROCESSING_DIE       3
+// m_threadStatus is set to PROCESSING_STOP when the thread is told to cancel
+// current computing process and get back to wait for more jobs
+#define PROCESSING_STOP      2
+// worker thread waiting for new jobs. m_threadStatus should be set to PROCESSING_ACTIVE
+#define PROCESSING_WAITING   1
+// normal operation. No cancelation nor death requested
+#define PROCESSING_ACTIVE    0
+
+Game4PlayersWorkerThread::Game4PlayersWorkerThread() throw (GUIException):
+        m_localGame(),
+        m_playerToMove(Game4Players::e_Game4_Player1), // by default. It will be always set before calculating next move anyway
+        m_heuristic(NULL),                             // by default. It will be always set before calculating next move anyway
+        m_searchTreeDepth(1),                          // by default. It will be always set before calculating next move anyway
+        m_timeBudgetMs(0),                             // by default. It will be always set before calculating next move anyway
+        m_nThreads(1),                                 // by default. It will be always set before calculating next move anyway
+        m_threadStatus(PROCESSING_WAITING),
+        m_thread(NULL),
+        m_mutex(NULL),
+        m_cond(NULL)
+{
+    m_mutex = g_mutex_new();
+    if (m_mutex == NULL)
+    {
+        throw new GUIException(e_GUIException_ProcessingThreadErr, __FILE__, __LINE__);
+#ifdef DEBUG
+        assert(0);
+#endif
+    }
+
+    m_cond = g_cond_new();
+    if (m_cond == NULL)
+    {
+        throw new GUIException(e_GUIException_ProcessingThreadErr, __FILE__, __LINE__);
+#ifdef DEBUG
+        assert(0);
+#endif
+    }
+
+    SpawnThread();
+}
+
+Game4PlayersWorkerThread::~Game4PlayersWorkerThread()
+{
+    g_cond_free(m_cond);
+    g_mutex_free(m_mutex);
+}
+
+void Game4PlayersWorkerThread::SpawnThread() throw (GUIException)
+{
+    // configure the option JOINABLE to the thread creation
+    bool joinable = true;
+    GError* err   = NULL;
+
+    m_thread = g_thread_create(
+            reinterpret_cast<GThreadFunc>(Game4PlayersWorkerThread::ThreadRoutine),
+            reinterpret_cast<void*>(this),
+            joinable,
+            &err);
+
+    if (m_thread == NULL)
+    {
+        g_error_free(err);
+        throw new GUIException(e_GUIException_ProcessingThreadErr, __FILE__, __LINE__);
+    }
+}
+
+void Game4PlayersWorkerThread::Join()
+{
+    g_mutex_lock(m_mutex);
+
+    // request the thread to kill itself
+    // current thread (the one that calls to this function) will be waiting for the worker thread
+    // to die in the g_thread_join function
+    m_threadStatus = PROCESSING_DIE;
+
+    // wake up the worker thread to exit the ThreadRoutine in case it stuck there
+    g_cond_broadcast(m_cond);
+
+    g_mutex_unlock(m_mutex);
+
+    g_thread_join(m_thread);
+}
+
+void Game4PlayersWorkerThread::CancelComputing()
+{
+    g_mutex_lock(m_mutex);
+
+    if (m_threadStatus == PROCESSING_ACTIVE)
+    {
+        // worker thread is busy
+        // request the thread to stop
+        m_threadStatus = PROCESSING_STOP;
+
+        // wait for the worker thread to cancel computing before keep going
+        while (m_threadStatus == PROCESSING_STOP)
+        {
+            g_cond_wait(m_cond, m_mutex);
+        }
+    }
+
+    g_mutex_unlock(m_mutex);
+}
+
+bool Game4PlayersWorkerThread::IsThreadComputingMove()
+{
+    bool rv;
+
+    g_mutex_lock(m_mutex);
+    rv = (m_threadStatus == PROCESSING_ACTIVE);
+    g_mutex_unlock(m_mutex);
+
+    return rv;
+}
+
+bool Game4PlayersWorkerThread::ComputeMove(
+        const Game4Players            &a_game,
+        Game4Players::eGame4_Player_t  a_whoMoves,
+        Heuristic::EvalFunction_t      a_heuristic,
+        int32_t                        a_searchTreeDepth,
+        int32_t                        a_timeBudgetMs,
+        int32_t                        a_nThreads,
+        bool                           a_blockCaller)
+{
+    bool rv = false;
+
+    g_mutex_lock(m_mutex);
+
+    // block current thread if a_blockCaller is set to true until worker thread
+    // is ready to calculate next move or worker thread is requested to die
+    while ( a_blockCaller &&
+           (m_threadStatus != PROCESSING_WAITING) &&
+           (m_threadStatus != PROCESSING_DIE) )
+    {
+        g_cond_wait(m_cond, m_mutex);
+    }
+
+    if (m_threadStatus == PROCESSING_WAITING)
+    {
+        // copy the game before computing the calculation
+        m_localGame       = a_game;
+        m_playerToMove    = a_whoMoves;
+        m_heuristic       = a_heuristic;
+        m_searchTreeDepth = a_searchTreeDepth;
+        m_timeBudgetMs    = a_timeBudgetMs;
+        m_nThreads        = a_nThreads;
+
+        // set the thread to calculate a move (computing flag to active)
+        m_threadStatus = PROCESSING_ACTIVE;
+
+        // wake up the worker thread to start computing the next move
+        g_cond_broadcast(m_cond);
+
+        // the function will return true
+        rv = true;
+    }
+
+    g_mutex_unlock(m_mutex);
+
+    return rv;
+}
+
+void* Game4PlayersWorkerThread::ThreadRoutine(void *a_ThreadParam)
+{
+    Game4PlayersWorkerThread* thisThread =
+            reinterpret_cast< Game4PlayersWorkerThread* >(a_ThreadParam);
+
+    // Piece calculated by the search
+    Piece resultPiece;
+    // Coordinate where the resultPiece should be put down
+    Coordinate resultCoord;
+    // the returned value by the computing process
+    int32_t resultReturnedValue;
+
+    while (thisThread->m_threadStatus != PROCESSING_DIE)
+    {
+        g_mutex_lock(thisThread->m_mutex);
+
+        if (thisThread->m_threadStatus != PROCESSING_DIE)
+        {
+            // previous processing was finished (either it was computed or cancelled)
+            // get back to waiting state unless the thread has been told to die
+            thisThread->m_threadStatus = PROCESSING_WAITING;
+        }
+
+        while (thisThread->m_threadStatus == PROCESSING_WAITING)
+        {
+            // Previous processing is finished. Someone might be waiting for us
+            // to notify thread is going to be ready. Wake them up
+            g_cond_broadcast(thisThread->m_cond);
+
+            // wait for new jobs to arrive
+            g_cond_wait(thisThread->m_cond, thisThread->m_mutex);
+        }
+
+        if (thisThread->m_threadStatus != PROCESSING_ACTIVE)
+        {
+            // there's nothing to compute
+            // Go back to the beginning to check if we must die
+            g_mutex_unlock(thisThread->m_mutex);
+            continue;
+        }
+
+        // get out of the mutex. m_threadStatus is PROCESSING_ACTIVE
+        // data which saves the next movement to be calculated is protected
+        // (it is only written in ComputeMove, and it cannot be written while
+        // m_threadStatus is set to PROCESSING_ACTIVE)
+        g_mutex_unlock(thisThread->m_mutex);
+
+        resultPiece = Piece(e_noPiece);
+        resultCoord = Coordinate();
+
+        if (thisThread->m_timeBudgetMs > 0)
+        {
+            // depth reached by the search within the time budget
+            int32_t depthReached;
+
+            resultReturnedValue = thisThread->m_localGame.MinMaxIterativeDeepening(
+                                        thisThread->m_heuristic,
+                                        thisThread->m_searchTreeDepth,
+                                        thisThread->m_timeBudgetMs,
+                                        thisThread->m_playerToMove,
+                                        resultPiece,
+                                        resultCoord,
+                                        depthReached,
+                                        thisThread->m_threadStatus,
+                                        thisThread->m_nThreads);
+        }
+        else
+        {
+            resultReturnedValue = thisThread->m_localGame.MinMax(
+                                        thisThread->m_heuristic,
+                                        thisThread->m_searchTreeDepth,
+                                        thisThread->m_playerToMove,
+                                        resultPiece,
+                                        resultCoord,
+                                        thisThread->m_threadStatus,
+                                        thisThread->m_nThreads);
+        }
+
+        if (thisThread->m_threadStatus != PROCESSING_ACTIVE)
+        {
+            // no need to notify the cancelled result to any listener
+            continue;
+        }
+
+        // notify the result
+        thisThread->signal_computingFinished().emit(
+                resultPiece,
+                resultCoord,
+                thisThread->m_playerToMove,
+                resultReturnedValue);
+
+    } // while (thisThread->m_threadStatus != PROCESSING_DIE)
+
+    return NULL;
+}
@@ -0,0 +1,132 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  game_4players_worker_thread.h
+/// @brief Thread which calculates the moves of the computer players of 4players games
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef GAME4PLAYERSWORKERTHREAD_H_
+#define GAME4PLAYERSWORKERTHREAD_H_
+
+#include <glib.h>             // glib-2.0/glib.h
+#include <sigc++/trackable.h> // sigc++-2.0/sigc++
+#include <sigc++/signal.h>    // sigc++-2.0/sigc++
+#include "game_4players.h"
+#include "gui/gui_exception.h"
+
+/// @brief Thread which will be used by the Game4PlayersWidget to calculate the
+///        moves of the computer players
+/// Same as MainWindowWorkerThread (the 1vs1 worker thread) but with no pondering:
+/// 3 opponents move before the computer player moves again, so predicting the
+/// position it will have to move in is not worth it
+class Game4PlayersWorkerThread :
+    public sigc::trackable // trackable must be inherited when objects shall automatically
+                           // invalidate slots referring to them on destruction
+{
+public:
+    Game4PlayersWorkerThread() throw (GUIException);
+    virtual ~Game4PlayersWorkerThread();
+
+    /// @returns true if the thread is busy computing a move. False otherwise
+    bool IsThreadComputingMove();
+
+    /// sends a signal to the thread to start calculating a move
+    /// If the thread is already calculating a move it won't do anything
+    /// @param the game to be used for the calculation.
+    ///        it will be copied in the thread to compute the move
+    /// @param player whose move is supposed to be calculated
+    /// @param heuristic/evaluation function to be used by the search
+    /// @param search tree depth. If a_timeBudgetMs is bigger than 0 it is the maximum depth
+    ///        the iterative deepening search is allowed to reach
+    /// @param time budget (in milliseconds). If it is bigger than 0 the move is calculated
+    ///        with Game4Players::MinMaxIterativeDeepening. 0 means a fixed depth search
+    /// @param number of threads the search will be split into (see Game4Players::MinMax)
+    /// @param Caller will block until worker thread finishes current job and starts to compute
+    ///        the job notified by this call. If it set to true it can only fail if worker thread
+    ///        is requested to die
+    /// @return true if the thread was idle. false if it was already computing
+    bool ComputeMove(
+            const Game4Players            &a_game,
+            Game4Players::eGame4_Player_t  a_whoMoves,
+            Heuristic::EvalFunction_t      a_heuristic,
+            int32_t                        a_searchTreeDepth,
+            int32_t                        a_timeBudgetMs,
+            int32_t                        a_nThreads,
+            bool                           a_blockCaller);
+
+    /// Cancels the move being computed by the worker thread and force it to get
+    /// ready for new jobs. The caller is blocked until the worker thread is ready
+    /// and waiting for another move to be computed
+    void CancelComputing();
+
+    /// suspends execution of the calling thread until the target thread terminates
+    void Join();
+
+    /// Access to the signal private member
+    sigc::signal<void, const Piece&, const Coordinate&, Game4Players::eGame4_Player_t, int32_t>& signal_computingFinished()
+    {
+        return m_signal_computingFinished;
+    }
+
+private:
+    /// The game that the thread will use for calculations
+    Game4Players m_localGame;
+    /// Whose move will be calculated next
+    Game4Players::eGame4_Player_t m_playerToMove;
+    /// Heuristic/evaluation function to be used by the search
+    Heuristic::EvalFunction_t m_heuristic;
+    /// depth of search tree. Maximum depth if m_timeBudgetMs is bigger than 0
+    int32_t m_searchTreeDepth;
+    /// time budget (in ms) of the iterative deepening search. 0 for a fixed depth search
+    int32_t m_timeBudgetMs;
+    /// number of threads the search will be split into
+    int32_t m_nThreads;
+    /// status of the thread (see the state machine in the .cpp file). Any
+    /// value but PROCESSING_ACTIVE cancels the search
+    volatile sig_atomic_t m_threadStatus;
+
+    /// the actual thread
+    GThread* m_thread;
+    /// Mutex to protect the data of the next move
+    GMutex* m_mutex;
+    /// Conditional variable to wake up threads
+    GCond* m_cond;
+
+    /// signal to be sent when the computing is finished. It notifies the move, the
+    /// player who put it down and the value returned by the search
+    sigc::signal<void, const Piece&, const Coordinate&, Game4Players::eGame4_Player_t, int32_t> m_signal_computingFinished;
+
+    /// creates the gthread
+    void SpawnThread() throw (GUIException);
+
+    /// The routine that will be run by the gthread created in SpawnThread
+    static void* ThreadRoutine(void *a_ThreadParam);
+
+    // no copy constructor or operator= allowed
+    Game4PlayersWorkerThread(const Game4PlayersWorkerThread& a_src);
+    Game4PlayersWorkerThread& operator= (const Game4PlayersWorkerThread& a_src);
+};
+
+#endif /* GAME4PLAYERSWORKERTHREAD_H_ */
@@ -270,20 +270,28 @@ const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTCOL1[]       = "newgame_4players
 const char GUI_NEWGAME_4PLAYERS_PLAYER1_LABEL[]              = "newgame_4players_label_player1";
 const char GUI_NEWGAME_4PLAYERS_PLAYER1_STARTING_ROW_LABEL[] = "newgame_4players_label_startingrow1";
 const char GUI_NEWGAME_4PLAYERS_PLAYER1_STARTING_COL_LABEL[] = "newgame_4players_label_startingcol1";
+const char GUI_NEWGAME_4PLAYERS_PLAYER1_TYPE_LABEL[]         = "newgame_4players_label_type1";
+const char GUI_NEWGAME_4PLAYERS_TABLE_PLAYER1[]              = "newgame_4players_table_player1";
 const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTROW2[]       = "newgame_4players_spinbutton_startingrow2";
 const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTCOL2[]       = "newgame_4players_spinbutton_startingcol2";
 const char GUI_NEWGAME_4PLAYERS_PLAYER2_LABEL[]              = "newgame_4players_label_player2";
 const char GUI_NEWGAME_4PLAYERS_PLAYER2_STARTING_ROW_LABEL[] = "newgame_4players_label_startingrow2";
 const char GUI_NEWGAME_4PLAYERS_PLAYER2_STARTING_COL_LABEL[] = "newgame_4players_label_startingcol2";
+const char GUI_NEWGAME_4PLAYERS_PLAYER2_TYPE_LABEL[]         = "newgame_4players_label_type2";
+const char GUI_NEWGAME_4PLAYERS_TABLE_PLAYER2[]              = "newgame_4players_table_player2";
 const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTROW3[]       = "newgame_4players_spinbutton_startingrow3";
 const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTCOL3[]       = "newgame_4players_spinbutton_startingcol3";
 const char GUI_NEWGAME_4PLAYERS_PLAYER3_LABEL[]              = "newgame_4players_label_player3";
 const char GUI_NEWGAME_4PLAYERS_PLAYER3_STARTING_ROW_LABEL[] = "newgame_4players_label_startingrow3";
 const char GUI_NEWGAME_4PLAYERS_PLAYER3_STARTING_COL_LABEL[] = "newgame_4players_label_startingcol3";
+const char GUI_NEWGAME_4PLAYERS_PLAYER3_TYPE_LABEL[]         = "newgame_4players_label_type3";
+const char GUI_NEWGAME_4PLAYERS_TABLE_PLAYER3[]              = "newgame_4players_table_player3";
 const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTROW4[]       = "newgame_4players_spinbutton_startingrow4";
 const char GUI_NEWGAME_4PLAYERS_SPINBUTTON_STARTCOL4[]       = "newgame_4players_spinbutton_startingcol4";
 const char GUI_NEWGAME_4PLAYERS_PLAYER4_LABEL[]              = "newgame_4players_label_player4";
 const char GUI_NEWGAME_4PLAYERS_PLAYER4_STARTING_ROW_LABEL[] = "newgame_4players_label_startingrow4";
 const char GUI_NEWGAME_4PLAYERS_PLAYER4_STARTING_COL_LABEL[] = "newgame_4players_label_startingcol4";
+const char GUI_NEWGAME_4PLAYERS_PLAYER4_TYPE_LABEL[]         = "newgame_4players_label_type4";
+const char GUI_NEWGAME_4PLAYERS_TABLE_PLAYER4[]              = "newgame_4players_table_player4";
 
 #endif /* GUI_GLADE_H_ */
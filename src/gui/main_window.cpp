@@ -31,6 +31,7 @@
 ///           Faustino Frechilla 06-Oct-2010  Adapted to Game1v1Widget
 ///           Faustino Frechilla 11-Oct-2010  New Game dialog
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  4 players computer moves cancelled too
 /// @endhistory
 ///
 // ============================================================================
@@ -375,7 +376,8 @@ MainWindow::~MainWindow()
 
 bool MainWindow::MainWindow_DeleteEvent(GdkEventAny*)
 {
-    if (m_game1v1Widget.IsComputingMove())
+    if (m_game1v1Widget.IsComputingMove() ||
+        m_game4PlayersWidget.IsComputingMove())
     {
         Gtk::MessageDialog exitingMessage(
                 *this,
@@ -392,8 +394,9 @@ bool MainWindow::MainWindow_DeleteEvent(GdkEventAny*)
         }
     }
 
-    // cancel the worker thread
+    // cancel the worker threads
     m_game1v1Widget.CancelComputing();
+    m_game4PlayersWidget.CancelComputing();
 
     // continue with delete event
     return false;
@@ -401,7 +404,8 @@ bool MainWindow::MainWindow_DeleteEvent(GdkEventAny*)
 
 void MainWindow::MenuItemGameQuit_Activate()
 {
-    if (m_game1v1Widget.IsComputingMove())
+    if (m_game1v1Widget.IsComputingMove() ||
+        m_game4PlayersWidget.IsComputingMove())
     {
         Gtk::MessageDialog exitingMessage(
                 *this,
@@ -418,8 +422,9 @@ void MainWindow::MenuItemGameQuit_Activate()
         }
     }
 
-    // cancel the worker thread
+    // cancel the worker threads
     m_game1v1Widget.CancelComputing();
+    m_game4PlayersWidget.CancelComputing();
 
     // exit the app
     this->hide();
@@ -699,9 +704,10 @@ void MainWindow::Notify_GameFinished(const std::string& a_msg)
 
 void MainWindow::SetupWindowForNewGame(e_blockemGameType_t a_gametype)
 {
-    // stop game1v1 computing process (it does nothing if it wasn't
-    // processing anything)
+    // stop game1v1 and 4players computing processes (it does nothing if
+    // they weren't processing anything)
     m_game1v1Widget.CancelComputing();
+    m_game4PlayersWidget.CancelComputing();
 
     switch(a_gametype)
     {
@@ -28,6 +28,11 @@
 ///           Faustino Frechilla 02-May-2010  blockin call to ComputeMove
 ///           Faustino Frechilla 23-Jul-2010  i18n
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Parallel MinMax support
+///           agent              17-Oct-2026  Transposition table
+///           agent              17-Oct-2026  Iterative deepening with a time budget
+///           agent              17-Oct-2026  Search statistics notified with the move
+///           agent              17-Oct-2026  Pondering
 /// @endhistory
 ///
 // ============================================================================
@@ -49,22 +54,32 @@
 //            +---------+           |           +--------+
 //            | WAITING |*----------+-----------|  STOP  |
 //            +---------+ Thread    |           +--------+
-//      Thread *   |      Routine   |               * Cancel
-//     Routine |   |           +---------+          |
-//             |   +----------*| ACTIVE  |----------+
-//             |   ComputeMove +---------+
-//             |                    |
-//             +--------------------+
+//      Thread *   |      Routine   |            *      *
+//     Routine |   |           +---------+ Cancel|      | Cancel
+//             |   +----------*| ACTIVE  |-------+      |
+//             |   ComputeMove +---------+              |
+//             |                 |  |  *                |
+//             +-----------------+  |  | ComputeMove    |
+//                           Thread *  |                |
+//                          Routine +-----------+       |
+//                                  | PONDERING |-------+
+//                                  +-----------+
+//
+// Join can be called in any state. The thread routine moves from ACTIVE to
+// PONDERING (instead of WAITING) when the move was requested with pondering on
 //
 // m_threadStatus is set to PROCESSING_DIE when the thread is told to kill itself
-#define PROCESSING_DIE     3
+#define PROCESSING_DIE       3
 // m_threadStatus is set to PROCESSING_STOP when the thread is told to cancel
 // current computing process and get back to wait for more jobs
-#define PROCESSING_STOP    2
+#define PROCESSING_STOP      2
 // worker thread waiting for new jobs. m_threadStatus should be set to PROCESSING_ACTIVE
-#define PROCESSING_WAITING 1
+#define PROCESSING_WAITING   1
 // normal operation. No cancelation nor death requested
-#define PROCESSING_ACTIVE  0
+#define PROCESSING_ACTIVE    0
+// worker thread searching on the opponent's time while it waits for new jobs.
+// Pondering searches are cancelled through m_ponderStop instead of m_threadStatus
+#define PROCESSING_PONDERING 4
 
 MainWindowWorkerThread::MainWindowWorkerThread() throw (GUIException):
         m_localGame(),
@@ -73,7 +88,21 @@ MainWindowWorkerThread::MainWindowWorkerThread() throw (GUIException):
         m_playerToMove(Game1v1::e_Game1v1Player1), // by default. It will be always set before calculating next move anyway
         m_heuristic(NULL),                         // by default. It will be always set before calculating next move anyway
         m_searchTreeDepth(3),                      // by default. It will be always set before calculating next move anyway
+        m_timeBudgetMs(0),                         // by default. It will be always set before calculating next move anyway
+        m_nThreads(1),                             // by default. It will be always set before calculating next move anyway
+        m_transTableSize(0),                       // by default. It will be always set before calculating next move anyway
+        m_ponder(false),                           // by default. It will be always set before calculating next move anyway
+        m_transTable(0),                           // memory is allocated by the worker thread once the size is known
         m_threadStatus(PROCESSING_WAITING),
+        m_ponderGame(),
+        m_ponderStop(0),
+        m_ponderPredicted(false),
+        m_ponderKey(0),
+        m_ponderHit(false),
+        m_ponderCompleted(false),
+        m_ponderPiece(e_noPiece),
+        m_ponderCoord(),
+        m_ponderValue(0),
         m_thread(NULL),
         m_mutex(NULL),
         m_cond(NULL)
@@ -137,6 +166,8 @@ void MainWindowWorkerThread::Join()
     // current thread (the one that calls to this function) will be waiting for the worker thread
     // to die in the g_thread_join function
     m_threadStatus = PROCESSING_DIE;
+    // it might be pondering
+    m_ponderStop   = 1;
 
     // wake up the worker thread to exit the ThreadRoutine in case it stuck there
     g_cond_broadcast(m_cond);
@@ -151,11 +182,13 @@ void MainWindowWorkerThread::CancelComputing()
 {
     g_mutex_lock(m_mutex);
 
-    if (m_threadStatus == PROCESSING_ACTIVE)
+    if ( (m_threadStatus == PROCESSING_ACTIVE) ||
+         (m_threadStatus == PROCESSING_PONDERING) )
     {
         // worker thread is busy
         // request the thread to stop
         m_threadStatus = PROCESSING_STOP;
+        m_ponderStop   = 1;
 
         // wait for the worker thread to cancel computing before keep going
         while (m_threadStatus == PROCESSING_STOP)
@@ -183,6 +216,10 @@ bool MainWindowWorkerThread::ComputeMove(
             Game1v1::eGame1v1Player_t a_whoMoves,
             Heuristic::EvalFunction_t a_heuristic,
             int32_t                   a_searchTreeDepth,
+            int32_t                   a_timeBudgetMs,
+            int32_t                   a_nThreads,
+            int32_t                   a_transTableSize,
+            bool                      a_ponder,
             bool                      a_blockCaller,
             const Coordinate         &a_latestCoordinate,
             const Piece              &a_latestPiece)
@@ -195,12 +232,36 @@ bool MainWindowWorkerThread::ComputeMove(
     // is ready to calculate next move or worker thread is requested to die
     while ( a_blockCaller &&
            (m_threadStatus != PROCESSING_WAITING) &&
+           (m_threadStatus != PROCESSING_PONDERING) &&
            (m_threadStatus != PROCESSING_DIE) )
     {
         g_cond_wait(m_cond, m_mutex);
     }
 
-    if (m_threadStatus == PROCESSING_WAITING)
+    if (m_threadStatus == PROCESSING_PONDERING)
+    {
+        // the move calculated while pondering can only be used if it was
+        // calculated for this same position and with the same settings
+        m_ponderHit = m_ponderPredicted                                 &&
+                      (m_ponderStop == 0)                               &&
+                      (a_game.GetPositionKey(a_whoMoves) == m_ponderKey) &&
+                      (a_whoMoves        == m_playerToMove)             &&
+                      (a_heuristic       == m_heuristic)                &&
+                      (a_searchTreeDepth == m_searchTreeDepth)          &&
+                      (a_timeBudgetMs    == m_timeBudgetMs)             &&
+                      (a_nThreads        == m_nThreads)                 &&
+                      (a_transTableSize  == m_transTableSize);
+
+        if (!m_ponderHit)
+        {
+            // the search being run while pondering is not needed anymore. It
+            // is left to finish otherwise, and its move will be returned
+            m_ponderStop = 1;
+        }
+    }
+
+    if ( (m_threadStatus == PROCESSING_WAITING) ||
+         (m_threadStatus == PROCESSING_PONDERING) )
     {
         // copy the 1v1Game, latest piece (and coord) put down by the opponent
         // before computing the calculation
@@ -210,6 +271,10 @@ bool MainWindowWorkerThread::ComputeMove(
         m_playerToMove     = a_whoMoves;
         m_heuristic        = a_heuristic;
         m_searchTreeDepth  = a_searchTreeDepth;
+        m_timeBudgetMs     = a_timeBudgetMs;
+        m_nThreads         = a_nThreads;
+        m_transTableSize   = a_transTableSize;
+        m_ponder           = a_ponder;
 
         // set the thread to calculate a move (computing flag to active)
         m_threadStatus = PROCESSING_ACTIVE;
@@ -237,18 +302,24 @@ void* MainWindowWorkerThread::ThreadRoutine(void *a_ThreadParam)
     Coordinate resultCoord;
     // the returned value by the computing process
     int32_t resultReturnedValue;
+    // true if the next move was requested while the thread was pondering. It
+    // must not go back to waiting state then, since the job is already there
+    bool jobReceivedWhilePondering = false;
 
     while (thisThread->m_threadStatus != PROCESSING_DIE)
     {
         g_mutex_lock(thisThread->m_mutex);
 
         // the move has been calculated. Update the variable accordingly
-        if (thisThread->m_threadStatus != PROCESSING_DIE)
+        if ( (thisThread->m_threadStatus != PROCESSING_DIE) &&
+             !jobReceivedWhilePondering )
         {
             // previous processing was finished (either it was computed or cancelled)
             // get back to waiting state unless the thread has been told to die
             thisThread->m_threadStatus = PROCESSING_WAITING;
+            thisThread->m_ponderHit    = false;
         }
+        jobReceivedWhilePondering = false;
 
         while (thisThread->m_threadStatus == PROCESSING_WAITING)
         {
@@ -269,6 +340,10 @@ void* MainWindowWorkerThread::ThreadRoutine(void *a_ThreadParam)
             continue;
         }
 
+        // the move requested might have been calculated already while pondering
+        bool usePonderedMove = thisThread->m_ponderHit && thisThread->m_ponderCompleted;
+        thisThread->m_ponderHit = false;
+
         // get out of the mutex. m_threadStatus is PROCESSING_ACTIVE
         // data which saves the next movement to be calculated is protected
         // (it is only written in ComputeMove, and it cannot be written while
@@ -279,21 +354,42 @@ void* MainWindowWorkerThread::ThreadRoutine(void *a_ThreadParam)
         //const Player &currentPlayer = thisThread->m_localGame.GetPlayer(thisThread->m_playerToMove);
         const Player &opponent      = thisThread->m_localGame.GetOpponent(thisThread->m_playerToMove);
 
+        // it doesn't do anything if the size of the table hasn't changed
+        thisThread->m_transTable.Resize(thisThread->m_transTableSize);
+
         // we've been told to calculate the move
         do
         {
-            resultPiece = Piece(e_noPiece);
-            resultCoord = Coordinate();
-
-            resultReturnedValue = thisThread->m_localGame.MinMax(
-                                        thisThread->m_heuristic,
-                                        thisThread->m_searchTreeDepth,
-                                        thisThread->m_playerToMove,
-                                        resultPiece,
-                                        resultCoord,
-                                        thisThread->m_threadStatus,
-                                        thisThread->m_localLatestCoord,
-                                        thisThread->m_localLatestPiece);
+            // statistics of the search the move was calculated with
+            const Game1v1::SearchStats_t* resultStats = &(thisThread->m_ponderStats);
+
+            if (usePonderedMove)
+            {
+                // the opponent made the move the thread predicted
+                resultPiece         = thisThread->m_ponderPiece;
+                resultCoord         = thisThread->m_ponderCoord;
+                resultReturnedValue = thisThread->m_ponderValue;
+                usePonderedMove     = false;
+            }
+            else
+            {
+                resultPiece = Piece(e_noPiece);
+                resultCoord = Coordinate();
+
+                resultReturnedValue = thisThread->Search(
+                                            thisThread->m_localGame,
+                                            thisThread->m_playerToMove,
+                                            thisThread->m_heuristic,
+                                            thisThread->m_searchTreeDepth,
+                                            thisThread->m_timeBudgetMs,
+                                            thisThread->m_nThreads,
+                                            thisThread->m_threadStatus,
+                                            thisThread->m_localLatestCoord,
+                                            thisThread->m_localLatestPiece,
+                                            resultPiece,
+                                            resultCoord);
+                resultStats = &(thisThread->m_localGame.GetSearchStats());
+            }
 
             if (thisThread->m_threadStatus != PROCESSING_ACTIVE)
             {
@@ -309,7 +405,8 @@ void* MainWindowWorkerThread::ThreadRoutine(void *a_ThreadParam)
                     resultPiece,
                     resultCoord,
                     thisThread->m_playerToMove,
-                    resultReturnedValue);
+                    resultReturnedValue,
+                    *resultStats);
 
             // update the local game as well in case the computer has
             // to put more than 1 move in a row
@@ -325,7 +422,162 @@ void* MainWindowWorkerThread::ThreadRoutine(void *a_ThreadParam)
                   (rules::CanPlayerGo(thisThread->m_localGame.GetBoard(),
                                       opponent) == false) );
 
+        if ( thisThread->m_ponder &&
+             (resultPiece.GetType() != e_noPiece) )
+        {
+            // the opponent can move (otherwise the loop above would still be
+            // running). Search on its time till the next move is requested
+            jobReceivedWhilePondering = thisThread->Ponder(resultPiece, resultCoord);
+        }
+
     } // while (thisThread->m_threadStatus != PROCESSING_DIE)
 
     return NULL;
 }
+
+int32_t MainWindowWorkerThread::Search(
+        Game1v1                  &a_game,
+        Game1v1::eGame1v1Player_t a_whoMoves,
+        Heuristic::EvalFunction_t a_heuristic,
+        int32_t                   a_searchTreeDepth,
+        int32_t                   a_timeBudgetMs,
+        int32_t                   a_nThreads,
+        const CancellationToken  &a_cancelToken,
+        const Coordinate         &a_latestCoordinate,
+        const Piece              &a_latestPiece,
+        Piece                    &out_piece,
+        Coordinate               &out_coord)
+{
+    if (a_timeBudgetMs > 0)
+    {
+        // depth reached by the search within the time budget
+        int32_t depthReached;
+
+        return a_game.MinMaxIterativeDeepening(
+                    a_heuristic,
+                    a_searchTreeDepth,
+                    a_timeBudgetMs,
+                    a_whoMoves,
+                    out_piece,
+                    out_coord,
+                    depthReached,
+                    a_cancelToken,
+                    a_latestCoordinate,
+                    a_latestPiece,
+                    a_nThreads,
+                    (m_transTable.GetSizeMB() > 0) ? &m_transTable : NULL);
+    }
+
+    return a_game.MinMax(
+                a_heuristic,
+                a_searchTreeDepth,
+                a_whoMoves,
+                out_piece,
+                out_coord,
+                a_cancelToken,
+                a_latestCoordinate,
+                a_latestPiece,
+                a_nThreads,
+                &m_transTable);
+}
+
+bool MainWindowWorkerThread::Ponder(const Piece &a_piece, const Coordinate &a_coord)
+{
+    g_mutex_lock(m_mutex);
+
+    if (m_threadStatus != PROCESSING_ACTIVE)
+    {
+        // the thread was cancelled (or told to die) right after the move was calculated
+        g_mutex_unlock(m_mutex);
+        return false;
+    }
+
+    // settings of the search. ComputeMove overwrites them as soon as
+    // the next move is requested, which might happen before pondering is done
+    Game1v1::eGame1v1Player_t computerType = m_playerToMove;
+    Game1v1::eGame1v1Player_t opponentType =
+        (computerType == Game1v1::e_Game1v1Player1) ?
+            Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    Heuristic::EvalFunction_t heuristic       = m_heuristic;
+    int32_t                   searchTreeDepth = m_searchTreeDepth;
+    int32_t                   timeBudgetMs    = m_timeBudgetMs;
+    int32_t                   nThreads        = m_nThreads;
+
+    // progress updates of pondering searches must not be shown, as the
+    // computer is not supposed to be thinking its move
+    m_ponderGame = m_localGame;
+    m_ponderGame.SetProgressUpdate(false);
+
+    m_ponderStop      = 0;
+    m_ponderPredicted = false;
+    m_ponderHit       = false;
+    m_ponderCompleted = false;
+    m_threadStatus    = PROCESSING_PONDERING;
+
+    // whoever is waiting for the thread to be ready for new jobs can carry on
+    g_cond_broadcast(m_cond);
+    g_mutex_unlock(m_mutex);
+
+    // 1) the most likely reply of the opponent is the one the computer would
+    // make in its place. This search also leaves in the transposition table the
+    // positions after every reply, so it speeds up the next search even if the
+    // prediction turns out to be wrong
+    Piece predictedPiece(e_noPiece);
+    Coordinate predictedCoord;
+    Search(m_ponderGame,
+           opponentType,
+           heuristic,
+           searchTreeDepth,
+           timeBudgetMs,
+           nThreads,
+           m_ponderStop,
+           a_coord,
+           a_piece,
+           predictedPiece,
+           predictedCoord);
+
+    if ( (m_ponderStop == 0) &&
+         (predictedPiece.GetType() != e_noPiece) )
+    {
+        m_ponderGame.PutDownPiece(predictedPiece, predictedCoord, opponentType);
+
+        g_mutex_lock(m_mutex);
+        m_ponderKey       = m_ponderGame.GetPositionKey(computerType);
+        m_ponderPredicted = (m_ponderStop == 0);
+        g_mutex_unlock(m_mutex);
+
+        // 2) the move of the computer after the predicted reply. It won't be
+        // cancelled if the opponent makes that reply before it is finished
+        m_ponderPiece = Piece(e_noPiece);
+        m_ponderCoord = Coordinate();
+        m_ponderValue = Search(
+                            m_ponderGame,
+                            computerType,
+                            heuristic,
+                            searchTreeDepth,
+                            timeBudgetMs,
+                            nThreads,
+                            m_ponderStop,
+                            predictedCoord,
+                            predictedPiece,
+                            m_ponderPiece,
+                            m_ponderCoord);
+        m_ponderStats = m_ponderGame.GetSearchStats();
+    }
+
+    g_mutex_lock(m_mutex);
+
+    m_ponderCompleted = m_ponderPredicted && (m_ponderStop == 0);
+
+    // wait for the next job if it hasn't arrived yet
+    while (m_threadStatus == PROCESSING_PONDERING)
+    {
+        g_cond_wait(m_cond, m_mutex);
+    }
+
+    bool jobReceived = (m_threadStatus == PROCESSING_ACTIVE);
+
+    g_mutex_unlock(m_mutex);
+
+    return jobReceived;
+}
@@ -24,6 +24,11 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 24 Nov 2009  Original development
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Parallel MinMax support
+///           agent              17-Oct-2026  Transposition table
+///           agent              17-Oct-2026  Iterative deepening with a time budget
+///           agent              17-Oct-2026  Search statistics notified with the move
+///           agent              17-Oct-2026  Pondering
 /// @endhistory
 ///
 // ============================================================================
@@ -49,6 +54,7 @@ public:
     virtual ~MainWindowWorkerThread();
 
     /// @returns true if the thread is busy computing a move. False otherwise
+    /// (a thread which is pondering is not considered busy)
     bool IsThreadComputingMove();
 
     /// sends a signal to the thread to start calculating a move
@@ -57,33 +63,50 @@ public:
     ///        it will be copied in the thread to compute the move
     /// @param player whose move is supposed to be calculated by MinMax
     /// @param heuristic/evaluation function to be used by the MinMax algorithm
-    /// @param search tree depth. It might be set to GAME1V1CONFIG_DEPTH_AUTOADJUST to indicate
-    ///        it will be left up to this thread depending on the expected lenght of the search tree
+    /// @param search tree depth. If a_timeBudgetMs is bigger than 0 it is the maximum depth
+    ///        the iterative deepening search is allowed to reach
+    /// @param time budget (in milliseconds). If it is bigger than 0 the move is calculated
+    ///        with Game1v1::MinMaxIterativeDeepening, which returns the move calculated by the
+    ///        deepest search completed within the budget. 0 means a fixed depth search
+    /// @param number of threads the search will be split into (see Game1v1::MinMax)
+    /// @param size (in MB) of the transposition table. 0 disables it. The table is kept by
+    ///        the worker thread between moves, so positions evaluated while computing a
+    ///        move can be reused by the next one
+    /// @param true if the thread must ponder once the move is calculated. It searches
+    ///        then for the most likely reply of the opponent, and the move it would
+    ///        make after it. If the next call to ComputeMove asks for that position
+    ///        (with the same settings) the move calculated while pondering is returned
+    ///        straight away. Otherwise the pondering search is cancelled, and the new
+    ///        search will make use of the positions it saved in the transposition table
     /// @param Caller will block until worker thread finishes current job and starts to compute
     ///        the job notified by this call. If it set to true it can only fail if worker thread
     ///        is requested to die
     /// @param coordinate where the latest piece was put down
     /// @param latest piece put down by the opponent
-    /// @return true if the thread was idle. false if it was already computing
+    /// @return true if the thread was idle (or pondering). false if it was already computing
     bool ComputeMove(
             const Game1v1            &a_game,
             Game1v1::eGame1v1Player_t a_whoMoves,
             Heuristic::EvalFunction_t a_heuristic,
             int32_t                   a_searchTreeDepth,
+            int32_t                   a_timeBudgetMs,
+            int32_t                   a_nThreads,
+            int32_t                   a_transTableSize,
+            bool                      a_ponder,
             bool                      a_blockCaller,
             const Coordinate         &a_latestCoordinate = Coordinate(),
             const Piece              &a_latestPiece      = Piece(e_noPiece));
 
-    /// Cancels the move being computed by the worker thread and force it to get ready
-    /// for new jobs. The caller is blocked until the worker thread is ready and waiting
-    /// for another move to be computed
+    /// Cancels the move being computed (or the pondering search) by the worker thread
+    /// and force it to get ready for new jobs. The caller is blocked until the worker
+    /// thread is ready and waiting for another move to be computed
     void CancelComputing();
 
     /// suspends execution of the calling thread until the target thread terminates
     void Join();
 
     /// Access to the signal private member
-    sigc::signal<void, const Piece&, const Coordinate&, Game1v1::eGame1v1Player_t, int32_t>& signal_computingFinished()
+    sigc::signal<void, const Piece&, const Coordinate&, Game1v1::eGame1v1Player_t, int32_t, const Game1v1::SearchStats_t&>& signal_computingFinished()
     {
         return m_signal_computingFinished;
     }
@@ -100,12 +123,42 @@ private:
     /// Heuristic/evaluation function to be used by the MinMAx algorithm
     Heuristic::EvalFunction_t m_heuristic;
     /// depth of search tree for the minimax algorithm
-    /// It might be set to GAME1V1CONFIG_DEPTH_AUTOADJUST to indicate
-    /// t will be left up to this thread depending on the expected lenght of the search tree
+    /// maximum depth if m_timeBudgetMs is bigger than 0
     int32_t m_searchTreeDepth;
+    /// time budget (in ms) of the iterative deepening search. 0 for a fixed depth search
+    int32_t m_timeBudgetMs;
+    /// number of threads the minimax search will be split into
+    int32_t m_nThreads;
+    /// size (in MB) of the transposition table used by the minimax search
+    int32_t m_transTableSize;
+    /// true if the thread ponders after calculating the move
+    bool m_ponder;
+    /// transposition table used by the minimax search. Only accessed by the worker thread
+    TranspositionTable m_transTable;
     /// set to true whenever we want the thread to terminate by itself
     volatile sig_atomic_t m_threadStatus;
 
+    /// copy of the game the pondering searches are run on. Only accessed by the worker thread
+    Game1v1 m_ponderGame;
+    /// set to non-zero to cancel the pondering search
+    volatile sig_atomic_t m_ponderStop;
+    /// true once the opponent's reply has been predicted (protected by m_mutex)
+    bool m_ponderPredicted;
+    /// key of the position after the predicted reply (protected by m_mutex)
+    uint64_t m_ponderKey;
+    /// true if the move requested while pondering is the one being pondered (protected by m_mutex)
+    bool m_ponderHit;
+    /// true if the search of the move after the predicted reply was completed
+    bool m_ponderCompleted;
+    /// move calculated after the predicted reply
+    Piece m_ponderPiece;
+    /// coordinate where m_ponderPiece would be put down
+    Coordinate m_ponderCoord;
+    /// value returned by the search of m_ponderPiece
+    int32_t m_ponderValue;
+    /// statistics of the search of m_ponderPiece
+    Game1v1::SearchStats_t m_ponderStats;
+
     /// the actual thread
     GThread* m_thread;
     /// Mutex to protect the queue
@@ -113,8 +166,9 @@ private:
     /// Conditional variable to wake up threads
     GCond* m_cond;
 
-    /// signal to be sent when the computing is finished
-    sigc::signal<void, const Piece&, const Coordinate&, Game1v1::eGame1v1Player_t, int32_t> m_signal_computingFinished;
+    /// signal to be sent when the computing is finished. It notifies the move, the player
+    /// who put it down, the value returned by MinMax and the statistics of the search
+    sigc::signal<void, const Piece&, const Coordinate&, Game1v1::eGame1v1Player_t, int32_t, const Game1v1::SearchStats_t&> m_signal_computingFinished;
 
     /// creates the gthread
     void SpawnThread() throw (GUIException);
@@ -122,6 +176,44 @@ private:
     /// The routine that will be run by the gthread created in SpawnThread
     static void* ThreadRoutine(void *a_ThreadParam);
 
+    /// @brief calculates a move with a fixed depth search, or an iterative deepening
+    /// one if a_timeBudgetMs is bigger than 0 (see ComputeMove). Run by the worker
+    /// thread only. It uses m_transTable
+    /// @param game the move is calculated on
+    /// @param player whose move will be calculated
+    /// @param heuristic/evaluation function
+    /// @param search tree depth (maximum depth if there's a time budget)
+    /// @param time budget (in milliseconds). 0 means a fixed depth search
+    /// @param number of threads the search will be split into
+    /// @param token that cancels the search
+    /// @param coordinate where the latest piece was put down
+    /// @param latest piece put down by the opponent
+    /// @param piece calculated
+    /// @param coordinate where the piece calculated should be put down
+    /// @return the value returned by the search
+    int32_t Search(
+            Game1v1                  &a_game,
+            Game1v1::eGame1v1Player_t a_whoMoves,
+            Heuristic::EvalFunction_t a_heuristic,
+            int32_t                   a_searchTreeDepth,
+            int32_t                   a_timeBudgetMs,
+            int32_t                   a_nThreads,
+            const CancellationToken  &a_cancelToken,
+            const Coordinate         &a_latestCoordinate,
+            const Piece              &a_latestPiece,
+            Piece                    &out_piece,
+            Coordinate               &out_coord);
+
+    /// @brief searches on the opponent's time after the move a_piece was put down
+    /// on m_localGame. Run by the worker thread only. It returns when the next job
+    /// arrives (or the thread is cancelled or told to die) and the pondering search
+    /// has finished
+    /// @param piece just put down by the computer
+    /// @param coordinate where a_piece was put down
+    /// @return true if a new move was requested. m_localGame and the settings of
+    ///         the search are already those of the new move then
+    bool Ponder(const Piece &a_piece, const Coordinate &a_coord);
+
     // no copy constructor or operator= allowed
     MainWindowWorkerThread(const MainWindowWorkerThread& a_src);
     MainWindowWorkerThread& operator= (const MainWindowWorkerThread& a_src);
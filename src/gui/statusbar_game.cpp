@@ -25,18 +25,23 @@
 ///           Faustino Frechilla 01-Oct-2010  Original development
 ///           Faustino Frechilla 04-Oct-2010  Extended to support N players
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Search statistics
 /// @endhistory
 ///
 // ============================================================================
 
 #include <stdint.h>  // uint32_t
 #include <iomanip>   // setw
+#include <sstream>
 #include "gettext.h" // i18n
 #include "gui/statusbar_game.h"
 
 /// maximum size of the string to apply to score labels
 static const uint32_t SCORE_LABEL_BUFFER_LENGTH = 64;
 
+/// maximum size of the string shown in the progress bar
+static const uint32_t SEARCH_STATS_BUFFER_LENGTH = 64;
+
 /// how often stopwatches are updated
 static const uint32_t STOPWATCH_UPDATE_PERIOD_MILLIS = 500; // 1000 = 1 second
 
@@ -294,3 +299,40 @@ void StatusBarGame::SetFraction(float a_fraction)
         m_progressBar->set_fraction(a_fraction);
     }
 }
+
+void StatusBarGame::SetSearchStats(const Game1v1::SearchStats_t &a_stats)
+{
+    if (m_progressBar == NULL)
+    {
+        return;
+    }
+
+    // this buffer will contain the string to be shown in the progress bar
+    char theMessage[SEARCH_STATS_BUFFER_LENGTH];
+
+    snprintf (theMessage,
+              SEARCH_STATS_BUFFER_LENGTH,
+              // i18n TRANSLATORS: the first %llu will be replaced by the number of
+              // i18n nodes searched by the computer to calculate its latest move, and
+              // i18n the second one by how many of them it searched per second
+              // i18n Thank you for contributing to this project
+              _("%llu nodes (%llu nodes/s)"),
+              static_cast<unsigned long long>(a_stats.nodes),
+              static_cast<unsigned long long>(Game1v1::NodesPerSecond(a_stats)));
+    m_progressBar->set_text(theMessage);
+
+    std::stringstream theDetails;
+    Game1v1::PrintSearchStats(a_stats, theDetails);
+    m_progressBar->set_tooltip_text(theDetails.str());
+}
+
+void StatusBarGame::ClearSearchStats()
+{
+    if (m_progressBar == NULL)
+    {
+        return;
+    }
+
+    m_progressBar->set_text("");
+    m_progressBar->set_tooltip_text("");
+}
@@ -26,6 +26,7 @@
 ///           Faustino Frechilla 04-Oct-2010  Extended to support N players
 ///           Faustino Frechilla 06-Oct-2010  Added a horizontal separator
 ///           Faustino Frechilla 23-Nov-2010  Moved into gui/ directory
+///           agent              17-Oct-2026  Search statistics
 /// @endhistory
 ///
 // ============================================================================
@@ -37,6 +38,7 @@
 #include <gtkmm.h>
 
 #include "player.h"
+#include "game1v1.h"
 #include "gui/stop_watch_label.h"
 
 /// @brief class to handle the status bar to be shown on the main window
@@ -94,6 +96,16 @@ public:
     /// @param a floating point number between 0.0 to 1.0 (0% to 100%)
     void SetFraction(float a_fraction);
 
+    /// shows the nodes searched (and nodes per second) by the latest MinMax search
+    /// as the text of the progress bar. The rest of statistics are shown in its tooltip
+    /// It does nothing if the object has been instantiated without progress bar
+    /// @param statistics of the search
+    void SetSearchStats(const Game1v1::SearchStats_t &a_stats);
+
+    /// removes the search statistics set by SetSearchStats
+    /// It does nothing if the object has been instantiated without progress bar
+    void ClearSearchStats();
+
 private:
     /// @brief number of players to be represented by this status bar
     uint32_t m_nPlayers;
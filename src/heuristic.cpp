@@ -24,6 +24,11 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 31-Mar-2009  Original development
 ///           Faustino Frechilla 23-Jul-2010  i18n
+///           agent              17-Oct-2026  Heuristics calculated with bit planes
+///           agent              17-Oct-2026  Incremental weighted areas heuristic
+///           agent              17-Oct-2026  Simple and weighted areas heuristics inlined
+///           agent              17-Oct-2026  Whole-board heuristics calculated with weighted popcount kernels
+///           agent              17-Oct-2026  Exact influence area heuristic
 /// @endhistory
 ///
 // ============================================================================
@@ -36,6 +41,7 @@
 #include "player.h"
 #include "rules.h"
 #include "bitwise.h"
+#include "weighted_popcount.h"
 
 /// Pieces that will be put down while trying to take over the centre of the board
 /// see CalculateNKWeightedv1 for an example
@@ -110,40 +116,39 @@ const Heuristic::sHeuristicData_t Heuristic::m_heuristicData[e_heuristicCount] =
 //     // i18n TRANSLATORS: This is a quick explanation of what the "Amount of pieces" heuristic is supposed
 //     // i18n to do. Shouldn't be too long since it will have to fit nicely on the GUI widgets
 //     N_("The more pieces can be put down per NK point, the better. It's slow and a bit crazy sometimes")
-//    }
+//    },
+    {e_heuristicWeightedAreas,
+     Heuristic::CalculateWeightedAreas,
+     // i18n TRANSLATORS: This is the name given to a type of heuristic. Should be as small as possible
+     N_("Weighted areas"),
+     // i18n TRANSLATORS: This is a quick explanation of what the "Weighted areas" heuristic is supposed
+     // i18n to do. Shouldn't be too long since it will have to fit nicely on the GUI widgets
+     N_("Nucleation points, influence area and squares taken are worth more the closer they are to the centre. It is very fast")
+    },
+    {e_heuristicInfluenceAreaExact,
+     Heuristic::CalculateInfluenceAreaExact,
+     // i18n TRANSLATORS: This is the name given to a type of heuristic. Should be as small as possible
+     N_("Exact influence area"),
+     // i18n TRANSLATORS: This is a quick explanation of what the "Exact influence area" heuristic is supposed
+     // i18n to do. Shouldn't be too long since it will have to fit nicely on the GUI widgets
+     N_("Same as \"Influence Area\", but it calculates which squares each player can really reach. It is slower")
+    },
 };
 
-int32_t Heuristic::CalculateSimple(
-        const Board  &a_board,
-        const Player &a_playerMe,
-        const Player &a_playerOpponent)
+bool Heuristic::ReadsInfluenceAreas(EvalFunction_t a_heuristicMethod)
 {
-    int32_t squaresMe = 0;
-    int32_t squaresOpponent = 0;
-    int32_t rv = 0;
-
-    Coordinate thisCoord(0, 0);
-    for (thisCoord.m_row = 0; thisCoord.m_row < a_board.GetNRows() ; thisCoord.m_row++)
-    {
-        for (thisCoord.m_col = 0; thisCoord.m_col <  a_board.GetNColumns() ; thisCoord.m_col++)
-        {
-            if (a_board.IsPlayerInCoord(thisCoord, a_playerMe))
-            {
-                squaresMe++;
-            }
-            else if (a_board.IsPlayerInCoord(thisCoord, a_playerOpponent))
-            {
-                squaresOpponent++;
-            }
-        }
-    }
-
-    rv += (squaresMe << 2); // times 4
-    rv += (a_playerMe.NumberOfNucleationPoints() << 1); // times 2
-    rv -= (squaresOpponent << 2); // times 4
-    rv -= a_playerOpponent.NumberOfNucleationPoints();
+    // heuristics which read the influence area plane or its weighted sum (see
+    // CalculateWeightedAreas). New heuristics which read them must be added here
+    return (a_heuristicMethod == Heuristic::CalculateInfluenceAreaWeighted)         ||
+           (a_heuristicMethod == Heuristic::CalculateInfluenceAreaWeightedEastwood) ||
+           (a_heuristicMethod == Heuristic::CalculateInfluenceAreaExact)            ||
+           (a_heuristicMethod == Heuristic::CalculateWeightedAreas)                 ||
+           (a_heuristicMethod == Heuristic::CalculateWeightedAreasCompute);
+}
 
-    return rv;
+bool Heuristic::ReadsExactInfluenceAreas(EvalFunction_t a_heuristicMethod)
+{
+    return (a_heuristicMethod == Heuristic::CalculateInfluenceAreaExact);
 }
 
 int32_t Heuristic::CalculateRandom(
@@ -164,10 +169,80 @@ int32_t Heuristic::CalculateRandom(
     return rand();
 }
 
+/// @brief adds to a_planes the planes which add up the circular weight of the
+/// squares set in a_plane times a_factor (see Board::GetCircularWeightSlice)
+/// @param the board
+/// @param the squares whose weights are added up
+/// @param true if the halved weight must be used instead
+/// @param every weight is multiplied by this
+/// @param planes of the weighted sum. New ones are added after in_out_nPlanes
+/// @param weights of the planes of the weighted sum
+/// @param number of planes of the weighted sum
+static void AddCircularWeightPlanes(
+        const Board    &a_board,
+        const Bitboard &a_plane,
+        bool            a_halved,
+        int32_t         a_factor,
+        Bitboard        in_out_planes[WEIGHTED_POPCOUNT_MAX_PLANES],
+        int32_t         in_out_weights[WEIGHTED_POPCOUNT_MAX_PLANES],
+        int32_t        &in_out_nPlanes)
+{
+#ifdef DEBUG
+    assert((in_out_nPlanes + BOARD_CIRCULAR_WEIGHT_BITS) <= WEIGHTED_POPCOUNT_MAX_PLANES);
+#endif
+    for (int32_t bit = 0; bit < BOARD_CIRCULAR_WEIGHT_BITS; bit++)
+    {
+        in_out_planes[in_out_nPlanes]  = a_plane & a_board.GetCircularWeightSlice(bit, a_halved);
+        in_out_weights[in_out_nPlanes] = a_factor * Board::GetCircularWeightSliceValue(bit);
+        in_out_nPlanes++;
+    }
+}
+
 int32_t Heuristic::CalculateCentreFocused(
         const Board  &a_board,
         const Player &a_playerMe,
         const Player &a_playerOpponent)
+{
+    Bitboard emptySquares   = a_board.GetEmptyPlane();
+    Bitboard nkOpponent     = a_playerOpponent.GetNucleationPointsPlane() & emptySquares;
+    Bitboard nkMe           = a_playerMe.GetNucleationPointsPlane() & emptySquares;
+    Bitboard squaresMePlane = a_board.GetPlayerPlane(a_playerMe);
+
+    // an nk point that is touching the other player is unblockable by the opponent
+    // (it might get blocked, but not directly)
+    Bitboard touchingOpponent =
+        a_board.GetOrthogonalNeighbours(a_board.GetPlayerPlane(a_playerOpponent));
+
+    Bitboard planes[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  weights[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  nPlanes = 0;
+
+    // nk points of the opponent
+    AddCircularWeightPlanes(a_board, nkOpponent, false, -1, planes, weights, nPlanes);
+
+    // nk points of 'me' not shared with the opponent
+    Bitboard nkOnlyMe = nkMe & ~nkOpponent;
+    AddCircularWeightPlanes(a_board, nkOnlyMe, false, 1, planes, weights, nPlanes);
+    planes[nPlanes]    = nkOnlyMe & touchingOpponent;
+    weights[nPlanes++] = 1;
+
+    // the weighted value of a shared nk point is half the value of the opponent's
+    // because putting down a piece which is sharing nk points is bad since the
+    // next go will be for the opponent
+    AddCircularWeightPlanes(a_board, nkMe & nkOpponent, true, 1, planes, weights, nPlanes);
+
+    planes[nPlanes]    = squaresMePlane;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = a_board.GetOccupiedPlane() & ~squaresMePlane;
+    weights[nPlanes++] = -1;
+
+    return weightedpopcount::Calculate(planes, weights, nPlanes);
+}
+
+int32_t Heuristic::CalculateCentreFocusedCompute(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
 {
     int32_t rv = 0;
     int32_t valueNkMe = 0;
@@ -246,6 +321,45 @@ int32_t Heuristic::CalculateNKWeightedv1(
         return CalculateCentreFocused(a_board, a_playerMe, a_playerOpponent);
     }
 
+    Bitboard emptySquares   = a_board.GetEmptyPlane();
+    Bitboard nkOpponent     = a_playerOpponent.GetNucleationPointsPlane() & emptySquares;
+    Bitboard nkOnlyMe       = a_playerMe.GetNucleationPointsPlane() & emptySquares & ~nkOpponent;
+    Bitboard squaresMePlane = a_board.GetPlayerPlane(a_playerMe);
+
+    // an nk point that is touching the other player is unblockable by the opponent
+    // (it might get blocked, but not directly)
+    Bitboard touchingOpponent =
+        a_board.GetOrthogonalNeighbours(a_board.GetPlayerPlane(a_playerOpponent));
+
+    Bitboard planes[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  weights[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  nPlanes = 0;
+
+    planes[nPlanes]    = nkOnlyMe;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = nkOnlyMe & touchingOpponent;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = squaresMePlane;
+    weights[nPlanes++] = 2;
+    planes[nPlanes]    = nkOpponent;
+    weights[nPlanes++] = -1;
+    planes[nPlanes]    = a_board.GetOccupiedPlane() & ~squaresMePlane;
+    weights[nPlanes++] = -2;
+
+    return weightedpopcount::Calculate(planes, weights, nPlanes);
+}
+
+int32_t Heuristic::CalculateNKWeightedv1Compute(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
+{
+    if (a_playerOpponent.NumberOfPiecesAvailable() >=
+           (e_numberOfPieces - N_PIECES_TO_TAKE_OVER_THE_CENTRE))
+    {
+        return CalculateCentreFocusedCompute(a_board, a_playerMe, a_playerOpponent);
+    }
+
     int32_t rv = 0;
 
     int32_t valueNkMe = 0;
@@ -400,136 +514,141 @@ int32_t Heuristic::CalculateInfluenceAreaWeighted(
         const Player &a_playerMe,
         const Player &a_playerOpponent)
 {
-    int32_t rv = 0;
-
-    int32_t valueNkMe = 0;
-    int32_t valueNkOpponent = 0;
-    int32_t squaresMe = 0;
-    int32_t squaresOpponent = 0;
-
-    Coordinate thisCoord;
-    for (thisCoord.m_row = 0; thisCoord.m_row < a_board.GetNRows() ; thisCoord.m_row++)
-    {
-        for (thisCoord.m_col = 0; thisCoord.m_col < a_board.GetNColumns() ; thisCoord.m_col++)
-        {
-            if (a_board.IsCoordEmpty(thisCoord))
-            {
-                bool opponentNKPoint = false;
-
-                if (a_playerOpponent.IsNucleationPoint(thisCoord))
-                {
-                    opponentNKPoint = true;
-                    valueNkOpponent += 1;
-                }
-                else if(a_playerOpponent.IsCoordInfluencedByPlayer(thisCoord))
-                {
-                    rv -= 1;
-                }
-
-                if (a_playerMe.IsNucleationPoint(thisCoord))
-                {
-                    if (!opponentNKPoint)
-                    {
-                        valueNkMe += 1;
-
-                        if (rules::IsCoordTouchingPlayerCompute(a_board, thisCoord, a_playerOpponent))
-                        {
-                            // an nk point that is touching the other player is unblockable by the opponent
-                            // (it might get blocked, but not directly)
-                            valueNkMe += 1;
-                        }
-                    }
-                }
-                else if(a_playerMe.IsCoordInfluencedByPlayer(thisCoord))
-                {
-                    rv += 1;
-                }
-            }
-            else if (a_board.IsPlayerInCoord(thisCoord, a_playerMe))
-            {
-                squaresMe++;
-            }
-            else // if (a_board.IsPlayerInCoord(thisCoord, a_playeOpponent))
-            {
-                squaresOpponent++;
-            }
-        } // for (thisCoord.m_col = 0; thisCoord.m_col < a_board.GetNColumns() ; thisCoord.m_col++)
-    } // for (thisCoord.m_row = 0; thisCoord.m_row < a_board.GetNRows() ; thisCoord.m_row++)
+    // empty squares which are nk points or are influenced by each player
+    // (a nk point of the opponent can't be also counted as a nk point of 'me')
+    Bitboard emptySquares  = a_board.GetEmptyPlane();
+    Bitboard nkOpponent    = a_playerOpponent.GetNucleationPointsPlane() & emptySquares;
+    Bitboard nkMe          = a_playerMe.GetNucleationPointsPlane() & emptySquares;
+    Bitboard influenceOpponent =
+        a_playerOpponent.GetInfluenceAreaPlane() & emptySquares & ~nkOpponent;
+    Bitboard influenceMe   = a_playerMe.GetInfluenceAreaPlane() & emptySquares & ~nkMe;
+    nkMe &= ~nkOpponent;
+
+    Bitboard squaresMePlane = a_board.GetPlayerPlane(a_playerMe);
+
+    // an nk point that is touching the other player is unblockable by the opponent
+    // (it might get blocked, but not directly)
+    Bitboard touchingOpponent =
+        a_board.GetOrthogonalNeighbours(a_board.GetPlayerPlane(a_playerOpponent));
+
+    Bitboard planes[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  weights[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  nPlanes = 0;
+
+    planes[nPlanes]    = influenceOpponent;
+    weights[nPlanes++] = -1;
+    planes[nPlanes]    = influenceMe;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = nkMe;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = nkMe & touchingOpponent;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = squaresMePlane;
+    weights[nPlanes++] = 2;
+    planes[nPlanes]    = nkOpponent;
+    weights[nPlanes++] = -1;
+    planes[nPlanes]    = a_board.GetOccupiedPlane() & ~squaresMePlane;
+    weights[nPlanes++] = -2;
+
+    return weightedpopcount::Calculate(planes, weights, nPlanes);
+}
 
-    rv += (valueNkMe);
-    rv += (squaresMe << 1);       // times 2
-    rv -= (valueNkOpponent);
-    rv -= (squaresOpponent << 1); // times 2
+int32_t Heuristic::CalculateInfluenceAreaWeightedEastwood(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
+{
+    // empty squares which are nk points or are influenced by each player
+    // (a nk point of the opponent can't be also counted as a nk point of 'me')
+    Bitboard emptySquares  = a_board.GetEmptyPlane();
+    Bitboard nkOpponent    = a_playerOpponent.GetNucleationPointsPlane() & emptySquares;
+    Bitboard nkMe          = a_playerMe.GetNucleationPointsPlane() & emptySquares;
+    Bitboard influenceOpponent =
+        a_playerOpponent.GetInfluenceAreaPlane() & emptySquares & ~nkOpponent;
+    Bitboard influenceMe   = a_playerMe.GetInfluenceAreaPlane() & emptySquares & ~nkMe;
+    nkMe &= ~nkOpponent;
+
+    Bitboard squaresMePlane = a_board.GetPlayerPlane(a_playerMe);
+
+    // an nk point that is touching the other player is unblockable by the opponent
+    // (it might get blocked, but not directly)
+    Bitboard touchingOpponent =
+        a_board.GetOrthogonalNeighbours(a_board.GetPlayerPlane(a_playerOpponent));
+
+    Bitboard planes[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  weights[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  nPlanes = 0;
+
+    planes[nPlanes]    = influenceOpponent;
+    weights[nPlanes++] = -2;
+    planes[nPlanes]    = influenceMe;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = nkMe;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = nkMe & touchingOpponent;
+    weights[nPlanes++] = 1;
+    planes[nPlanes]    = squaresMePlane;
+    weights[nPlanes++] = 2;
+    planes[nPlanes]    = nkOpponent;
+    weights[nPlanes++] = -2;
+    planes[nPlanes]    = a_board.GetOccupiedPlane() & ~squaresMePlane;
+    weights[nPlanes++] = -2;
+
+    return weightedpopcount::Calculate(planes, weights, nPlanes);
+}
 
-    return rv;
+int32_t Heuristic::CalculateInfluenceAreaExact(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
+{
+    // same sum as "Influence Area". Game1v1 searches evaluated with this heuristic
+    // keep the exact influence areas in the players instead of the approximation
+    return CalculateInfluenceAreaWeighted(a_board, a_playerMe, a_playerOpponent);
 }
 
-int32_t Heuristic::CalculateInfluenceAreaWeightedEastwood(
+int32_t Heuristic::CalculateWeightedAreasCompute(
         const Board  &a_board,
         const Player &a_playerMe,
         const Player &a_playerOpponent)
 {
     int32_t rv = 0;
 
-    int32_t valueNkMe = 0;
-    int32_t valueNkOpponent = 0;
-    int32_t squaresMe = 0;
-    int32_t squaresOpponent = 0;
-
     Coordinate thisCoord;
     for (thisCoord.m_row = 0; thisCoord.m_row < a_board.GetNRows() ; thisCoord.m_row++)
     {
         for (thisCoord.m_col = 0; thisCoord.m_col < a_board.GetNColumns() ; thisCoord.m_col++)
         {
-            if (a_board.IsCoordEmpty(thisCoord))
-            {
-                bool opponentNKPoint = false;
+            int32_t weightedValue = CalculateCircularWeight(a_board, thisCoord);
 
-                if (a_playerOpponent.IsNucleationPoint(thisCoord))
-                {
-                    opponentNKPoint = true;
-                    valueNkOpponent += 1;
-                }
-                else if(a_playerOpponent.IsCoordInfluencedByPlayer(thisCoord))
-                {
-                    rv -= 2;
-                }
-
-                if (a_playerMe.IsNucleationPoint(thisCoord))
-                {
-                    if (!opponentNKPoint)
-                    {
-                        valueNkMe += 1;
-
-                        if (rules::IsCoordTouchingPlayerCompute(a_board, thisCoord, a_playerOpponent))
-                        {
-                            // an nk point that is touching the other player is unblockable by the opponent
-                            // (it might get blocked, but not directly)
-                            valueNkMe += 1;
-                        }
-                    }
-                }
-                else if(a_playerMe.IsCoordInfluencedByPlayer(thisCoord))
-                {
-                    rv += 1;
-                }
+            if (a_playerMe.IsNucleationPoint(thisCoord))
+            {
+                rv += weightedValue;
             }
-            else if (a_board.IsPlayerInCoord(thisCoord, a_playerMe))
+            if (a_playerMe.IsCoordInfluencedByPlayer(thisCoord))
             {
-                squaresMe++;
+                rv += weightedValue;
             }
-            else // if (a_board.IsPlayerInCoord(thisCoord, a_playeOpponent))
+            if (a_playerOpponent.IsNucleationPoint(thisCoord))
             {
-                squaresOpponent++;
+                rv -= weightedValue;
+            }
+            if (a_playerOpponent.IsCoordInfluencedByPlayer(thisCoord))
+            {
+                rv -= weightedValue;
+            }
+
+            if (a_board.IsPlayerInCoord(thisCoord, a_playerMe))
+            {
+                rv += (weightedValue << 1);       // times 2
+            }
+            else if (a_board.IsPlayerInCoord(thisCoord, a_playerOpponent))
+            {
+                rv -= (weightedValue << 1);       // times 2
             }
         } // for (thisCoord.m_col = 0; thisCoord.m_col < a_board.GetNColumns() ; thisCoord.m_col++)
     } // for (thisCoord.m_row = 0; thisCoord.m_row < a_board.GetNRows() ; thisCoord.m_row++)
 
-    rv += (valueNkMe);
-    rv += (squaresMe << 1);       // times 2
-    rv -= (valueNkOpponent << 1); // times 2
-    rv -= (squaresOpponent << 1); // times 2
-
     return rv;
 }
 
@@ -772,14 +891,8 @@ int32_t Heuristic::CalculateCircularWeight(
     return static_cast<int32_t>(s_circularWeightValues[a_coord.m_row][a_coord.m_col]);
 #endif
 
-    int32_t tmpValue =
-        std::max(
-                abs(a_coord.m_row + 1 - (a_board.GetNRows() / 2)),
-                abs(a_coord.m_col + 1 - (a_board.GetNColumns() / 2)) );
-
-    int32_t weightedValue = ( ( (a_board.GetNRows() / 2) - tmpValue ) / 2) + 1;
-
-    return weightedValue;
+    // same calculation used by players to keep their weighted sums up to date
+    return Player::CalculateCircularWeight(a_board.GetNRows(), a_board.GetNColumns(), a_coord);
 }
 
 //int32_t Heuristic::CountSquaresCanBeDeployedBitwise(
@@ -23,6 +23,10 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 31-Mar-2009  Original development
+///           agent              17-Oct-2026  Incremental weighted areas heuristic
+///           agent              17-Oct-2026  Evaluator policies for searches specialised per heuristic
+///           agent              17-Oct-2026  Whole-board heuristics calculated with weighted popcount kernels
+///           agent              17-Oct-2026  Exact influence area heuristic
 /// @endhistory
 ///
 // ============================================================================
@@ -65,6 +69,8 @@ public:
         e_heuristicSimple,
         e_heuristicRandom,
 //        e_heuristicAmountOfPieces,
+        e_heuristicWeightedAreas,
+        e_heuristicInfluenceAreaExact,
 
         e_heuristicCount, // stores the amount of heuristics. Must be always at the end
     } eHeuristicType_t;
@@ -80,10 +86,46 @@ public:
 
     static const sHeuristicData_t m_heuristicData[e_heuristicCount];
 
+    /// @brief evaluation policy which calls the heuristic through the pointer it
+    /// receives. Searches compiled with it work with any heuristic
+    struct PointerEvaluator
+    {
+        static int32_t Evaluate(
+                EvalFunction_t a_heuristicMethod,
+                const Board   &a_board,
+                const Player  &a_playerMe,
+                const Player  &a_playerOpponent);
+    };
+
+    /// @brief evaluation policy bound to the heuristic EVAL_FUNCTION at compile time
+    /// The pointer it receives is ignored. EVAL_FUNCTION is called directly, so
+    /// searches compiled with it can inline it if its body is visible (see
+    /// impl/heuristic_impl.h)
+    template<EvalFunction_t EVAL_FUNCTION>
+    struct StaticEvaluator
+    {
+        static int32_t Evaluate(
+                EvalFunction_t a_heuristicMethod,
+                const Board   &a_board,
+                const Player  &a_playerMe,
+                const Player  &a_playerOpponent);
+    };
+
     virtual ~Heuristic();
 
+    /// @return true if a_heuristicMethod reads the influence areas saved in the players
+    ///         (see Player::GetInfluenceAreaPlane and Player::GetInfluenceAreaWeight).
+    ///         Searches evaluated with any other heuristic (including the ones not
+    ///         described here) don't keep them up to date
+    static bool ReadsInfluenceAreas(EvalFunction_t a_heuristicMethod);
+
+    /// @return true if a_heuristicMethod needs the influence areas saved in the players
+    ///         to be exact (see rules::CalculateInfluenceAreaInBoard). Game1v1 searches
+    ///         calculate them again every time a piece is put down then
+    static bool ReadsExactInfluenceAreas(EvalFunction_t a_heuristicMethod);
+
     /// Calculate the heuristic value taking into account only the amount
-    /// Of squares of the pieces put down
+    /// Of squares of the pieces put down. Inlined
     static int32_t CalculateSimple(
             const Board  &a_board,
             const Player &a_playerMe,
@@ -97,16 +139,33 @@ public:
 
     /// Calculate the heuristic value taking into account the weight nucleation points
     /// The more in the middle in the board a NK point is the more important it is
+    /// It is a weighted sum of the squares set in a few bit planes of the board and
+    /// the players calculated by weightedpopcount::Calculate
     static int32_t CalculateCentreFocused(
             const Board  &a_board,
             const Player &a_playerMe,
             const Player &a_playerOpponent);
 
+    /// Same value as CalculateCentreFocused, but it is computed going through the
+    /// whole board square by square. It is the reference used to check the bit plane version
+    static int32_t CalculateCentreFocusedCompute(
+            const Board  &a_board,
+            const Player &a_playerMe,
+            const Player &a_playerOpponent);
+
+    /// Calculated with weightedpopcount::Calculate (see CalculateCentreFocused)
     static int32_t CalculateNKWeightedv1(
             const Board  &a_board,
             const Player &a_playerMe,
             const Player &a_playerOpponent);
 
+    /// Same value as CalculateNKWeightedv1, but it is computed going through the
+    /// whole board square by square. It is the reference used to check the bit plane version
+    static int32_t CalculateNKWeightedv1Compute(
+            const Board  &a_board,
+            const Player &a_playerMe,
+            const Player &a_playerOpponent);
+
 //    static int32_t CalculateNKWeightedv2(
 //            const Board  &a_board,
 //            const Player &a_playerMe,
@@ -122,6 +181,32 @@ public:
             const Player &a_playerMe,
             const Player &a_playerOpponent);
 
+    /// Same as CalculateInfluenceAreaWeighted, but Game1v1 searches evaluated with it keep
+    /// the squares each player can really reach with the pieces it has got left (see
+    /// rules::CalculateInfluenceAreaInBoard) in the players instead of the approximation.
+    /// Anywhere else it reads the influence areas as they are saved in the players
+    static int32_t CalculateInfluenceAreaExact(
+            const Board  &a_board,
+            const Player &a_playerMe,
+            const Player &a_playerOpponent);
+
+    /// Calculate the heuristic value using the nucleation points, the influence area
+    /// and the squares taken by each player weighted with CalculateCircularWeight
+    /// It doesn't go through the board. It reads the weighted sums each player keeps
+    /// up to date while pieces are put down and removed (see Player::GetNucleationPointsWeight),
+    /// so it takes the same time regardless of the size of the board. Inlined
+    static int32_t CalculateWeightedAreas(
+            const Board  &a_board,
+            const Player &a_playerMe,
+            const Player &a_playerOpponent);
+
+    /// Same value as CalculateWeightedAreas, but it is computed going through the
+    /// whole board. It is the reference used to check the incremental version
+    static int32_t CalculateWeightedAreasCompute(
+            const Board  &a_board,
+            const Player &a_playerMe,
+            const Player &a_playerOpponent);
+
     /// Calculate the heurisitc value based on the amount of pieces that can be put down
     /// on the board. It uses bitwise representation of pieces and board to improve
     /// calculation times
@@ -187,5 +272,8 @@ private:
     Heuristic& operator=(const Heuristic &src);
 };
 
+// include implementation details of inline functions
+#include "impl/heuristic_impl.h"
+
 #endif /* HEURISTIC_H_ */
 
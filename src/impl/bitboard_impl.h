@@ -0,0 +1,329 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  bitboard_impl.h
+/// @brief Implementation details of inlined functions of the Bitboard class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef BITBOARD_IMPL_H_
+#define BITBOARD_IMPL_H_
+
+inline
+Bitboard::Bitboard()
+{
+    Clear();
+}
+
+inline
+int32_t Bitboard::CoordToIndex(const Coordinate &a_coord, int32_t a_nColumns)
+{
+    return (a_coord.m_row * a_nColumns) + a_coord.m_col;
+}
+
+inline
+void Bitboard::IndexToCoord(int32_t a_index, int32_t a_nColumns, Coordinate &out_coord)
+{
+    out_coord.m_row = a_index / a_nColumns;
+    out_coord.m_col = a_index % a_nColumns;
+}
+
+inline
+void Bitboard::Clear()
+{
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        m_words[i] = 0;
+    }
+}
+
+inline
+void Bitboard::SetLowest(int32_t a_nBits)
+{
+#ifdef DEBUG
+    assert((a_nBits >= 0) && (a_nBits <= BITBOARD_N_BITS));
+#endif
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        int32_t bitsInThisWord = a_nBits - (i * 64);
+        if (bitsInThisWord >= 64)
+        {
+            m_words[i] = ~static_cast<uint64_t>(0);
+        }
+        else if (bitsInThisWord > 0)
+        {
+            m_words[i] = (static_cast<uint64_t>(1) << bitsInThisWord) - 1;
+        }
+        else
+        {
+            m_words[i] = 0;
+        }
+    }
+}
+
+inline
+bool Bitboard::IsSet(int32_t a_index) const
+{
+#ifdef DEBUG
+    assert((a_index >= 0) && (a_index < BITBOARD_N_BITS));
+#endif
+    return (m_words[a_index >> 6] >> (a_index & 63)) & 1;
+}
+
+inline
+void Bitboard::Set(int32_t a_index)
+{
+#ifdef DEBUG
+    assert((a_index >= 0) && (a_index < BITBOARD_N_BITS));
+#endif
+    m_words[a_index >> 6] |= (static_cast<uint64_t>(1) << (a_index & 63));
+}
+
+inline
+void Bitboard::Unset(int32_t a_index)
+{
+#ifdef DEBUG
+    assert((a_index >= 0) && (a_index < BITBOARD_N_BITS));
+#endif
+    m_words[a_index >> 6] &= ~(static_cast<uint64_t>(1) << (a_index & 63));
+}
+
+inline
+bool Bitboard::IsEmpty() const
+{
+    uint64_t accum = 0;
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        accum |= m_words[i];
+    }
+    return (accum == 0);
+}
+
+inline
+int32_t Bitboard::PopCount() const
+{
+    int32_t count = 0;
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        count += PopCount64(m_words[i]);
+    }
+    return count;
+}
+
+inline
+int32_t Bitboard::NextSetBit(int32_t a_index) const
+{
+    if ((a_index < 0) || (a_index >= BITBOARD_N_BITS))
+    {
+        return -1;
+    }
+
+    int32_t thisWord = a_index >> 6;
+    // ignore the bits lower than a_index in the first word
+    uint64_t word = m_words[thisWord] & (~static_cast<uint64_t>(0) << (a_index & 63));
+    while (word == 0)
+    {
+        thisWord++;
+        if (thisWord >= BITBOARD_N_WORDS)
+        {
+            return -1;
+        }
+        word = m_words[thisWord];
+    }
+
+    return (thisWord << 6) + LowestBit64(word);
+}
+
+inline
+uint64_t Bitboard::GetWord(int32_t a_word) const
+{
+#ifdef DEBUG
+    assert((a_word >= 0) && (a_word < BITBOARD_N_WORDS));
+#endif
+    return m_words[a_word];
+}
+
+inline
+const uint64_t* Bitboard::GetWords() const
+{
+    return m_words;
+}
+
+inline
+Bitboard& Bitboard::operator&= (const Bitboard &a_src)
+{
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        m_words[i] &= a_src.m_words[i];
+    }
+    return *this;
+}
+
+inline
+Bitboard& Bitboard::operator|= (const Bitboard &a_src)
+{
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        m_words[i] |= a_src.m_words[i];
+    }
+    return *this;
+}
+
+inline
+Bitboard& Bitboard::operator^= (const Bitboard &a_src)
+{
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        m_words[i] ^= a_src.m_words[i];
+    }
+    return *this;
+}
+
+inline
+Bitboard Bitboard::operator& (const Bitboard &a_src) const
+{
+    Bitboard result(*this);
+    result &= a_src;
+    return result;
+}
+
+inline
+Bitboard Bitboard::operator| (const Bitboard &a_src) const
+{
+    Bitboard result(*this);
+    result |= a_src;
+    return result;
+}
+
+inline
+Bitboard Bitboard::operator^ (const Bitboard &a_src) const
+{
+    Bitboard result(*this);
+    result ^= a_src;
+    return result;
+}
+
+inline
+Bitboard Bitboard::operator~ () const
+{
+    Bitboard result;
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        result.m_words[i] = ~m_words[i];
+    }
+    return result;
+}
+
+inline
+Bitboard Bitboard::operator<< (int32_t a_nBits) const
+{
+#ifdef DEBUG
+    assert(a_nBits >= 0);
+#endif
+    Bitboard result;
+    int32_t wordShift = a_nBits >> 6;
+    int32_t bitShift  = a_nBits & 63;
+
+    for (int32_t i = BITBOARD_N_WORDS - 1; i >= wordShift; i--)
+    {
+        result.m_words[i] = m_words[i - wordShift] << bitShift;
+        if ( (bitShift != 0) && ((i - wordShift) > 0) )
+        {
+            result.m_words[i] |= m_words[i - wordShift - 1] >> (64 - bitShift);
+        }
+    }
+
+    return result;
+}
+
+inline
+Bitboard Bitboard::operator>> (int32_t a_nBits) const
+{
+#ifdef DEBUG
+    assert(a_nBits >= 0);
+#endif
+    Bitboard result;
+    int32_t wordShift = a_nBits >> 6;
+    int32_t bitShift  = a_nBits & 63;
+
+    for (int32_t i = 0; i < (BITBOARD_N_WORDS - wordShift); i++)
+    {
+        result.m_words[i] = m_words[i + wordShift] >> bitShift;
+        if ( (bitShift != 0) && ((i + wordShift + 1) < BITBOARD_N_WORDS) )
+        {
+            result.m_words[i] |= m_words[i + wordShift + 1] << (64 - bitShift);
+        }
+    }
+
+    return result;
+}
+
+inline
+bool Bitboard::operator== (const Bitboard &a_src) const
+{
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        if (m_words[i] != a_src.m_words[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline
+bool Bitboard::operator!= (const Bitboard &a_src) const
+{
+    return !(*this == a_src);
+}
+
+inline
+int32_t Bitboard::PopCount64(uint64_t a_word)
+{
+#ifdef __GNUC__
+    return __builtin_popcountll(a_word);
+#else
+    a_word = a_word - ((a_word >> 1) & 0x5555555555555555ull);
+    a_word = (a_word & 0x3333333333333333ull) + ((a_word >> 2) & 0x3333333333333333ull);
+    a_word = (a_word + (a_word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return static_cast<int32_t>((a_word * 0x0101010101010101ull) >> 56);
+#endif
+}
+
+inline
+int32_t Bitboard::LowestBit64(uint64_t a_word)
+{
+#ifdef DEBUG
+    assert(a_word != 0);
+#endif
+#ifdef __GNUC__
+    return __builtin_ctzll(a_word);
+#else
+    // the lowest bit set is isolated and then counted: (a_word & -a_word) - 1
+    // has got as many 1s as trailing 0s has got a_word
+    return PopCount64((a_word & (~a_word + 1)) - 1);
+#endif
+}
+
+#endif // BITBOARD_IMPL_H_
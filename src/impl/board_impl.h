@@ -23,6 +23,8 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 6-Jul-2010  Original development
+///           agent              17-Oct-2026  Board saved into bit planes
+///           agent              17-Oct-2026  Circular weights saved into bit planes
 /// @endhistory
 ///
 // ============================================================================
@@ -30,8 +32,8 @@
 #ifndef BOARD_IMPL_H_
 #define BOARD_IMPL_H_
 
-inline 
-bool Board::IsCoordEmpty(const Coordinate &a_coord) const
+inline
+int32_t Board::CoordToIndex(const Coordinate &a_coord) const
 {
 #ifdef DEBUG
     assert(a_coord.m_row >= 0);
@@ -39,43 +41,52 @@ bool Board::IsCoordEmpty(const Coordinate &a_coord) const
     assert(a_coord.m_row < m_nRows);
     assert(a_coord.m_col < m_nColumns);
 #endif
-    return (m_theBoard[a_coord.m_row][a_coord.m_col] == m_emptyChar);
+    return Bitboard::CoordToIndex(a_coord, m_nColumns);
+}
+
+inline
+int32_t Board::GetPlayerPlaneIndex(char a_presentationChar) const
+{
+    for (int32_t i = 0; i < m_nPlayerPlanes; i++)
+    {
+        if (m_playerChars[i] == a_presentationChar)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+inline 
+bool Board::IsCoordEmpty(const Coordinate &a_coord) const
+{
+    return (m_squares[CoordToIndex(a_coord)] == m_emptyChar);
 }
 
 inline 
 void Board::BlankCoord(const Coordinate &a_coord)
 {
-#ifdef DEBUG
-    assert(a_coord.m_row >= 0);
-    assert(a_coord.m_col >= 0);
-    assert(a_coord.m_row < m_nRows);
-    assert(a_coord.m_col < m_nColumns);
-#endif
-    m_theBoard[a_coord.m_row][a_coord.m_col] = m_emptyChar;
+    int32_t index = CoordToIndex(a_coord);
+
+    int32_t planeIndex = GetPlayerPlaneIndex(m_squares[index]);
+    if (planeIndex >= 0)
+    {
+        m_playerPlanes[planeIndex].Unset(index);
+    }
+    m_occupied.Unset(index);
+    m_squares[index] = m_emptyChar;
 }
 
 inline 
 bool Board::IsPlayerInCoord(const Coordinate &a_coord, const Player &a_player) const
 {
-#ifdef DEBUG
-    assert(a_coord.m_row >= 0);
-    assert(a_coord.m_col >= 0);
-    assert(a_coord.m_row < m_nRows);
-    assert(a_coord.m_col < m_nColumns);
-#endif
-    return (m_theBoard[a_coord.m_row][a_coord.m_col] == a_player.PresentationChar());
+    return (m_squares[CoordToIndex(a_coord)] == a_player.PresentationChar());
 }
 
 inline 
 void Board::SetPlayerInCoord(const Coordinate &a_coord, const Player &a_player)
 {
-#ifdef DEBUG
-    assert(a_coord.m_row >= 0);
-    assert(a_coord.m_col >= 0);
-    assert(a_coord.m_row < m_nRows);
-    assert(a_coord.m_col < m_nColumns);
-#endif
-    m_theBoard[a_coord.m_row][a_coord.m_col] = a_player.PresentationChar();
+    SetCharInIndex(CoordToIndex(a_coord), a_player.PresentationChar());
 }
 
 inline 
@@ -90,4 +101,128 @@ int32_t Board::GetNColumns() const
     return m_nColumns;
 }
 
+inline
+const Bitboard& Board::GetOccupiedPlane() const
+{
+    return m_occupied;
+}
+
+inline
+Bitboard Board::GetEmptyPlane() const
+{
+    return m_insideMask & ~m_occupied;
+}
+
+inline
+Bitboard Board::GetPlayerPlane(const Player &a_player) const
+{
+    int32_t planeIndex = GetPlayerPlaneIndex(a_player.PresentationChar());
+    if (planeIndex < 0)
+    {
+        // this player hasn't taken any square of the board yet
+        return Bitboard();
+    }
+    return m_playerPlanes[planeIndex];
+}
+
+inline
+Bitboard Board::GetOrthogonalNeighbours(const Bitboard &a_plane) const
+{
+    // squares moved 1 column to the right can't end up in the 1st column
+    // (they would have wrapped around from the end of the previous row)
+    // and the other way around when moving them to the left
+    Bitboard neighbours =
+        ((a_plane << 1) & m_columnMasks[BOARD_MAX_PLANE_SHIFT - 1]) |
+        ((a_plane >> 1) & m_columnMasks[BOARD_MAX_PLANE_SHIFT + 1]) |
+        (a_plane << m_nColumns)                                     |
+        (a_plane >> m_nColumns);
+
+    return neighbours & m_insideMask;
+}
+
+inline
+Bitboard Board::GetDiagonalNeighbours(const Bitboard &a_plane) const
+{
+    Bitboard right = (a_plane << 1) & m_columnMasks[BOARD_MAX_PLANE_SHIFT - 1];
+    Bitboard left  = (a_plane >> 1) & m_columnMasks[BOARD_MAX_PLANE_SHIFT + 1];
+    Bitboard neighbours =
+        (right << m_nColumns) |
+        (right >> m_nColumns) |
+        (left  << m_nColumns) |
+        (left  >> m_nColumns);
+
+    return neighbours & m_insideMask;
+}
+
+inline
+Bitboard Board::GetShiftedPlane(
+        const Bitboard &a_plane,
+        int32_t         a_rowOffset,
+        int32_t         a_colOffset) const
+{
+#ifdef DEBUG
+    assert( (a_colOffset >= -BOARD_MAX_PLANE_SHIFT) && (a_colOffset <= BOARD_MAX_PLANE_SHIFT) );
+#endif
+
+    // the square (row, col) takes the value of the square which is
+    // (a_rowOffset * m_nColumns + a_colOffset) bits above it. Squares moved
+    // out of the 1st/last rows are lost by the shift itself, and the mask
+    // removes the ones which wrapped around a row (and the ones moved
+    // to the unused bits above the last row)
+    int32_t nBits = (a_rowOffset * m_nColumns) + a_colOffset;
+    if (nBits >= 0)
+    {
+        return (a_plane >> nBits) & m_columnMasks[BOARD_MAX_PLANE_SHIFT + a_colOffset];
+    }
+    return (a_plane << -nBits) & m_columnMasks[BOARD_MAX_PLANE_SHIFT + a_colOffset];
+}
+
+inline
+int32_t Board::GetFirstIndexSpiral(const Bitboard &a_plane, int32_t &out_ring) const
+{
+    out_ring = 0;
+    return GetNextIndexSpiral(a_plane, out_ring, -1);
+}
+
+inline
+int32_t Board::GetNextIndexSpiral(
+        const Bitboard &a_plane,
+        int32_t        &in_out_ring,
+        int32_t         a_index) const
+{
+    while (in_out_ring < m_nSpiralRings)
+    {
+        int32_t index = (a_plane & m_spiralRings[in_out_ring]).NextSetBit(a_index + 1);
+        if (index >= 0)
+        {
+            return index;
+        }
+
+        // no squares left in this ring. Start from the beginning of the next one
+        in_out_ring++;
+        a_index = -1;
+    }
+
+    return -1;
+}
+
+inline
+const Bitboard& Board::GetCircularWeightSlice(int32_t a_bit, bool a_halved) const
+{
+#ifdef DEBUG
+    assert((a_bit >= 0) && (a_bit < BOARD_CIRCULAR_WEIGHT_BITS));
+#endif
+    return m_circularWeightSlices[a_halved ? 1 : 0][a_bit];
+}
+
+inline
+int32_t Board::GetCircularWeightSliceValue(int32_t a_bit)
+{
+#ifdef DEBUG
+    assert((a_bit >= 0) && (a_bit < BOARD_CIRCULAR_WEIGHT_BITS));
+#endif
+    // the highest bit is the sign bit
+    return (a_bit == (BOARD_CIRCULAR_WEIGHT_BITS - 1)) ? -(1 << a_bit) : (1 << a_bit);
+}
+
 #endif // BOARD_IMPL_H_
\ No newline at end of file
@@ -0,0 +1,134 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  cancellation_token_impl.h
+/// @brief Implementation details of inlined functions of the CancellationToken
+///        and CancellationCheckpoint classes
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef CANCELLATION_TOKEN_IMPL_H_
+#define CANCELLATION_TOKEN_IMPL_H_
+
+inline
+CancellationToken::CancellationToken(const CancellationToken* a_parent) :
+    m_ownFlag(0),
+    m_flag(&m_ownFlag),
+    m_parent(a_parent)
+{
+}
+
+inline
+CancellationToken::CancellationToken(const volatile sig_atomic_t &a_flag) :
+    m_ownFlag(0),
+    m_flag(&a_flag),
+    m_parent(NULL)
+{
+}
+
+inline
+CancellationToken::CancellationToken(const CancellationToken &a_src) :
+    m_ownFlag(0),
+    m_flag(a_src.m_flag),
+    m_parent(a_src.m_parent)
+{
+}
+
+inline
+CancellationToken::~CancellationToken()
+{
+}
+
+inline
+void CancellationToken::Cancel()
+{
+#ifdef DEBUG
+    assert(m_flag == &m_ownFlag);
+#endif
+
+    m_ownFlag = 1;
+}
+
+inline
+bool CancellationToken::IsCancelled() const
+{
+    return (*m_flag != 0) ||
+           ( (m_parent != NULL) && m_parent->IsCancelled() );
+}
+
+inline
+CancellationCheckpoint::CancellationCheckpoint(
+        const CancellationToken &a_token,
+        int32_t                  a_interval) :
+    m_token(a_token),
+    m_interval(a_interval),
+    m_countdown(a_interval),
+    m_cancelled(false)
+{
+#ifdef DEBUG
+    assert(m_interval > 0);
+#endif
+}
+
+inline
+CancellationCheckpoint::~CancellationCheckpoint()
+{
+}
+
+inline
+bool CancellationCheckpoint::Poll()
+{
+    if (--m_countdown > 0)
+    {
+        return m_cancelled;
+    }
+
+    return Check();
+}
+
+inline
+bool CancellationCheckpoint::Check()
+{
+    m_countdown = m_interval;
+    if (!m_cancelled)
+    {
+        m_cancelled = m_token.IsCancelled();
+    }
+
+    return m_cancelled;
+}
+
+inline
+bool CancellationCheckpoint::IsCancelled() const
+{
+    return m_cancelled;
+}
+
+inline
+const CancellationToken& CancellationCheckpoint::GetToken() const
+{
+    return m_token;
+}
+
+#endif /* CANCELLATION_TOKEN_IMPL_H_ */
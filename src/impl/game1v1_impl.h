@@ -23,6 +23,15 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 6-Jul-2010  Original development
+///           agent              17-Oct-2026  Zobrist hash key of a position
+///           agent              17-Oct-2026  Number of nodes searched
+///           agent              17-Oct-2026  Search statistics
+///           agent              17-Oct-2026  Move ordering switch
+///           agent              17-Oct-2026  Search mode
+///           agent              17-Oct-2026  Position keys and switchable progress updates
+///           agent              17-Oct-2026  Opening book
+///           agent              17-Oct-2026  Endgame solver threshold
+///           agent              17-Oct-2026  Specialised search switch
 /// @endhistory
 ///
 // ============================================================================
@@ -36,6 +45,100 @@ const Board& Game1v1::GetBoard() const
     return m_board;
 }
 
+inline
+const Game1v1::SearchStats_t& Game1v1::GetSearchStats() const
+{
+    return m_searchStats;
+}
+
+inline
+void Game1v1::SetMoveOrdering(bool a_enabled)
+{
+    m_moveOrdering = a_enabled;
+}
+
+inline
+bool Game1v1::IsMoveOrderingEnabled() const
+{
+    return m_moveOrdering;
+}
+
+inline
+void Game1v1::SetSearchMode(eSearchMode_t a_searchMode)
+{
+    m_searchMode = a_searchMode;
+}
+
+inline
+Game1v1::eSearchMode_t Game1v1::GetSearchMode() const
+{
+    return m_searchMode;
+}
+
+inline
+void Game1v1::SetSpecialisedSearch(bool a_enabled)
+{
+    m_specialisedSearch = a_enabled;
+}
+
+inline
+bool Game1v1::IsSpecialisedSearchEnabled() const
+{
+    return m_specialisedSearch;
+}
+
+inline
+void Game1v1::SetProgressUpdate(bool a_enabled)
+{
+    m_progressUpdate = a_enabled;
+}
+
+inline
+bool Game1v1::IsProgressUpdateEnabled() const
+{
+    return m_progressUpdate;
+}
+
+inline
+void Game1v1::SetOpeningBook(const OpeningBook* a_openingBook)
+{
+    m_openingBook = a_openingBook;
+}
+
+inline
+const OpeningBook* Game1v1::GetOpeningBook() const
+{
+    return m_openingBook;
+}
+
+inline
+void Game1v1::SetEndgameThreshold(int32_t a_nMoves)
+{
+    m_endgameThreshold = (a_nMoves > 0) ? a_nMoves : 0;
+}
+
+inline
+int32_t Game1v1::GetEndgameThreshold() const
+{
+    return m_endgameThreshold;
+}
+
+inline
+uint64_t Game1v1::GetPositionKey(eGame1v1Player_t a_playerToMove) const
+{
+    return CalculateHashKey(GetPlayer(a_playerToMove), GetOpponent(a_playerToMove));
+}
+
+inline
+uint64_t Game1v1::CalculateHashKey(
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
+{
+    return a_playerMe.GetHashKey() ^
+           a_playerOpponent.GetHashKey() ^
+           zobrist::SideToMoveKey(a_playerMe.PresentationChar());
+}
+
 inline 
 int32_t Game1v1::GetAllNucleationPoints(
         const Player       &a_player,
@@ -0,0 +1,90 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  heuristic_impl.h
+/// @brief Implementation details of inlined functions of the Heuristic class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef HEURISTIC_IMPL_H_
+#define HEURISTIC_IMPL_H_
+
+inline
+int32_t Heuristic::PointerEvaluator::Evaluate(
+        EvalFunction_t a_heuristicMethod,
+        const Board   &a_board,
+        const Player  &a_playerMe,
+        const Player  &a_playerOpponent)
+{
+    return a_heuristicMethod(a_board, a_playerMe, a_playerOpponent);
+}
+
+template<Heuristic::EvalFunction_t EVAL_FUNCTION>
+inline
+int32_t Heuristic::StaticEvaluator<EVAL_FUNCTION>::Evaluate(
+        EvalFunction_t /* a_heuristicMethod */,
+        const Board   &a_board,
+        const Player  &a_playerMe,
+        const Player  &a_playerOpponent)
+{
+    return EVAL_FUNCTION(a_board, a_playerMe, a_playerOpponent);
+}
+
+inline
+int32_t Heuristic::CalculateSimple(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
+{
+    int32_t squaresMe       = a_board.GetPlayerPlane(a_playerMe).PopCount();
+    int32_t squaresOpponent = a_board.GetPlayerPlane(a_playerOpponent).PopCount();
+    int32_t rv = 0;
+
+    rv += (squaresMe << 2); // times 4
+    rv += (a_playerMe.NumberOfNucleationPoints() << 1); // times 2
+    rv -= (squaresOpponent << 2); // times 4
+    rv -= a_playerOpponent.NumberOfNucleationPoints();
+
+    return rv;
+}
+
+inline
+int32_t Heuristic::CalculateWeightedAreas(
+        const Board  &a_board,
+        const Player &a_playerMe,
+        const Player &a_playerOpponent)
+{
+    int32_t rv = 0;
+
+    rv += a_playerMe.GetNucleationPointsWeight();
+    rv += a_playerMe.GetInfluenceAreaWeight();
+    rv += (a_playerMe.GetTakenSquaresWeight() << 1);       // times 2
+    rv -= a_playerOpponent.GetNucleationPointsWeight();
+    rv -= a_playerOpponent.GetInfluenceAreaWeight();
+    rv -= (a_playerOpponent.GetTakenSquaresWeight() << 1); // times 2
+
+    return rv;
+}
+
+#endif // HEURISTIC_IMPL_H_
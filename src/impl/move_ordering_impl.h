@@ -0,0 +1,165 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  move_ordering_impl.h
+/// @brief Implementation details of inlined functions of the MoveOrdering class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef MOVE_ORDERING_IMPL_H_
+#define MOVE_ORDERING_IMPL_H_
+
+// scores of the killer moves. Always higher than any history value
+#define MO_SCORE_KILLER_0 0xffffffffull
+#define MO_SCORE_KILLER_1 0xfffffffeull
+
+inline
+bool MoveOrdering::IsEnabled() const
+{
+    return m_enabled;
+}
+
+inline
+int32_t MoveOrdering::HistoryIndex(PackedMove_t a_move) const
+{
+#ifdef DEBUG
+    assert(packedmove::IsNoMove(a_move) == false);
+    assert(packedmove::GetSquareIndex(a_move) < m_nSquares);
+#endif
+
+    return ((m_firstConf[packedmove::GetPieceType(a_move)] +
+             packedmove::GetConfIndex(a_move)) * m_nSquares) +
+           packedmove::GetSquareIndex(a_move);
+}
+
+inline
+void MoveOrdering::ClearMoves(int32_t a_ply)
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+#endif
+
+    m_nMoves[a_ply] = 0;
+}
+
+inline
+void MoveOrdering::AddMove(int32_t a_ply, PackedMove_t a_move)
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+    assert(m_nMoves[a_ply] < m_maxMoves);
+#endif
+
+    int32_t index = m_nMoves[a_ply]++;
+    m_moves[(a_ply * m_maxMoves) + index] = a_move;
+
+    uint64_t score = 0;
+    if (m_enabled)
+    {
+        const PackedMove_t* killers = &m_killers[a_ply * MOVE_ORDERING_KILLERS_PER_PLY];
+        if (a_move == killers[0])
+        {
+            score = MO_SCORE_KILLER_0;
+        }
+        else if (a_move == killers[1])
+        {
+            score = MO_SCORE_KILLER_1;
+        }
+        else
+        {
+            score = m_history[HistoryIndex(a_move)];
+        }
+    }
+
+    m_keys[(a_ply * m_maxMoves) + index] =
+        (score << 32) | (static_cast<uint32_t>(index) ^ 0xffffffff);
+}
+
+inline
+int32_t MoveOrdering::GetNMoves(int32_t a_ply) const
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+#endif
+
+    return m_nMoves[a_ply];
+}
+
+inline
+PackedMove_t MoveOrdering::GetMove(int32_t a_ply, int32_t a_index) const
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+    assert( (a_index >= 0) && (a_index < m_nMoves[a_ply]) );
+#endif
+
+    uint32_t moveIndex = static_cast<uint32_t>(m_keys[(a_ply * m_maxMoves) + a_index]) ^ 0xffffffff;
+    return m_moves[(a_ply * m_maxMoves) + moveIndex];
+}
+
+inline
+void MoveOrdering::SaveCutoff(int32_t a_ply, PackedMove_t a_move, int32_t a_depth)
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+#endif
+
+    if ( (m_enabled == false) || packedmove::IsNoMove(a_move) )
+    {
+        return;
+    }
+
+    PackedMove_t* killers = &m_killers[a_ply * MOVE_ORDERING_KILLERS_PER_PLY];
+    if (killers[0] != a_move)
+    {
+        killers[1] = killers[0];
+        killers[0] = a_move;
+    }
+
+    uint32_t &history = m_history[HistoryIndex(a_move)];
+    history += static_cast<uint32_t>(a_depth * a_depth);
+    if (history >= MOVE_ORDERING_MAX_HISTORY)
+    {
+        AgeHistory();
+    }
+}
+
+inline
+PackedMove_t MoveOrdering::GetKiller(int32_t a_ply, int32_t a_index) const
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+    assert( (a_index >= 0) && (a_index < MOVE_ORDERING_KILLERS_PER_PLY) );
+#endif
+
+    return m_killers[(a_ply * MOVE_ORDERING_KILLERS_PER_PLY) + a_index];
+}
+
+inline
+uint32_t MoveOrdering::GetHistory(PackedMove_t a_move) const
+{
+    return m_history[HistoryIndex(a_move)];
+}
+
+#endif /* MOVE_ORDERING_IMPL_H_ */
@@ -0,0 +1,118 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book_impl.h
+/// @brief Implementation details of inlined functions of the OpeningBook class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef OPENING_BOOK_IMPL_H_
+#define OPENING_BOOK_IMPL_H_
+
+inline
+bool OpeningBook::IsLoaded() const
+{
+    return (m_mappedFile != NULL);
+}
+
+inline
+uint32_t OpeningBook::GetNEntries() const
+{
+    return m_nEntries;
+}
+
+inline
+const OpeningBook::Entry_t& OpeningBook::GetEntry(uint32_t a_index) const
+{
+#ifdef DEBUG
+    assert(a_index < m_nEntries);
+#endif
+
+    return m_entries[a_index];
+}
+
+inline
+Heuristic::eHeuristicType_t OpeningBook::GetHeuristicType() const
+{
+#ifdef DEBUG
+    assert(m_header != NULL);
+#endif
+
+    return static_cast<Heuristic::eHeuristicType_t>(m_header->heuristicType);
+}
+
+inline
+int32_t OpeningBook::GetDepth() const
+{
+#ifdef DEBUG
+    assert(m_header != NULL);
+#endif
+
+    return m_header->depth;
+}
+
+inline
+int32_t OpeningBook::GetPlies() const
+{
+#ifdef DEBUG
+    assert(m_header != NULL);
+#endif
+
+    return m_header->plies;
+}
+
+inline
+bool OpeningBook::Lookup(uint64_t a_key, Entry_t &out_entry) const
+{
+    uint32_t low  = 0;
+    uint32_t high = m_nEntries;
+    while (low < high)
+    {
+        uint32_t middle = low + ((high - low) / 2);
+        if (m_entries[middle].key < a_key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if ( (low < m_nEntries) && (m_entries[low].key == a_key) )
+    {
+        out_entry = m_entries[low];
+        return true;
+    }
+
+    return false;
+}
+
+inline
+bool OpeningBook::EntryLessThan(const Entry_t &a_entry1, const Entry_t &a_entry2)
+{
+    return (a_entry1.key < a_entry2.key);
+}
+
+#endif /* OPENING_BOOK_IMPL_H_ */
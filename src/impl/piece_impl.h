@@ -17,12 +17,13 @@
 // with Blockem. If not, see http://www.gnu.org/licenses/.
 //
 /// @file  piece_impl.h
-/// @brief Implementation details of inlined functions of the Piece class
+/// @brief Implementation details of inlined functions of the Piece and PieceConfTable classes
 ///
 /// @author Faustino Frechilla
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 6-Jul-2010  Original development
+///           agent              17-Oct-2026  PieceConfTable
 /// @endhistory
 ///
 // ============================================================================
@@ -75,18 +76,6 @@ uint8_t Piece::GetRadius() const
     return m_radius;
 }
 
-inline
-const std::list<PieceConfiguration>& Piece::GetPrecalculatedConfs() const
-{
-    return m_precalculatedConfsList;
-}
-
-inline
-const std::list<uint64_t>& Piece::GetBitwiseList() const
-{
-    return m_bitwiseRepresentationList;
-}
-
 inline
 void Piece::SetCurrentConfiguration(const PieceConfiguration &a_newConf)
 {
@@ -124,4 +113,37 @@ const Coordinate& Piece::GetCoord(int32_t a_squareIndex) const
     return m_currentConf.m_pieceSquares[a_squareIndex];
 }
 
+inline
+const PieceConf_t& PieceConfTable::GetConf(int32_t a_index) const
+{
+#ifdef DEBUG
+    assert( (a_index >= 0) && (a_index < PIECE_TOTAL_CONFS) );
+#endif
+    return m_confs[a_index];
+}
+
+inline
+int32_t PieceConfTable::GetFirstConf(ePieceType_t a_piece) const
+{
+#ifdef DEBUG
+    assert( (a_piece >= e_minimumPieceIndex) && (a_piece < e_numberOfPieces) );
+#endif
+    return m_firstConf[a_piece];
+}
+
+inline
+int32_t PieceConfTable::GetEndConf(ePieceType_t a_piece) const
+{
+#ifdef DEBUG
+    assert( (a_piece >= e_minimumPieceIndex) && (a_piece < e_numberOfPieces) );
+#endif
+    return m_firstConf[a_piece + 1];
+}
+
+inline
+int32_t PieceConfTable::GetNConfs(ePieceType_t a_piece) const
+{
+    return GetEndConf(a_piece) - GetFirstConf(a_piece);
+}
+
 #endif // __PIECE_IMPL_H__
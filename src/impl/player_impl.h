@@ -23,6 +23,10 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 6-Jul-2010  Original development
+///           agent              17-Oct-2026  Zobrist hash key
+///           agent              17-Oct-2026  NK points and influence area saved into bit planes
+///           agent              17-Oct-2026  Circular weights kept up to date incrementally
+///           agent              17-Oct-2026  Board state saved and restored at once
 /// @endhistory
 ///
 // ============================================================================
@@ -82,6 +86,34 @@ uint8_t Player::NumberOfPiecesAvailable() const
     return m_nPiecesAvailable;
 }
 
+inline
+int32_t Player::CoordToIndex(const Coordinate &a_coord) const
+{
+#ifdef DEBUG
+    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
+    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
+#endif
+    return Bitboard::CoordToIndex(a_coord, m_nColumnsInBoard);
+}
+
+inline
+int32_t Player::CalculateCircularWeight(
+        int32_t a_nRows, int32_t a_nColumns, const Coordinate &a_coord)
+{
+    int32_t tmpValue =
+        std::max(
+                abs(a_coord.m_row + 1 - (a_nRows / 2)),
+                abs(a_coord.m_col + 1 - (a_nColumns / 2)) );
+
+    return ( ( (a_nRows / 2) - tmpValue ) / 2) + 1;
+}
+
+inline
+int32_t Player::CircularWeight(const Coordinate &a_coord) const
+{
+    return CalculateCircularWeight(m_nRowsInBoard, m_nColumnsInBoard, a_coord);
+}
+
 inline
 int32_t Player::NumberOfNucleationPoints() const
 {
@@ -94,6 +126,50 @@ int32_t Player::InfluenceAreaSize() const
     return m_influencedCoordsCount;
 }
 
+inline
+int32_t Player::GetNucleationPointsWeight() const
+{
+    return m_nkPointsWeight;
+}
+
+inline
+int32_t Player::GetInfluenceAreaWeight() const
+{
+    return m_influenceAreaWeight;
+}
+
+inline
+int32_t Player::GetTakenSquaresWeight() const
+{
+    return m_takenSquaresWeight;
+}
+
+inline
+void Player::AddTakenSquare(const Coordinate &a_coord)
+{
+#ifdef DEBUG
+    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
+    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
+#endif
+    m_takenSquaresWeight += CircularWeight(a_coord);
+}
+
+inline
+void Player::RemoveTakenSquare(const Coordinate &a_coord)
+{
+#ifdef DEBUG
+    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
+    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
+#endif
+    m_takenSquaresWeight -= CircularWeight(a_coord);
+}
+
+inline
+void Player::ResetTakenSquares()
+{
+    m_takenSquaresWeight = 0;
+}
+
 inline
 void Player::UnsetPiece(ePieceType_t a_piece)
 {
@@ -103,6 +179,7 @@ void Player::UnsetPiece(ePieceType_t a_piece)
 #endif
     m_piecesPresent[a_piece] = false;
     m_nPiecesAvailable--;
+    m_hashKey ^= zobrist::PieceKey(m_presentationChar, a_piece);
 }
 
 
@@ -115,6 +192,7 @@ void Player::SetPiece(ePieceType_t a_piece)
 #endif
     m_piecesPresent[a_piece] = true;
     m_nPiecesAvailable++;
+    m_hashKey ^= zobrist::PieceKey(m_presentationChar, a_piece);
 }
 
 inline
@@ -127,115 +205,167 @@ bool Player::IsPieceAvailable(ePieceType_t a_piece) const
 }
 
 inline
-bool Player::IsCoordInfluencedByPlayer(const Coordinate &a_coord) const
+uint64_t Player::GetHashKey() const
+{
+    return m_hashKey;
+}
+
+inline
+void Player::ToggleHashKeySquare(const Coordinate &a_coord)
 {
 #ifdef DEBUG
     assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
     assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
 #endif
-    uint8_t coordProperty = m_coordinateProperties[a_coord.m_row][a_coord.m_col];
-    return static_cast<bool>(coordProperty & COORD_PROPERTY_INFLUENCE_AREA);
+    m_hashKey ^= zobrist::SquareKey(m_presentationChar, a_coord);
+}
+
+inline
+bool Player::IsCoordInfluencedByPlayer(const Coordinate &a_coord) const
+{
+    return m_influenceArea.IsSet(CoordToIndex(a_coord));
 }
 
 inline
 void Player::SetInfluencedCoord(const Coordinate &a_coord)
 {
-#ifdef DEBUG
-    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
-    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
-#endif
-    uint8_t coordProperty = m_coordinateProperties[a_coord.m_row][a_coord.m_col];
-    if ((coordProperty & COORD_PROPERTY_INFLUENCE_AREA) == 0)
+    int32_t index = CoordToIndex(a_coord);
+    if (!m_influenceArea.IsSet(index))
     {
-#ifdef DEBUG
-        assert(m_influencedCoordsCount < (m_nRowsInBoard * m_nColumnsInBoard));
-#endif
-        m_coordinateProperties[a_coord.m_row][a_coord.m_col] |= COORD_PROPERTY_INFLUENCE_AREA;
+        m_influenceArea.Set(index);
         m_influencedCoordsCount++;
+        m_influenceAreaWeight += CircularWeight(a_coord);
     }
 }
 
 inline
 void Player::UnsetInfluencedCoord(const Coordinate &a_coord)
 {
-#ifdef DEBUG
-    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
-    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
-#endif
-    uint8_t coordProperty = m_coordinateProperties[a_coord.m_row][a_coord.m_col];
-    if ((coordProperty & COORD_PROPERTY_INFLUENCE_AREA) == COORD_PROPERTY_INFLUENCE_AREA)
+    int32_t index = CoordToIndex(a_coord);
+    if (m_influenceArea.IsSet(index))
     {
-#ifdef DEBUG
-         assert(m_influencedCoordsCount > 0);
-#endif
-         m_coordinateProperties[a_coord.m_row][a_coord.m_col] &= ~COORD_PROPERTY_INFLUENCE_AREA;
-         m_influencedCoordsCount--;
+        m_influenceArea.Unset(index);
+        m_influencedCoordsCount--;
+        m_influenceAreaWeight -= CircularWeight(a_coord);
     }
 }
 
 inline
 bool Player::IsNucleationPoint(const Coordinate &a_coord) const
 {
-#ifdef DEBUG
-    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
-    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
-#endif
-    uint8_t coordProperty = m_coordinateProperties[a_coord.m_row][a_coord.m_col];
-    return static_cast<bool>(coordProperty & COORD_PROPERTY_NKPOINTS);
+    return m_nkPoints.IsSet(CoordToIndex(a_coord));
 }
 
 inline
 void Player::SetNucleationPoint(const Coordinate &a_coord)
 {
-#ifdef DEBUG
-    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
-    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
-#endif
-    uint8_t coordProperty = m_coordinateProperties[a_coord.m_row][a_coord.m_col];
-    if ((coordProperty & COORD_PROPERTY_NKPOINTS) == 0)
+    int32_t index = CoordToIndex(a_coord);
+    if (!m_nkPoints.IsSet(index))
     {
-#ifdef DEBUG
-        assert(m_nkPointsCount < (m_nRowsInBoard * m_nColumnsInBoard));
-#endif
-        m_coordinateProperties[a_coord.m_row][a_coord.m_col] |= COORD_PROPERTY_NKPOINTS;
+        m_nkPoints.Set(index);
         m_nkPointsCount++;
+        m_nkPointsWeight += CircularWeight(a_coord);
     }
 }
 
 inline
 void Player::UnsetNucleationPoint(const Coordinate &a_coord)
 {
-#ifdef DEBUG
-    assert((a_coord.m_row >= 0) && (a_coord.m_row < m_nRowsInBoard));
-    assert((a_coord.m_col >= 0) && (a_coord.m_col < m_nColumnsInBoard));
-#endif
-    uint8_t coordProperty = m_coordinateProperties[a_coord.m_row][a_coord.m_col];
-    if ((coordProperty & COORD_PROPERTY_NKPOINTS) == COORD_PROPERTY_NKPOINTS)
+    int32_t index = CoordToIndex(a_coord);
+    if (m_nkPoints.IsSet(index))
     {
-#ifdef DEBUG
-        assert(m_nkPointsCount > 0);
-#endif
-        m_coordinateProperties[a_coord.m_row][a_coord.m_col] &= ~COORD_PROPERTY_NKPOINTS;
+        m_nkPoints.Unset(index);
         m_nkPointsCount--;
+        m_nkPointsWeight -= CircularWeight(a_coord);
+    }
+}
+
+inline
+const Bitboard& Player::GetNucleationPointsPlane() const
+{
+    return m_nkPoints;
+}
+
+inline
+void Player::SetNucleationPointsPlane(const Bitboard &a_plane)
+{
+    m_nkPoints       = a_plane;
+    m_nkPointsCount  = a_plane.PopCount();
+    m_nkPointsWeight = 0;
+
+    Coordinate thisCoord;
+    for (int32_t index = a_plane.NextSetBit(0);
+         index >= 0;
+         index = a_plane.NextSetBit(index + 1))
+    {
+        Bitboard::IndexToCoord(index, m_nColumnsInBoard, thisCoord);
+        m_nkPointsWeight += CircularWeight(thisCoord);
+    }
+}
+
+inline
+const Bitboard& Player::GetInfluenceAreaPlane() const
+{
+    return m_influenceArea;
+}
+
+inline
+void Player::SetInfluenceAreaPlane(const Bitboard &a_plane)
+{
+    m_influenceArea         = a_plane;
+    m_influencedCoordsCount = a_plane.PopCount();
+    m_influenceAreaWeight   = 0;
+
+    Coordinate thisCoord;
+    for (int32_t index = a_plane.NextSetBit(0);
+         index >= 0;
+         index = a_plane.NextSetBit(index + 1))
+    {
+        Bitboard::IndexToCoord(index, m_nColumnsInBoard, thisCoord);
+        m_influenceAreaWeight += CircularWeight(thisCoord);
     }
 }
 
+inline
+void Player::SaveBoardState(BoardState_t &out_state) const
+{
+    out_state.nkPoints              = m_nkPoints;
+    out_state.influenceArea         = m_influenceArea;
+    out_state.nkPointsCount         = m_nkPointsCount;
+    out_state.influencedCoordsCount = m_influencedCoordsCount;
+    out_state.nkPointsWeight        = m_nkPointsWeight;
+    out_state.influenceAreaWeight   = m_influenceAreaWeight;
+    out_state.takenSquaresWeight    = m_takenSquaresWeight;
+    out_state.hashKey               = m_hashKey;
+}
+
+inline
+void Player::RestoreBoardState(const BoardState_t &a_state)
+{
+    m_nkPoints              = a_state.nkPoints;
+    m_influenceArea         = a_state.influenceArea;
+    m_nkPointsCount         = a_state.nkPointsCount;
+    m_influencedCoordsCount = a_state.influencedCoordsCount;
+    m_nkPointsWeight        = a_state.nkPointsWeight;
+    m_influenceAreaWeight   = a_state.influenceAreaWeight;
+    m_takenSquaresWeight    = a_state.takenSquaresWeight;
+    m_hashKey               = a_state.hashKey;
+}
+
 inline
 int32_t Player::GetAllNucleationPoints(STLCoordinateSet_t &a_set) const
 {
     int32_t nNucleationPoints = 0;
 
-    Coordinate thisCoord(0, 0);
-    for (thisCoord.m_row = 0; thisCoord.m_row < m_nRowsInBoard ; thisCoord.m_row++)
+    Coordinate thisCoord;
+    int32_t index = m_nkPoints.NextSetBit(0);
+    while (index >= 0)
     {
-        for (thisCoord.m_col = 0; thisCoord.m_col < m_nColumnsInBoard ; thisCoord.m_col++)
-        {
-            if (IsNucleationPoint(thisCoord))
-            {
-                a_set.insert(thisCoord);
-                nNucleationPoints++;
-            }
-        }
+        Bitboard::IndexToCoord(index, m_nColumnsInBoard, thisCoord);
+        a_set.insert(thisCoord);
+        nNucleationPoints++;
+
+        index = m_nkPoints.NextSetBit(index + 1);
     }
 
     return nNucleationPoints;
@@ -244,47 +374,26 @@ int32_t Player::GetAllNucleationPoints(STLCoordinateSet_t &a_set) const
 inline
 bool Player::GetNextNucleationPoint(Coordinate &in_out_coord) const
 {
-    Coordinate thisCoord(0, 0);
+    int32_t index = 0;
     if (in_out_coord.Initialised())
     {
-        thisCoord.m_row = in_out_coord.m_row;
-        thisCoord.m_col = in_out_coord.m_col + 1;
-        if (thisCoord.m_col >= m_nColumnsInBoard)
+        index = CoordToIndex(in_out_coord) + 1;
+        if (index >= (m_nRowsInBoard * m_nColumnsInBoard))
         {
-            thisCoord.m_col = 0;
-            thisCoord.m_row = in_out_coord.m_row + 1;
-            if (thisCoord.m_row >= m_nRowsInBoard)
-            {
-                // the end of the board;
-                return false;
-            }
+            // the end of the board;
+            return false;
         }
     }
 
-    while (thisCoord.m_col < m_nColumnsInBoard)
+    // bits outside the board are never set
+    index = m_nkPoints.NextSetBit(index);
+    if (index < 0)
     {
-        if (IsNucleationPoint(thisCoord))
-        {
-            in_out_coord = thisCoord;
-            return true;
-        }
-
-        thisCoord.m_col++;
-    }
-
-    for (thisCoord.m_row++; thisCoord.m_row < m_nRowsInBoard; thisCoord.m_row++)
-    {
-        for (thisCoord.m_col = 0; thisCoord.m_col < m_nColumnsInBoard; thisCoord.m_col++)
-        {
-            if (IsNucleationPoint(thisCoord))
-            {
-                in_out_coord = thisCoord;
-                return true;
-            }
-        }
+        return false;
     }
 
-    return false;
+    Bitboard::IndexToCoord(index, m_nColumnsInBoard, in_out_coord);
+    return true;
 }
 
 #endif // PLAYER_IMPL_H_
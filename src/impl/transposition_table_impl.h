@@ -0,0 +1,253 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  transposition_table_impl.h
+/// @brief Implementation details of inlined functions of the TranspositionTable class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Best move saved as a PackedMove_t
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef TRANSPOSITION_TABLE_IMPL_H_
+#define TRANSPOSITION_TABLE_IMPL_H_
+
+// layout of the data of an entry packed into 64 bits:
+//   bits  0-31 value
+//   bits 32-39 depth
+//   bits 40-41 bound
+//   bits 42-46 type of piece of the best move (TT_NO_PIECE if there is none)
+//   bits 47-49 configuration index of the best move
+//   bits 50-59 square index of the best move
+//   bits 60-63 generation (number of search which saved the entry)
+#define TT_DEPTH_SHIFT      32
+#define TT_BOUND_SHIFT      40
+#define TT_PIECE_SHIFT      42
+#define TT_CONF_SHIFT       47
+#define TT_SQUARE_SHIFT     50
+#define TT_GENERATION_SHIFT 60
+
+#define TT_DEPTH_MASK       0xff
+#define TT_BOUND_MASK       0x03
+#define TT_PIECE_MASK       0x1f
+#define TT_CONF_MASK        0x07
+#define TT_SQUARE_MASK      0x3ff
+#define TT_GENERATION_MASK  0x0f
+// bits used by the best move (piece, conf and square)
+#define TT_MOVE_MASK        (static_cast<uint64_t>(0x3ffff) << TT_PIECE_SHIFT)
+// value of the piece field when there is no best move saved
+#define TT_NO_PIECE         TT_PIECE_MASK
+
+inline
+int32_t TranspositionTable::GetSizeMB() const
+{
+    return m_sizeMB;
+}
+
+inline
+uint32_t TranspositionTable::GetNEntries() const
+{
+    return m_nBuckets * ENTRIES_PER_BUCKET;
+}
+
+inline
+const TranspositionTable::Stats_t& TranspositionTable::GetStats() const
+{
+    return m_stats;
+}
+
+inline
+uint64_t TranspositionTable::Pack(
+        int32_t      a_depth,
+        int32_t      a_value,
+        eBound_t     a_bound,
+        PackedMove_t a_move) const
+{
+    if (a_depth < 0)
+    {
+        a_depth = 0;
+    }
+    else if (a_depth > TT_DEPTH_MASK)
+    {
+        a_depth = TT_DEPTH_MASK;
+    }
+
+    uint64_t data =
+        static_cast<uint64_t>(static_cast<uint32_t>(a_value))                     |
+        (static_cast<uint64_t>(a_depth) << TT_DEPTH_SHIFT)                         |
+        (static_cast<uint64_t>(a_bound & TT_BOUND_MASK) << TT_BOUND_SHIFT)         |
+        (static_cast<uint64_t>(m_generation & TT_GENERATION_MASK) << TT_GENERATION_SHIFT);
+
+    ePieceType_t pieceType   = packedmove::GetPieceType(a_move);
+    int32_t      confIndex   = packedmove::GetConfIndex(a_move);
+    int32_t      squareIndex = packedmove::GetSquareIndex(a_move);
+
+    if ( (pieceType >= e_minimumPieceIndex) && (pieceType < e_numberOfPieces) &&
+         (confIndex <= TT_CONF_MASK) && (squareIndex <= TT_SQUARE_MASK) )
+    {
+        data |= (static_cast<uint64_t>(pieceType)   << TT_PIECE_SHIFT) |
+                (static_cast<uint64_t>(confIndex)   << TT_CONF_SHIFT)  |
+                (static_cast<uint64_t>(squareIndex) << TT_SQUARE_SHIFT);
+    }
+    else
+    {
+        // no best move (or it can't be packed)
+        data |= (static_cast<uint64_t>(TT_NO_PIECE) << TT_PIECE_SHIFT);
+    }
+
+    return data;
+}
+
+inline
+void TranspositionTable::Unpack(uint64_t a_data, Entry_t &out_entry)
+{
+    out_entry.value = static_cast<int32_t>(static_cast<uint32_t>(a_data & 0xffffffffull));
+    out_entry.depth = static_cast<int32_t>((a_data >> TT_DEPTH_SHIFT) & TT_DEPTH_MASK);
+    out_entry.bound = static_cast<eBound_t>((a_data >> TT_BOUND_SHIFT) & TT_BOUND_MASK);
+
+    int32_t piece = static_cast<int32_t>((a_data >> TT_PIECE_SHIFT) & TT_PIECE_MASK);
+    if (piece == TT_NO_PIECE)
+    {
+        out_entry.move = packedmove::NoMove();
+    }
+    else
+    {
+        out_entry.move = packedmove::Pack(
+                static_cast<ePieceType_t>(piece),
+                static_cast<int32_t>((a_data >> TT_CONF_SHIFT)   & TT_CONF_MASK),
+                static_cast<int32_t>((a_data >> TT_SQUARE_SHIFT) & TT_SQUARE_MASK));
+    }
+}
+
+inline
+bool TranspositionTable::Probe(uint64_t a_key, Entry_t &out_entry, Stats_t &in_out_stats) const
+{
+    if (m_nBuckets == 0)
+    {
+        in_out_stats.misses++;
+        return false;
+    }
+
+    const Bucket_t &bucket = m_buckets[a_key & (m_nBuckets - 1)];
+    bool bucketInUse = false;
+
+    for (int32_t i = 0; i < ENTRIES_PER_BUCKET; i++)
+    {
+        uint64_t data       = bucket.entries[i].data;
+        uint64_t keyXorData = bucket.entries[i].keyXorData;
+
+        if (data == 0)
+        {
+            // empty entry (stored entries never have data set to 0 since
+            // the bound of a stored entry is never e_boundNone)
+            continue;
+        }
+
+        if ((keyXorData ^ data) == a_key)
+        {
+            Unpack(data, out_entry);
+            in_out_stats.hits++;
+            return true;
+        }
+
+        bucketInUse = true;
+    }
+
+    if (bucketInUse)
+    {
+        in_out_stats.collisions++;
+    }
+    else
+    {
+        in_out_stats.misses++;
+    }
+
+    return false;
+}
+
+inline
+void TranspositionTable::Store(
+        uint64_t     a_key,
+        int32_t      a_depth,
+        int32_t      a_value,
+        eBound_t     a_bound,
+        PackedMove_t a_move)
+{
+#ifdef DEBUG
+    assert(a_bound != e_boundNone);
+#endif
+
+    if (m_nBuckets == 0)
+    {
+        return;
+    }
+
+    Bucket_t &bucket = m_buckets[a_key & (m_nBuckets - 1)];
+    uint64_t newData = Pack(a_depth, a_value, a_bound, a_move);
+
+    // look for the entry to be replaced: the one that saves this same position,
+    // an empty one or the one which is less valuable, in that order. Entries saved
+    // by previous searches are less valuable than any entry saved by this one.
+    // Shallow entries are less valuable than deep ones
+    int32_t victim      = 0;
+    int32_t victimScore = 0x7fffffff;
+    for (int32_t i = 0; i < ENTRIES_PER_BUCKET; i++)
+    {
+        uint64_t data = bucket.entries[i].data;
+
+        if (data == 0)
+        {
+            victim = i;
+            break;
+        }
+
+        if ((bucket.entries[i].keyXorData ^ data) == a_key)
+        {
+            if (packedmove::IsNoMove(a_move))
+            {
+                // keep the best move saved before. It is still a good
+                // candidate to be tried out first
+                newData = (newData & ~TT_MOVE_MASK) | (data & TT_MOVE_MASK);
+            }
+            victim = i;
+            break;
+        }
+
+        int32_t score = static_cast<int32_t>((data >> TT_DEPTH_SHIFT) & TT_DEPTH_MASK);
+        if (((data >> TT_GENERATION_SHIFT) & TT_GENERATION_MASK) !=
+            static_cast<uint64_t>(m_generation & TT_GENERATION_MASK))
+        {
+            score -= (TT_DEPTH_MASK + 1);
+        }
+
+        if (score < victimScore)
+        {
+            victim      = i;
+            victimScore = score;
+        }
+    }
+
+    bucket.entries[victim].keyXorData = a_key ^ newData;
+    bucket.entries[victim].data       = newData;
+}
+
+#endif /* TRANSPOSITION_TABLE_IMPL_H_ */
@@ -26,6 +26,15 @@
 ///           Faustino Frechilla 23-Jun-2010  Nice handling of command line parameters
 ///           Faustino Frechilla 21-Jul-2010  i18n
 ///           Faustino Frechilla 23-Sep-2010  Reorganisation. Blockem Options support
+///           agent              17-Oct-2026  --threads option for 1vs1 games
+///           agent              17-Oct-2026  --hash-size option for 1vs1 games
+///           agent              17-Oct-2026  --time-budget option for 1vs1 games
+///           agent              17-Oct-2026  Maximum size of total allocation boards
+///           agent              17-Oct-2026  --threads option for total allocation games
+///           agent              17-Oct-2026  Self-play mode (--mode=3)
+///           agent              17-Oct-2026  Search statistics printed out in 1vs1 mode
+///           agent              17-Oct-2026  Opening book builder mode (--mode=4) and --book option
+///           agent              17-Oct-2026  Challenge validation mode (--mode=5)
 /// @endhistory
 ///
 // ============================================================================
@@ -48,7 +57,12 @@
 #include "blockem_config.h"
 #include "game1v1.h"                // 1vs1 and total allocation games are
 #include "game_total_allocation.h"  // available from terminal
+#include "game_challenge.h"         // challenges can be validated from terminal
+#include "blockem_challenge.h"
 #include "heuristic.h"
+#include "self_play.h"              // AI vs AI games
+#include "opening_book.h"
+#include "opening_book_builder.h"
 #include "gui/glade_defs.h"
 #include "gui/main_window.h"
 #include "gui/game_1v1_config.h"               // initialise singleton
@@ -90,7 +104,10 @@ static const int COMMAND_LINE_PARSING_ERR    = 1;
 static const int TOTAL_ALLOC_BAD_OPTIONS_ERR = 3;
 static const int GAME1V1_BAD_OPTIONS_ERR     = 7;
 static const int BAD_MODE_OPTION_ERR         = 15;
+static const int SELF_PLAY_BAD_OPTIONS_ERR   = 31;
+static const int OPENING_BOOK_OPTIONS_ERR    = 63;
 static const int GUI_EXCEPTION_ERR           = 127;
+static const int CHALLENGE_OPTIONS_ERR       = 255;
 
 /// maximum size of error strings
 static const int32_t ERROR_STRING_BUFFER_SIZE = 128;
@@ -109,6 +126,15 @@ static gint g_columns        = GOPTION_INT_NOT_SET;
 static gint g_startingRow    = GOPTION_INT_NOT_SET;
 static gint g_startingColumn = GOPTION_INT_NOT_SET;
 static gint g_depth          = GOPTION_INT_NOT_SET;
+static gint g_threads        = 1;     // default is --threads=1
+static gint g_hashSize       = TRANSPOSITION_TABLE_DEFAULT_SIZE_MB;
+static gint g_timeBudget     = 0;     // default is no time budget (fixed depth)
+static gint g_heuristic2     = 0;     // default is --heuristic2=0
+static gint g_depth2         = GOPTION_INT_NOT_SET;
+static gint g_games          = GOPTION_INT_NOT_SET;
+static gint g_plies          = OPENING_BOOK_DEFAULT_PLIES;
+static gint g_width          = OPENING_BOOK_DEFAULT_WIDTH;
+static gchar* g_bookPath     = NULL;
 static gchar** g_blockemfilePath = NULL;
 
 // typedef struct {
@@ -131,7 +157,8 @@ static GOptionEntry g_cmdEntries[] =
     { "mode", 'm', 0, G_OPTION_ARG_INT, &g_mode,
       N_("Specifies the mode blockem runs. Valid options are: "
       "'0' GUI is shown (Default); '1' one player total-allocation; "
-      "'2' 1vs1 Game"),
+      "'2' 1vs1 Game; '3' self-play (complete 1vs1 games between 2 AIs); "
+      "'4' builds an opening book for 1vs1 games; '5' validates blockem challenge files"),
       "M" },
 
     { "rows", 'r', 0, G_OPTION_ARG_INT, &g_rows,
@@ -158,19 +185,79 @@ static GOptionEntry g_cmdEntries[] =
 
     { "depth"  , 'd', 0, G_OPTION_ARG_INT, &g_depth,
       N_("Sets the maximum depth of search tree to D when 1vs1 Game is selected. "
-      "This is a MANDATORY parameter for --mode=2"),
+      "This is a MANDATORY parameter for --mode=2 unless --time-budget is set. "
+      "In opening book mode (--mode=4) it is the depth every position is searched with, "
+      "and it is MANDATORY too"),
       "D"},
 
+    { "time-budget", 'b', 0, G_OPTION_ARG_INT, &g_timeBudget,
+      N_("Time (in milliseconds) the search is allowed to take when 1vs1 Game is selected "
+      "(--mode=2). The search tree is deepened one level at a time (up to --depth, if set) "
+      "until the time runs out. In challenge validation mode (--mode=5) it is the time "
+      "each challenge is allowed to be solved in. Default is 0 (no time budget)"),
+      "B"},
+
+    { "threads", 't', 0, G_OPTION_ARG_INT, &g_threads,
+      N_("Number of threads the search tree will be split into when 1vs1 Game (--mode=2) "
+      "or total allocation (--mode=1) is selected. In self-play mode (--mode=3) it is the "
+      "number of games played at the same time, and in opening book mode (--mode=4) the "
+      "number of positions searched at the same time (set it to the number of cores). "
+      "In challenge validation mode (--mode=5) the search of each challenge is split "
+      "into T threads. Default is 1"),
+      "T"},
+
+    { "hash-size", 's', 0, G_OPTION_ARG_INT, &g_hashSize,
+      N_("Size (in MB) of the transposition table used by the search when 1vs1 Game is selected "
+      "(--mode=2). '0' disables it. Default is 16"),
+      "S"},
+
     { "heuristic", 'i', 0, G_OPTION_ARG_INT, &g_heuristic,
       N_("Heuristic to be used when mode is set to 1v1 game (--mode=2). Valid options: "
       "'0' \"Influence Area\" (Default); '1' \"Mr. Eastwood\"; '2' \"NK weighted\"; "
-      "'3' \"Centre focused\"; '4' \"Simple\"; '5' \"Random\""),
+      "'3' \"Centre focused\"; '4' \"Simple\"; '5' \"Random\"; '6' \"Weighted areas\"; "
+      "'7' \"Exact influence area\". "
+      "In self-play mode (--mode=3) it is the heuristic of the 1st AI. In opening book "
+      "mode (--mode=4) the heuristic positions are evaluated with"),
+      "H" },
+
+    { "heuristic2", 'j', 0, G_OPTION_ARG_INT, &g_heuristic2,
+      N_("Heuristic of the 2nd AI in self-play mode (--mode=3). Valid options are the same "
+      "as --heuristic's. Default is 0"),
       "H" },
 
+    { "depth2", 'e', 0, G_OPTION_ARG_INT, &g_depth2,
+      N_("Sets the maximum depth of the search tree of the 2nd AI in self-play mode (--mode=3). "
+      "Default is the same as --depth"),
+      "D"},
+
+    { "games", 'g', 0, G_OPTION_ARG_INT, &g_games,
+      N_("Number of games played in self-play mode (--mode=3). The 1st AI moves first in even "
+      "games and the 2nd one in odd games. One JSON line per game is printed out. "
+      "This is a MANDATORY parameter for --mode=3"),
+      "N"},
+
+    { "book", 'k', 0, G_OPTION_ARG_FILENAME, &g_bookPath,
+      N_("Opening book file. The moves of the first plies of 1vs1 games (GUI and --mode=2) "
+      "are read from it instead of being searched when the heuristic and depth are the ones "
+      "the book was built with. In opening book mode (--mode=4) the "
+      "book is written into it, and it is MANDATORY then"),
+      "FILE"},
+
+    { "plies", 'p', 0, G_OPTION_ARG_INT, &g_plies,
+      N_("Number of plies from the start of the game covered by the opening book "
+      "built in --mode=4. Default is 4"),
+      "P"},
+
+    { "width", 'w', 0, G_OPTION_ARG_INT, &g_width,
+      N_("Number of moves expanded per position of the opening book built in --mode=4 "
+      "(the best one and the next best ones 1 ply deep). Default is 6"),
+      "W"},
+
     { G_OPTION_REMAINING, 0, 0, G_OPTION_ARG_FILENAME_ARRAY, &g_blockemfilePath,
       N_("Paths to 1vs1game files (mode 2). Blockem will calculate next move per each one of them "
-      "and print out the result in console. "
-      "Specifying at least 1 file is MANDATORY for --mode=2"),
+      "and print out the result in console. In challenge validation mode (mode 5) they are the "
+      "paths to blockem challenge files, and blockem will try to solve each one of them. "
+      "Specifying at least 1 file is MANDATORY for --mode=2 and --mode=5"),
       // i18n TRANSLATORS: This string is supposed to mean that one or more
       // i18n files might be specified
       // i18n Thank you for contributing to this project
@@ -363,7 +450,10 @@ void ProcessCommandLine(int argc, char **argv)
     // note that the group will be freed together with the context when
     // g_option_context_free() is called, so you must not free the group
     // yourself after adding it to a context
-    g_option_context_add_group (cmdContext, gtk_get_option_group (TRUE));
+    // The default display is not opened while parsing the command line, so the
+    // console modes can be run on machines with no display. The GUI mode opens it
+    // when Gtk::Main is instantiated
+    g_option_context_add_group (cmdContext, gtk_get_option_group (FALSE));
 
     // http://library.gnome.org/devel/glib/unstable/glib-Commandline-option-parser.html#g-option-group-set-translation-domain
     //g_option_group_set_translation_domain (grp, GETTEXT_PACKAGE);
@@ -408,6 +498,28 @@ int main(int argc, char **argv)
     // this file (they all start with 'g_')
     ProcessCommandLine(argc, argv);
 
+    // the opening book is mapped into memory at startup. It is written instead
+    // of read in opening book mode (--mode=4)
+    OpeningBook openingBook;
+    if ( !g_version && (g_bookPath != NULL) && (g_mode != 4) )
+    {
+        if (!openingBook.Load(g_bookPath))
+        {
+            snprintf(errorStringBuffer,
+                     ERROR_STRING_BUFFER_SIZE,
+                     // i18n TRANSLATORS: Please, leave that %s as it is. It will be replaced
+                     // i18n by the path to the opening book file
+                     // i18n Thank you for contributing to this project
+                     _("'%s' is not a valid opening book"),
+                     g_bookPath);
+
+            FatalError(
+                argv[0],
+                errorStringBuffer,
+                OPENING_BOOK_OPTIONS_ERR);
+        }
+    }
+
     if (g_version)
     {
         // "version" option takes priority. If it set nothing else will be done
@@ -434,6 +546,12 @@ int main(int argc, char **argv)
         GameTotalAllocationConfig::Instance();
         GameChallengeConfig::Instance();
 
+        if (openingBook.IsLoaded())
+        {
+            // 1vs1 games will read their first moves from the book
+            Game1v1Config::Instance().SetOpeningBook(&openingBook);
+        }
+
         // g_thread_supported returns TRUE if the thread system is initialised,
         // and FALSE if it is not. Initiliase gthreads only if they haven't been
         // initialised already. Since glib 2.24.0 (from its changelog):
@@ -563,6 +681,23 @@ int main(int argc, char **argv)
                     TOTAL_ALLOC_BAD_OPTIONS_ERR);
             }
 
+            if ( (g_rows > BOARD_MAX_ROWS) || (g_columns > BOARD_MAX_COLUMNS) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave those %d as they are. They will be replaced
+                         // i18n by the maximum number of rows and columns of a board
+                         // i18n Thank you for contributing to this project
+                         _("Boards can't have more than %d rows and %d columns"),
+                         BOARD_MAX_ROWS,
+                         BOARD_MAX_COLUMNS);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    TOTAL_ALLOC_BAD_OPTIONS_ERR);
+            }
+
             if ( (g_startingRow != g_startingColumn) &&
                  ( (g_startingRow == GOPTION_INT_NOT_SET) ||
                    (g_startingColumn == GOPTION_INT_NOT_SET) ) )
@@ -593,8 +728,24 @@ int main(int argc, char **argv)
                 startingCoord.m_col = g_startingColumn;
             }
 
+            if ( (g_threads <= 0) || (g_threads > GAME_TOTAL_ALLOCATION_MAX_THREADS) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum number of threads allowed
+                         // i18n Thank you for contributing to this project
+                         _("Number of threads must be a value between 1 and %d"),
+                         GAME_TOTAL_ALLOCATION_MAX_THREADS);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    TOTAL_ALLOC_BAD_OPTIONS_ERR);
+            }
+
             GameTotalAllocation theGame(g_rows, g_columns, startingCoord);
-            if (theGame.Solve())
+            if (theGame.Solve(g_threads))
             {
                 std::cout << std::endl;
                 // i18n TRANSLATORS: This string is to be printed when the applications finds
@@ -672,6 +823,19 @@ int main(int argc, char **argv)
                    _(Heuristic::m_heuristicData[g_heuristic].m_name),
                    g_heuristic);
 
+            if (g_timeBudget < 0)
+            {
+                FatalError(
+                    argv[0],
+                    _("Time budget in 1vs1Game mode must be set to a positive value"),
+                    GAME1V1_BAD_OPTIONS_ERR);
+            }
+            else if ( (g_timeBudget > 0) && (g_depth == GOPTION_INT_NOT_SET) )
+            {
+                // the search will go as deep as the time budget allows
+                g_depth = GAME1V1_MAX_SEARCH_DEPTH;
+            }
+
             if (g_depth <= 0)
             {
                 FatalError(
@@ -679,7 +843,7 @@ int main(int argc, char **argv)
                     _("Depth in 1vs1Game mode must be set to a positive value"),
                     GAME1V1_BAD_OPTIONS_ERR);
             }
-            else if ( (g_depth & 0x01) == 0)
+            else if ( (g_timeBudget == 0) && ((g_depth & 0x01) == 0) )
             {
                 std::cerr << argv[0]
                           << ": "
@@ -687,9 +851,57 @@ int main(int argc, char **argv)
                           << std::endl;
             }
 
+            if ( (g_threads <= 0) || (g_threads > GAME1V1_MAX_SEARCH_THREADS) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum number of threads allowed
+                         // i18n Thank you for contributing to this project
+                         _("Number of threads must be a value between 1 and %d"),
+                         GAME1V1_MAX_SEARCH_THREADS);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    GAME1V1_BAD_OPTIONS_ERR);
+            }
+
+            if ( (g_hashSize < 0) || (g_hashSize > TRANSPOSITION_TABLE_MAX_SIZE_MB) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum size of the transposition table allowed
+                         // i18n Thank you for contributing to this project
+                         _("Size of the transposition table must be a value between 0 and %d"),
+                         TRANSPOSITION_TABLE_MAX_SIZE_MB);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    GAME1V1_BAD_OPTIONS_ERR);
+            }
+
+            // the transposition table is shared by the searches of all files
+            TranspositionTable transTable(g_hashSize);
+
             // go through all the filenames array. Each file will be loaded into a gam1v1 and the next
             // move will be calculated and printed in the screen
             Game1v1 theGame;
+            if (openingBook.IsLoaded())
+            {
+                theGame.SetOpeningBook(&openingBook);
+
+                // i18n TRANSLATORS: '%s' will be replaced here by the path to the opening
+                // i18n book and '%u' by the number of positions it contains. Bear in mind
+                // i18n the '\n' character should be there in the translated version of the string too
+                // i18n Thank you for contributing to this project
+                printf(_("Opening book '%s' loaded (%u positions)\n"),
+                       g_bookPath,
+                       openingBook.GetNEntries());
+            }
+
             for (int32_t fileIndex = 0; g_blockemfilePath[fileIndex] != NULL; fileIndex++)
             {
                 if (!g_file_test(g_blockemfilePath[fileIndex], G_FILE_TEST_IS_REGULAR))
@@ -768,14 +980,46 @@ int main(int argc, char **argv)
                 // dummy volatile because no one will change it
                 volatile sig_atomic_t dummyAtomic = 0;
 
-                int32_t minimaxWinner =
-                    theGame.MinMax(
-                            heuristic,
-                            g_depth,
-                            Game1v1::e_Game1v1Player1,
-                            resultPiece,
-                            resultCoord,
-                            dummyAtomic);
+                int32_t minimaxWinner;
+                if (g_timeBudget > 0)
+                {
+                    int32_t depthReached = 0;
+                    minimaxWinner =
+                        theGame.MinMaxIterativeDeepening(
+                                heuristic,
+                                g_depth,
+                                g_timeBudget,
+                                Game1v1::e_Game1v1Player1,
+                                resultPiece,
+                                resultCoord,
+                                depthReached,
+                                dummyAtomic,
+                                Coordinate(),
+                                Piece(e_noPiece),
+                                g_threads,
+                                (g_hashSize > 0) ? &transTable : NULL);
+
+                    // i18n TRANSLATORS: '%d' will be replaced here by the depth of the deepest
+                    // i18n search completed within the time budget. Bear in mind the '\n' character
+                    // i18n should be there in the translated version of the string too
+                    // i18n Thank you for contributing to this project
+                    printf(_("Search depth reached: %d\n"), depthReached);
+                }
+                else
+                {
+                    minimaxWinner =
+                        theGame.MinMax(
+                                heuristic,
+                                g_depth,
+                                Game1v1::e_Game1v1Player1,
+                                resultPiece,
+                                resultCoord,
+                                dummyAtomic,
+                                Coordinate(),
+                                Piece(e_noPiece),
+                                g_threads,
+                                (g_hashSize > 0) ? &transTable : NULL);
+                }
 
                 // i18n TRANSLATORS: '%d' will be replaced here by the value of the winning
                 // i18n move calculated by the minimax engine. Bear in mind the '\n' character
@@ -783,6 +1027,23 @@ int main(int argc, char **argv)
                 // i18n Thank you for contributing to this project
                 printf(_("Winning evaluation function value: %d\n"), minimaxWinner);
 
+                if (g_hashSize > 0)
+                {
+                    const TranspositionTable::Stats_t &stats = transTable.GetStats();
+                    // i18n TRANSLATORS: These strings report how many times a position was
+                    // i18n found (hits), not found (misses), or not found because its slot
+                    // i18n was taken by other positions (collisions) in the transposition table
+                    // i18n Thank you for contributing to this project
+                    std::cout << _("Transposition table")  << ": "
+                              << stats.hits                << " " << _("hits")   << ", "
+                              << stats.misses              << " " << _("misses") << ", "
+                              << stats.collisions          << " " << _("collisions")
+                              << std::endl;
+                }
+
+                // nodes visited, pruning... of the search which calculated the move
+                Game1v1::PrintSearchStats(theGame.GetSearchStats(), std::cout);
+
                 if (resultPiece.GetType() == e_noPiece)
                 {
                     std::cout << std::endl;
@@ -812,7 +1073,374 @@ int main(int argc, char **argv)
 
             } // for (int32_t fileIndex = 0; g_blockemfilePath[fileIndex] != NULL; fileIndex++)
         }
-        else // (g_mode != 1 && g_mode != 2)
+        else if (g_mode == 3)
+        {
+            // self-play (--mode=3). Nothing but the JSON lines of the games
+            // is printed out to stdout
+
+            if (g_games == GOPTION_INT_NOT_SET)
+            {
+                FatalError(
+                    argv[0],
+                    _("Number of games must be specified in mode '3'"),
+                    SELF_PLAY_BAD_OPTIONS_ERR);
+            }
+            else if (g_games <= 0)
+            {
+                FatalError(
+                    argv[0],
+                    _("Number of games in self-play mode must be set to a positive value"),
+                    SELF_PLAY_BAD_OPTIONS_ERR);
+            }
+
+            const gint heuristics[2] = {g_heuristic, g_heuristic2};
+            for (int32_t i = 0; i < 2; i++)
+            {
+                if ( (heuristics[i] <  Heuristic::e_heuristicStartCount) ||
+                     (heuristics[i] >= Heuristic::e_heuristicCount) )
+                {
+                    snprintf(errorStringBuffer,
+                             ERROR_STRING_BUFFER_SIZE,
+                             // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                             // i18n by the type of heuristic used by the user
+                             // i18n Thank you for contributing to this project
+                             _("Invalid heuristic type (%d)"),
+                             heuristics[i]);
+
+                    FatalError(
+                        argv[0],
+                        errorStringBuffer,
+                        SELF_PLAY_BAD_OPTIONS_ERR);
+                }
+            }
+
+            if (g_depth2 == GOPTION_INT_NOT_SET)
+            {
+                // both AIs search as deep by default
+                g_depth2 = g_depth;
+            }
+
+            if ( (g_depth <= 0) || (g_depth2 <= 0) ||
+                 (g_depth > GAME1V1_MAX_SEARCH_DEPTH) || (g_depth2 > GAME1V1_MAX_SEARCH_DEPTH) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum depth of the search tree
+                         // i18n Thank you for contributing to this project
+                         _("Depth in self-play mode must be a value between 1 and %d"),
+                         GAME1V1_MAX_SEARCH_DEPTH);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    SELF_PLAY_BAD_OPTIONS_ERR);
+            }
+
+            if ( (g_threads <= 0) || (g_threads > SELF_PLAY_MAX_THREADS) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum number of threads allowed
+                         // i18n Thank you for contributing to this project
+                         _("Number of threads must be a value between 1 and %d"),
+                         SELF_PLAY_MAX_THREADS);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    SELF_PLAY_BAD_OPTIONS_ERR);
+            }
+
+            if ( (g_hashSize < 0) || (g_hashSize > TRANSPOSITION_TABLE_MAX_SIZE_MB) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum size of the transposition table allowed
+                         // i18n Thank you for contributing to this project
+                         _("Size of the transposition table must be a value between 0 and %d"),
+                         TRANSPOSITION_TABLE_MAX_SIZE_MB);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    SELF_PLAY_BAD_OPTIONS_ERR);
+            }
+
+            SelfPlay::AIConfig_t ai1;
+            ai1.heuristicType = static_cast<Heuristic::eHeuristicType_t>(g_heuristic);
+            ai1.depth         = g_depth;
+
+            SelfPlay::AIConfig_t ai2;
+            ai2.heuristicType = static_cast<Heuristic::eHeuristicType_t>(g_heuristic2);
+            ai2.depth         = g_depth2;
+
+            SelfPlay selfPlay(ai1, ai2, g_hashSize);
+            selfPlay.Run(g_games, g_threads, std::cout);
+        }
+        else if (g_mode == 4)
+        {
+            // opening book builder (--mode=4)
+
+            if (g_bookPath == NULL)
+            {
+                FatalError(
+                    argv[0],
+                    _("The file the opening book will be written into must be specified in mode '4'"),
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            if ( (g_heuristic <  Heuristic::e_heuristicStartCount) ||
+                 (g_heuristic >= Heuristic::e_heuristicCount) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the type of heuristic used by the user
+                         // i18n Thank you for contributing to this project
+                         _("Invalid heuristic type (%d)"),
+                         g_heuristic);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            if ( (g_depth <= 0) || (g_depth > GAME1V1_MAX_SEARCH_DEPTH) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum depth of the search tree
+                         // i18n Thank you for contributing to this project
+                         _("Depth in opening book mode must be a value between 1 and %d"),
+                         GAME1V1_MAX_SEARCH_DEPTH);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            if ( (g_plies <= 0) || (g_width <= 0) )
+            {
+                FatalError(
+                    argv[0],
+                    _("Plies and width of the opening book must be set to positive values"),
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            if ( (g_threads <= 0) || (g_threads > OPENING_BOOK_BUILDER_MAX_THREADS) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum number of threads allowed
+                         // i18n Thank you for contributing to this project
+                         _("Number of threads must be a value between 1 and %d"),
+                         OPENING_BOOK_BUILDER_MAX_THREADS);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            if ( (g_hashSize < 0) || (g_hashSize > TRANSPOSITION_TABLE_MAX_SIZE_MB) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum size of the transposition table allowed
+                         // i18n Thank you for contributing to this project
+                         _("Size of the transposition table must be a value between 0 and %d"),
+                         TRANSPOSITION_TABLE_MAX_SIZE_MB);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            OpeningBookBuilder builder(
+                    static_cast<Heuristic::eHeuristicType_t>(g_heuristic),
+                    g_depth,
+                    g_plies,
+                    g_width,
+                    g_hashSize);
+
+            GTimer* timer = g_timer_new();
+            std::vector<OpeningBook::Entry_t> entries;
+            int32_t nPositionsSearched = builder.Build(g_threads, entries);
+            gdouble elapsedSeconds = g_timer_elapsed(timer, NULL);
+            g_timer_destroy(timer);
+
+            if (!OpeningBook::Save(
+                    g_bookPath,
+                    static_cast<Heuristic::eHeuristicType_t>(g_heuristic),
+                    g_depth,
+                    g_plies,
+                    entries))
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %s as it is. It will be replaced
+                         // i18n by the path to the opening book file
+                         // i18n Thank you for contributing to this project
+                         _("Opening book could not be written into '%s'"),
+                         g_bookPath);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    OPENING_BOOK_OPTIONS_ERR);
+            }
+
+            // i18n TRANSLATORS: The 1st '%d' will be replaced by the number of positions
+            // i18n searched, '%.1f' by the time it took (in seconds), the 2nd '%d' by the
+            // i18n number of positions saved (symmetric ones included) and '%s' by the path to
+            // i18n the opening book. Bear in mind the '\n' character should be there
+            // i18n in the translated version of the string too
+            // i18n Thank you for contributing to this project
+            printf(_("%d positions searched in %.1f seconds. %d positions saved into '%s'\n"),
+                   nPositionsSearched,
+                   elapsedSeconds,
+                   static_cast<int32_t>(entries.size()),
+                   g_bookPath);
+        }
+        else if (g_mode == 5)
+        {
+            // challenge validation (--mode=5). Every challenge file is solved
+            // and the size of its search tree is printed out
+
+            if ( (g_blockemfilePath == NULL) || (g_blockemfilePath[0] == NULL) )
+            {
+                FatalError(
+                    argv[0],
+                    _("At least one challenge file must be specified in mode '5'"),
+                    CHALLENGE_OPTIONS_ERR);
+            }
+
+            if ( (g_threads <= 0) || (g_threads > GAME_CHALLENGE_MAX_THREADS) )
+            {
+                snprintf(errorStringBuffer,
+                         ERROR_STRING_BUFFER_SIZE,
+                         // i18n TRANSLATORS: Please, leave that %d as it is. It will be replaced
+                         // i18n by the maximum number of threads allowed
+                         // i18n Thank you for contributing to this project
+                         _("Number of threads must be a value between 1 and %d"),
+                         GAME_CHALLENGE_MAX_THREADS);
+
+                FatalError(
+                    argv[0],
+                    errorStringBuffer,
+                    CHALLENGE_OPTIONS_ERR);
+            }
+
+            if (g_timeBudget < 0)
+            {
+                FatalError(
+                    argv[0],
+                    _("Time budget in challenge validation mode must be set to a positive value"),
+                    CHALLENGE_OPTIONS_ERR);
+            }
+
+            int32_t nSolved      = 0;
+            int32_t nUnsolvable  = 0;
+            int32_t nTimedOut    = 0;
+            int32_t nNotLoaded   = 0;
+            for (int32_t fileIndex = 0; g_blockemfilePath[fileIndex] != NULL; fileIndex++)
+            {
+                BlockemChallenge theChallenge;
+                try
+                {
+                    theChallenge.LoadXMLChallenge(g_blockemfilePath[fileIndex]);
+                }
+                catch (const std::runtime_error &ex)
+                {
+                    fprintf(stderr,
+                            // i18n TRANSLATORS: This string is shown when a file specified by the user
+                            // i18n does not contain a valid blockem challenge. The 1st %s will be replaced
+                            // i18n by the name of the binary (normally "./blockem"), the 2nd one by
+                            // i18n the file that couldn't be loaded and the 3rd one by the reason why.
+                            // i18n Bear in mind the '\n' character should be there in the translated
+                            // i18n version of the string too
+                            // i18n Thank you for contributing to this project
+                            _("%s: Error: '%s' could not be loaded (%s). Trying next file...\n"),
+                            argv[0],
+                            g_blockemfilePath[fileIndex],
+                            ex.what());
+
+                    nNotLoaded++;
+                    continue;
+                }
+
+                GameChallenge theGame(theChallenge);
+
+                GTimer* timer = g_timer_new();
+                bool solved = theGame.Solve(g_threads, g_timeBudget);
+                gdouble elapsedSeconds = g_timer_elapsed(timer, NULL);
+                g_timer_destroy(timer);
+
+                const GameChallenge::SolverStats_t &stats = theGame.GetSolverStats();
+
+                std::cout << "'" << g_blockemfilePath[fileIndex] << "': ";
+                if (solved)
+                {
+                    // i18n TRANSLATORS: This string is printed when a blockem challenge is solved
+                    // i18n Thank you for contributing to this project
+                    std::cout << _("SOLVED!");
+                    nSolved++;
+                }
+                else if (stats.completed)
+                {
+                    // i18n TRANSLATORS: This string is printed when it is proven all the
+                    // i18n pieces of a blockem challenge can't be put down on the board
+                    // i18n Thank you for contributing to this project
+                    std::cout << _("No solution");
+                    nUnsolvable++;
+                }
+                else
+                {
+                    // i18n TRANSLATORS: This string is printed when the time allowed to
+                    // i18n solve a blockem challenge runs out before the search is finished
+                    // i18n Thank you for contributing to this project
+                    std::cout << _("Time out");
+                    nTimedOut++;
+                }
+
+                // i18n TRANSLATORS: These strings report the size of the search tree explored
+                // i18n to solve a blockem challenge: nodes visited, and how many of them were
+                // i18n discarded because the pieces left couldn't fit on the board
+                // i18n Thank you for contributing to this project
+                std::cout << " (" << elapsedSeconds << " " << _("seconds")  << ", "
+                          << stats.nodes            << " " << _("nodes")    << ", "
+                          << stats.prunedNodes      << " " << _("pruned")   << ")"
+                          << std::endl;
+
+                if (solved)
+                {
+                    // print solved board on the screen
+                    theGame.GetBoard().PrintBoard(std::cout);
+                    std::cout << std::endl;
+                }
+            } // for (int32_t fileIndex = 0; g_blockemfilePath[fileIndex] != NULL; fileIndex++)
+
+            // i18n TRANSLATORS: Summary of the challenge validation mode. The '%d' will be
+            // i18n replaced (respectively) by the number of challenges solved, with no solution,
+            // i18n whose time ran out and that couldn't be loaded. Bear in mind the '\n'
+            // i18n character should be there in the translated version of the string too
+            // i18n Thank you for contributing to this project
+            printf(_("Challenges solved: %d. No solution: %d. Time out: %d. Not loaded: %d\n"),
+                   nSolved,
+                   nUnsolvable,
+                   nTimedOut,
+                   nNotLoaded);
+        }
+        else // (g_mode != 1 && g_mode != 2 && g_mode != 3 && g_mode != 4 && g_mode != 5)
         {
             snprintf(errorStringBuffer,
                      ERROR_STRING_BUFFER_SIZE,
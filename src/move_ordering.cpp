@@ -0,0 +1,105 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  move_ordering.cpp
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <string.h>   // memset
+#include <algorithm>  // std::sort
+#include <functional> // std::greater
+#include "move_ordering.h"
+
+MoveOrdering::MoveOrdering(int32_t a_nPlies, int32_t a_nSquares, bool a_enabled) :
+    m_nPlies(a_nPlies),
+    m_nSquares(a_nSquares),
+    m_maxMoves(PIECE_TOTAL_CONFS * a_nSquares),
+    m_enabled(a_enabled)
+{
+#ifdef DEBUG
+    assert(m_nPlies > 0);
+    assert(m_nSquares > 0);
+#endif
+
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        m_firstConf[i] = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+    }
+
+    m_history = new uint32_t[PIECE_TOTAL_CONFS * m_nSquares];
+    m_killers = new PackedMove_t[m_nPlies * MOVE_ORDERING_KILLERS_PER_PLY];
+    m_moves   = new PackedMove_t[m_nPlies * m_maxMoves];
+    m_keys    = new uint64_t[m_nPlies * m_maxMoves];
+    m_nMoves  = new int32_t[m_nPlies];
+
+    for (int32_t i = 0; i < m_nPlies; i++)
+    {
+        m_nMoves[i] = 0;
+    }
+
+    Clear();
+}
+
+MoveOrdering::~MoveOrdering()
+{
+    delete [] m_history;
+    delete [] m_killers;
+    delete [] m_moves;
+    delete [] m_keys;
+    delete [] m_nMoves;
+}
+
+void MoveOrdering::Clear()
+{
+    memset(m_history, 0, PIECE_TOTAL_CONFS * m_nSquares * sizeof(uint32_t));
+    for (int32_t i = 0; i < (m_nPlies * MOVE_ORDERING_KILLERS_PER_PLY); i++)
+    {
+        m_killers[i] = packedmove::NoMove();
+    }
+}
+
+void MoveOrdering::SortMoves(int32_t a_ply)
+{
+#ifdef DEBUG
+    assert( (a_ply >= 0) && (a_ply < m_nPlies) );
+#endif
+
+    if (m_enabled)
+    {
+        // highest scores first. The index of the move (xor'ed with 0xffffffff)
+        // breaks ties, so moves with the same score keep the order they were added
+        uint64_t* keys = &m_keys[a_ply * m_maxMoves];
+        std::sort(keys, keys + m_nMoves[a_ply], std::greater<uint64_t>());
+    }
+}
+
+void MoveOrdering::AgeHistory()
+{
+    for (int32_t i = 0; i < (PIECE_TOTAL_CONFS * m_nSquares); i++)
+    {
+        m_history[i] >>= 1;
+    }
+}
@@ -0,0 +1,140 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  move_ordering.h
+/// @brief Sorts the moves of a search tree using killer moves and history
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef MOVE_ORDERING_H_
+#define MOVE_ORDERING_H_
+
+#include <stdint.h> // for types
+#include "assert.h"
+#include "piece.h"
+#include "packed_move.h"
+
+/// number of killer moves saved per ply
+const int32_t MOVE_ORDERING_KILLERS_PER_PLY = 2;
+/// history values are halved when one of them reaches this value
+const uint32_t MOVE_ORDERING_MAX_HISTORY = 0x40000000;
+
+/// @brief the order in which the moves of each node of a search tree are tried out
+/// Alpha-beta prunes more branches the sooner the best move of a node is tried
+/// out. Every node saves its moves into the list of its ply, which are then sorted:
+///   1) killer moves of the ply (moves that pruned a sibling branch)
+///   2) the rest of moves, by their history value. The history of a move (piece
+///      configuration put down on a square) increases every time it prunes a
+///      branch, by the square of the depth left, since cutoffs close to the root
+///      save more nodes
+///   3) moves with the same value are left in the order they were added
+///
+/// All the memory (the history table and the list of moves of each ply) is
+/// allocated by the constructor, so a search doesn't allocate any memory once
+/// it is running. A disabled object doesn't change the order of the moves nor
+/// saves any killer move or history. Each search thread must use its own object
+class MoveOrdering
+{
+public:
+    /// @param number of plies of the search tree whose moves will be saved
+    /// @param number of squares of the board
+    /// @param false if moves must be tried in the order they were added
+    MoveOrdering(int32_t a_nPlies, int32_t a_nSquares, bool a_enabled = true);
+    virtual ~MoveOrdering();
+
+    /// @return true if moves are sorted
+    bool IsEnabled() const;
+
+    /// @brief forgets killer moves and history
+    void Clear();
+
+    /// @brief empties the list of moves of a_ply
+    void ClearMoves(int32_t a_ply);
+
+    /// @brief adds a move to the list of moves of a_ply. The list can save every
+    ///        configuration of every piece put down on every square of the board
+    void AddMove(int32_t a_ply, PackedMove_t a_move);
+
+    /// @brief sorts the list of moves of a_ply. It must be called once all the moves
+    ///        of the ply have been added
+    void SortMoves(int32_t a_ply);
+
+    /// @return number of moves in the list of a_ply
+    int32_t GetNMoves(int32_t a_ply) const;
+
+    /// @return the move a_index of the (sorted) list of a_ply
+    PackedMove_t GetMove(int32_t a_ply, int32_t a_index) const;
+
+    /// @brief saves a_move as the best move of a node of a_ply which pruned the
+    ///        rest of its branches. a_depth is the depth of the subtree below the node
+    void SaveCutoff(int32_t a_ply, PackedMove_t a_move, int32_t a_depth);
+
+    /// @return the killer move a_index of a_ply (packedmove::NoMove() if there is none)
+    PackedMove_t GetKiller(int32_t a_ply, int32_t a_index) const;
+
+    /// @return the history value of a_move
+    uint32_t GetHistory(PackedMove_t a_move) const;
+
+private:
+    /// number of plies
+    int32_t m_nPlies;
+    /// number of squares of the board
+    int32_t m_nSquares;
+    /// maximum number of moves per ply
+    int32_t m_maxMoves;
+    /// moves are only sorted if this is true
+    bool m_enabled;
+
+    /// index in PieceConfTable of the first configuration of each piece
+    int32_t m_firstConf[e_numberOfPieces];
+
+    /// history of each configuration (index in PieceConfTable) on each square
+    uint32_t* m_history;
+    /// killer moves of each ply (MOVE_ORDERING_KILLERS_PER_PLY per ply)
+    PackedMove_t* m_killers;
+
+    /// moves of each ply in the order they were added (m_maxMoves per ply)
+    PackedMove_t* m_moves;
+    /// sort keys of the moves of each ply. The highest 32 bits are the score of
+    /// the move, the lowest ones its index in m_moves xor'ed with 0xffffffff
+    /// (moves with the same score are kept in the order they were added)
+    uint64_t* m_keys;
+    /// number of moves of each ply
+    int32_t* m_nMoves;
+
+    /// @return index of a_move in m_history
+    int32_t HistoryIndex(PackedMove_t a_move) const;
+
+    /// @brief halves every history value
+    void AgeHistory();
+
+    // no copy constructor or operator= allowed
+    MoveOrdering(const MoveOrdering &a_src);
+    MoveOrdering& operator=(const MoveOrdering &a_src);
+};
+
+// include implementation details of inline functions
+#include "impl/move_ordering_impl.h"
+
+#endif /* MOVE_ORDERING_H_ */
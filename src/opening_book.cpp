@@ -0,0 +1,172 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book.cpp
+/// @brief Read-only table of precalculated moves for the first plies of a 1vs1 game
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <string.h>  // memcpy, memcmp
+#include <algorithm> // stable_sort
+#include <fstream>
+#include "opening_book.h"
+
+/// identifies opening book files
+static const char OPENING_BOOK_MAGIC[8] = {'B', 'L', 'K', 'M', 'B', 'O', 'O', 'K'};
+/// value of FileHeader_t::byteOrder
+static const uint32_t OPENING_BOOK_BYTE_ORDER = 0x01020304;
+
+OpeningBook::OpeningBook() :
+    m_mappedFile(NULL),
+    m_header(NULL),
+    m_entries(NULL),
+    m_nEntries(0)
+{
+}
+
+OpeningBook::~OpeningBook()
+{
+    Unload();
+}
+
+bool OpeningBook::Load(const char* a_path)
+{
+    Unload();
+
+    GError* err = NULL;
+    m_mappedFile = g_mapped_file_new(a_path, FALSE, &err);
+    if (m_mappedFile == NULL)
+    {
+        if (err != NULL)
+        {
+            g_error_free(err);
+        }
+        return false;
+    }
+
+    const char* contents = g_mapped_file_get_contents(m_mappedFile);
+    gsize length = g_mapped_file_get_length(m_mappedFile);
+
+    FileHeader_t expectedHeader;
+    InitHeader(expectedHeader);
+
+    // mapped files are page aligned, so the header and the entries
+    // (right after it) can be read in place
+    const FileHeader_t* header = reinterpret_cast<const FileHeader_t*>(contents);
+    if ( (contents == NULL) ||
+         (length < sizeof(FileHeader_t)) ||
+         (memcmp(header->magic, expectedHeader.magic, sizeof(header->magic)) != 0) ||
+         (header->version   != expectedHeader.version) ||
+         (header->byteOrder != expectedHeader.byteOrder) ||
+         (header->heuristicType <  Heuristic::e_heuristicStartCount) ||
+         (header->heuristicType >= Heuristic::e_heuristicCount) ||
+         ( (length - sizeof(FileHeader_t)) / sizeof(Entry_t) < header->nEntries ) )
+    {
+        Unload();
+        return false;
+    }
+
+    m_header   = header;
+    m_entries  = reinterpret_cast<const Entry_t*>(contents + sizeof(FileHeader_t));
+    m_nEntries = header->nEntries;
+
+    return true;
+}
+
+void OpeningBook::Unload()
+{
+    if (m_mappedFile != NULL)
+    {
+#if GLIB_CHECK_VERSION(2, 22, 0)
+        g_mapped_file_unref(m_mappedFile);
+#else
+        g_mapped_file_free(m_mappedFile);
+#endif
+    }
+
+    m_mappedFile = NULL;
+    m_header     = NULL;
+    m_entries    = NULL;
+    m_nEntries   = 0;
+}
+
+bool OpeningBook::Save(
+        const char*                 a_path,
+        Heuristic::eHeuristicType_t a_heuristicType,
+        int32_t                     a_depth,
+        int32_t                     a_plies,
+        std::vector<Entry_t>       &in_out_entries)
+{
+    // the same position can be reached through different orders of moves (and
+    // symmetric positions of a symmetric starting position are the same one).
+    // Sorting must be stable so the entry kept doesn't depend on the sort algorithm
+    std::stable_sort(in_out_entries.begin(), in_out_entries.end(), OpeningBook::EntryLessThan);
+
+    std::vector<Entry_t>::iterator it = in_out_entries.begin();
+    std::vector<Entry_t>::iterator last = in_out_entries.begin();
+    while (it != in_out_entries.end())
+    {
+        if ( (last == in_out_entries.begin()) || ((last - 1)->key != it->key) )
+        {
+            *last = *it;
+            last++;
+        }
+        it++;
+    }
+    in_out_entries.erase(last, in_out_entries.end());
+
+    FileHeader_t header;
+    InitHeader(header);
+    header.nEntries      = static_cast<uint32_t>(in_out_entries.size());
+    header.heuristicType = static_cast<int32_t>(a_heuristicType);
+    header.depth         = a_depth;
+    header.plies         = a_plies;
+
+    std::ofstream outFile(a_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!outFile)
+    {
+        return false;
+    }
+
+    outFile.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader_t));
+    if (!in_out_entries.empty())
+    {
+        outFile.write(
+            reinterpret_cast<const char*>(&in_out_entries[0]),
+            in_out_entries.size() * sizeof(Entry_t));
+    }
+    outFile.close();
+
+    return !outFile.fail();
+}
+
+void OpeningBook::InitHeader(FileHeader_t &out_header)
+{
+    // padding bytes are written into the file too
+    memset(&out_header, 0, sizeof(FileHeader_t));
+
+    memcpy(out_header.magic, OPENING_BOOK_MAGIC, sizeof(out_header.magic));
+    out_header.version   = OPENING_BOOK_VERSION;
+    out_header.byteOrder = OPENING_BOOK_BYTE_ORDER;
+}
@@ -0,0 +1,173 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book.h
+/// @brief Read-only table of precalculated moves for the first plies of a 1vs1 game
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef OPENING_BOOK_H_
+#define OPENING_BOOK_H_
+
+#include <stdint.h> // for types
+#include <vector>
+#include <glib.h>   // glib-2.0/glib.h (files are mapped with GMappedFile)
+#include "assert.h"
+#include "heuristic.h"
+#include "packed_move.h"
+
+/// version of the format of opening book files
+const uint32_t OPENING_BOOK_VERSION = 1;
+
+/// @brief moves calculated offline for the positions of the first plies of 1vs1 games
+/// The search tree of the first moves of a game is the widest one (the board is
+/// almost empty), and the positions it starts from are always the same ones, so
+/// they are searched deeply only once (see OpeningBookBuilder) and the result is
+/// saved into a file. The file is mapped into memory (it is never copied) and the
+/// move of a position is looked up by its zobrist hash key (Game1v1::GetPositionKey)
+///
+/// A book file is made up of a FileHeader_t followed by nEntries Entry_t structures
+/// sorted by key. Integers are saved in the byte order of the machine which built the
+/// book. Books built by a machine with a different byte order are rejected by Load.
+/// The book is never modified once it's loaded, so it can be read by several threads
+/// at the same time
+class OpeningBook
+{
+public:
+    /// @brief a position of the book and the move calculated for it
+    typedef struct
+    {
+        /// zobrist hash key of the position (player to move included)
+        uint64_t     key;
+        /// best move found by the search
+        PackedMove_t move;
+        /// value of the evaluation function returned by the search
+        int32_t      value;
+    } Entry_t;
+
+    /// @brief header of an opening book file
+    typedef struct
+    {
+        /// always "BLKMBOOK" (not null-terminated)
+        char     magic[8];
+        /// version of the format of the file (OPENING_BOOK_VERSION)
+        uint32_t version;
+        /// 0x01020304 saved in the byte order of the machine which built the book
+        uint32_t byteOrder;
+        /// number of entries saved after the header
+        uint32_t nEntries;
+        /// heuristic positions were evaluated with. Index in Heuristic::m_heuristicData
+        int32_t  heuristicType;
+        /// depth of the search tree of every position
+        int32_t  depth;
+        /// number of plies from the start of the game covered by the book
+        int32_t  plies;
+    } FileHeader_t;
+
+    OpeningBook();
+    virtual ~OpeningBook();
+
+    /// @brief maps an opening book file into memory
+    /// The book loaded previously (if any) is unloaded first
+    /// @param path to the file
+    /// @return true if the file was mapped and it contains a valid book. The book
+    ///         is left empty otherwise
+    bool Load(const char* a_path);
+
+    /// @brief unmaps the file of the book. The book is left empty
+    void Unload();
+
+    /// @return true if a book file is loaded
+    bool IsLoaded() const;
+
+    /// @return number of positions saved in the book. 0 if none is loaded
+    uint32_t GetNEntries() const;
+
+    /// @return the entry saved in the position a_index of the book (sorted by key)
+    const Entry_t& GetEntry(uint32_t a_index) const;
+
+    /// @return heuristic the book was built with. Only valid if a book is loaded
+    Heuristic::eHeuristicType_t GetHeuristicType() const;
+
+    /// @return depth of the search tree of the positions of the book. Only valid
+    ///         if a book is loaded
+    int32_t GetDepth() const;
+
+    /// @return number of plies covered by the book. Only valid if a book is loaded
+    int32_t GetPlies() const;
+
+    /// @brief looks up the position a_key in the book (binary search)
+    /// The move saved might not be valid in the position the caller is in (zobrist
+    /// keys of 2 different positions could collide). It must be checked before being
+    /// put down
+    /// @param zobrist key of the position
+    /// @param the entry of the position. Only set if it is found
+    /// @return true if the position was found
+    bool Lookup(uint64_t a_key, Entry_t &out_entry) const;
+
+    /// @brief saves a book file
+    /// in_out_entries is sorted by key, and only the first entry of those that share
+    /// the same key is kept
+    /// @param path to the file. It is overwritten if it already exists
+    /// @param heuristic positions were evaluated with
+    /// @param depth of the search tree of every position
+    /// @param number of plies from the start of the game covered by the book
+    /// @param entries to be saved
+    /// @return true if the file was written successfully
+    static bool Save(
+            const char*                 a_path,
+            Heuristic::eHeuristicType_t a_heuristicType,
+            int32_t                     a_depth,
+            int32_t                     a_plies,
+            std::vector<Entry_t>       &in_out_entries);
+
+private:
+    /// the file of the book mapped into memory. NULL if none is loaded
+    GMappedFile* m_mappedFile;
+
+    /// header of the book (inside the mapped file)
+    const FileHeader_t* m_header;
+
+    /// entries of the book sorted by key (inside the mapped file)
+    const Entry_t* m_entries;
+
+    /// number of entries of the book
+    uint32_t m_nEntries;
+
+    /// @brief fills a_header with the magic string, version and byte order of
+    ///        the files built by this machine
+    static void InitHeader(FileHeader_t &out_header);
+
+    /// @return true if a_entry1 goes before a_entry2 in the book
+    static bool EntryLessThan(const Entry_t &a_entry1, const Entry_t &a_entry2);
+
+    // no copy constructor or operator= allowed
+    OpeningBook(const OpeningBook &a_src);
+    OpeningBook& operator=(const OpeningBook &a_src);
+};
+
+// include implementation details of inline functions
+#include "impl/opening_book_impl.h"
+
+#endif /* OPENING_BOOK_H_ */
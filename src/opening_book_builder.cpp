@@ -0,0 +1,515 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book_builder.cpp
+/// @brief Offline deep search of the first plies of 1vs1 games
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <set>
+#include <algorithm> // stable_sort
+#include "opening_book_builder.h"
+#include "rules.h"
+
+/// number of symmetries of a square board (4 rotations X 2 mirrors)
+static const int32_t BOARD_SYMMETRIES = 8;
+
+/// @brief a move expanded from a position of the book, and its value 1 ply deep
+typedef struct
+{
+    PackedMove_t move;
+    int32_t      value;
+    uint64_t     key;
+} ExpandedMove_t;
+
+/// @return true if a_move1 is better than a_move2 according to the evaluation function
+static bool ExpandedMoveGreaterThan(const ExpandedMove_t &a_move1, const ExpandedMove_t &a_move2)
+{
+    return (a_move1.value > a_move2.value);
+}
+
+OpeningBookBuilder::OpeningBookBuilder(
+    Heuristic::eHeuristicType_t a_heuristicType,
+    int32_t                     a_depth,
+    int32_t                     a_plies,
+    int32_t                     a_width,
+    int32_t                     a_transTableSizeMB) :
+    m_heuristicType(a_heuristicType),
+    m_depth(a_depth),
+    m_plies(a_plies),
+    m_width(a_width),
+    m_transTableSizeMB(a_transTableSizeMB)
+{
+#ifdef DEBUG
+    assert( (m_heuristicType >= Heuristic::e_heuristicStartCount) &&
+            (m_heuristicType <  Heuristic::e_heuristicCount) );
+    assert(m_depth > 0);
+    assert(m_plies > 0);
+    assert(m_width > 0);
+    // symmetric positions are calculated rotating the board
+    assert(BOARD_1VS1_ROWS == BOARD_1VS1_COLUMNS);
+#endif
+}
+
+OpeningBookBuilder::~OpeningBookBuilder()
+{
+}
+
+int32_t OpeningBookBuilder::Build(
+    int32_t                            a_nThreads,
+    std::vector<OpeningBook::Entry_t> &out_entries) const
+{
+    if (a_nThreads > OPENING_BOOK_BUILDER_MAX_THREADS)
+    {
+        a_nThreads = OPENING_BOOK_BUILDER_MAX_THREADS;
+    }
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    // SINGLETON creation is not thread safe. Ensure the table of configurations
+    // is instantiated before the worker threads are created
+    PieceConfTable::Instance();
+
+    out_entries.clear();
+
+    // positions already found (in this ply or in the previous ones)
+    std::set<uint64_t> keysFound;
+    keysFound.insert(Game1v1().GetPositionKey(Game1v1::e_Game1v1Player1));
+
+    // the 1st ply is the empty board
+    std::vector<Position_t> thisPly(1);
+    std::vector<Position_t> nextPly;
+
+    int32_t nPositionsSearched = 0;
+    for (int32_t ply = 0; (ply < m_plies) && !thisPly.empty(); ply++)
+    {
+        BuildData_t buildData;
+        buildData.builder      = this;
+        buildData.positions    = &thisPly;
+        buildData.expand       = (ply < (m_plies - 1));
+        buildData.mutex        = g_mutex_new();
+        buildData.nextPosition = 0;
+
+#ifdef DEBUG
+        assert(buildData.mutex != NULL);
+#endif
+
+        int32_t nThreads = a_nThreads;
+        if (nThreads > static_cast<int32_t>(thisPly.size()))
+        {
+            // no point on spawning threads that won't have anything to do
+            nThreads = static_cast<int32_t>(thisPly.size());
+        }
+
+        GThread* workerThreads[OPENING_BOOK_BUILDER_MAX_THREADS];
+        int32_t nThreadsCreated = 0;
+        // 1 position at a time is searched in the calling thread
+        for (int32_t i = 0; (nThreads > 1) && (i < nThreads); i++)
+        {
+            GError* err = NULL;
+            workerThreads[nThreadsCreated] = g_thread_create(
+                    reinterpret_cast<GThreadFunc>(OpeningBookBuilder::BuildThreadRoutine),
+                    reinterpret_cast<void*>(&buildData),
+                    TRUE, // joinable
+                    &err);
+
+            if (workerThreads[nThreadsCreated] == NULL)
+            {
+                // the rest of threads will have to do the job of this one
+                g_error_free(err);
+                continue;
+            }
+
+            nThreadsCreated++;
+        }
+
+        if (nThreadsCreated == 0)
+        {
+            // no thread was created. Current thread will search all the positions
+            BuildThreadRoutine(reinterpret_cast<void*>(&buildData));
+        }
+
+        for (int32_t i = 0; i < nThreadsCreated; i++)
+        {
+            g_thread_join(workerThreads[i]);
+        }
+
+        g_mutex_free(buildData.mutex);
+
+        nPositionsSearched += static_cast<int32_t>(thisPly.size());
+
+        // positions are saved and expanded in the same order whatever the
+        // number of threads is
+        nextPly.clear();
+        for (std::size_t i = 0; i < thisPly.size(); i++)
+        {
+            const Position_t &thisPosition = thisPly[i];
+
+            if (thisPosition.save)
+            {
+                for (int32_t symmetry = 0; symmetry < BOARD_SYMMETRIES; symmetry++)
+                {
+                    Game1v1 symmetricGame(
+                        TransformCoord(
+                            Coordinate(DEFAULT_STARTING_ROW_PLAYER1, DEFAULT_STARTING_COL_PLAYER1),
+                            symmetry,
+                            BOARD_1VS1_ROWS),
+                        TransformCoord(
+                            Coordinate(DEFAULT_STARTING_ROW_PLAYER2, DEFAULT_STARTING_COL_PLAYER2),
+                            symmetry,
+                            BOARD_1VS1_ROWS));
+
+                    std::vector<PackedMove_t> symmetricLine(thisPosition.line.size());
+                    for (std::size_t j = 0; j < thisPosition.line.size(); j++)
+                    {
+                        symmetricLine[j] = TransformMove(thisPosition.line[j], symmetry, BOARD_1VS1_ROWS);
+                    }
+
+                    Piece lastPiece(e_noPiece);
+                    Coordinate lastCoord;
+                    Game1v1::eGame1v1Player_t whoMoves =
+                        ReplayLine(symmetricLine, symmetricGame, lastPiece, lastCoord);
+
+                    OpeningBook::Entry_t thisEntry;
+                    thisEntry.key   = symmetricGame.GetPositionKey(whoMoves);
+                    thisEntry.move  = TransformMove(thisPosition.bestMove, symmetry, BOARD_1VS1_ROWS);
+                    thisEntry.value = thisPosition.value;
+                    out_entries.push_back(thisEntry);
+                }
+            }
+
+            for (std::size_t j = 0; j < thisPosition.childMoves.size(); j++)
+            {
+                if (keysFound.insert(thisPosition.childKeys[j]).second)
+                {
+                    nextPly.push_back(Position_t());
+                    nextPly.back().line = thisPosition.line;
+                    nextPly.back().line.push_back(thisPosition.childMoves[j]);
+                }
+            }
+        }
+
+        thisPly.swap(nextPly);
+    } // for (int32_t ply = 0; (ply < m_plies) && !thisPly.empty(); ply++)
+
+    return nPositionsSearched;
+}
+
+void* OpeningBookBuilder::BuildThreadRoutine(void *a_threadParam)
+{
+    BuildData_t* buildData = reinterpret_cast<BuildData_t*>(a_threadParam);
+
+    // each thread reuses its own table for all the positions it searches
+    TranspositionTable transTable(buildData->builder->m_transTableSizeMB);
+
+    while (true)
+    {
+        g_mutex_lock(buildData->mutex);
+        int32_t thisPosition = buildData->nextPosition++;
+        g_mutex_unlock(buildData->mutex);
+
+        if (thisPosition >= static_cast<int32_t>(buildData->positions->size()))
+        {
+            // no more positions to be searched
+            break;
+        }
+
+        // entries saved by previous searches would make the result of this
+        // one depend on the positions searched before by this thread
+        transTable.Clear();
+
+        buildData->builder->SearchPosition(
+                (*(buildData->positions))[thisPosition],
+                buildData->expand,
+                (transTable.GetSizeMB() > 0) ? &transTable : NULL);
+    }
+
+    return NULL;
+}
+
+void OpeningBookBuilder::SearchPosition(
+    Position_t         &in_out_position,
+    bool                a_expand,
+    TranspositionTable *a_transTable) const
+{
+    in_out_position.bestMove = packedmove::NoMove();
+    in_out_position.value    = 0;
+    in_out_position.save     = false;
+    in_out_position.childMoves.clear();
+    in_out_position.childKeys.clear();
+
+    Game1v1 theGame;
+    Piece lastPiece(e_noPiece);
+    Coordinate lastCoord;
+    Game1v1::eGame1v1Player_t whoMoves =
+        ReplayLine(in_out_position.line, theGame, lastPiece, lastCoord);
+    Game1v1::eGame1v1Player_t whoMovesNext =
+        (whoMoves == Game1v1::e_Game1v1Player1) ? Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+
+    const Player &playerMe       = theGame.GetPlayer(whoMoves);
+    const Player &playerOpponent = theGame.GetOpponent(whoMoves);
+    Heuristic::EvalFunction_t heuristic = Heuristic::m_heuristicData[m_heuristicType].m_evalFunction;
+
+    // no one will ask the search to stop
+    CancellationToken cancelToken;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+    in_out_position.value = theGame.MinMax(
+                                heuristic,
+                                m_depth,
+                                whoMoves,
+                                resultPiece,
+                                resultCoord,
+                                cancelToken,
+                                lastCoord,
+                                lastPiece,
+                                1,
+                                a_transTable);
+
+    if (resultPiece.GetType() == e_noPiece)
+    {
+        // the player to move can't go. The book finishes here
+        return;
+    }
+
+    Coordinate squares[PIECE_MAX_SQUARES];
+    for (int32_t i = 0; i < static_cast<int32_t>(resultPiece.GetNSquares()); i++)
+    {
+        squares[i].m_row = resultCoord.m_row + resultPiece.GetCoord(i).m_row;
+        squares[i].m_col = resultCoord.m_col + resultPiece.GetCoord(i).m_col;
+    }
+    in_out_position.bestMove = FindMove(
+                                    resultPiece.GetType(),
+                                    squares,
+                                    static_cast<int32_t>(resultPiece.GetNSquares()),
+                                    theGame.GetBoard().GetNColumns());
+#ifdef DEBUG
+    assert(!packedmove::IsNoMove(in_out_position.bestMove));
+#endif
+
+    // the 1st piece of a player is not calculated with a search tree
+    in_out_position.save = (playerMe.NumberOfPiecesAvailable() < e_numberOfPieces);
+
+    if (!a_expand)
+    {
+        return;
+    }
+
+    // evaluate every valid move 1 ply deep
+    std::vector<rules::Move_t> validMoves;
+    int32_t nValidMoves = rules::CalculateValidMoves(theGame.GetBoard(), playerMe, validMoves);
+
+    std::vector<ExpandedMove_t> expandedMoves(nValidMoves);
+    for (int32_t i = 0; i < nValidMoves; i++)
+    {
+        const rules::Move_t &thisMove = validMoves[i];
+
+        Piece thisPiece = playerMe.m_pieces[thisMove.pieceType];
+        thisPiece.SetCurrentConfiguration(*(thisMove.pieceConf->pieceConf));
+
+        theGame.PutDownPiece(thisPiece, thisMove.coord, whoMoves);
+
+        expandedMoves[i].move  = packedmove::FromCoordinate(
+                                    thisMove.pieceType,
+                                    thisMove.confIndex,
+                                    thisMove.coord,
+                                    theGame.GetBoard().GetNColumns());
+        expandedMoves[i].value = heuristic(theGame.GetBoard(), playerMe, playerOpponent);
+        expandedMoves[i].key   = theGame.GetPositionKey(whoMovesNext);
+
+        theGame.RemovePiece(thisPiece, thisMove.coord, whoMoves);
+    }
+
+    // moves with the same value keep the order they were generated in
+    std::stable_sort(expandedMoves.begin(), expandedMoves.end(), ExpandedMoveGreaterThan);
+
+    // the best move goes first, followed by the best other moves 1 ply deep
+    for (int32_t i = 0; i < nValidMoves; i++)
+    {
+        if (expandedMoves[i].move == in_out_position.bestMove)
+        {
+            in_out_position.childMoves.push_back(expandedMoves[i].move);
+            in_out_position.childKeys.push_back(expandedMoves[i].key);
+            break;
+        }
+    }
+
+    for (int32_t i = 0;
+         (i < nValidMoves) && (static_cast<int32_t>(in_out_position.childMoves.size()) < m_width);
+         i++)
+    {
+        if (expandedMoves[i].move != in_out_position.bestMove)
+        {
+            in_out_position.childMoves.push_back(expandedMoves[i].move);
+            in_out_position.childKeys.push_back(expandedMoves[i].key);
+        }
+    }
+}
+
+Game1v1::eGame1v1Player_t OpeningBookBuilder::ReplayLine(
+    const std::vector<PackedMove_t> &a_line,
+    Game1v1                         &a_game,
+    Piece                           &out_lastPiece,
+    Coordinate                      &out_lastCoord)
+{
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    Game1v1::eGame1v1Player_t whoMoves = Game1v1::e_Game1v1Player1;
+    out_lastPiece = Piece(e_noPiece);
+    out_lastCoord = Coordinate();
+
+    for (std::size_t i = 0; i < a_line.size(); i++)
+    {
+        const PieceConf_t &pieceConf = packedmove::GetConf(a_line[i], confTable);
+
+        out_lastPiece = a_game.GetPlayer(whoMoves).m_pieces[pieceConf.pieceType];
+        out_lastPiece.SetCurrentConfiguration(*(pieceConf.pieceConf));
+        packedmove::ToCoordinate(a_line[i], a_game.GetBoard().GetNColumns(), out_lastCoord);
+
+        a_game.PutDownPiece(out_lastPiece, out_lastCoord, whoMoves);
+
+        // players can always go in the first plies of a game
+        whoMoves = (whoMoves == Game1v1::e_Game1v1Player1) ?
+                        Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+
+    return whoMoves;
+}
+
+PackedMove_t OpeningBookBuilder::FindMove(
+    ePieceType_t      a_pieceType,
+    const Coordinate  a_squares[PIECE_MAX_SQUARES],
+    int32_t           a_nSquares,
+    int32_t           a_nColumns)
+{
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    for (int32_t confIt  = confTable.GetFirstConf(a_pieceType);
+                 confIt  < confTable.GetEndConf(a_pieceType);
+                 confIt++)
+    {
+        const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+        if (pieceConf.nSquares != a_nSquares)
+        {
+            continue;
+        }
+
+        // any square of the configuration could be the one put down on a_squares[0]
+        for (int32_t anchor = 0; anchor < pieceConf.nSquares; anchor++)
+        {
+            Coordinate thisCoord(
+                a_squares[0].m_row - pieceConf.squareRows[anchor],
+                a_squares[0].m_col - pieceConf.squareCols[anchor]);
+
+            int32_t nMatches = 0;
+            for (int32_t i = 0; i < pieceConf.nSquares; i++)
+            {
+                Coordinate thisSquare(
+                    thisCoord.m_row + pieceConf.squareRows[i],
+                    thisCoord.m_col + pieceConf.squareCols[i]);
+
+                for (int32_t j = 0; j < a_nSquares; j++)
+                {
+                    if (thisSquare == a_squares[j])
+                    {
+                        nMatches++;
+                        break;
+                    }
+                }
+            }
+
+            if (nMatches == a_nSquares)
+            {
+                return packedmove::FromCoordinate(
+                            a_pieceType,
+                            pieceConf.confIndex,
+                            thisCoord,
+                            a_nColumns);
+            }
+        } // for (int32_t anchor = 0; anchor < pieceConf.nSquares; anchor++)
+    } // for (int32_t confIt  = confTable.GetFirstConf(a_pieceType);
+
+    return packedmove::NoMove();
+}
+
+Coordinate OpeningBookBuilder::TransformCoord(
+    const Coordinate &a_coord,
+    int32_t           a_symmetry,
+    int32_t           a_size)
+{
+    Coordinate rv(a_coord);
+    if (a_symmetry & 0x04)
+    {
+        rv.m_row = a_coord.m_col;
+        rv.m_col = a_coord.m_row;
+    }
+    if (a_symmetry & 0x01)
+    {
+        rv.m_row = a_size - rv.m_row - 1;
+    }
+    if (a_symmetry & 0x02)
+    {
+        rv.m_col = a_size - rv.m_col - 1;
+    }
+
+    return rv;
+}
+
+PackedMove_t OpeningBookBuilder::TransformMove(
+    PackedMove_t a_move,
+    int32_t      a_symmetry,
+    int32_t      a_size)
+{
+    if (packedmove::IsNoMove(a_move))
+    {
+        return a_move;
+    }
+
+    const PieceConf_t &pieceConf = packedmove::GetConf(a_move, PieceConfTable::Instance());
+    Coordinate coord;
+    packedmove::ToCoordinate(a_move, a_size, coord);
+
+    Coordinate squares[PIECE_MAX_SQUARES];
+    for (int32_t i = 0; i < pieceConf.nSquares; i++)
+    {
+        squares[i] = TransformCoord(
+                        Coordinate(coord.m_row + pieceConf.squareRows[i],
+                                   coord.m_col + pieceConf.squareCols[i]),
+                        a_symmetry,
+                        a_size);
+    }
+
+    PackedMove_t rv = FindMove(pieceConf.pieceType, squares, pieceConf.nSquares, a_size);
+#ifdef DEBUG
+    // configurations of a piece are closed under rotations and mirrors
+    assert(!packedmove::IsNoMove(rv));
+#endif
+
+    return rv;
+}
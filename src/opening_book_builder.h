@@ -0,0 +1,199 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book_builder.h
+/// @brief Offline deep search of the first plies of 1vs1 games
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef OPENING_BOOK_BUILDER_H_
+#define OPENING_BOOK_BUILDER_H_
+
+#include <vector>
+#include <glib.h>   // glib-2.0/glib.h (threads used to search several positions at once)
+#include "heuristic.h"
+#include "packed_move.h"
+#include "opening_book.h"
+#include "transposition_table.h"
+#include "coordinate.h"
+#include "game1v1.h"
+
+/// maximum number of positions OpeningBookBuilder can search at the same time
+const int32_t OPENING_BOOK_BUILDER_MAX_THREADS = 64;
+/// default number of plies covered by an opening book
+const int32_t OPENING_BOOK_DEFAULT_PLIES = 4;
+/// default number of moves expanded per position of the book
+const int32_t OPENING_BOOK_DEFAULT_WIDTH = 6;
+
+/// @brief builds up the entries of an opening book (see OpeningBook)
+/// Positions are explored ply by ply from the start of a game with the default
+/// starting coordinates (player1 moves first). Each position of the first a_plies
+/// plies is searched with MinMax (a_depth deep) and its best move is saved into the
+/// book. The next ply is made up of the positions reached from each one of them
+/// through its best move and the a_width - 1 best other moves according to the
+/// evaluation function (1 ply deep). Positions reached through different orders
+/// of moves are searched only once.
+///
+/// The 1st piece of each player is calculated by Game1v1::ComputeFirstPiece, so
+/// those positions are expanded but not saved. Every position saved is saved as
+/// well as the 7 positions symmetric to it (rotations and mirrors of the board),
+/// which are the ones reached by games whose starting coordinates are symmetric
+/// to the default ones (player1 in (4, 9) and player2 in (9, 4), for example)
+///
+/// Positions of the same ply are searched by a_nThreads worker threads (each
+/// search runs in 1 thread). The entries built up don't depend on the number of
+/// threads
+class OpeningBookBuilder
+{
+public:
+    /// @param heuristic positions are evaluated with
+    /// @param depth of the search tree of every position
+    /// @param number of plies from the start of the game covered by the book
+    /// @param number of moves expanded per position
+    /// @param size (in MB) of the transposition table of each worker thread.
+    ///        0 disables it
+    OpeningBookBuilder(
+        Heuristic::eHeuristicType_t a_heuristicType,
+        int32_t                     a_depth,
+        int32_t                     a_plies,
+        int32_t                     a_width,
+        int32_t                     a_transTableSizeMB);
+    virtual ~OpeningBookBuilder();
+
+    /// @brief searches the positions of the book
+    /// @param number of positions searched at the same time. Capped to
+    ///        OPENING_BOOK_BUILDER_MAX_THREADS
+    /// @param the entries of the book are saved here (not sorted, and the same
+    ///        position might be saved more than once). It is cleared first
+    /// @return number of positions searched
+    int32_t Build(int32_t a_nThreads, std::vector<OpeningBook::Entry_t> &out_entries) const;
+
+private:
+    /// heuristic positions are evaluated with
+    Heuristic::eHeuristicType_t m_heuristicType;
+
+    /// depth of the search tree of every position
+    int32_t m_depth;
+
+    /// number of plies covered by the book
+    int32_t m_plies;
+
+    /// number of moves expanded per position
+    int32_t m_width;
+
+    /// size of the transposition tables (in MB)
+    int32_t m_transTableSizeMB;
+
+    /// @brief a position of the book and the result of its search
+    typedef struct
+    {
+        /// moves put down from the start of the game to reach the position
+        std::vector<PackedMove_t> line;
+        /// best move found by the search (packedmove::NoMove() if there's none)
+        PackedMove_t              bestMove;
+        /// value returned by the search
+        int32_t                   value;
+        /// true if the position must be saved into the book
+        bool                      save;
+        /// moves expanded to reach the positions of the next ply
+        std::vector<PackedMove_t> childMoves;
+        /// zobrist keys of the positions reached by childMoves
+        std::vector<uint64_t>     childKeys;
+    } Position_t;
+
+    /// @brief data shared by all the worker threads of Build
+    /// everything below m_mutex (included) must be accessed holding the mutex
+    typedef struct
+    {
+        /// the positions will be searched by this object
+        const OpeningBookBuilder* builder;
+        /// positions of the ply being searched. Each one of them is only
+        /// written by the thread which searches it
+        std::vector<Position_t>*  positions;
+        /// true if the children of the positions must be calculated
+        bool                      expand;
+
+        /// protects the rest of the members of the structure
+        GMutex*                   mutex;
+        /// index of the next position to be searched
+        int32_t                   nextPosition;
+    } BuildData_t;
+
+    /// The routine run by the worker threads of Build. It searches positions
+    /// till there are no more of them to be searched
+    /// @param pointer to a BuildData_t structure
+    /// @return NULL
+    static void* BuildThreadRoutine(void *a_threadParam);
+
+    /// @brief searches in_out_position and calculates its children if a_expand is true
+    /// @param the position. Its line must be set
+    /// @param true if the children of the position must be calculated
+    /// @param transposition table used by the search. NULL if there's none
+    void SearchPosition(
+        Position_t         &in_out_position,
+        bool                a_expand,
+        TranspositionTable *a_transTable) const;
+
+    /// @brief puts down on a_game the moves of a_line (player1 moves first)
+    /// @param moves to be put down
+    /// @param the game. Its board must be empty
+    /// @param latest piece put down (e_noPiece if a_line is empty)
+    /// @param coordinate of the latest piece put down
+    /// @return the player who moves next
+    static Game1v1::eGame1v1Player_t ReplayLine(
+        const std::vector<PackedMove_t> &a_line,
+        Game1v1                         &a_game,
+        Piece                           &out_lastPiece,
+        Coordinate                      &out_lastCoord);
+
+    /// @return the move which puts down a piece of type a_pieceType on the
+    ///         squares a_squares (ABSOLUTE coords). packedmove::NoMove() if no
+    ///         configuration of the piece takes up those squares
+    static PackedMove_t FindMove(
+        ePieceType_t      a_pieceType,
+        const Coordinate  a_squares[PIECE_MAX_SQUARES],
+        int32_t           a_nSquares,
+        int32_t           a_nColumns);
+
+    /// @return a_coord moved by the symmetry a_symmetry of a square board
+    ///         whose side is a_size squares long. Bit 2 of a_symmetry swaps rows
+    ///         and columns, bit 0 flips rows and bit 1 flips columns. Symmetry 0
+    ///         leaves coordinates as they are
+    static Coordinate TransformCoord(
+        const Coordinate &a_coord,
+        int32_t           a_symmetry,
+        int32_t           a_size);
+
+    /// @brief moves a_move by the symmetry a_symmetry (see TransformCoord)
+    /// @return a_move moved. packedmove::NoMove() if a_move is packedmove::NoMove()
+    static PackedMove_t TransformMove(
+        PackedMove_t a_move,
+        int32_t      a_symmetry,
+        int32_t      a_size);
+
+    // prevent this class to be instantiated without the proper arguments
+    OpeningBookBuilder();
+};
+
+#endif /* OPENING_BOOK_BUILDER_H_ */
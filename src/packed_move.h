@@ -0,0 +1,116 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  packed_move.h
+/// @brief A move of the search tree packed into 32 bits
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef _PACKED_MOVE_H_
+#define _PACKED_MOVE_H_
+
+#include <stdint.h> // for types
+#include "piece.h"
+#include "coordinate.h"
+#include "bitboard.h"
+
+/// @brief a move (a configuration of a piece put down on a square of the board)
+/// packed into a 32-bit word. It is what the search saves in its stack and in the
+/// transposition table. The square is saved as its index in the board (see
+/// Bitboard::CoordToIndex), so converting it into a Coordinate needs the number
+/// of columns of the board
+///   bits  0-15 index of the square where the piece is put down
+///   bits 16-23 type of piece (e_noPiece if there is no move)
+///   bits 24-31 index of the configuration among the ones of the piece (see PieceConfTable)
+typedef uint32_t PackedMove_t;
+
+/// this namespace contains the functions to build up and read PackedMove_t words
+namespace packedmove
+{
+    /// @return a move made up of a_pieceType, its configuration a_confIndex and
+    ///         the square a_squareIndex
+    inline PackedMove_t Pack(ePieceType_t a_pieceType, int32_t a_confIndex, int32_t a_squareIndex)
+    {
+        return static_cast<PackedMove_t>(a_squareIndex & 0xffff)        |
+               (static_cast<PackedMove_t>(a_pieceType & 0xff) << 16)    |
+               (static_cast<PackedMove_t>(a_confIndex & 0xff) << 24);
+    }
+
+    /// @return the move which represents no move at all
+    inline PackedMove_t NoMove()
+    {
+        return Pack(e_noPiece, 0, 0);
+    }
+
+    /// @return type of the piece put down by a_move (e_noPiece if there's no move)
+    inline ePieceType_t GetPieceType(PackedMove_t a_move)
+    {
+        return static_cast<ePieceType_t>((a_move >> 16) & 0xff);
+    }
+
+    /// @return index of the configuration put down by a_move among the ones of its piece
+    inline int32_t GetConfIndex(PackedMove_t a_move)
+    {
+        return static_cast<int32_t>((a_move >> 24) & 0xff);
+    }
+
+    /// @return index of the square where a_move puts down its piece
+    inline int32_t GetSquareIndex(PackedMove_t a_move)
+    {
+        return static_cast<int32_t>(a_move & 0xffff);
+    }
+
+    /// @return true if a_move represents no move
+    inline bool IsNoMove(PackedMove_t a_move)
+    {
+        return (GetPieceType(a_move) == e_noPiece);
+    }
+
+    /// @return the configuration put down by a_move, read from a_confTable. a_move
+    ///         can't be packedmove::NoMove()
+    inline const PieceConf_t& GetConf(PackedMove_t a_move, const PieceConfTable &a_confTable)
+    {
+        return a_confTable.GetConf(
+                a_confTable.GetFirstConf(GetPieceType(a_move)) + GetConfIndex(a_move));
+    }
+
+    /// @return the move a_pieceType with its configuration a_confIndex put down
+    ///         on a_coord (wide form used by the GUI and by Game1v1's interface)
+    inline PackedMove_t FromCoordinate(
+            ePieceType_t      a_pieceType,
+            int32_t           a_confIndex,
+            const Coordinate &a_coord,
+            int32_t           a_nColumns)
+    {
+        return Pack(a_pieceType, a_confIndex, Bitboard::CoordToIndex(a_coord, a_nColumns));
+    }
+
+    /// @brief saves into out_coord the square where a_move puts down its piece
+    inline void ToCoordinate(PackedMove_t a_move, int32_t a_nColumns, Coordinate &out_coord)
+    {
+        Bitboard::IndexToCoord(GetSquareIndex(a_move), a_nColumns, out_coord);
+    }
+} // namespace packedmove
+
+#endif /* _PACKED_MOVE_H_ */
@@ -24,6 +24,7 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 30-Mar-2009  Original development
 ///           Faustino Frechilla 23-Jul-2010  i18n
+///           agent              17-Oct-2026  Flat table of precalculated configurations
 /// @endhistory
 ///
 // ============================================================================
@@ -110,9 +111,6 @@ Piece::Piece(ePieceType_t a_type):
 #endif
 	    // load the legacy piece representation
         (m_loadFunctionMap[a_type])(*this);
-
-        // build up the precalculated configuration too
-        BuildUpPrecalculatedRepresentations();
 	}
 	else
 	{
@@ -1158,15 +1156,20 @@ void Piece::LoadPiece_5TheUltimate(Piece &thisPiece)
     thisPiece.SetPiece(coords, nkPoints, forbiddenArea, true,  4, 2);
 }
 
-void Piece::BuildUpPrecalculatedRepresentations()
+void Piece::BuildUpPrecalculatedRepresentations(
+        std::vector<PieceConfiguration> &out_confs,
+        std::vector<uint64_t>           &out_bitwise)
 {
+    out_confs.clear();
+    out_bitwise.clear();
+
     do
     {
         uint8_t nRotations = 0;
         while(nRotations < GetNRotations())
         {
             // save current configuration into precalculated list of coords
-            m_precalculatedConfsList.push_back(m_currentConf);
+            out_confs.push_back(m_currentConf);
 
             // calculate and save bitwise representation of this configuration
             uint64_t bitwisePiece = 0x0000000000000000ull;
@@ -1178,7 +1181,7 @@ void Piece::BuildUpPrecalculatedRepresentations()
                 // this piece of magic converts a piece into a string of bits
                 bitwisePiece |= static_cast<uint64_t>(1) << ( ((3 - it->m_row) * 7) + (3 - it->m_col) );
             }
-            m_bitwiseRepresentationList.push_back(bitwisePiece);
+            out_bitwise.push_back(bitwisePiece);
 
             RotateRight();
             nRotations++;
@@ -1203,3 +1206,84 @@ void Piece::BuildUpPrecalculatedRepresentations()
     // leave the piece as it was originally described
     Reset();
 }
+
+PieceConfTable::PieceConfTable() :
+    Singleton<PieceConfTable>()
+{
+    std::vector<PieceConfiguration> pieceConfs;
+    std::vector<uint64_t> bitwiseConfs;
+
+    int32_t index = 0;
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        m_firstConf[i] = index;
+
+        Piece thisPiece(static_cast<ePieceType_t>(i));
+        thisPiece.BuildUpPrecalculatedRepresentations(pieceConfs, bitwiseConfs);
+
+#ifdef DEBUG
+        assert(pieceConfs.size() <= static_cast<std::size_t>(PIECE_MAX_CONFS));
+        assert(pieceConfs.size() == bitwiseConfs.size());
+#endif
+
+        for (std::size_t j = 0; j < pieceConfs.size(); j++, index++)
+        {
+#ifdef DEBUG
+            assert(index < PIECE_TOTAL_CONFS);
+#endif
+            m_pieceConfs[index] = pieceConfs[j];
+
+            Pack(m_pieceConfs[index], static_cast<ePieceType_t>(i), m_confs[index]);
+            m_confs[index].confIndex = static_cast<uint8_t>(j);
+            m_confs[index].bitwise   = bitwiseConfs[j];
+        }
+    }
+
+    m_firstConf[e_numberOfPieces] = index;
+
+#ifdef DEBUG
+    assert(index == PIECE_TOTAL_CONFS);
+#endif
+}
+
+PieceConfTable::~PieceConfTable()
+{
+}
+
+void PieceConfTable::Pack(
+        const PieceConfiguration &a_pieceConf,
+        ePieceType_t              a_pieceType,
+        PieceConf_t              &out_conf)
+{
+#ifdef DEBUG
+    assert(a_pieceConf.m_pieceSquares.size()  <= PIECE_MAX_SQUARES);
+    assert(a_pieceConf.m_nkPoints.size()      <= PIECE_MAX_NK_POINTS);
+    assert(a_pieceConf.m_forbiddenArea.size() <= PIECE_MAX_FORBIDDEN_AREA);
+#endif
+
+    out_conf.nSquares = static_cast<uint8_t>(a_pieceConf.m_pieceSquares.size());
+    for (uint8_t i = 0; i < out_conf.nSquares; i++)
+    {
+        out_conf.squareRows[i] = static_cast<int8_t>(a_pieceConf.m_pieceSquares[i].m_row);
+        out_conf.squareCols[i] = static_cast<int8_t>(a_pieceConf.m_pieceSquares[i].m_col);
+    }
+
+    out_conf.nNkPoints = static_cast<uint8_t>(a_pieceConf.m_nkPoints.size());
+    for (uint8_t i = 0; i < out_conf.nNkPoints; i++)
+    {
+        out_conf.nkRows[i] = static_cast<int8_t>(a_pieceConf.m_nkPoints[i].m_row);
+        out_conf.nkCols[i] = static_cast<int8_t>(a_pieceConf.m_nkPoints[i].m_col);
+    }
+
+    out_conf.nForbiddenArea = static_cast<uint8_t>(a_pieceConf.m_forbiddenArea.size());
+    for (uint8_t i = 0; i < out_conf.nForbiddenArea; i++)
+    {
+        out_conf.forbiddenRows[i] = static_cast<int8_t>(a_pieceConf.m_forbiddenArea[i].m_row);
+        out_conf.forbiddenCols[i] = static_cast<int8_t>(a_pieceConf.m_forbiddenArea[i].m_col);
+    }
+
+    out_conf.confIndex = 0;
+    out_conf.pieceType = a_pieceType;
+    out_conf.bitwise   = 0;
+    out_conf.pieceConf = &a_pieceConf;
+}
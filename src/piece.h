@@ -25,6 +25,7 @@
 ///           Faustino Frechilla 30-Mar-2009  Original development
 ///           Faustino Frechilla 19-Apr-2010  Bitwise representations
 ///           Faustino Frechilla  9-MAy-2010  Precalculated representations
+///           agent              17-Oct-2026  Flat table of precalculated configurations
 /// @endhistory
 ///
 // ============================================================================
@@ -38,9 +39,18 @@
 #include <vector>
 #include "assert.h"
 #include "coordinate.h"
+#include "singleton.h"
 
 /// maximum number of squares a piece can have
 const std::size_t PIECE_MAX_SQUARES = 5;
+/// maximum number of nk points a piece configuration can have
+const std::size_t PIECE_MAX_NK_POINTS = 8;
+/// maximum number of squares the forbidden area of a piece configuration can have
+const std::size_t PIECE_MAX_FORBIDDEN_AREA = 12;
+/// maximum number of different configurations of a piece (4 rotations X 2 mirrors)
+const int32_t PIECE_MAX_CONFS = 8;
+/// number of different configurations of all the pieces together
+const int32_t PIECE_TOTAL_CONFS = 91;
 
 /// @brief available blockem pieces
 typedef enum
@@ -164,14 +174,6 @@ public:
     /// and for the bigpenis 2
     uint8_t GetRadius() const;
 
-    /// @return the list of precalculated configurations of the piece
-    const std::list<PieceConfiguration>& GetPrecalculatedConfs() const;
-
-    /// @return the list of bitwise representations of the piece
-    /// have a look at the documentation for BuildUpBitwiseRepresentation to learn
-    /// more about this way of representing pieces
-    const std::list<uint64_t>& GetBitwiseList() const;
-
     /// set current configuration of the piece to the configuration specified by a_newCoords
     /// The user of this function must ensure size of std::vectors in PieceConfiguration "a_newConf"
     /// is the same as the vectors of the piece
@@ -199,11 +201,6 @@ private:
     int8_t m_nMirrors;
     /// "radius" of the square where the piece fits (see comment for SetPiece)
     uint8_t m_radius;
-    /// list of precaculated configurations of the piece
-    std::list<PieceConfiguration> m_precalculatedConfsList;
-    /// bitwise representation of al the possible configurations of the piece
-    /// have a look at BuildUpBitwiseRepresentation to learn more
-    std::list<uint64_t> m_bitwiseRepresentationList;
 
 #ifdef DEBUG
     /// true if the piece has been initialised
@@ -272,16 +269,21 @@ private:
     /// @brief array of strings which describe every possible piece
     static const char* m_pieceDescription[e_numberOfPieces];
 
+    /// PieceConfTable builds up its table out of the precalculated
+    /// configurations of every type of piece
+    friend class PieceConfTable;
+
     /// @brief build up precalculated list of configurations of this piece
-    /// Saves into m_precalculatedConfsList a list of PieceConfiguration
-    /// which represents the piece using (its squares + nk points + forbidden area)
+    /// Saves into out_confs a list of PieceConfiguration which represents
+    /// the piece using (its squares + nk points + forbidden area)
     ///
-    /// it also build up the bitwise representation of all the configurations of
-    /// the piece
+    /// it also build up into out_bitwise the bitwise representation of all
+    /// the configurations of the piece
     ///
     /// this method must be called once the m_origCoords array and the rest of
     /// attributes of the object has been set (have a look at the constructor of
-    /// this class)
+    /// this class). It is only called by PieceConfTable, which saves the result
+    /// once for all the pieces of the same type
     /// it rotates and mirrors the piece as many times as possible and then
     /// calls Reset to restore the original status of it. DO NOT CALL TO THIS
     /// FUNCTION ONCE THE PIECE COULD HAVE BEEN EDITED BY AN EXTERNAL USER
@@ -308,9 +310,106 @@ private:
     /// Using this representation moving a piece to the right is a matter of (>>1) and to the
     /// left (<< 1). Moving up and down is (<<7) and (>>7) respectively
     ///
-    /// These binary representations are saved into the list m_bitwiseRepresentations, which holds
+    /// These binary representations are saved into the vector out_bitwise, which holds
     /// a maximum of 8 (4 rotations X 2 mirrors) configurations
-    void BuildUpPrecalculatedRepresentations();
+    void BuildUpPrecalculatedRepresentations(
+            std::vector<PieceConfiguration> &out_confs,
+            std::vector<uint64_t>           &out_bitwise);
+};
+
+/// @brief a precalculated configuration of a piece saved in fixed-size arrays
+/// It holds the same coordinates as a PieceConfiguration (relative to the centre
+/// of the piece), but they are packed as rows and columns of 8 bits each inside
+/// the structure itself, so going through them doesn't need to follow any pointer
+/// to heap memory
+typedef struct
+{
+    /// rows and columns of the squares occupied by the piece
+    int8_t squareRows[PIECE_MAX_SQUARES];
+    int8_t squareCols[PIECE_MAX_SQUARES];
+    /// rows and columns of the nk points created by the piece
+    int8_t nkRows[PIECE_MAX_NK_POINTS];
+    int8_t nkCols[PIECE_MAX_NK_POINTS];
+    /// rows and columns of the squares which will be forbidden for the player
+    /// once he/she deploys the piece
+    int8_t forbiddenRows[PIECE_MAX_FORBIDDEN_AREA];
+    int8_t forbiddenCols[PIECE_MAX_FORBIDDEN_AREA];
+    /// number of squares, nk points and squares of the forbidden area
+    uint8_t nSquares;
+    uint8_t nNkPoints;
+    uint8_t nForbiddenArea;
+    /// index of this configuration among the configurations of the same piece
+    uint8_t confIndex;
+    /// type of piece
+    ePieceType_t pieceType;
+    /// bitwise representation of the configuration (see
+    /// Piece::BuildUpPrecalculatedRepresentations)
+    uint64_t bitwise;
+    /// this same configuration as a PieceConfiguration, for those functions which
+    /// still need one (Piece::SetCurrentConfiguration for example)
+    const PieceConfiguration* pieceConf;
+} PieceConf_t;
+
+/// @brief table with all the precalculated configurations of all the pieces
+/// The PIECE_TOTAL_CONFS fixed configurations (orientations) of the pieces are
+/// calculated only once, the first time the table is accessed, and saved one
+/// after the other in one contiguous array. Configurations of the same piece
+/// are consecutive and sorted in the same order Piece used to build them up.
+/// Pieces don't keep their own copy of their configurations. Search algorithms
+/// go through them by index:
+///     for (int32_t i = table.GetFirstConf(piece); i < table.GetEndConf(piece); i++)
+///
+/// The table is never modified once it's been built, so it can be read by
+/// several threads at the same time. It must be accessed at least once by the
+/// main thread before any other thread is spawned (the constructor of Player
+/// does it)
+class PieceConfTable :
+    public Singleton<PieceConfTable>
+{
+public:
+    /// @return the configuration saved in the position a_index of the table
+    const PieceConf_t& GetConf(int32_t a_index) const;
+
+    /// @return index of the first configuration of a_piece
+    int32_t GetFirstConf(ePieceType_t a_piece) const;
+
+    /// @return index of the configuration right after the last one of a_piece
+    int32_t GetEndConf(ePieceType_t a_piece) const;
+
+    /// @return number of different configurations of a_piece
+    int32_t GetNConfs(ePieceType_t a_piece) const;
+
+    /// @brief packs a PieceConfiguration into fixed-size arrays
+    /// it can be used to convert the current configuration of a Piece (which
+    /// might not be any of the ones saved in the table) into a PieceConf_t
+    /// @param configuration to be packed
+    /// @param type of the piece. It will be saved into out_conf
+    /// @param configuration packed into the PieceConf_t structure. Its bitwise
+    ///        representation is not calculated, and its pieceConf pointer will
+    ///        point to a_pieceConf (which must outlive out_conf)
+    static void Pack(
+            const PieceConfiguration &a_pieceConf,
+            ePieceType_t              a_pieceType,
+            PieceConf_t              &out_conf);
+
+private:
+    /// the whole set of configurations of all the pieces
+    PieceConf_t m_confs[PIECE_TOTAL_CONFS];
+    /// configurations of the table represented as PieceConfiguration
+    /// (PieceConf_t::pieceConf points to them)
+    PieceConfiguration m_pieceConfs[PIECE_TOTAL_CONFS];
+    /// index of the first configuration of each piece. The last position saves
+    /// the number of configurations of the table
+    int32_t m_firstConf[e_numberOfPieces + 1];
+
+    /// the table is only built by Singleton<PieceConfTable>::Instance
+    PieceConfTable();
+    virtual ~PieceConfTable();
+    friend class Singleton<PieceConfTable>;
+
+    // no copy constructor or operator= allowed
+    PieceConfTable(const PieceConfTable &a_src);
+    PieceConfTable& operator=(const PieceConfTable &a_src);
 };
 
 // include implementation details of inline functions
@@ -23,6 +23,11 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 30-Mar-2009  Original development
+///           agent              17-Oct-2026  Zobrist hash key
+///           agent              17-Oct-2026  NK points and influence area saved into bit planes
+///           agent              17-Oct-2026  Precalculated configurations built up by PieceConfTable
+///           agent              17-Oct-2026  Circular weights kept up to date incrementally
+///           agent              17-Oct-2026  NK points iterated in spiral order with precalculated ring masks
 /// @endhistory
 ///
 // ============================================================================
@@ -43,11 +48,19 @@ Player::Player(
         m_nColumnsInBoard(a_columnsInBoard),
         m_nkPointsCount(0),
         m_influencedCoordsCount(0),
-        m_startingCoordinate(a_startingCoordinate)
+        m_nkPointsWeight(0),
+        m_influenceAreaWeight(0),
+        m_takenSquaresWeight(0),
+        m_startingCoordinate(a_startingCoordinate),
+        m_hashKey(0)
 {
     // load the pieces
     LoadPieces();
 
+    // the configurations of the pieces are saved in a table built up only
+    // once. Make sure it is built up before any search thread can access it
+    PieceConfTable::Instance();
+
     // all the pieces are available
     for (int8_t i = e_minimumPieceIndex; i < e_numberOfPieces ; i++)
     {
@@ -55,102 +68,34 @@ Player::Player(
     }
     m_nPiecesAvailable = e_numberOfPieces;
 
-	// allocate memory for the nucleation point array and set all the nk points to 0
-    m_coordinateProperties = new uint8_t* [m_nRowsInBoard];
-	for (int32_t i = 0 ; i < m_nRowsInBoard; i++)
-	{
-	    m_coordinateProperties[i] = new uint8_t[m_nColumnsInBoard];
-		for (int32_t j = 0; j < m_nColumnsInBoard; j++)
-		{
-		    // set all the properties to "not present" (false)
-		    m_coordinateProperties[i][j] = ~COORD_PROPERTY_MASK;
-		}
-	}
-}
-
-Player::~Player()
-{
-    // delete the array that saves the nk points of this player
-	for (int32_t i = 0 ; i < m_nRowsInBoard; i++)
-	{
-		delete [] m_coordinateProperties[i];
-	}
-	delete [] m_coordinateProperties;
-}
-
-Player::Player(const Player &a_src)
-{
-    // allocate the memory needed before copying from object
-    this->m_coordinateProperties = new uint8_t* [a_src.m_nRowsInBoard];
-    for (int32_t i = 0; i < a_src.m_nRowsInBoard; i++)
-    {
-        this->m_coordinateProperties[i] = new uint8_t[a_src.m_nColumnsInBoard];
-    }
-
-    CopyFromObject(a_src);
-}
+#ifdef DEBUG
+    assert( (m_nRowsInBoard * m_nColumnsInBoard) <= BITBOARD_N_BITS );
+#endif
 
-Player& Player::operator= (const Player &a_src)
-{
-    if (this != &a_src)
+    // rings of squares around the middle of the board the nk points are iterated
+    // through by GetFirstNucleationPointSpiral (Bitboard's constructor creates empty planes)
+    int32_t middleRow = m_nRowsInBoard / 2;
+    int32_t middleCol = m_nColumnsInBoard / 2;
+    m_nSpiralRings = 0;
+    for (int32_t i = 0; i < m_nRowsInBoard; i++)
     {
-        // only delete the memory already allocated if the size of the
-        // new board is different from "this"
-        if ( (this->m_nRowsInBoard    != a_src.m_nRowsInBoard)  ||
-             (this->m_nColumnsInBoard != a_src.m_nColumnsInBoard) )
+        for (int32_t j = 0; j < m_nColumnsInBoard; j++)
         {
-            // delete the array that saves the nk points of this player
-            for (int32_t i = 0 ; i < this->m_nRowsInBoard; i++)
-            {
-                delete [] this->m_coordinateProperties[i];
-            }
-            delete [] m_coordinateProperties;
-
-            // once the old memory is deleted allocate the new memory
-            // needed for the new size before copying from object
-            this->m_coordinateProperties   = new uint8_t* [a_src.m_nRowsInBoard];
-            for (int32_t i = 0; i < a_src.m_nRowsInBoard; i++)
-            {
-                m_coordinateProperties[i] = new uint8_t[a_src.m_nColumnsInBoard];
-            }
+            int32_t ring = std::max(std::abs(i - middleRow), std::abs(j - middleCol));
+#ifdef DEBUG
+            assert(ring < PLAYER_MAX_SPIRAL_RINGS);
+#endif
+            m_spiralRings[ring].Set((i * m_nColumnsInBoard) + j);
+            m_nSpiralRings = std::max(m_nSpiralRings, ring + 1);
         }
-
-        // copy the new info from the source object
-        CopyFromObject(a_src);
     }
 
-    return *this;
+    // no nk point and no coord influenced (Bitboard's constructor
+    // creates empty planes)
 }
 
-void Player::CopyFromObject(const Player &a_src)
+Player::~Player()
 {
-    this->m_name                  = a_src.m_name;
-    this->m_presentationChar      = a_src.m_presentationChar;
-    this->m_nPiecesAvailable      = a_src.m_nPiecesAvailable;
-    this->m_nRowsInBoard          = a_src.m_nRowsInBoard;
-    this->m_nColumnsInBoard       = a_src.m_nColumnsInBoard;
-    this->m_nkPointsCount         = a_src.m_nkPointsCount;
-    this->m_influencedCoordsCount = a_src.m_influencedCoordsCount;
-    this->m_startingCoordinate    = a_src.m_startingCoordinate;
-    this->m_colourRed             = a_src.m_colourRed;
-    this->m_colourGreen           = a_src.m_colourGreen;
-    this->m_colourBlue            = a_src.m_colourBlue;
-
-    // copy the state of the pieces
-    for (int8_t i = e_minimumPieceIndex; i < e_numberOfPieces ; i++)
-    {
-        this->m_pieces[i] = a_src.m_pieces[i];
-        this->m_piecesPresent[i] = a_src.m_piecesPresent[i];
-    }
-
-    // set all the nk points to the src's
-    for (int32_t i = 0; i < a_src.m_nRowsInBoard; i++)
-    {
-        for (int32_t j = 0 ; j < a_src.m_nColumnsInBoard; j++)
-        {
-            m_coordinateProperties[i][j] = a_src.m_coordinateProperties[i][j];
-        }
-    }
 }
 
 void Player::Reset(const Coordinate &a_startingCoordinate)
@@ -167,38 +112,42 @@ void Player::Reset(const Coordinate &a_startingCoordinate)
 	}
 
 	// Player will have all properties unset (false)
-	Coordinate thisCoord(0, 0);
-	for (thisCoord.m_row = 0 ; thisCoord.m_row < m_nRowsInBoard; thisCoord.m_row++)
-	{
-		for (thisCoord.m_col = 0 ; thisCoord.m_col < m_nColumnsInBoard; thisCoord.m_col++)
-		{
-		    //m_coordinateProperties[thisCoord.m_row][thisCoord.m_col] = ~COORD_PROPERTY_MASK;
-		    UnsetInfluencedCoord(thisCoord);
-		    UnsetNucleationPoint(thisCoord);
-		}
-	}
+	m_nkPoints.Clear();
+	m_influenceArea.Clear();
+	m_nkPointsCount         = 0;
+	m_influencedCoordsCount = 0;
+	m_nkPointsWeight        = 0;
+	m_influenceAreaWeight   = 0;
+	m_takenSquaresWeight    = 0;
 
     SetStartingCoordinate(a_startingCoordinate);
 
+    // all pieces are available and no square of the board is taken
+    m_hashKey = 0;
+
 #ifdef DEBUG
-	assert(m_nkPointsCount == 0);
-	assert(m_influencedCoordsCount == 0);
+	assert(NumberOfNucleationPoints() == 0);
+	assert(InfluenceAreaSize() == 0);
+	assert(GetTakenSquaresWeight() == 0);
 	assert(m_nPiecesAvailable == e_numberOfPieces);
 
 	for (int8_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
 	{
 		assert(IsPieceAvailable(static_cast<ePieceType_t>(i)));
 	}
+#endif
+}
 
-    for (thisCoord.m_row = 0 ; thisCoord.m_row < m_nRowsInBoard; thisCoord.m_row++)
+void Player::ResetHashKey()
+{
+    m_hashKey = 0;
+    for (int8_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
     {
-        for (thisCoord.m_col = 0 ; thisCoord.m_col < m_nColumnsInBoard; thisCoord.m_col++)
+        if (IsPieceAvailable(static_cast<ePieceType_t>(i)) == false)
         {
-            assert(IsNucleationPoint(thisCoord) == false);
-            assert(IsCoordInfluencedByPlayer(thisCoord) == false);
+            m_hashKey ^= zobrist::PieceKey(m_presentationChar, static_cast<ePieceType_t>(i));
         }
     }
-#endif
 }
 
 void Player::LoadPieces()
@@ -291,20 +240,17 @@ int32_t Player::GetAllNucleationPoints(
 {
 	int32_t nNucleationPoints = 0;
 
-	Coordinate thisCoord(0, 0);
-    for (thisCoord.m_row = 0; thisCoord.m_row < m_nRowsInBoard ; thisCoord.m_row++)
+    int32_t index = m_nkPoints.NextSetBit(0);
+    while (index >= 0)
     {
-        for (thisCoord.m_col = 0; thisCoord.m_col < m_nColumnsInBoard ; thisCoord.m_col++)
+        if (nNucleationPoints < a_size)
         {
-        	if (IsNucleationPoint(thisCoord))
-            {
-                if (nNucleationPoints < a_size)
-                {
-                    out_nucleationPoints[nNucleationPoints] = thisCoord;
-                }
-                nNucleationPoints++;
-            }
+            Bitboard::IndexToCoord(
+                index, m_nColumnsInBoard, out_nucleationPoints[nNucleationPoints]);
         }
+        nNucleationPoints++;
+
+        index = m_nkPoints.NextSetBit(index + 1);
     }
 
     return nNucleationPoints;
@@ -313,42 +259,8 @@ int32_t Player::GetAllNucleationPoints(
 bool Player::GetFirstNucleationPointSpiral(
         SpiralIterator &iterator, Coordinate &out_coord) const
 {
-	int32_t rowCount    = m_nRowsInBoard / 2;
-	int32_t columnCount = m_nColumnsInBoard / 2;
-    int32_t startRow, startCol, endRow, endCol;
-	Coordinate thisCoord(0, 0);
     iterator = 0;
-
-    int32_t maxRotationalIndex = 1 + std::max(m_nRowsInBoard / 2, m_nColumnsInBoard / 2);
-    while (iterator <= maxRotationalIndex)
-    {
-        startRow = std::max(0, rowCount - iterator);
-        startCol = std::max(0, columnCount - iterator);
-        endRow   = std::min(m_nRowsInBoard - 1, rowCount + iterator);
-        endCol   = std::min(m_nColumnsInBoard - 1, columnCount + iterator);
-
-        for (thisCoord.m_row = startRow; thisCoord.m_row <= endRow; thisCoord.m_row++)
-        {
-            for (thisCoord.m_col = startCol; thisCoord.m_col <= endCol; thisCoord.m_col++)
-            {
-                if ( (thisCoord.m_col == (columnCount - iterator)) ||
-                     (thisCoord.m_col == (columnCount + iterator)) ||
-                     (thisCoord.m_row == (rowCount - iterator))    ||
-                     (thisCoord.m_row == (rowCount + iterator))    )
-                {
-                    if (IsNucleationPoint(thisCoord))
-                    {
-                        out_coord = thisCoord;
-                        return true;
-                    }
-                }
-            } // for (thisCoord.m_col = (columnCount - iterator) ;
-        } // for (thisCoord.m_row = (rowCount - iterator) ;
-
-        iterator++;
-    } // while (iterator <= maxRotationalIndex)
-
-    return false;
+    return GetNextNucleationPointSpiral(iterator, -1, out_coord);
 }
 
 bool Player::GetNextNucleationPointSpiral(
@@ -359,81 +271,31 @@ bool Player::GetNextNucleationPointSpiral(
     assert(in_out_coord.m_row <  m_nRowsInBoard);
     assert(in_out_coord.m_col >= 0);
     assert(in_out_coord.m_col <  m_nColumnsInBoard);
+    assert( (iterator >= m_nSpiralRings) ||
+            m_spiralRings[iterator].IsSet(CoordToIndex(in_out_coord)) );
 #endif
 
-	int32_t rowCount    = m_nRowsInBoard / 2;
-	int32_t columnCount = m_nColumnsInBoard / 2;
-    int32_t startRow, startCol, endRow, endCol;
-	Coordinate thisCoord(0, 0);
-
-    // check the current line before incrementing this row
-	thisCoord.m_row = in_out_coord.m_row;
-    endCol = std::min(m_nColumnsInBoard - 1, columnCount + iterator);
-    for (thisCoord.m_col = (in_out_coord.m_col + 1);
-         thisCoord.m_col <= endCol;
-         thisCoord.m_col++)
+    return GetNextNucleationPointSpiral(iterator, CoordToIndex(in_out_coord), in_out_coord);
+}
+
+bool Player::GetNextNucleationPointSpiral(
+        SpiralIterator &iterator, int32_t a_index, Coordinate &in_out_coord) const
+{
+    // only the nk points of each ring are visited (count trailing zeros), so it
+    // costs the same no matter how big the board is
+    while (iterator < m_nSpiralRings)
     {
-        if ( (thisCoord.m_col == (columnCount - iterator)) || (thisCoord.m_col == (columnCount + iterator)) ||
-             (thisCoord.m_row == (rowCount - iterator))    || (thisCoord.m_row == (rowCount + iterator)) )
+        int32_t index = (m_nkPoints & m_spiralRings[iterator]).NextSetBit(a_index + 1);
+        if (index >= 0)
         {
-            if (IsNucleationPoint(thisCoord))
-            {
-                in_out_coord = thisCoord;
-                return true;
-            }
+            Bitboard::IndexToCoord(index, m_nColumnsInBoard, in_out_coord);
+            return true;
         }
-    }// for (thisCoord.m_col = (in_out_coord.m_col + 1);
-
-    // check all the possibilities for next row before incrementing the rotational index
-    startCol = std::max(0, columnCount - iterator);
-    endRow   = std::min(m_nRowsInBoard - 1, rowCount + iterator);
-    endCol   = std::min(m_nColumnsInBoard - 1, columnCount + iterator);
-    for (thisCoord.m_row  = (in_out_coord.m_row + 1) ;
-         thisCoord.m_row <= endRow;
-         thisCoord.m_row++)
-    {
-        for (thisCoord.m_col = startCol; thisCoord.m_col <= endCol; thisCoord.m_col++)
-        {
-            if ( (thisCoord.m_col == (columnCount - iterator)) || (thisCoord.m_col == (columnCount + iterator)) ||
-                 (thisCoord.m_row == (rowCount - iterator))    || (thisCoord.m_row == (rowCount + iterator)) )
-            {
-                if (IsNucleationPoint(thisCoord))
-                {
-                    in_out_coord = thisCoord;
-                    return true;
-                }
-            }
-        } // for (thisCoord.m_col= (columnCount - iterator) ;
-    } // for (thisCoord.m_row= (in_out_coord.m_row + 1) ;
 
-    // go on with the next rotational index
-    iterator++;
-
-    int maxRotationalIndex = 1 + std::max(m_nRowsInBoard / 2, m_nColumnsInBoard / 2);
-    while (iterator <= maxRotationalIndex)
-    {
-        startRow = std::max(0, rowCount - iterator);
-        startCol = std::max(0, columnCount - iterator);
-        endRow   = std::min(m_nRowsInBoard - 1, rowCount + iterator);
-        endCol   = std::min(m_nColumnsInBoard - 1, columnCount + iterator);
-
-        for (thisCoord.m_row = startRow; thisCoord.m_row <= endRow; thisCoord.m_row++)
-        {
-            for (thisCoord.m_col = startCol; thisCoord.m_col <= endCol; thisCoord.m_col++)
-            {
-                if ( (thisCoord.m_col == (columnCount - iterator)) || (thisCoord.m_col == (columnCount + iterator)) ||
-                     (thisCoord.m_row == (rowCount - iterator))    || (thisCoord.m_row == (rowCount + iterator)) )
-                {
-                    if (IsNucleationPoint(thisCoord))
-                    {
-                        in_out_coord = thisCoord;
-                        return true;
-                    }
-                }
-            } // for (thisCoord.m_col= (columnCount - iterator) ;
-        } // for (thisCoord.m_row= (rowCount - iterator) ;
+        // no nk points left in this ring. Start from the beginning of the next one
         iterator++;
-    } // while (iterator <= maxRotationalIndex)
+        a_index = -1;
+    }
 
     return false;
 }
@@ -24,6 +24,11 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 30-Mar-2009  Original development
 ///           Faustino Frechilla 16-Jun-2010  Influence area support
+///           agent              17-Oct-2026  Zobrist hash key
+///           agent              17-Oct-2026  NK points and influence area saved into bit planes
+///           agent              17-Oct-2026  Circular weights kept up to date incrementally
+///           agent              17-Oct-2026  NK points iterated in spiral order with precalculated ring masks
+///           agent              17-Oct-2026  Board state saved and restored at once
 /// @endhistory
 ///
 // ============================================================================
@@ -32,16 +37,19 @@
 #define PLAYER_H_
 
 #include <string>
+#include <stdlib.h>  // abs
+#include <algorithm> // std::max
 #include "assert.h"
 #include "piece.h"
 #include "coordinate.h"
 #include "coordinate_set.h"
+#include "bitboard.h"
+#include "zobrist.h"
 
-// masks for the coordinate properties saved in Player::m_coordinateProperties
-// each bit says if that specific property is present (0 false, 1 true)
-#define COORD_PROPERTY_NKPOINTS       0x01  // bit 1 (lowest significant bit)
-#define COORD_PROPERTY_INFLUENCE_AREA 0x02  // bit 2
-#define COORD_PROPERTY_MASK           0x03  // 2 lowest significant bits
+/// maximum number of rings of squares around the middle of the board the nk points
+/// of a player can be iterated through (see GetFirstNucleationPointSpiral). Enough
+/// for boards up to 20x20
+const int32_t PLAYER_MAX_SPIRAL_RINGS = 11;
 
 class Player
 {
@@ -49,6 +57,21 @@ public:
 	/// type of the iterator used to retrieve the nk points of this player in a spiral shape
     typedef int32_t SpiralIterator;
 
+    /// @brief properties of the player which change when a piece is put down on the board:
+    /// nucleation points, influence area, their weighted sums and the hash key. The
+    /// pieces available are not saved (see SaveBoardState)
+    typedef struct
+    {
+        Bitboard nkPoints;
+        Bitboard influenceArea;
+        int32_t  nkPointsCount;
+        int32_t  influencedCoordsCount;
+        int32_t  nkPointsWeight;
+        int32_t  influenceAreaWeight;
+        int32_t  takenSquaresWeight;
+        uint64_t hashKey;
+    } BoardState_t;
+
     /// @param name is the name of the player
     /// @param presenChar is the character that represents the player
 	/// @param a_rowsInBoard
@@ -62,11 +85,6 @@ public:
             const Coordinate &a_startingCoordinate);
     virtual ~Player();
 
-    /// @brief copy constructor. Needed because there's some dynamic memory
-    Player(const Player &a_src);
-    /// @brief operator=. Needed because there's some dynamic memory
-    Player& operator= (const Player &a_src);
-
     /// array with this player's pieces
     Piece m_pieces[e_numberOfPieces];
 
@@ -107,6 +125,35 @@ public:
     /// @return size of the influence area (in squares)
     int32_t InfluenceAreaSize() const;
 
+    /// @return sum of the circular weights of the nucleation points of this player
+    /// (see CalculateCircularWeight). It is kept up to date every time a nk point is set
+    /// or unset, so it doesn't need to go through the board
+    int32_t GetNucleationPointsWeight() const;
+
+    /// @return sum of the circular weights of the coords influenced by this player
+    int32_t GetInfluenceAreaWeight() const;
+
+    /// @return sum of the circular weights of the squares of the board taken by this player
+    int32_t GetTakenSquaresWeight() const;
+
+    /// @brief adds a_coord to the squares of the board taken by this player
+    /// as it happens with ToggleHashKeySquare the player doesn't know which squares of
+    /// the board it takes, so whoever puts down or removes pieces of this player is in
+    /// charge of calling AddTakenSquare and RemoveTakenSquare once per square
+    void AddTakenSquare(const Coordinate &a_coord);
+
+    /// @brief removes a_coord from the squares of the board taken by this player
+    void RemoveTakenSquare(const Coordinate &a_coord);
+
+    /// @brief forgets every square added with AddTakenSquare
+    void ResetTakenSquares();
+
+    /// @brief calculates the circular weight of a coord in a board
+    /// The closer to the centre of the board a_coord is the bigger its weight.
+    /// The output in a 14x14 board is drawn in Heuristic::CalculateCircularWeight
+    static int32_t CalculateCircularWeight(
+            int32_t a_nRows, int32_t a_nColumns, const Coordinate &a_coord);
+
     /// Set the piece as not present
     void UnsetPiece(ePieceType_t a_piece);
 
@@ -116,9 +163,24 @@ public:
     /// returns true if the player still has the piece
     bool IsPieceAvailable(ePieceType_t a_piece) const;
 
+    /// @return the zobrist hash key of this player. It represents the pieces already used
+    /// by the player and the squares of the board taken by them (see namespace zobrist)
+    uint64_t GetHashKey() const;
+
+    /// @brief adds (or removes, if it was already there) a_coord to the zobrist hash key
+    /// Pieces are added to the key by SetPiece and UnsetPiece, but the player doesn't know
+    /// which squares of the board it takes, so whoever puts down or removes pieces of this
+    /// player is in charge of calling this method once per square (see Game1v1::PutDownPiece)
+    void ToggleHashKeySquare(const Coordinate &a_coord);
+
+    /// @brief recalculates the zobrist hash key using the pieces available
+    /// squares of the board taken by the player must be added again with ToggleHashKeySquare
+    void ResetHashKey();
+
     /// returns true if a_coord is influenced by the player. Definition of "influenced"
     /// is a bit vague. Have a look at rules::RecalculateInfluenceAreaAroundPiece
-    /// to know what "influence" in blockem
+    /// to know what "influence" in blockem. Game1v1 searches can keep the exact one
+    /// instead (see rules::CalculateInfluenceAreaInBoard)
     bool IsCoordInfluencedByPlayer(const Coordinate &a_coord) const;
 
     /// sets a specific coord as "influenced" by this player
@@ -136,6 +198,29 @@ public:
     /// delete a nucleation point in the coords passed as parameters
     void UnsetNucleationPoint(const Coordinate &a_coord);
 
+    /// @return plane with the nucleation points of this player. The square
+    ///         (row, col) is saved in the bit (row * number_of_columns + col)
+    const Bitboard& GetNucleationPointsPlane() const;
+
+    /// @brief replaces all the nucleation points of this player with the ones set in a_plane
+    /// a_plane can't have bits set outside the board (see Board::GetEmptyPlane)
+    void SetNucleationPointsPlane(const Bitboard &a_plane);
+
+    /// @return plane with the coords influenced by this player
+    const Bitboard& GetInfluenceAreaPlane() const;
+
+    /// @brief replaces the influence area of this player with the coords set in a_plane
+    /// a_plane can't have bits set outside the board (see Board::GetEmptyPlane)
+    void SetInfluenceAreaPlane(const Bitboard &a_plane);
+
+    /// @brief saves the properties of the player which change when a piece is put down
+    /// so they can be restored exactly as they were with RestoreBoardState
+    void SaveBoardState(BoardState_t &out_state) const;
+
+    /// @brief restores the properties saved by SaveBoardState. The hash key includes the
+    /// pieces used, so the same pieces must be available as when the state was saved
+    void RestoreBoardState(const BoardState_t &a_state);
+
     /// Get all the nucleation points in the board. The user has to ensure the size of the array is big enough (for example
     /// 2/5 the size of the board) If the size of the array wasn't big enough this function will save a_size
     /// into the out_nucleationPoints array and return the total number of nk points (bigger than a_size)
@@ -151,7 +236,8 @@ public:
     int32_t GetAllNucleationPoints(STLCoordinateSet_t &a_set) const;
 
     /// Get the first nucleation point in the board starting from the center of the board
-    /// and keep on going on a spiral shape
+    /// and keep on going on a spiral shape: ring after ring of squares around the middle, each
+    /// ring row by row. Only the nk points are visited, not every square of the board
     /// The result will be saved in the variables out_coordX and out_coordY
     /// @param iterator used to go through the board rotating from the center to the borders. It is reseted in this function
     ///     It is used also in GetNextNucleationPoint
@@ -199,15 +285,29 @@ private:
     int32_t m_nRowsInBoard;
     /// number of columns of the board where the player is playing
     int32_t m_nColumnsInBoard;
-    /// Array with the properties of this player related to every place
-    /// in the board (every coordinate)
-    uint8_t** m_coordinateProperties;
-    /// Number of nucleation points of this player (saved in m_coordinateProperties)
+    /// nucleation points of this player
+    Bitboard m_nkPoints;
+    /// coords influenced by this player
+    Bitboard m_influenceArea;
+    /// m_spiralRings[i] has got set to 1 the squares which are i rows or columns away
+    /// (whatever is bigger) from the middle of the board. Same rings as Board's
+    Bitboard m_spiralRings[PLAYER_MAX_SPIRAL_RINGS];
+    /// number of rings of squares of the board where the player is playing
+    int32_t m_nSpiralRings;
+    /// Number of nucleation points of this player (bits set in m_nkPoints)
     int32_t m_nkPointsCount;
-    /// Number of coords influenced by this player
+    /// Number of coords influenced by this player (bits set in m_influenceArea)
     int32_t m_influencedCoordsCount;
+    /// sum of the circular weights of the coords set in m_nkPoints
+    int32_t m_nkPointsWeight;
+    /// sum of the circular weights of the coords set in m_influenceArea
+    int32_t m_influenceAreaWeight;
+    /// sum of the circular weights of the squares taken by this player
+    int32_t m_takenSquaresWeight;
     /// Starting coordinate of this player
     Coordinate m_startingCoordinate;
+    /// zobrist hash key of the pieces used by the player and the squares it takes
+    uint64_t m_hashKey;
     /// Red channel of the Colour representation of the player
     uint8_t m_colourRed;
     /// Green channel of the Colour representation of the player
@@ -218,11 +318,16 @@ private:
     /// load all pieces into the m_pieces array
     void LoadPieces();
 
-    /// @brief copy the source player argument into the current object
-    /// It doesn't delete or allocate any memory, so when used in
-    /// operator= or copy constructor that should be taken care of
-    /// before calling to the function
-    void CopyFromObject(const Player &a_src);
+    /// @brief next nk point after the square a_index of the ring iterator (or the first
+    ///        one of that ring if a_index is -1). See GetNextNucleationPointSpiral
+    bool GetNextNucleationPointSpiral(
+            SpiralIterator &iterator, int32_t a_index, Coordinate &in_out_coord) const;
+
+    /// @return the index of the bit that represents a_coord in the planes of this player
+    int32_t CoordToIndex(const Coordinate &a_coord) const;
+
+    /// @return the circular weight of a_coord in the board where the player is playing
+    int32_t CircularWeight(const Coordinate &a_coord) const;
 
     // prevent players to be created without the proper arguments
     Player();
@@ -24,6 +24,11 @@
 /// Ref       Who                When         What
 ///           Faustino Frechilla 08-Sept-2009 Original development
 ///           Faustino Frechilla 16-Jun-2010  Influence area support
+///           agent              17-Oct-2026  Nucleation points calculated with bit planes
+///           agent              17-Oct-2026  Valid coords calculated with bit planes
+///           agent              17-Oct-2026  Configurations read from PieceConfTable
+///           agent              17-Oct-2026  Valid moves counted with bit planes
+///           agent              17-Oct-2026  Exact influence area calculated with bit planes
 /// @endhistory
 ///
 // ============================================================================
@@ -248,6 +253,18 @@ bool rules::IsNucleationPointCompute(
     return isNucleationPoint;
 }
 
+void rules::CalculateNucleationPointsCompute(
+        const Board  &a_board,
+        const Player &a_player,
+        Bitboard     &out_nkPoints)
+{
+    Bitboard playerPlane = a_board.GetPlayerPlane(a_player);
+
+    out_nkPoints  = a_board.GetDiagonalNeighbours(playerPlane);
+    out_nkPoints &= ~a_board.GetOrthogonalNeighbours(playerPlane);
+    out_nkPoints &= a_board.GetEmptyPlane();
+}
+
 bool rules::IsPieceDeployableInCoord(
         const Board              &a_board,
         const PieceConfiguration &a_pieceConf,
@@ -485,6 +502,157 @@ int32_t rules::CalculateValidCoordsInNucleationPoint(
     return nValidCoords;
 }
 
+void rules::CalculateValidCoordsInBoard(
+        const Board       &a_board,
+        const Player      &a_player,
+        const PieceConf_t &a_pieceConf,
+        const Bitboard    &a_mustTouchPlane,
+        Bitboard          &out_validCoords)
+{
+    // coords where at least one of the squares of the piece
+    // would be touching a_mustTouchPlane
+    out_validCoords.Clear();
+
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
+    {
+        out_validCoords |= a_board.GetShiftedPlane(
+            a_mustTouchPlane, a_pieceConf.squareRows[i], a_pieceConf.squareCols[i]);
+    }
+
+    if (out_validCoords.IsEmpty())
+    {
+        return;
+    }
+
+    // every square of the piece must be empty (and inside the board)
+    Bitboard emptyPlane = a_board.GetEmptyPlane();
+    for (uint8_t i = 0; i < a_pieceConf.nSquares; i++)
+    {
+        out_validCoords &= a_board.GetShiftedPlane(
+            emptyPlane, a_pieceConf.squareRows[i], a_pieceConf.squareCols[i]);
+        if (out_validCoords.IsEmpty())
+        {
+            return;
+        }
+    }
+
+    // a_player can't have a piece already in the forbidden area of the piece
+    Bitboard playerPlane = a_board.GetPlayerPlane(a_player);
+    if (playerPlane.IsEmpty())
+    {
+        return;
+    }
+
+    for (uint8_t i = 0; i < a_pieceConf.nForbiddenArea; i++)
+    {
+        out_validCoords &= ~a_board.GetShiftedPlane(
+            playerPlane, a_pieceConf.forbiddenRows[i], a_pieceConf.forbiddenCols[i]);
+    }
+}
+
+int32_t rules::CalculateValidMoves(
+        const Board         &a_board,
+        const Player        &a_player,
+        std::vector<Move_t> &out_moves)
+{
+    out_moves.clear();
+
+    // the starting point is one more square that can be touched
+    // as long as nobody has put down a piece on it
+    Bitboard mustTouchPlane = a_player.GetNucleationPointsPlane();
+    const Coordinate &startingCoord = a_player.GetStartingCoordinate();
+    if (startingCoord.Initialised() && a_board.IsCoordEmpty(startingCoord))
+    {
+        mustTouchPlane.Set(a_board.CoordToIndex(startingCoord));
+    }
+
+    if (mustTouchPlane.IsEmpty())
+    {
+        return 0;
+    }
+
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    Move_t thisMove;
+    Bitboard validCoords;
+    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    {
+        if (a_player.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false)
+        {
+            continue;
+        }
+
+        thisMove.pieceType = static_cast<ePieceType_t>(i);
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
+        {
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+            CalculateValidCoordsInBoard(
+                a_board, a_player, pieceConf, mustTouchPlane, validCoords);
+
+            thisMove.confIndex = pieceConf.confIndex;
+            thisMove.pieceConf = &pieceConf;
+
+            int32_t ring;
+            for (int32_t index = a_board.GetFirstIndexSpiral(validCoords, ring);
+                 index >= 0;
+                 index = a_board.GetNextIndexSpiral(validCoords, ring, index))
+            {
+                Bitboard::IndexToCoord(index, a_board.GetNColumns(), thisMove.coord);
+                out_moves.push_back(thisMove);
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
+    } // for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+
+    return static_cast<int32_t>(out_moves.size());
+}
+
+int32_t rules::CountValidMoves(
+        const Board  &a_board,
+        const Player &a_player)
+{
+    // the starting point is one more square that can be touched
+    // as long as nobody has put down a piece on it
+    Bitboard mustTouchPlane = a_player.GetNucleationPointsPlane();
+    const Coordinate &startingCoord = a_player.GetStartingCoordinate();
+    if (startingCoord.Initialised() && a_board.IsCoordEmpty(startingCoord))
+    {
+        mustTouchPlane.Set(a_board.CoordToIndex(startingCoord));
+    }
+
+    if (mustTouchPlane.IsEmpty())
+    {
+        return 0;
+    }
+
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
+    int32_t nMoves = 0;
+    Bitboard validCoords;
+    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    {
+        if (a_player.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false)
+        {
+            continue;
+        }
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
+        {
+            CalculateValidCoordsInBoard(
+                a_board, a_player, confTable.GetConf(confIt), mustTouchPlane, validCoords);
+
+            nMoves += validCoords.PopCount();
+        }
+    }
+
+    return nMoves;
+}
+
 bool rules::HasValidCoordInNucleationPoint(
         const Board              &a_board,
         const Player             &a_player,
@@ -569,10 +737,10 @@ void rules::RecalculateNKAroundCoord(
 }
 
 void rules::RecalculateInfluenceAreaAroundPieceFast(
-        const Board              &a_board,
-        const Coordinate         &a_coord,
-        const PieceConfiguration &a_pieceConf,
-        Player                   &a_player)
+        const Board       &a_board,
+        const Coordinate  &a_coord,
+        const PieceConf_t &a_pieceConf,
+        Player            &a_player)
 {
     int32_t startCol, endCol, startRow, endRow;
 
@@ -607,26 +775,26 @@ void rules::RecalculateInfluenceAreaAroundPieceFast(
     // now go through the borders of the influence area per each one
     // of squares that make up the piece configuration to check if
     // this influence area should be bigger
-    PieceConfigurationContainer_t::const_iterator it =
-        a_pieceConf.m_pieceSquares.begin();
     // 1st square is always relative (0, 0) - read comment above -
     // it has been checked in the previous loop. Also note that
-    // incrementing this iterator is always correct because all
+    // starting from the 2nd square is always correct because all
     // piece must have at least one coordinate
-    it++;
-    while (it != a_pieceConf.m_pieceSquares.end())
+    for (uint8_t i = 1; i < a_pieceConf.nSquares; i++)
     {
+        int32_t squareRow = a_pieceConf.squareRows[i];
+        int32_t squareCol = a_pieceConf.squareCols[i];
+
         // go for the borders on the top and bottom of the influence area
-        startCol = std::max(0, a_coord.m_col - INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_col);
+        startCol = std::max(0, a_coord.m_col - INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareCol);
         endCol   = std::min(a_board.GetNColumns() - 1,
-                            a_coord.m_col + INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_col);
+                            a_coord.m_col + INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareCol);
 
-        if (it->m_row < 0)
+        if (squareRow < 0)
         {
             // upper most row of the influence area. Check it only if the squares to be
             // checked are expected to be outside the "main" influence area checked
             // in the 1st loop of the function
-            tmpCoord.m_row = a_coord.m_row - INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_row;
+            tmpCoord.m_row = a_coord.m_row - INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareRow;
             if ( (tmpCoord.m_row >= 0) && (tmpCoord.m_row < a_board.GetNRows()) )
             {
                 for (tmpCoord.m_col  = startCol;
@@ -644,11 +812,11 @@ void rules::RecalculateInfluenceAreaAroundPieceFast(
                     }
                 }
             } // if ( (tmpCoord.m_row >= 0) && (tmpCoord.m_row < a_board.GetNRows()) )
-        } // if (it->m_row < 0)
-        else if (it->m_row > 0)
+        } // if (squareRow < 0)
+        else if (squareRow > 0)
         {
             // lowest most row of the influence area
-            tmpCoord.m_row = a_coord.m_row + INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_row;
+            tmpCoord.m_row = a_coord.m_row + INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareRow;
             if ( (tmpCoord.m_row >= 0) && (tmpCoord.m_row < a_board.GetNRows()) )
             {
                 for (tmpCoord.m_col  = startCol;
@@ -666,20 +834,20 @@ void rules::RecalculateInfluenceAreaAroundPieceFast(
                     }
                 }
             } // if ( (tmpCoord.m_row >= 0) && (tmpCoord.m_row < a_board.GetNRows()) )
-        } // if (it->m_row > 0)
+        } // if (squareRow > 0)
 
         // go for the borders on the sides (thay haven't been checked yet)
         // upper and down most rows have already been checked, but some coordinates
         // could have been discarded because they weren't expected to go outside the
         // the influence area checked in the 1st loop of the function
-        startRow = std::max(0, a_coord.m_row - INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_row);
+        startRow = std::max(0, a_coord.m_row - INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareRow);
         endRow   = std::min(a_board.GetNRows() - 1,
-                            a_coord.m_row + INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_row);
+                            a_coord.m_row + INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareRow);
 
-        if (it->m_col < 0)
+        if (squareCol < 0)
         {
             // left side
-            tmpCoord.m_col = a_coord.m_col - INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_col;
+            tmpCoord.m_col = a_coord.m_col - INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareCol;
             if ( (tmpCoord.m_col >= 0) && (tmpCoord.m_col < a_board.GetNColumns()) )
             {
                 for (tmpCoord.m_row  = startRow;
@@ -697,11 +865,11 @@ void rules::RecalculateInfluenceAreaAroundPieceFast(
                     }
                 }
             } // if ( (tmpCoord.m_col >= 0) && (tmpCoord.m_col < a_board.GetNColumns()) )
-        } // if (it->m_col < 0)
-        else if (it->m_col > 0)
+        } // if (squareCol < 0)
+        else if (squareCol > 0)
         {
             // right side
-            tmpCoord.m_col = a_coord.m_col + INFLUENCE_AREA_AROUND_SQUARE_SIZE + it->m_col;
+            tmpCoord.m_col = a_coord.m_col + INFLUENCE_AREA_AROUND_SQUARE_SIZE + squareCol;
             if ( (tmpCoord.m_col >= 0) && (tmpCoord.m_col < a_board.GetNColumns()) )
             {
                 for (tmpCoord.m_row  = startRow;
@@ -719,11 +887,8 @@ void rules::RecalculateInfluenceAreaAroundPieceFast(
                     }
                 }
             } // if ( (tmpCoord.m_col >= 0) && (tmpCoord.m_col < a_board.GetNColumns()) )
-        }// if (it->m_col > 0)
-
-        // go for the next square of the piece!
-        it++;
-    } // while (it != a_pieceConf.end())
+        }// if (squareCol > 0)
+    } // for (uint8_t i = 1; i < a_pieceConf.nSquares; i++)
 
 }
 
@@ -774,6 +939,15 @@ bool rules::IsCoordInfluencedByPlayerFastCompute(
 void rules::RecalculateInfluenceAreaInBoard(
         const Board &a_board,
         Player      &a_player)
+{
+    Bitboard influenceArea;
+    CalculateInfluenceAreaInBoard(a_board, a_player, influenceArea);
+    a_player.SetInfluenceAreaPlane(influenceArea);
+}
+
+void rules::RecalculateInfluenceAreaInBoardCompute(
+        const Board &a_board,
+        Player      &a_player)
 {
     // remove current influence area state
     Coordinate thisCoord;
@@ -790,7 +964,11 @@ void rules::RecalculateInfluenceAreaInBoard(
         return;
     }
 
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+
     STLCoordinateSet_t nkPointsSet;
+    a_player.GetAllNucleationPoints(nkPointsSet);
+
     std::vector<Coordinate> validCoords(PIECE_MAX_SQUARES);
     for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
     {
@@ -799,15 +977,12 @@ void rules::RecalculateInfluenceAreaInBoard(
             continue;
         }
 
-        const std::list<PieceConfiguration> &pieceConfList =
-            a_player.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
-            a_player.GetAllNucleationPoints(nkPointsSet);
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
             for (STLCoordinateSet_t::const_iterator nkIt = nkPointsSet.begin();
                  nkIt != nkPointsSet.end();
                  nkIt++)
@@ -817,19 +992,16 @@ void rules::RecalculateInfluenceAreaInBoard(
                                             a_board,
                                             a_player,
                                             (*nkIt),
-                                            (*pieceConfIt),
+                                            *(pieceConf.pieceConf),
                                             validCoords);
 
                 for (int32_t k = 0; k < nValidCoords; k++)
                 {
-                    PieceConfigurationContainer_t::const_iterator it;
-                    for (it  = pieceConfIt->m_pieceSquares.begin();
-                         it != pieceConfIt->m_pieceSquares.end();
-                         it++)
+                    for (uint8_t j = 0; j < pieceConf.nSquares; j++)
                     {
                         Coordinate influeceAreaCoord(
-                            validCoords[k].m_row + it->m_row,
-                            validCoords[k].m_col + it->m_col);
+                            validCoords[k].m_row + pieceConf.squareRows[j],
+                            validCoords[k].m_col + pieceConf.squareCols[j]);
 
                         if ( (influeceAreaCoord.m_row >= 0) &&
                              (influeceAreaCoord.m_row <  a_board.GetNRows()) &&
@@ -841,71 +1013,175 @@ void rules::RecalculateInfluenceAreaInBoard(
                     }
                 }
             } // for (STLCoordinateSet_t::const_iterator it = nkPointsSet.begin();
-        } // for (pieceCoordIt = coordConfList.begin()
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
     } // for (int i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
 }
 
-bool rules::CanPlayerGo(const Board &a_board, const Player &a_player)
+void rules::CalculateInfluenceAreaInBoard(
+        const Board  &a_board,
+        const Player &a_player,
+        Bitboard     &out_influenceArea)
 {
+    out_influenceArea.Clear();
+
     if (a_player.NumberOfPiecesAvailable() == 0)
     {
-        return false;
+        return;
     }
 
-    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    // the starting point is one more square that can be touched
+    // as long as nobody has put down a piece on it
+    Bitboard mustTouchPlane = a_player.GetNucleationPointsPlane();
+    const Coordinate &startingCoord = a_player.GetStartingCoordinate();
+    if (startingCoord.Initialised() && a_board.IsCoordEmpty(startingCoord))
+    {
+        mustTouchPlane.Set(a_board.CoordToIndex(startingCoord));
+    }
+
+    if (mustTouchPlane.IsEmpty())
+    {
+        return;
+    }
+
+    // a square of a piece can be put down on any empty square which is not touching
+    // a square of a_player (that is the same as saying that a_player has got no square
+    // in the forbidden area of the piece)
+    Bitboard allowedPlane = a_board.GetEmptyPlane() &
+                            ~a_board.GetOrthogonalNeighbours(a_board.GetPlayerPlane(a_player));
+
+    // mustTouchPlane and allowedPlane shifted by every offset (row, col) a square of a
+    // piece can be at. They are shifted the first time a configuration needs them (bit
+    // ((row + BOARD_MAX_PLANE_SHIFT) * N_OFFSETS) + col + BOARD_MAX_PLANE_SHIFT of
+    // shiftedMask is set once offset (row, col) has been shifted)
+    const int32_t N_OFFSETS = (2 * BOARD_MAX_PLANE_SHIFT) + 1;
+    Bitboard shiftedTouch[N_OFFSETS * N_OFFSETS];
+    Bitboard shiftedAllowed[N_OFFSETS * N_OFFSETS];
+    uint64_t shiftedMask = 0;
+
+    // valid coords of every configuration OR'ed by the offset of each one of
+    // its squares. They are shifted back to the squares at the end
+    Bitboard footprint[N_OFFSETS * N_OFFSETS];
+    uint64_t footprintMask = 0;
+
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    for (int8_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
     {
         if (a_player.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false)
         {
             continue;
         }
 
-        const std::list<PieceConfiguration> &pieceConfList =
-            a_player.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
-            if (a_player.GetStartingCoordinate().Initialised() &&
-                a_board.IsCoordEmpty(a_player.GetStartingCoordinate()))
+            const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+
+#ifdef DEBUG
+            assert(pieceConf.nSquares > 0);
+#endif
+            int32_t offsets[PIECE_MAX_SQUARES] = {0};
+            for (uint8_t j = 0; j < pieceConf.nSquares; j++)
             {
-                std::vector<Coordinate> validCoords(VALID_COORDS_SIZE);
-                int32_t nValidCoords = CalculateValidCoordsInStartingPoint(
-                                        a_board,
-                                        a_player.GetStartingCoordinate(),
-                                        (*pieceConfIt),
-                                        validCoords);
-
-                if (nValidCoords > 0)
+                offsets[j] = ((pieceConf.squareRows[j] + BOARD_MAX_PLANE_SHIFT) * N_OFFSETS) +
+                             pieceConf.squareCols[j] + BOARD_MAX_PLANE_SHIFT;
+                if ((shiftedMask & (static_cast<uint64_t>(1) << offsets[j])) == 0)
                 {
-                    return true;
+                    shiftedTouch[offsets[j]] = a_board.GetShiftedPlane(
+                        mustTouchPlane, pieceConf.squareRows[j], pieceConf.squareCols[j]);
+                    shiftedAllowed[offsets[j]] = a_board.GetShiftedPlane(
+                        allowedPlane, pieceConf.squareRows[j], pieceConf.squareCols[j]);
+                    shiftedMask |= (static_cast<uint64_t>(1) << offsets[j]);
                 }
-            } // if (a_player.NumberOfPiecesAvailable() == e_numberOfPieces)
+            }
 
-            bool nkExists;
-            Coordinate thisNkPoint;
-            Player::SpiralIterator nkIterator;
+            // coords where a square of the piece would be touching mustTouchPlane
+            // and every square of the piece would be on allowedPlane
+            Bitboard touchCoords(shiftedTouch[offsets[0]]);
+            Bitboard validCoords(shiftedAllowed[offsets[0]]);
+            for (uint8_t j = 1; j < pieceConf.nSquares; j++)
+            {
+                touchCoords |= shiftedTouch[offsets[j]];
+                validCoords &= shiftedAllowed[offsets[j]];
+            }
+            validCoords &= touchCoords;
 
-            nkExists = a_player.GetFirstNucleationPointSpiral(nkIterator, thisNkPoint);
-            while(nkExists)
+            if (validCoords.IsEmpty())
             {
-                // retrieve if there is a valid coord of this piece in the current nk point
-                bool nValidCoords = rules::HasValidCoordInNucleationPoint(
-                                            a_board,
-                                            a_player,
-                                            thisNkPoint,
-                                            (*pieceConfIt),
-                                            a_player.m_pieces[i].GetRadius());
+                continue;
+            }
 
-                if (nValidCoords)
+            for (uint8_t j = 0; j < pieceConf.nSquares; j++)
+            {
+                if ((footprintMask & (static_cast<uint64_t>(1) << offsets[j])) == 0)
                 {
-                    return true;
+                    footprint[offsets[j]] = validCoords;
+                    footprintMask |= (static_cast<uint64_t>(1) << offsets[j]);
                 }
+                else
+                {
+                    footprint[offsets[j]] |= validCoords;
+                }
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
+    } // for (int8_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+
+    // move the coords where the pieces can be put down to the squares they take
+    for (int32_t i = 0; i < (N_OFFSETS * N_OFFSETS); i++)
+    {
+        if (footprintMask & (static_cast<uint64_t>(1) << i))
+        {
+            out_influenceArea |= a_board.GetShiftedPlane(
+                footprint[i],
+                BOARD_MAX_PLANE_SHIFT - (i / N_OFFSETS),
+                BOARD_MAX_PLANE_SHIFT - (i % N_OFFSETS));
+        }
+    }
+}
+
+bool rules::CanPlayerGo(const Board &a_board, const Player &a_player)
+{
+    if (a_player.NumberOfPiecesAvailable() == 0)
+    {
+        return false;
+    }
+
+    // the piece must touch a nk point or the starting point (as long
+    // as nobody has put down a piece on it)
+    Bitboard mustTouchPlane = a_player.GetNucleationPointsPlane();
+    const Coordinate &startingCoord = a_player.GetStartingCoordinate();
+    if (startingCoord.Initialised() && a_board.IsCoordEmpty(startingCoord))
+    {
+        mustTouchPlane.Set(a_board.CoordToIndex(startingCoord));
+    }
+
+    if (mustTouchPlane.IsEmpty())
+    {
+        return false;
+    }
+
+    const PieceConfTable &confTable = PieceConfTable::Instance();
 
-                nkExists = a_player.GetNextNucleationPointSpiral(nkIterator, thisNkPoint);
-            } // while(nkExists)
-        } // for (pieceCoordIt = coordConfList.begin()
+    Bitboard validCoords;
+    for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
+    {
+        if (a_player.IsPieceAvailable(static_cast<ePieceType_t>(i)) == false)
+        {
+            continue;
+        }
+
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
+        {
+            CalculateValidCoordsInBoard(
+                a_board, a_player, confTable.GetConf(confIt), mustTouchPlane, validCoords);
+
+            if (validCoords.IsEmpty() == false)
+            {
+                return true;
+            }
+        } // for (int32_t confIt = confTable.GetFirstConf(i)
     } // for (int i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
 
     return false;
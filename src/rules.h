@@ -23,6 +23,11 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 07-Sept-2009 Original development
+///           agent              17-Oct-2026  Nucleation points calculated with bit planes
+///           agent              17-Oct-2026  Valid coords calculated with bit planes
+///           agent              17-Oct-2026  Configurations read from PieceConfTable
+///           agent              17-Oct-2026  Valid moves counted with bit planes
+///           agent              17-Oct-2026  Exact influence area calculated with bit planes
 /// @endhistory
 ///
 // ============================================================================
@@ -34,6 +39,7 @@
 #include "piece.h"
 #include "player.h"
 #include "coordinate.h"
+#include "bitboard.h"
 
 /// Size of the valid coords arrays
 const uint8_t VALID_COORDS_SIZE = PIECE_MAX_SQUARES;
@@ -41,6 +47,20 @@ const uint8_t VALID_COORDS_SIZE = PIECE_MAX_SQUARES;
 /// @brief this namespace contains all the methods that define any blockem game
 namespace rules
 {
+    /// @brief a valid move: a configuration of a piece and where to put it down
+    typedef struct
+    {
+        /// type of piece
+        ePieceType_t              pieceType;
+        /// index of pieceConf among the configurations of the piece
+        int8_t                    confIndex;
+        /// configuration of the piece. It points to one of the configurations
+        /// saved in PieceConfTable
+        const PieceConf_t*        pieceConf;
+        /// ABSOLUTE coord where the piece is put down
+        Coordinate                coord;
+    } Move_t;
+
     /// return true if 'a_coord' is touching one of a_player's pieces as
     /// that coord would be an illegal place to put one of a_player's pieces
     /// as it is touching one of its pieces.
@@ -94,6 +114,18 @@ namespace rules
             const Player     &a_player,
             const Coordinate &a_coord);
 
+    /// Calculates using the current state of the board all the nucleation points of
+    /// a player at once. Same as calling IsNucleationPointCompute for every coord of
+    /// the board, but using the bit planes of the board: a nk point is an empty square
+    /// which shares a corner with a square taken by a_player but doesn't share any side
+    /// with them
+    /// @param the player whose nucleation points are being calculated
+    /// @param plane where the nk points of a_player will be saved
+    void CalculateNucleationPointsCompute(
+            const Board  &a_board,
+            const Player &a_player,
+            Bitboard     &out_nkPoints);
+
     /// return true if the piece can be deployed in the position defined by the
     /// 4rdparameter. It checks:
     ///   1) if the space that the piece will occupy is empty (and inside the board)
@@ -191,6 +223,58 @@ namespace rules
             const PieceConfiguration &a_pieceConf,
             std::vector<Coordinate>  &out_validCoords);
 
+    /// @brief calculates at once every coord of the board where a_pieceConf can be deployed
+    /// touching at least one of the squares set in a_mustTouchPlane (the nucleation points of
+    /// a_player, usually). Same result as calling CalculateValidCoordsInNucleationPoint for
+    /// every square of a_mustTouchPlane, with no duplicates, but instead of testing every
+    /// square of the piece per coord whole planes are shifted by the coords of the squares
+    /// of the piece (see Board::GetShiftedPlane):
+    ///   1) coords where a square of the piece lands on a_mustTouchPlane (or'ed)
+    ///   2) coords where every square of the piece is empty (and'ed)
+    ///   3) coords where no square of the forbidden area is taken by a_player (and'ed)
+    /// You MUST ensure the squares set in a_mustTouchPlane are nucleation points of a_player
+    /// (or its starting point) since this function doesn't check it
+    /// it doesn't rotate or mirror the piece
+    /// @param the blockem board
+    /// @param the player who needs the valid coords
+    /// @param the piece configuration
+    /// @param plane with the squares the piece must touch
+    /// @param plane where the coords (see Board::CoordToIndex) where the piece can be
+    ///        deployed will be saved
+    void CalculateValidCoordsInBoard(
+            const Board       &a_board,
+            const Player      &a_player,
+            const PieceConf_t &a_pieceConf,
+            const Bitboard    &a_mustTouchPlane,
+            Bitboard          &out_validCoords);
+
+    /// @brief calculates every valid move of a_player: all the configurations of every
+    /// available piece deployed in every coord where they touch a nucleation point of
+    /// a_player or its starting point (in case it is still empty). Valid coords are
+    /// calculated with CalculateValidCoordsInBoard, so there are no duplicates
+    /// Moves are saved from the biggest piece to the smallest one, configurations in
+    /// the order they are saved in PieceConfTable, and coords from the middle of the
+    /// board to the edges (see Board::GetFirstIndexSpiral)
+    /// @param the blockem board
+    /// @param the player whose moves are calculated
+    /// @param vector where the moves will be saved. It is cleared first
+    /// @return the number of moves saved into out_moves
+    int32_t CalculateValidMoves(
+            const Board         &a_board,
+            const Player        &a_player,
+            std::vector<Move_t> &out_moves);
+
+    /// @brief counts the valid moves of a_player. Same number CalculateValidMoves
+    /// would return, but moves are not saved anywhere (the bits of the planes
+    /// calculated by CalculateValidCoordsInBoard are just counted), so it doesn't
+    /// allocate any memory
+    /// @param the blockem board
+    /// @param the player whose moves are counted
+    /// @return the number of valid moves of a_player
+    int32_t CountValidMoves(
+            const Board  &a_board,
+            const Player &a_player);
+
     /// @brief Retrieve next valid coord to deploy a_pieceConf in a_nkPointCoord
     /// It is based on the old CalculateValidCoordsInNucleationPoint:
     /// Pieces are described in such a way that the middle of the piece (0,0) is always a square and
@@ -312,10 +396,10 @@ namespace rules
     /// @param configuration of the piece deployed
     /// @param reference to the player whose influence area will be changed
     void RecalculateInfluenceAreaAroundPieceFast(
-            const Board              &a_board,
-            const Coordinate         &a_coord,
-            const PieceConfiguration &a_pieceConf,
-            Player                   &a_player);
+            const Board       &a_board,
+            const Coordinate  &a_coord,
+            const PieceConf_t &a_pieceConf,
+            Player            &a_player);
 
     /// computes if a_coord belongs to the influence area of a_player
     /// It uses the "fast" way (see RecalculateInfluenceAreaAroundPieceFast)
@@ -332,12 +416,38 @@ namespace rules
     /// point of the player trying to allocate all his pieces left. A coordinate will belong
     /// to the influence area if a piece can be allocated "in" it (that is, a square of any piece
     /// will be set in that specific coordinate)
+    /// It uses CalculateInfluenceAreaInBoard. Game1v1 searches evaluated with
+    /// Heuristic::CalculateInfluenceAreaExact call it for both players every time a piece
+    /// is put down (see Game1v1::eInfluenceAreaUpdate_t)
     /// @param the board
     /// @param reference to the player whose influence area will be changed
     void RecalculateInfluenceAreaInBoard(
         const Board &a_board,
         Player      &a_player);
 
+    /// @brief same as RecalculateInfluenceAreaInBoard, but it tries every configuration
+    /// of every piece left in every nucleation point one by one (slow). Kept to check
+    /// CalculateInfluenceAreaInBoard against it
+    void RecalculateInfluenceAreaInBoardCompute(
+        const Board &a_board,
+        Player      &a_player);
+
+    /// @brief calculates the exact influence area of a_player with bit planes: the OR of
+    /// the squares of every valid move of a_player (see CalculateValidMoves), so the
+    /// starting point counts as a nk point as long as it is empty. The valid coords of each
+    /// configuration are calculated as in CalculateValidCoordsInBoard, and then shifted back
+    /// by the coords of each square of the piece. Instead of checking the forbidden area the
+    /// squares of the piece must not touch a_player, and many configurations shift the same
+    /// planes by the same offsets, so each plane is shifted by each offset only once
+    /// It doesn't read nor modify the influence area saved in a_player
+    /// @param the board
+    /// @param the player whose influence area is calculated
+    /// @param plane where the influence area will be saved
+    void CalculateInfluenceAreaInBoard(
+        const Board  &a_board,
+        const Player &a_player,
+        Bitboard     &out_influenceArea);
+
     /// @return true if the 'a_player' can put down at least one piece on the board
     /// bear in mind it uses some of the properties saved in the 2nd parameter (a_player)
     bool CanPlayerGo(const Board &a_board, const Player &a_player);
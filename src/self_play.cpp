@@ -0,0 +1,387 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  self_play.cpp
+/// @brief Complete 1vs1 games played by 2 AIs against each other
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <sstream>
+#include <locale>
+#include <vector>
+#include <cstdio>   // snprintf
+#include "self_play.h"
+#include "game1v1.h"
+#include "rules.h"
+
+SelfPlay::SelfPlay(
+    const AIConfig_t &a_ai1,
+    const AIConfig_t &a_ai2,
+    int32_t           a_transTableSizeMB) :
+    m_ai1(a_ai1),
+    m_ai2(a_ai2),
+    m_transTableSizeMB(a_transTableSizeMB)
+{
+#ifdef DEBUG
+    assert( (m_ai1.heuristicType >= Heuristic::e_heuristicStartCount) &&
+            (m_ai1.heuristicType <  Heuristic::e_heuristicCount) );
+    assert( (m_ai2.heuristicType >= Heuristic::e_heuristicStartCount) &&
+            (m_ai2.heuristicType <  Heuristic::e_heuristicCount) );
+    assert(m_ai1.depth > 0);
+    assert(m_ai2.depth > 0);
+#endif
+}
+
+SelfPlay::~SelfPlay()
+{
+}
+
+void SelfPlay::Run(int32_t a_nGames, int32_t a_nThreads, std::ostream &a_outStream) const
+{
+    if (a_nThreads > SELF_PLAY_MAX_THREADS)
+    {
+        a_nThreads = SELF_PLAY_MAX_THREADS;
+    }
+    if (a_nThreads > a_nGames)
+    {
+        // no point on spawning threads that won't have anything to do
+        a_nThreads = a_nGames;
+    }
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    // SINGLETON creation is not thread safe. Ensure the table of configurations
+    // is instantiated before the worker threads are created
+    PieceConfTable::Instance();
+
+    RunData_t runData;
+    runData.selfPlay  = this;
+    runData.nGames    = a_nGames;
+    runData.mutex     = g_mutex_new();
+    runData.outStream = &a_outStream;
+    runData.nextGame  = 0;
+
+#ifdef DEBUG
+    assert(runData.mutex != NULL);
+#endif
+
+    GThread* workerThreads[SELF_PLAY_MAX_THREADS];
+    int32_t nThreadsCreated = 0;
+    // 1 game at a time is played in the calling thread
+    for (int32_t i = 0; (a_nThreads > 1) && (i < a_nThreads); i++)
+    {
+        GError* err = NULL;
+        workerThreads[nThreadsCreated] = g_thread_create(
+                reinterpret_cast<GThreadFunc>(SelfPlay::RunThreadRoutine),
+                reinterpret_cast<void*>(&runData),
+                TRUE, // joinable
+                &err);
+
+        if (workerThreads[nThreadsCreated] == NULL)
+        {
+            // the rest of threads will have to do the job of this one
+            g_error_free(err);
+            continue;
+        }
+
+        nThreadsCreated++;
+    }
+
+    if (nThreadsCreated == 0)
+    {
+        // no thread was created. Current thread will play all the games
+        RunThreadRoutine(reinterpret_cast<void*>(&runData));
+    }
+
+    for (int32_t i = 0; i < nThreadsCreated; i++)
+    {
+        g_thread_join(workerThreads[i]);
+    }
+
+    g_mutex_free(runData.mutex);
+}
+
+void* SelfPlay::RunThreadRoutine(void *a_threadParam)
+{
+    RunData_t* runData = reinterpret_cast<RunData_t*>(a_threadParam);
+
+    // each thread reuses its own tables for all the games it plays
+    TranspositionTable transTableAI1(runData->selfPlay->m_transTableSizeMB);
+    TranspositionTable transTableAI2(runData->selfPlay->m_transTableSizeMB);
+
+    std::string jsonLine;
+    while (true)
+    {
+        g_mutex_lock(runData->mutex);
+        int32_t thisGame = runData->nextGame++;
+        g_mutex_unlock(runData->mutex);
+
+        if (thisGame >= runData->nGames)
+        {
+            // no more games to be played
+            break;
+        }
+
+        runData->selfPlay->PlayGame(thisGame, transTableAI1, transTableAI2, jsonLine);
+
+        g_mutex_lock(runData->mutex);
+        (*(runData->outStream)) << jsonLine << std::endl;
+        g_mutex_unlock(runData->mutex);
+    }
+
+    return NULL;
+}
+
+void SelfPlay::PlayGame(
+    int32_t            a_gameIndex,
+    TranspositionTable &a_transTableAI1,
+    TranspositionTable &a_transTableAI2,
+    std::string        &out_jsonLine) const
+{
+    // AI 1 is player1 in even games
+    const AIConfig_t* ai[2];
+    TranspositionTable* transTable[2];
+    int32_t aiNumber[2];
+    if ((a_gameIndex & 0x01) == 0)
+    {
+        ai[0]         = &m_ai1;
+        ai[1]         = &m_ai2;
+        transTable[0] = &a_transTableAI1;
+        transTable[1] = &a_transTableAI2;
+        aiNumber[0]   = 1;
+        aiNumber[1]   = 2;
+    }
+    else
+    {
+        ai[0]         = &m_ai2;
+        ai[1]         = &m_ai1;
+        transTable[0] = &a_transTableAI2;
+        transTable[1] = &a_transTableAI1;
+        aiNumber[0]   = 2;
+        aiNumber[1]   = 1;
+    }
+
+    // entries saved by previous games would make the result of this one
+    // depend on the games played before by this thread
+    a_transTableAI1.Clear();
+    a_transTableAI2.Clear();
+
+    // both games of a pair (same opening, swapped colours) use the same seed
+    GRand* randomizer = g_rand_new_with_seed(static_cast<guint32>(a_gameIndex / 2));
+    GTimer* timer = g_timer_new();
+
+    // no one will ask the search to stop
+    volatile sig_atomic_t dummyAtomic = 0;
+
+    Game1v1 theGame;
+    Game1v1::eGame1v1Player_t whoMoves = Game1v1::e_Game1v1Player1;
+    Piece lastPiece(e_noPiece);
+    Coordinate lastCoord;
+    std::vector<rules::Move_t> validMoves;
+
+    // JSON strings are saved with a '.' as decimal separator whatever the locale is
+    std::ostringstream jsonStream;
+    jsonStream.imbue(std::locale::classic());
+
+    std::string jsonName;
+    jsonStream << "{\"game\":" << a_gameIndex;
+    for (int32_t i = 0; i < 2; i++)
+    {
+        JSONString(Heuristic::m_heuristicData[ai[i]->heuristicType].m_name, jsonName);
+        jsonStream << ",\"player" << (i + 1) << "\":{"
+                   << "\"ai\":"         << aiNumber[i]    << ","
+                   << "\"heuristic\":"  << jsonName       << ","
+                   << "\"depth\":"      << ai[i]->depth   << "}";
+    }
+    jsonStream << ",\"moves\":[";
+
+    uint64_t totalNodes = 0;
+    gdouble totalMs = 0.0;
+    int32_t nMoves = 0;
+    int32_t nPassesInARow = 0;
+    while (nPassesInARow < 2)
+    {
+        int32_t playerIndex = (whoMoves == Game1v1::e_Game1v1Player1) ? 0 : 1;
+        const Player &thisPlayer = theGame.GetPlayer(whoMoves);
+
+        Piece resultPiece(e_noPiece);
+        Coordinate resultCoord;
+        int32_t value = 0;
+        uint64_t nodes = 0;
+
+        g_timer_start(timer);
+        if (thisPlayer.NumberOfPiecesAvailable() == e_numberOfPieces)
+        {
+            // random opening
+            int32_t nValidMoves = rules::CalculateValidMoves(
+                                        theGame.GetBoard(),
+                                        thisPlayer,
+                                        validMoves);
+            if (nValidMoves > 0)
+            {
+                const rules::Move_t &thisMove =
+                    validMoves[g_rand_int_range(randomizer, 0, nValidMoves)];
+
+                resultPiece = thisPlayer.m_pieces[thisMove.pieceType];
+                resultPiece.SetCurrentConfiguration(*(thisMove.pieceConf->pieceConf));
+                resultCoord = thisMove.coord;
+            }
+        }
+        else if (rules::CanPlayerGo(theGame.GetBoard(), thisPlayer))
+        {
+            value = theGame.MinMax(
+                        Heuristic::m_heuristicData[ai[playerIndex]->heuristicType].m_evalFunction,
+                        ai[playerIndex]->depth,
+                        whoMoves,
+                        resultPiece,
+                        resultCoord,
+                        dummyAtomic,
+                        lastCoord,
+                        lastPiece,
+                        1,
+                        (transTable[playerIndex]->GetSizeMB() > 0) ?
+                            transTable[playerIndex] : NULL);
+            nodes = theGame.GetSearchStats().nodes;
+        }
+        gdouble elapsedMs = g_timer_elapsed(timer, NULL) * 1000;
+
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            // this player can't put down any more pieces
+            nPassesInARow++;
+        }
+        else
+        {
+            nPassesInARow = 0;
+
+            theGame.PutDownPiece(resultPiece, resultCoord, whoMoves);
+
+            JSONString(Piece::GetPieceDescription(resultPiece.GetType()), jsonName);
+            jsonStream << ((nMoves > 0) ? "," : "")
+                       << "{\"player\":" << (playerIndex + 1)
+                       << ",\"piece\":"  << jsonName
+                       << ",\"squares\":[";
+            for (int32_t i = 0; i < static_cast<int32_t>(resultPiece.GetNSquares()); i++)
+            {
+                jsonStream << ((i > 0) ? "," : "")
+                           << "[" << (resultCoord.m_row + resultPiece.GetCoord(i).m_row)
+                           << "," << (resultCoord.m_col + resultPiece.GetCoord(i).m_col)
+                           << "]";
+            }
+            jsonStream << "],\"value\":" << value
+                       << ",\"nodes\":"  << nodes
+                       << ",\"ms\":"     << elapsedMs
+                       << "}";
+
+            nMoves++;
+            lastPiece = resultPiece;
+            lastCoord = resultCoord;
+        }
+
+        totalNodes += nodes;
+        totalMs    += elapsedMs;
+
+        whoMoves = (whoMoves == Game1v1::e_Game1v1Player1) ?
+                        Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    } // while (nPassesInARow < 2)
+
+    // calculate the number of squares left
+    int32_t squaresLeft[2] = {0, 0};
+    for (int32_t i = 0; i < 2; i++)
+    {
+        const Player &thisPlayer = theGame.GetPlayer(
+            (i == 0) ? Game1v1::e_Game1v1Player1 : Game1v1::e_Game1v1Player2);
+
+        for (int8_t j = e_minimumPieceIndex ; j < e_numberOfPieces; j++)
+        {
+            if (thisPlayer.IsPieceAvailable(static_cast<ePieceType_t>(j)))
+            {
+                squaresLeft[i] += thisPlayer.m_pieces[j].GetNSquares();
+            }
+        }
+    }
+
+    int32_t winner = 0;
+    if (squaresLeft[0] < squaresLeft[1])
+    {
+        winner = 1;
+    }
+    else if (squaresLeft[1] < squaresLeft[0])
+    {
+        winner = 2;
+    }
+
+    jsonStream << "],\"squares_left\":{"
+               << "\"player1\":"  << squaresLeft[0]
+               << ",\"player2\":" << squaresLeft[1]
+               << "},\"winner\":" << winner
+               << ",\"nodes\":"   << totalNodes
+               << ",\"ms\":"      << totalMs
+               << "}";
+
+    g_timer_destroy(timer);
+    g_rand_free(randomizer);
+
+    out_jsonLine = jsonStream.str();
+}
+
+void SelfPlay::JSONString(const char* a_string, std::string &out_string)
+{
+    out_string = "\"";
+    for (const char* it = a_string; *it != '\0'; it++)
+    {
+        switch (*it)
+        {
+        case '"':
+        {
+            out_string += "\\\"";
+            break;
+        }
+        case '\\':
+        {
+            out_string += "\\\\";
+            break;
+        }
+        default:
+        {
+            if (static_cast<unsigned char>(*it) < 0x20)
+            {
+                // control characters must be escaped
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(*it));
+                out_string += escaped;
+            }
+            else
+            {
+                out_string += *it;
+            }
+        }
+        } // switch (*it)
+    }
+    out_string += "\"";
+}
@@ -0,0 +1,147 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  self_play.h
+/// @brief Complete 1vs1 games played by 2 AIs against each other
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef SELF_PLAY_H_
+#define SELF_PLAY_H_
+
+#include <string>
+#include <ostream>
+#include <glib.h>   // glib-2.0/glib.h (threads used to play several games at once)
+#include "heuristic.h"
+#include "transposition_table.h"
+
+/// maximum number of games SelfPlay can play at the same time
+const int32_t SELF_PLAY_MAX_THREADS = 64;
+
+/// @brief plays complete 1vs1 games between 2 AIs
+/// Each AI is a heuristic and the depth of its search tree. AI 1 moves first
+/// (it is player1) in even games and second in odd ones. The first move of each
+/// player is picked at random among all the valid ones (every AI calculates the
+/// same first move otherwise, and all the games would be the same). Random numbers
+/// are seeded with the index of the game divided by 2, so both AIs play the same
+/// opening with both colours, and the result of a game doesn't depend on how many
+/// of them are played at the same time
+///
+/// Games don't need a display. Each one of them is described by a JSON object
+/// written in a single line:
+///   {"game":0,
+///    "player1":{"ai":1,"heuristic":"Influence Area","depth":3},
+///    "player2":{"ai":2,"heuristic":"Simple","depth":1},
+///    "moves":[{"player":1,"piece":"Cross piece","squares":[[4,5],[3,5],...],
+///              "value":0,"nodes":0,"ms":0.012}, ...],
+///    "squares_left":{"player1":3,"player2":10},
+///    "winner":1,"nodes":123456,"ms":1234.5}
+/// "winner" is the player (1 or 2) with less squares left, or 0 if it is a draw.
+/// "value" is the value of the evaluation function returned by MinMax, "nodes"
+/// the number of nodes it searched and "ms" the time it took, in milliseconds.
+/// Players who can't put down any more pieces just pass, and passes are not saved
+class SelfPlay
+{
+public:
+    /// @brief one of the AIs that play against each other
+    typedef struct
+    {
+        /// heuristic the AI evaluates positions with. Index in Heuristic::m_heuristicData
+        Heuristic::eHeuristicType_t heuristicType;
+        /// depth of the search tree
+        int32_t                     depth;
+    } AIConfig_t;
+
+    /// @param AI 1
+    /// @param AI 2
+    /// @param size (in MB) of the transposition table of each AI. 0 disables it
+    SelfPlay(
+        const AIConfig_t &a_ai1,
+        const AIConfig_t &a_ai2,
+        int32_t           a_transTableSizeMB);
+    virtual ~SelfPlay();
+
+    /// @brief plays a_nGames complete games
+    /// a_nThreads games are played at the same time (each one of them with a
+    /// 1-thread search). The JSON line of each game is written into a_outStream as
+    /// soon as the game is finished, so lines are not sorted by game index unless
+    /// a_nThreads is 1
+    /// @param number of games to be played
+    /// @param number of games played at the same time. Capped to SELF_PLAY_MAX_THREADS
+    /// @param stream where the result of the games will be written
+    void Run(int32_t a_nGames, int32_t a_nThreads, std::ostream &a_outStream) const;
+
+    /// @brief plays the game a_gameIndex
+    /// Transposition tables are cleared before the game starts
+    /// @param index of the game. It picks who moves first and the random opening
+    /// @param transposition table used by AI 1. Its size is not changed
+    /// @param transposition table used by AI 2. Its size is not changed
+    /// @param string where the JSON line of the game (with no '\n') will be saved
+    void PlayGame(
+        int32_t            a_gameIndex,
+        TranspositionTable &a_transTableAI1,
+        TranspositionTable &a_transTableAI2,
+        std::string        &out_jsonLine) const;
+
+private:
+    /// AI 1
+    AIConfig_t m_ai1;
+
+    /// AI 2
+    AIConfig_t m_ai2;
+
+    /// size of the transposition tables (in MB)
+    int32_t m_transTableSizeMB;
+
+    /// @brief data shared by all the worker threads of Run
+    /// everything below m_mutex (included) must be accessed holding the mutex
+    typedef struct
+    {
+        /// the games will be played by this object
+        const SelfPlay* selfPlay;
+        /// number of games to be played
+        int32_t         nGames;
+
+        /// protects the rest of the members of the structure
+        GMutex*         mutex;
+        /// stream where the lines of the games are written
+        std::ostream*   outStream;
+        /// index of the next game to be played
+        int32_t         nextGame;
+    } RunData_t;
+
+    /// The routine run by the worker threads of Run. It plays games till there
+    /// are no more of them to be played
+    /// @param pointer to a RunData_t structure
+    /// @return NULL
+    static void* RunThreadRoutine(void *a_threadParam);
+
+    /// @brief saves into out_string a_string as a JSON string (quotes included)
+    static void JSONString(const char* a_string, std::string &out_string);
+
+    // prevent this class to be instantiated without the proper arguments
+    SelfPlay();
+};
+
+#endif /* SELF_PLAY_H_ */
@@ -0,0 +1,116 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  allocation_counter.cpp
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <cstdlib> // malloc, free
+#include <new>     // std::bad_alloc
+#include <glib.h>  // glib-2.0/glib.h (atomic operations)
+#include "allocation_counter.h"
+
+/// non-zero while allocations are being counted
+static volatile gint g_counting = 0;
+/// number of allocations made since allocationcounter::Start was called
+static volatile gint g_nAllocations = 0;
+
+/// @brief counts one allocation (if allocations are being counted) and allocates a_size bytes
+/// @return the memory allocated. NULL if it couldn't be allocated
+static void* CountedAlloc(std::size_t a_size)
+{
+    if (g_atomic_int_get(&g_counting))
+    {
+        g_atomic_int_inc(&g_nAllocations);
+    }
+
+    return std::malloc((a_size > 0) ? a_size : 1);
+}
+
+// every replaceable version of operator new and delete is replaced. The standard
+// doesn't guarantee the array and nothrow versions call the single-object ones
+void* operator new(std::size_t a_size) throw(std::bad_alloc)
+{
+    void* ptr = CountedAlloc(a_size);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void* operator new[](std::size_t a_size) throw(std::bad_alloc)
+{
+    void* ptr = CountedAlloc(a_size);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+
+    return ptr;
+}
+
+void* operator new(std::size_t a_size, const std::nothrow_t&) throw()
+{
+    return CountedAlloc(a_size);
+}
+
+void* operator new[](std::size_t a_size, const std::nothrow_t&) throw()
+{
+    return CountedAlloc(a_size);
+}
+
+void operator delete(void* a_ptr) throw()
+{
+    std::free(a_ptr);
+}
+
+void operator delete[](void* a_ptr) throw()
+{
+    std::free(a_ptr);
+}
+
+void operator delete(void* a_ptr, const std::nothrow_t&) throw()
+{
+    std::free(a_ptr);
+}
+
+void operator delete[](void* a_ptr, const std::nothrow_t&) throw()
+{
+    std::free(a_ptr);
+}
+
+void allocationcounter::Start()
+{
+    g_atomic_int_set(&g_nAllocations, 0);
+    g_atomic_int_set(&g_counting, 1);
+}
+
+int32_t allocationcounter::Stop()
+{
+    g_atomic_int_set(&g_counting, 0);
+    return static_cast<int32_t>(g_atomic_int_get(&g_nAllocations));
+}
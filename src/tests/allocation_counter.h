@@ -0,0 +1,52 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  allocation_counter.h
+/// @brief counts the memory allocations made by the test program
+///
+/// The global operators new and delete of the test program (single-object, array
+/// and nothrow versions) are replaced (see allocation_counter.cpp) so tests can check how many times a piece of code
+/// allocates memory. The search algorithms must not allocate any memory
+/// once they are running
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef ALLOCATION_COUNTER_H_
+#define ALLOCATION_COUNTER_H_
+
+#include <stdint.h> // for types
+
+/// this namespace contains the functions to count memory allocations
+namespace allocationcounter
+{
+    /// @brief resets the counter and starts counting allocations made by operator new
+    /// and new[] (any thread, nothrow versions included). Memory allocated by C functions such as malloc is not counted
+    void Start();
+
+    /// @brief stops counting allocations
+    /// @return number of allocations made since Start was called
+    int32_t Stop();
+} // namespace allocationcounter
+
+#endif /* ALLOCATION_COUNTER_H_ */
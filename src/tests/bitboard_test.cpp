@@ -0,0 +1,288 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  bitboard_test.cpp
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Weighted popcount kernels test
+/// @endhistory
+///
+// ============================================================================
+
+#include <stdlib.h> // rand
+#include "bitboard_test.h"
+#ifdef DEBUG_PRINT
+#include <iostream>
+#endif
+
+BitboardTest::BitboardTest()
+{
+}
+
+BitboardTest::~BitboardTest()
+{
+}
+
+void BitboardTest::DoTest()
+{
+    // all other test functions are called from this one
+    TestSetAndCount();
+    TestNextSetBit();
+    TestShifts();
+    TestWeightedPopCount();
+}
+
+void BitboardTest::TestSetAndCount()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    Bitboard plane;
+    assert(plane.IsEmpty());
+    assert(plane.PopCount() == 0);
+
+    // bits at the limits of every word
+    for (int32_t i = 0; i < BITBOARD_N_WORDS; i++)
+    {
+        plane.Set(i * 64);
+        plane.Set((i * 64) + 63);
+    }
+    assert(!plane.IsEmpty());
+    assert(plane.PopCount() == (2 * BITBOARD_N_WORDS));
+
+    for (int32_t i = 0; i < BITBOARD_N_BITS; i++)
+    {
+        bool expected = ((i % 64) == 0) || ((i % 64) == 63);
+        assert(plane.IsSet(i) == expected);
+    }
+
+    // setting a bit twice doesn't change anything
+    plane.Set(0);
+    assert(plane.PopCount() == (2 * BITBOARD_N_WORDS));
+
+    plane.Unset(0);
+    plane.Unset(0);
+    assert(!plane.IsSet(0));
+    assert(plane.PopCount() == ((2 * BITBOARD_N_WORDS) - 1));
+
+    plane.Clear();
+    assert(plane.IsEmpty());
+
+    // 14x14 and 20x20 boards
+    plane.SetLowest(14 * 14);
+    assert(plane.PopCount() == (14 * 14));
+    assert(plane.IsSet((14 * 14) - 1));
+    assert(!plane.IsSet(14 * 14));
+    assert(plane.GetWord(3) != 0);
+    assert(plane.GetWord(4) == 0);
+
+    plane.SetLowest(20 * 20);
+    assert(plane.PopCount() == (20 * 20));
+    assert(plane.IsSet((20 * 20) - 1));
+    assert(!plane.IsSet(20 * 20));
+
+    plane.SetLowest(BITBOARD_N_BITS);
+    assert(plane.PopCount() == BITBOARD_N_BITS);
+    assert((~plane).IsEmpty());
+
+    plane.SetLowest(0);
+    assert(plane.IsEmpty());
+
+    // coordinates and indexes
+    Coordinate coord;
+    assert(Bitboard::CoordToIndex(Coordinate(0, 0), 14) == 0);
+    assert(Bitboard::CoordToIndex(Coordinate(1, 0), 14) == 14);
+    assert(Bitboard::CoordToIndex(Coordinate(19, 19), 20) == 399);
+    Bitboard::IndexToCoord(399, 20, coord);
+    assert( (coord.m_row == 19) && (coord.m_col == 19) );
+    Bitboard::IndexToCoord(15, 14, coord);
+    assert( (coord.m_row == 1) && (coord.m_col == 1) );
+}
+
+void BitboardTest::TestNextSetBit()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    Bitboard plane;
+    assert(plane.NextSetBit(0) == -1);
+
+    const int32_t bits[] = {0, 1, 63, 64, 130, 255, 256, 399, 511};
+    const int32_t nBits = sizeof(bits) / sizeof(bits[0]);
+    for (int32_t i = 0; i < nBits; i++)
+    {
+        plane.Set(bits[i]);
+    }
+
+    int32_t count = 0;
+    int32_t index = plane.NextSetBit(0);
+    while (index >= 0)
+    {
+        assert(count < nBits);
+        assert(index == bits[count]);
+        count++;
+
+        index = plane.NextSetBit(index + 1);
+    }
+    assert(count == nBits);
+
+    // starting in the middle of a word
+    assert(plane.NextSetBit(2) == 63);
+    assert(plane.NextSetBit(131) == 255);
+    assert(plane.NextSetBit(400) == 511);
+
+    // out of the plane
+    assert(plane.NextSetBit(BITBOARD_N_BITS) == -1);
+    assert(plane.NextSetBit(-1) == -1);
+
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        assert(Bitboard::LowestBit64(static_cast<uint64_t>(1) << i) == static_cast<int32_t>(i));
+        assert(Bitboard::PopCount64((static_cast<uint64_t>(1) << i) - 1) == static_cast<int32_t>(i));
+    }
+}
+
+void BitboardTest::TestShifts()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    Bitboard plane;
+    plane.Set(0);
+    plane.Set(63);
+    plane.Set(200);
+
+    // shifts smaller than a word, crossing a word and bigger than a word
+    const int32_t shifts[] = {0, 1, 14, 20, 64, 65, 130};
+    const int32_t nShifts = sizeof(shifts) / sizeof(shifts[0]);
+    for (int32_t i = 0; i < nShifts; i++)
+    {
+        Bitboard up   = plane << shifts[i];
+        Bitboard down = up >> shifts[i];
+        assert(down == plane);
+
+        for (int32_t bit = 0; bit < BITBOARD_N_BITS; bit++)
+        {
+            bool expected = (bit >= shifts[i]) && plane.IsSet(bit - shifts[i]);
+            assert(up.IsSet(bit) == expected);
+        }
+    }
+
+    // bits moved out of the plane are lost
+    Bitboard top;
+    top.Set(BITBOARD_N_BITS - 1);
+    assert((top << 1).IsEmpty());
+    assert((plane >> 1).PopCount() == 2);
+
+    // bitwise operators
+    Bitboard other;
+    other.Set(0);
+    other.Set(1);
+    assert((plane & other).PopCount() == 1);
+    assert((plane | other).PopCount() == 4);
+    assert((plane ^ other).PopCount() == 3);
+    assert((plane & ~other).PopCount() == 2);
+    assert((plane & ~other).IsSet(63));
+    assert(plane != other);
+
+    other = plane;
+    assert(plane == other);
+    other ^= plane;
+    assert(other.IsEmpty());
+}
+
+void BitboardTest::TestWeightedPopCount()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // the scalar kernel is always there, and it is the one every other is checked against
+    assert(weightedpopcount::IsKernelSupported(weightedpopcount::e_kernelScalar));
+    assert(weightedpopcount::IsKernelSupported(weightedpopcount::GetKernel()));
+
+    Bitboard planes[WEIGHTED_POPCOUNT_MAX_PLANES];
+    int32_t  weights[WEIGHTED_POPCOUNT_MAX_PLANES];
+
+    // every bit of every word set, with the biggest and negative weights
+    for (int32_t i = 0; i < WEIGHTED_POPCOUNT_MAX_PLANES; i++)
+    {
+        planes[i] = ~Bitboard();
+        weights[i] = (i % 2) ? -8 : 7;
+    }
+
+    for (int32_t kernel = weightedpopcount::e_kernelScalar;
+         kernel < weightedpopcount::e_kernelCount;
+         kernel++)
+    {
+        weightedpopcount::eKernel_t thisKernel = static_cast<weightedpopcount::eKernel_t>(kernel);
+        if (!weightedpopcount::IsKernelSupported(thisKernel))
+        {
+            continue;
+        }
+
+        assert(weightedpopcount::Calculate(thisKernel, planes, weights, 0) == 0);
+        assert(weightedpopcount::Calculate(thisKernel, planes, weights, 1) ==
+                (7 * BITBOARD_N_BITS));
+        assert(weightedpopcount::Calculate(thisKernel, planes, weights, WEIGHTED_POPCOUNT_MAX_PLANES) ==
+                (-(WEIGHTED_POPCOUNT_MAX_PLANES / 2) * BITBOARD_N_BITS));
+    }
+
+    // random planes and weights
+    for (int32_t test = 0; test < 1000; test++)
+    {
+        int32_t nPlanes = 1 + (rand() % WEIGHTED_POPCOUNT_MAX_PLANES);
+        int32_t expected = 0;
+        for (int32_t i = 0; i < nPlanes; i++)
+        {
+            planes[i].Clear();
+            int32_t nBits = rand() % BITBOARD_N_BITS;
+            for (int32_t j = 0; j < nBits; j++)
+            {
+                planes[i].Set(rand() % BITBOARD_N_BITS);
+            }
+            weights[i] = (rand() % 33) - 16;
+            expected += weights[i] * planes[i].PopCount();
+        }
+
+        for (int32_t kernel = weightedpopcount::e_kernelScalar;
+             kernel < weightedpopcount::e_kernelCount;
+             kernel++)
+        {
+            weightedpopcount::eKernel_t thisKernel =
+                static_cast<weightedpopcount::eKernel_t>(kernel);
+            if (weightedpopcount::IsKernelSupported(thisKernel))
+            {
+                assert(weightedpopcount::Calculate(thisKernel, planes, weights, nPlanes) == expected);
+            }
+        }
+        assert(weightedpopcount::Calculate(planes, weights, nPlanes) == expected);
+    }
+
+#ifdef DEBUG_PRINT
+    std::cout << "  kernel: " << weightedpopcount::GetKernelName(weightedpopcount::GetKernel())
+              << std::endl;
+#endif
+}
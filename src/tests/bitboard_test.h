@@ -0,0 +1,61 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  bitboard_test.h
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef BITBOARD_TEST_H_
+#define BITBOARD_TEST_H_
+
+#include "bitboard.h"
+#include "weighted_popcount.h"
+
+/// @brief regression testing for the Bitboard class
+class BitboardTest
+{
+public:
+    BitboardTest();
+    virtual ~BitboardTest();
+
+    /// launches the Bitboard test!
+    void DoTest();
+
+private:
+    /// tests setting, unsetting and counting bits
+    void TestSetAndCount();
+
+    /// tests NextSetBit goes through every bit set in order
+    void TestNextSetBit();
+
+    /// tests shifts and bitwise operators, specially across words
+    void TestShifts();
+
+    /// tests every kernel of weightedpopcount supported by the CPU returns the
+    /// same weighted sum as the scalar one
+    void TestWeightedPopCount();
+};
+
+#endif /* BITBOARD_TEST_H_ */
@@ -106,18 +106,13 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
             continue;
         }
 
-        const std::list<uint64_t> &pieceConfigurations = m_player1.m_pieces[i].GetBitwiseList();
-        std::list<uint64_t>::const_iterator it = pieceConfigurations.begin();
-
         // retrieve legacy precalculated coords
-        const std::list<PieceConfiguration> &pieceConfList =
-            m_player1.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        const PieceConfTable &confTable = PieceConfTable::Instance();
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
+            const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
             // current coordinate being studied
             Coordinate thisCoord(0, 0);
 
@@ -127,7 +122,7 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
             uint64_t bitwiseBoardPlayer1;
             bitwise::BoardCalculate(m_board, thisCoord, m_player1, bitwiseBoard, bitwiseBoardPlayer1);
             // bitwise representation of current piece
-            uint64_t bPiece = (*it);
+            uint64_t bPiece = confTable.GetConf(confIt).bitwise;
 
             // the following loop goes trough the board doing a S-like movement.
             // it goes from left to right, then down, then right to left, then down,
@@ -141,7 +136,7 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
                     // check
                     TestBitwiseCheckConfiguration(
                         thisCoord,
-                        *pieceConfIt,
+                        pieceConf,
                         bPiece,
                         bitwiseBoard,
                         bitwiseBoardPlayer1);
@@ -152,7 +147,7 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
                 // check
                 TestBitwiseCheckConfiguration(
                     thisCoord,
-                    *pieceConfIt,
+                    pieceConf,
                     bPiece,
                     bitwiseBoard,
                     bitwiseBoardPlayer1);
@@ -174,7 +169,7 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
                     // check
                     TestBitwiseCheckConfiguration(
                         thisCoord,
-                        *pieceConfIt,
+                        pieceConf,
                         bPiece,
                         bitwiseBoard,
                         bitwiseBoardPlayer1);
@@ -185,7 +180,7 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
                 //check
                 TestBitwiseCheckConfiguration(
                     thisCoord,
-                    *pieceConfIt,
+                    pieceConf,
                     bPiece,
                     bitwiseBoard,
                     bitwiseBoardPlayer1);
@@ -200,15 +195,7 @@ void BitwiseTest::TestBoardAndPiecesBitwise(int32_t a_nUsedPieces, ePieceType_t
                 thisCoord.m_row++;
             } // while (true)
 
-            // next bitwise representation (rotate right)
-            // if it is the latest rotation and the piece can be mirrored
-            // it'll represent the piece mirrored
-            it++;
-
-        } // for (pieceCoordIt = coordConfList.begin()
-
-        // asserting we checked all possible configurations
-        assert(it == pieceConfigurations.end());
+        } // for (confIt = confTable.GetFirstConf(i)
 
     } // for (int i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
 
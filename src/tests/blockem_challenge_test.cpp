@@ -76,6 +76,10 @@ void BlockemChallengeTest::DoTest()
     assert(!TryLoadXMLChallenge(CHALLENGE_DIR"/challenge_board_ncolumns_invalid.xml"));
     // "blockem_challenge" bogus "board"->"ncolumns" tag
     assert(!TryLoadXMLChallenge(CHALLENGE_DIR"/challenge_board_ncolumns_negative.xml"));
+    // "blockem_challenge" "board"->"nrows" tag bigger than BOARD_MAX_ROWS
+    assert(!TryLoadXMLChallenge(CHALLENGE_DIR"/challenge_board_nrows_toobig.xml"));
+    // "blockem_challenge" "board"->"ncolumns" tag bigger than BOARD_MAX_COLUMNS
+    assert(!TryLoadXMLChallenge(CHALLENGE_DIR"/challenge_board_ncolumns_toobig.xml"));
 
     // "blockem_challenge" doesn't have "opponent" tag
     assert(!TryLoadXMLChallenge(CHALLENGE_DIR"/challenge_opponent_no.xml"));
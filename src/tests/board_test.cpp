@@ -23,6 +23,9 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 15-Jul-2010  Original development
+///           agent              17-Oct-2026  Bit planes test
+///           agent              17-Oct-2026  Shifted planes and spiral iteration test
+///           agent              17-Oct-2026  Circular weight slices test
 /// @endhistory
 ///
 // ============================================================================
@@ -31,8 +34,11 @@
 #include <iostream>
 #endif
 
+#include <stdlib.h> // rand
+#include <string.h> // memcpy
 #include "board_test.h"
 #include "player.h"
+#include "rules.h"
 
 #define ROWS    14
 #define COLUMNS 14
@@ -53,6 +59,15 @@ void BoardTest::DoTest()
     TestCopyBoard();
 
     TestCreateBoardFromArray();
+
+    // tests planes against the square by square accessors
+    TestBitPlanes();
+
+    // tests planes moved around and iterated from the middle of the board
+    TestShiftedPlanesAndSpiral();
+
+    // tests circular weights saved into bit planes
+    TestCircularWeightSlices();
 }
 
 void BoardTest::TestCopyBoard()
@@ -199,3 +214,270 @@ void BoardTest::TestCreateBoardFromArray()
     }
     delete [] m_preloadedBoard;
 }
+
+void BoardTest::TestBitPlanes()
+{
+    // sizes of the boards to be tested
+    const int32_t sizes[][2] = { {14, 14}, {20, 20}, {1, 20}, {20, 1}, {7, 13} };
+    const int32_t nSizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    srand(1);
+    for (int32_t i = 0; i < nSizes; i++)
+    {
+        const int32_t nRows    = sizes[i][0];
+        const int32_t nColumns = sizes[i][1];
+
+        Board theBoard(nRows, nColumns, ' ');
+        Player player1(std::string("player1"), 'X', nRows, nColumns, Coordinate());
+        Player player2(std::string("player2"), 'O', nRows, nColumns, Coordinate());
+
+        // scatter some squares of both players around the board
+        Coordinate thisCoord;
+        for (thisCoord.m_row = 0; thisCoord.m_row < nRows; thisCoord.m_row++)
+        {
+            for (thisCoord.m_col = 0; thisCoord.m_col < nColumns; thisCoord.m_col++)
+            {
+                int32_t dice = rand() % 6;
+                if (dice == 0)
+                {
+                    theBoard.SetPlayerInCoord(thisCoord, player1);
+                }
+                else if (dice == 1)
+                {
+                    theBoard.SetPlayerInCoord(thisCoord, player2);
+                }
+            }
+        }
+
+        // a square taken by a player can be taken by the other one
+        thisCoord = Coordinate(0, 0);
+        theBoard.SetPlayerInCoord(thisCoord, player1);
+        theBoard.SetPlayerInCoord(thisCoord, player2);
+        assert(!theBoard.IsPlayerInCoord(thisCoord, player1));
+        assert(theBoard.IsPlayerInCoord(thisCoord, player2));
+
+        Bitboard plane1 = theBoard.GetPlayerPlane(player1);
+        Bitboard plane2 = theBoard.GetPlayerPlane(player2);
+        assert((plane1 & plane2).IsEmpty());
+        assert((plane1 | plane2) == theBoard.GetOccupiedPlane());
+        assert((theBoard.GetEmptyPlane() & theBoard.GetOccupiedPlane()).IsEmpty());
+        assert( (theBoard.GetEmptyPlane().PopCount() + theBoard.GetOccupiedPlane().PopCount()) ==
+                (nRows * nColumns) );
+
+        Bitboard nkPoints1;
+        Bitboard nkPoints2;
+        rules::CalculateNucleationPointsCompute(theBoard, player1, nkPoints1);
+        rules::CalculateNucleationPointsCompute(theBoard, player2, nkPoints2);
+
+        Bitboard orthogonal = theBoard.GetOrthogonalNeighbours(plane1);
+        Bitboard diagonal   = theBoard.GetDiagonalNeighbours(plane1);
+
+        for (thisCoord.m_row = 0; thisCoord.m_row < nRows; thisCoord.m_row++)
+        {
+            for (thisCoord.m_col = 0; thisCoord.m_col < nColumns; thisCoord.m_col++)
+            {
+                int32_t index = theBoard.CoordToIndex(thisCoord);
+
+                assert(plane1.IsSet(index) == theBoard.IsPlayerInCoord(thisCoord, player1));
+                assert(plane2.IsSet(index) == theBoard.IsPlayerInCoord(thisCoord, player2));
+                assert(theBoard.GetOccupiedPlane().IsSet(index) == !theBoard.IsCoordEmpty(thisCoord));
+
+                assert(nkPoints1.IsSet(index) ==
+                       rules::IsNucleationPointCompute(theBoard, player1, thisCoord));
+                assert(nkPoints2.IsSet(index) ==
+                       rules::IsNucleationPointCompute(theBoard, player2, thisCoord));
+
+                // neighbours calculated square by square
+                bool isOrthogonal = false;
+                bool isDiagonal   = false;
+                for (int32_t deltaRow = -1; deltaRow <= 1; deltaRow++)
+                {
+                    for (int32_t deltaCol = -1; deltaCol <= 1; deltaCol++)
+                    {
+                        Coordinate neighbour(thisCoord.m_row + deltaRow, thisCoord.m_col + deltaCol);
+                        if ( ((deltaRow == 0) && (deltaCol == 0))               ||
+                             (neighbour.m_row < 0) || (neighbour.m_row >= nRows) ||
+                             (neighbour.m_col < 0) || (neighbour.m_col >= nColumns) )
+                        {
+                            continue;
+                        }
+
+                        if (theBoard.IsPlayerInCoord(neighbour, player1))
+                        {
+                            if ((deltaRow == 0) || (deltaCol == 0))
+                            {
+                                isOrthogonal = true;
+                            }
+                            else
+                            {
+                                isDiagonal = true;
+                            }
+                        }
+                    }
+                }
+                assert(orthogonal.IsSet(index) == isOrthogonal);
+                assert(diagonal.IsSet(index) == isDiagonal);
+            }
+        }
+
+        // nothing is set outside the board
+        assert((orthogonal & ~theBoard.GetEmptyPlane() & ~theBoard.GetOccupiedPlane()).IsEmpty());
+        assert((diagonal & ~theBoard.GetEmptyPlane() & ~theBoard.GetOccupiedPlane()).IsEmpty());
+
+        // boards don't allocate any memory. They can be copied byte by byte
+        Board copyBoard(nRows, nColumns, ' ');
+        memcpy(&copyBoard, &theBoard, sizeof(Board));
+        for (thisCoord.m_row = 0; thisCoord.m_row < nRows; thisCoord.m_row++)
+        {
+            for (thisCoord.m_col = 0; thisCoord.m_col < nColumns; thisCoord.m_col++)
+            {
+                assert(copyBoard.IsPlayerInCoord(thisCoord, player1) ==
+                       theBoard.IsPlayerInCoord(thisCoord, player1));
+                assert(copyBoard.IsPlayerInCoord(thisCoord, player2) ==
+                       theBoard.IsPlayerInCoord(thisCoord, player2));
+            }
+        }
+
+        // blanked squares are removed from every plane
+        theBoard.BlankCoord(Coordinate(0, 0));
+        assert(theBoard.IsCoordEmpty(Coordinate(0, 0)));
+        assert(!theBoard.GetPlayerPlane(player2).IsSet(0));
+        assert(copyBoard.IsPlayerInCoord(Coordinate(0, 0), player2));
+
+        theBoard.Reset();
+        assert(theBoard.GetOccupiedPlane().IsEmpty());
+        assert(theBoard.GetPlayerPlane(player1).IsEmpty());
+        assert(theBoard.GetEmptyPlane().PopCount() == (nRows * nColumns));
+    }
+}
+
+void BoardTest::TestShiftedPlanesAndSpiral()
+{
+    const int32_t sizes[][2] = { {14, 14}, {20, 20}, {1, 20}, {20, 1}, {7, 13} };
+    const int32_t nSizes = sizeof(sizes) / sizeof(sizes[0]);
+
+    srand(2);
+    for (int32_t i = 0; i < nSizes; i++)
+    {
+        const int32_t nRows    = sizes[i][0];
+        const int32_t nColumns = sizes[i][1];
+
+        Board theBoard(nRows, nColumns, ' ');
+        Player player1(std::string("player1"), 'X', nRows, nColumns, Coordinate());
+
+        Coordinate thisCoord;
+        for (thisCoord.m_row = 0; thisCoord.m_row < nRows; thisCoord.m_row++)
+        {
+            for (thisCoord.m_col = 0; thisCoord.m_col < nColumns; thisCoord.m_col++)
+            {
+                if ((rand() % 3) == 0)
+                {
+                    theBoard.SetPlayerInCoord(thisCoord, player1);
+                }
+            }
+        }
+        Bitboard plane1 = theBoard.GetPlayerPlane(player1);
+
+        // shifted planes against the square by square calculation
+        for (int32_t rowOffset = -BOARD_MAX_PLANE_SHIFT; rowOffset <= BOARD_MAX_PLANE_SHIFT; rowOffset++)
+        {
+            for (int32_t colOffset = -BOARD_MAX_PLANE_SHIFT; colOffset <= BOARD_MAX_PLANE_SHIFT; colOffset++)
+            {
+                Bitboard shifted = theBoard.GetShiftedPlane(plane1, rowOffset, colOffset);
+                Bitboard expected;
+                for (thisCoord.m_row = 0; thisCoord.m_row < nRows; thisCoord.m_row++)
+                {
+                    for (thisCoord.m_col = 0; thisCoord.m_col < nColumns; thisCoord.m_col++)
+                    {
+                        Coordinate source(thisCoord.m_row + rowOffset, thisCoord.m_col + colOffset);
+                        if ( (source.m_row >= 0) && (source.m_row < nRows)    &&
+                             (source.m_col >= 0) && (source.m_col < nColumns) &&
+                             theBoard.IsPlayerInCoord(source, player1) )
+                        {
+                            expected.Set(theBoard.CoordToIndex(thisCoord));
+                        }
+                    }
+                }
+                assert(shifted == expected);
+            }
+        }
+
+        // iterating a plane in spiral must give back the squares in the same order
+        // as the spiral iteration of nk points of a player does
+        player1.SetNucleationPointsPlane(plane1);
+
+        int32_t nSquares = 0;
+        int32_t ring;
+        Coordinate nkCoord;
+        Player::SpiralIterator nkIterator;
+        bool nkExists = player1.GetFirstNucleationPointSpiral(nkIterator, nkCoord);
+        for (int32_t index = theBoard.GetFirstIndexSpiral(plane1, ring);
+             index >= 0;
+             index = theBoard.GetNextIndexSpiral(plane1, ring, index))
+        {
+            assert(nkExists);
+            assert(index == theBoard.CoordToIndex(nkCoord));
+            nSquares++;
+
+            nkExists = player1.GetNextNucleationPointSpiral(nkIterator, nkCoord);
+        }
+        assert(!nkExists);
+        assert(nSquares == plane1.PopCount());
+
+        Bitboard emptyPlane;
+        assert(theBoard.GetFirstIndexSpiral(emptyPlane, ring) == -1);
+    }
+}
+
+void BoardTest::TestCircularWeightSlices()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // weights of the narrowest boards go below 0
+    const int32_t SIZES[][2] = { {14, 14}, {20, 20}, {9, 20}, {20, 9}, {1, 20}, {2, 20}, {1, 1} };
+    const int32_t N_SIZES = sizeof(SIZES) / sizeof(SIZES[0]);
+
+    for (int32_t size = 0; size < N_SIZES; size++)
+    {
+        int32_t nRows    = SIZES[size][0];
+        int32_t nColumns = SIZES[size][1];
+        Board theBoard(nRows, nColumns);
+
+        Coordinate thisCoord;
+        for (thisCoord.m_row = 0; thisCoord.m_row < nRows; thisCoord.m_row++)
+        {
+            for (thisCoord.m_col = 0; thisCoord.m_col < nColumns; thisCoord.m_col++)
+            {
+                int32_t index = theBoard.CoordToIndex(thisCoord);
+                int32_t weight = 0;
+                int32_t halvedWeight = 0;
+                for (int32_t bit = 0; bit < BOARD_CIRCULAR_WEIGHT_BITS; bit++)
+                {
+                    if (theBoard.GetCircularWeightSlice(bit, false).IsSet(index))
+                    {
+                        weight += Board::GetCircularWeightSliceValue(bit);
+                    }
+                    if (theBoard.GetCircularWeightSlice(bit, true).IsSet(index))
+                    {
+                        halvedWeight += Board::GetCircularWeightSliceValue(bit);
+                    }
+                }
+
+                int32_t expected = Player::CalculateCircularWeight(nRows, nColumns, thisCoord);
+                assert(weight == expected);
+                assert(halvedWeight == (expected / 2));
+            }
+        }
+
+        // squares outside the board are never set
+        Bitboard outside = ~Bitboard();
+        outside = outside << (nRows * nColumns);
+        for (int32_t bit = 0; bit < BOARD_CIRCULAR_WEIGHT_BITS; bit++)
+        {
+            assert((theBoard.GetCircularWeightSlice(bit, false) & outside).IsEmpty());
+            assert((theBoard.GetCircularWeightSlice(bit, true) & outside).IsEmpty());
+        }
+    }
+}
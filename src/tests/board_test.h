@@ -49,6 +49,16 @@ private:
 
     /// Test creation of boards loading data from arrays
     void TestCreateBoardFromArray();
+
+    /// tests the bit planes of the board against the square by square accessors
+    void TestBitPlanes();
+
+    /// tests GetShiftedPlane and the spiral iteration of planes
+    void TestShiftedPlanesAndSpiral();
+
+    /// tests the circular weight slices add up to the weight of every square
+    /// (also in boards with negative weights)
+    void TestCircularWeightSlices();
 };
 
 #endif // BOARD_TEST_H_
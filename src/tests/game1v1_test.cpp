@@ -25,12 +25,29 @@
 ///           Faustino Frechilla 13-Sep-2009  Original development
 ///           Faustino Frechilla 06-May-2010  Bitwise configuration check
 ///           Faustino Frechilla 15-Jul-2010  Bitwise stuff moved to bitwise_test.[cpp|h]
+///           agent              17-Oct-2026  Parallel MinMax test
+///           agent              17-Oct-2026  Zobrist keys and transposition table test
+///           agent              17-Oct-2026  Iterative deepening test
+///           agent              17-Oct-2026  Incremental heuristic test
+///           agent              17-Oct-2026  Search statistics test
+///           agent              17-Oct-2026  Search allocations test
+///           agent              17-Oct-2026  Move ordering test
+///           agent              17-Oct-2026  Principal variation search test
+///           agent              17-Oct-2026  Cancellation latency test
+///           agent              17-Oct-2026  Endgame solver test
+///           agent              17-Oct-2026  Specialised search benchmark
+///           agent              17-Oct-2026  Vectorised heuristics test
+///           agent              17-Oct-2026  Exact influence area test
 /// @endhistory
 ///
 // ============================================================================
 
+#include <fstream>
+#include <new>     // std::nothrow
 #include "game1v1_test.h"
 #include "bitwise.h"
+#include "allocation_counter.h"
+#include "weighted_popcount.h"
 #ifdef DEBUG_PRINT
 #include <iostream>
 #endif
@@ -48,6 +65,20 @@ void Game1v1Test::DoTest()
 {
     // all other test functions are called from this one
     TestGame1v1PutDownAndRemovePiece();
+    TestGame1v1ParallelMinMax();
+    TestGame1v1TranspositionTable();
+    TestGame1v1IterativeDeepening();
+    TestGame1v1IncrementalHeuristic();
+    TestGame1v1SearchStats();
+    TestGame1v1SearchAllocations();
+    TestGame1v1MoveOrdering();
+    TestGame1v1PrincipalVariationSearch();
+    TestGame1v1CancellationLatency();
+    TestGame1v1EndgameSolver();
+    TestGame1v1SpecialisedSearch();
+    TestGame1v1VectorisedHeuristics();
+    TestGame1v1ExactInfluenceArea();
+    TestGame1v1UndoRecord();
 }
 
 void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
@@ -67,14 +98,12 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
     for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
     {
         // both m_player1 and m_player2 should have all the pieces available anyway
-        const std::list<PieceConfiguration> &pieceConfList =
-            m_player1.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        const PieceConfTable &confTable = PieceConfTable::Instance();
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
+            const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
             // sets&iterators to retrieve nk points
             STLCoordinateSet_t nkPointsSetPlayer1;
             STLCoordinateSet_t nkPointsSetPlayer2;
@@ -87,7 +116,7 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
             Game1v1::PutDownPiece(
                 m_board,
                 m_player1.GetStartingCoordinate(),
-                *pieceConfIt,
+                confTable.GetConf(confIt),
                 m_player1,
                 m_player2);
 
@@ -97,7 +126,7 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
             Game1v1::PutDownPiece(
                 m_board,
                 m_player2.GetStartingCoordinate(),
-                *pieceConfIt,
+                confTable.GetConf(confIt),
                 m_player2,
                 m_player1);
 
@@ -107,8 +136,8 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
             // put down the very same pieces on the extraBoard using the extra players
             // using directly m_pieceSquares attribute
             PieceConfigurationContainer_t::const_iterator it;
-            for (it  = pieceConfIt->m_pieceSquares.begin();
-                 it != pieceConfIt->m_pieceSquares.end();
+            for (it  = pieceConf.m_pieceSquares.begin();
+                 it != pieceConf.m_pieceSquares.end();
                  it++)
             {
                 Coordinate player1Coord(
@@ -211,7 +240,7 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
             Game1v1::RemovePiece(
                 m_board,
                 m_player1.GetStartingCoordinate(),
-                *pieceConfIt,
+                confTable.GetConf(confIt),
                 m_player1,
                 m_player2);
 
@@ -221,7 +250,7 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
             Game1v1::RemovePiece(
                 m_board,
                 m_player2.GetStartingCoordinate(),
-                *pieceConfIt,
+                confTable.GetConf(confIt),
                 m_player2,
                 m_player1);
 
@@ -230,8 +259,8 @@ void Game1v1Test::TestGame1v1PutDownAndRemovePiece()
 
             // remove the very same pieces from the extraBoard using the extra players
             // using directly m_pieceSquares attribute
-            for (it  = pieceConfIt->m_pieceSquares.begin();
-                 it != pieceConfIt->m_pieceSquares.end();
+            for (it  = pieceConf.m_pieceSquares.begin();
+                 it != pieceConf.m_pieceSquares.end();
                  it++)
             {
                 Coordinate player1Coord(
@@ -381,3 +410,1906 @@ void Game1v1Test::TestGame1v1GetAllNucleationPoints(eGame1v1Player_t who)
             GetPlayer(who).GetFirstNucleationPointSpiral(iterator, tmpCoord) == false);
     }
 }
+
+void Game1v1Test::TestGame1v1ParallelMinMax()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    // put down the 1st piece of both players (this is a special case
+    // in MinMax which doesn't use the search tree) and then a couple
+    // more so the search tree is not too big
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    // 2-thread search is the reference
+    Piece referencePiece(e_noPiece);
+    Coordinate referenceCoord;
+    int32_t referenceValue = MinMax(
+            Heuristic::CalculateInfluenceAreaWeighted,
+            2,
+            Game1v1::e_Game1v1Player1,
+            referencePiece,
+            referenceCoord,
+            stopFlag,
+            Coordinate(),
+            Piece(e_noPiece),
+            2);
+    assert(referencePiece.GetType() != e_noPiece);
+    assert(referenceCoord.Initialised());
+
+    int32_t nThreadsToTest[] = {3, 4, 7};
+    for (uint32_t i = 0; i < (sizeof(nThreadsToTest) / sizeof(int32_t)); i++)
+    {
+        resultPiece = Piece(e_noPiece);
+        resultCoord = Coordinate();
+
+        int32_t value = MinMax(
+                Heuristic::CalculateInfluenceAreaWeighted,
+                2,
+                Game1v1::e_Game1v1Player1,
+                resultPiece,
+                resultCoord,
+                stopFlag,
+                Coordinate(),
+                Piece(e_noPiece),
+                nThreadsToTest[i]);
+
+        assert(value == referenceValue);
+        assert(resultPiece.GetType() == referencePiece.GetType());
+        assert(resultPiece.GetCurrentConfiguration().m_pieceSquares ==
+               referencePiece.GetCurrentConfiguration().m_pieceSquares);
+        assert(resultCoord == referenceCoord);
+    }
+
+    // board and players must be left as they were before the search
+    Board  extraBoard(m_board);
+    MinMax(Heuristic::CalculateInfluenceAreaWeighted,
+           2,
+           Game1v1::e_Game1v1Player1,
+           resultPiece,
+           resultCoord,
+           stopFlag,
+           Coordinate(),
+           Piece(e_noPiece),
+           4);
+
+    Coordinate thisCoord(0, 0);
+    for (thisCoord.m_row = 0 ;
+         thisCoord.m_row < extraBoard.GetNRows();
+         thisCoord.m_row++)
+    {
+        for (thisCoord.m_col = 0 ;
+             thisCoord.m_col < extraBoard.GetNColumns();
+             thisCoord.m_col++)
+        {
+            assert (m_board.IsCoordEmpty(thisCoord) ==
+                    extraBoard.IsCoordEmpty(thisCoord));
+        }
+    }
+}
+
+void Game1v1Test::TestGame1v1TranspositionTable()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+    assert(m_player1.GetHashKey() == 0);
+    assert(m_player2.GetHashKey() == 0);
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    // keys updated incrementally must be the same as keys calculated from scratch
+    uint64_t keyPlayer1 = m_player1.GetHashKey();
+    uint64_t keyPlayer2 = m_player2.GetHashKey();
+    assert(keyPlayer1 != 0);
+    assert(keyPlayer2 != 0);
+    assert(keyPlayer1 != keyPlayer2);
+
+    RecalculateHashKeys();
+    assert(m_player1.GetHashKey() == keyPlayer1);
+    assert(m_player2.GetHashKey() == keyPlayer2);
+
+    // the player to move is part of the key of the position
+    assert(CalculateHashKey(m_player1, m_player2) != CalculateHashKey(m_player2, m_player1));
+    assert(GetPositionKey(Game1v1::e_Game1v1Player1) == CalculateHashKey(m_player1, m_player2));
+    assert(GetPositionKey(Game1v1::e_Game1v1Player2) == CalculateHashKey(m_player2, m_player1));
+
+    // the same position reached in 2 different orders has the same key.
+    // Removing pieces must restore the old keys
+    MinMax(Heuristic::CalculateNKWeightedv1,
+           1,
+           Game1v1::e_Game1v1Player1,
+           resultPiece,
+           resultCoord,
+           stopFlag);
+    assert(resultPiece.GetType() != e_noPiece);
+    Piece otherPiece(e_noPiece);
+    Coordinate otherCoord;
+    MinMax(Heuristic::CalculateNKWeightedv1,
+           1,
+           Game1v1::e_Game1v1Player2,
+           otherPiece,
+           otherCoord,
+           stopFlag);
+    assert(otherPiece.GetType() != e_noPiece);
+
+    Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+    assert(m_player1.GetHashKey() != keyPlayer1);
+    assert(m_player2.GetHashKey() == keyPlayer2);
+    uint64_t keyAfterPlayer1 = m_player1.GetHashKey();
+
+    if (rules::IsPieceDeployableCompute(
+            m_board,
+            otherPiece.GetCurrentConfiguration(),
+            otherCoord,
+            m_player2))
+    {
+        Game1v1::PutDownPiece(otherPiece, otherCoord, Game1v1::e_Game1v1Player2);
+        uint64_t positionKey = CalculateHashKey(m_player1, m_player2);
+
+        // the other way round
+        Game1v1::RemovePiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+        Game1v1::RemovePiece(otherPiece, otherCoord, Game1v1::e_Game1v1Player2);
+        assert(m_player1.GetHashKey() == keyPlayer1);
+        assert(m_player2.GetHashKey() == keyPlayer2);
+
+        Game1v1::PutDownPiece(otherPiece, otherCoord, Game1v1::e_Game1v1Player2);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+        assert(m_player1.GetHashKey() == keyAfterPlayer1);
+        assert(CalculateHashKey(m_player1, m_player2) == positionKey);
+
+        Game1v1::RemovePiece(otherPiece, otherCoord, Game1v1::e_Game1v1Player2);
+    }
+    Game1v1::RemovePiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+    assert(m_player1.GetHashKey() == keyPlayer1);
+    assert(m_player2.GetHashKey() == keyPlayer2);
+
+    // MinMax with a transposition table
+    TranspositionTable transTable(1);
+    TranspositionTable::Stats_t transTableStats;
+    TranspositionTable::ResetStats(transTableStats);
+    Board extraBoard(m_board);
+    bool nkPointsFiltered = false;
+
+    int32_t nThreadsToTest[] = {1, 3};
+    for (uint32_t i = 0; i < (sizeof(nThreadsToTest) / sizeof(int32_t)); i++)
+    {
+        for (int32_t j = 0; j < 2; j++)
+        {
+            resultPiece = Piece(e_noPiece);
+            resultCoord = Coordinate();
+
+            MinMax(Heuristic::CalculateInfluenceAreaWeighted,
+                   3,
+                   Game1v1::e_Game1v1Player1,
+                   resultPiece,
+                   resultCoord,
+                   stopFlag,
+                   Coordinate(),
+                   Piece(e_noPiece),
+                   nThreadsToTest[i],
+                   &transTable);
+
+            assert(resultPiece.GetType() != e_noPiece);
+            assert(rules::IsPieceDeployableCompute(
+                        m_board,
+                        resultPiece.GetCurrentConfiguration(),
+                        resultCoord,
+                        m_player1));
+
+            const TranspositionTable::Stats_t &stats = transTable.GetStats();
+            assert((stats.hits + stats.misses + stats.collisions) > 0);
+            if (j > 0)
+            {
+                // the same search again. Positions saved by the previous one must be found
+                assert(stats.hits > 0);
+            }
+
+            if (GetSearchStats().duplicateNkPointsSkipped > 0)
+            {
+                // the value of the root comes from nodes which skipped some moves.
+                // It is not exact, and not even a bound
+                TranspositionTable::Entry_t rootEntry;
+                assert(transTable.Probe(
+                            CalculateHashKey(m_player1, m_player2),
+                            rootEntry,
+                            transTableStats));
+                assert(rootEntry.bound == TranspositionTable::e_boundLower);
+                assert(rootEntry.value == -INFINITE);
+                assert(packedmove::IsNoMove(rootEntry.move) == false);
+                nkPointsFiltered = true;
+            }
+        }
+    }
+    assert(nkPointsFiltered);
+
+    // the same goes for every ancestor of a filtered node, not only the root
+    // of the tree. The 1st move of the root is searched 3 levels deep, so the
+    // nk points filter is used 2 levels below it
+    ePieceType_t lastPiecesMe[e_numberOfPieces];
+    ePieceType_t lastPiecesOpponent[e_numberOfPieces];
+    const Bitboard* oldNkPointsMe[e_numberOfPieces];
+    const Bitboard* oldNkPointsOpponent[e_numberOfPieces];
+    for (int32_t i = e_minimumPieceIndex ; i < e_numberOfPieces ; i++)
+    {
+        lastPiecesMe[i]        = e_noPiece;
+        oldNkPointsMe[i]       = NULL;
+        lastPiecesOpponent[i]  = e_noPiece;
+        oldNkPointsOpponent[i] = NULL;
+    }
+
+    const int32_t SEARCH_DEPTH = 3;
+    SearchStats_t searchStats;
+    ResetSearchStats(searchStats);
+    MoveOrdering moveOrdering(SEARCH_DEPTH, m_board.GetNRows() * m_board.GetNColumns());
+    CancellationToken cancelToken(stopFlag);
+    CancellationCheckpoint checkpoint(cancelToken);
+    bool subtreeFiltered = false;
+
+    AlphaBetaComputeFunction_t alphaBetaCompute =
+            SelectAlphaBetaCompute(Heuristic::CalculateNKWeightedv1, false);
+
+    transTable.Clear();
+    alphaBetaCompute(
+            m_board,
+            m_player1,
+            oldNkPointsMe,
+            lastPiecesMe,
+            m_player2,
+            oldNkPointsOpponent,
+            lastPiecesOpponent,
+            Heuristic::CalculateNKWeightedv1,
+            SEARCH_DEPTH,
+            SEARCH_DEPTH,
+            -INFINITE,
+            INFINITE,
+            &transTable,
+            transTableStats,
+            checkpoint,
+            Game1v1::e_searchModePVS,
+            moveOrdering,
+            searchStats,
+            subtreeFiltered);
+    assert(searchStats.duplicateNkPointsSkipped > 0);
+    assert(subtreeFiltered);
+
+    TranspositionTable::Entry_t ancestorEntry;
+    assert(transTable.Probe(
+                CalculateHashKey(m_player1, m_player2),
+                ancestorEntry,
+                transTableStats));
+    assert(ancestorEntry.bound != TranspositionTable::e_boundExact);
+    assert(ancestorEntry.value == -INFINITE);
+
+    // board and keys must be left as they were before the search
+    assert(m_player1.GetHashKey() == keyPlayer1);
+    assert(m_player2.GetHashKey() == keyPlayer2);
+
+    Coordinate thisCoord(0, 0);
+    for (thisCoord.m_row = 0 ;
+         thisCoord.m_row < extraBoard.GetNRows();
+         thisCoord.m_row++)
+    {
+        for (thisCoord.m_col = 0 ;
+             thisCoord.m_col < extraBoard.GetNColumns();
+             thisCoord.m_col++)
+        {
+            assert (m_board.IsCoordEmpty(thisCoord) ==
+                    extraBoard.IsCoordEmpty(thisCoord));
+        }
+    }
+}
+
+void Game1v1Test::TestGame1v1IterativeDeepening()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+    int32_t depthReached = 0;
+
+    // the first piece is not calculated with a search tree. Only depth 1 is "searched"
+    MinMaxIterativeDeepening(
+            Heuristic::CalculateNKWeightedv1,
+            5,
+            0,
+            Game1v1::e_Game1v1Player1,
+            resultPiece,
+            resultCoord,
+            depthReached,
+            stopFlag);
+    assert(resultPiece.GetType() != e_noPiece);
+    assert(depthReached == 1);
+
+    // put down a few pieces so the search tree is not trivial
+    for (int32_t i = 0; i < 3; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    Board extraBoard(m_board);
+
+    // no time budget. All the depths until the maximum are searched
+    TranspositionTable transTable(1);
+    MinMaxIterativeDeepening(
+            Heuristic::CalculateInfluenceAreaWeighted,
+            3,
+            0,
+            Game1v1::e_Game1v1Player1,
+            resultPiece,
+            resultCoord,
+            depthReached,
+            stopFlag,
+            Coordinate(),
+            Piece(e_noPiece),
+            1,
+            &transTable);
+    assert(depthReached == 3);
+    assert(resultPiece.GetType() != e_noPiece);
+    assert(rules::IsPieceDeployableCompute(
+                m_board,
+                resultPiece.GetCurrentConfiguration(),
+                resultCoord,
+                m_player1));
+    // every iteration but the first one used what the previous one saved
+    assert(transTable.GetStats().hits > 0);
+
+    // the search must be stopped when the time runs out. Depth 1 is always completed
+    // so the only timing that can be checked safely is the search doesn't take forever
+    const int32_t TIME_BUDGET_MS = 100;
+    int32_t nThreadsToTest[] = {1, 3};
+    for (uint32_t i = 0; i < (sizeof(nThreadsToTest) / sizeof(int32_t)); i++)
+    {
+        GTimer* timer = g_timer_new();
+        MinMaxIterativeDeepening(
+                Heuristic::CalculateInfluenceAreaWeighted,
+                GAME1V1_MAX_SEARCH_DEPTH,
+                TIME_BUDGET_MS,
+                Game1v1::e_Game1v1Player2,
+                resultPiece,
+                resultCoord,
+                depthReached,
+                stopFlag,
+                Coordinate(),
+                Piece(e_noPiece),
+                nThreadsToTest[i]);
+        gdouble elapsed = g_timer_elapsed(timer, NULL);
+        g_timer_destroy(timer);
+
+        assert(depthReached >= 1);
+        assert(depthReached < GAME1V1_MAX_SEARCH_DEPTH);
+        assert(elapsed < 10.0);
+        assert(resultPiece.GetType() != e_noPiece);
+        assert(rules::IsPieceDeployableCompute(
+                    m_board,
+                    resultPiece.GetCurrentConfiguration(),
+                    resultCoord,
+                    m_player2));
+    }
+
+    // the endgame solver is cancelled by the time budget too. With this threshold
+    // every position is solved up to the end of the game, which takes far longer
+    // than the budget this early. The move of depth 1 is returned instead
+    SetEndgameThreshold(1000000);
+    assert(IsEndgame(Game1v1::e_Game1v1Player2));
+    {
+        GTimer* timer = g_timer_new();
+        MinMaxIterativeDeepening(
+                Heuristic::CalculateInfluenceAreaWeighted,
+                GAME1V1_MAX_SEARCH_DEPTH,
+                TIME_BUDGET_MS,
+                Game1v1::e_Game1v1Player2,
+                resultPiece,
+                resultCoord,
+                depthReached,
+                stopFlag);
+        gdouble elapsed = g_timer_elapsed(timer, NULL);
+        g_timer_destroy(timer);
+
+        // depth 1 takes a few milliseconds. The rest is the latency of the watchdog
+        assert(elapsed < (2.0 * TIME_BUDGET_MS / 1000));
+        assert(depthReached == 1);
+        assert(resultPiece.GetType() != e_noPiece);
+        assert(rules::IsPieceDeployableCompute(
+                    m_board,
+                    resultPiece.GetCurrentConfiguration(),
+                    resultCoord,
+                    m_player2));
+
+#ifdef DEBUG_PRINT
+        std::cout << "  endgame solver cancelled after (ms):            "
+                  << (elapsed * 1000) << std::endl;
+#endif
+    }
+    SetEndgameThreshold(GAME1V1_DEFAULT_ENDGAME_THRESHOLD);
+
+    // cancelled searches leave the board as it was
+    Coordinate thisCoord(0, 0);
+    for (thisCoord.m_row = 0 ;
+         thisCoord.m_row < extraBoard.GetNRows();
+         thisCoord.m_row++)
+    {
+        for (thisCoord.m_col = 0 ;
+             thisCoord.m_col < extraBoard.GetNColumns();
+             thisCoord.m_col++)
+        {
+            assert (m_board.IsCoordEmpty(thisCoord) ==
+                    extraBoard.IsCoordEmpty(thisCoord));
+        }
+    }
+}
+
+void Game1v1Test::TestGame1v1IncrementalHeuristic()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    assert(Heuristic::CalculateWeightedAreas(m_board, m_player1, m_player2) == 0);
+    assert(Heuristic::CalculateWeightedAreasCompute(m_board, m_player1, m_player2) == 0);
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    // pieces put down by both players (in order) so they can be removed afterwards
+    std::vector<Piece>            piecesPutDown;
+    std::vector<Coordinate>       coordsPutDown;
+    std::vector<eGame1v1Player_t> playersPutDown;
+
+    eGame1v1Player_t thisPlayer = Game1v1::e_Game1v1Player1;
+    for (int32_t i = 0; i < 12; i++)
+    {
+        Piece resultPiece(e_noPiece);
+        Coordinate resultCoord;
+
+        MinMax(Heuristic::CalculateWeightedAreas,
+               1,
+               thisPlayer,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            break;
+        }
+
+        Game1v1::PutDownPiece(resultPiece, resultCoord, thisPlayer);
+        piecesPutDown.push_back(resultPiece);
+        coordsPutDown.push_back(resultCoord);
+        playersPutDown.push_back(thisPlayer);
+
+        assert(Heuristic::CalculateWeightedAreas(m_board, m_player1, m_player2) ==
+               Heuristic::CalculateWeightedAreasCompute(m_board, m_player1, m_player2));
+        assert(Heuristic::CalculateWeightedAreas(m_board, m_player2, m_player1) ==
+               Heuristic::CalculateWeightedAreasCompute(m_board, m_player2, m_player1));
+
+        thisPlayer = (thisPlayer == Game1v1::e_Game1v1Player1) ?
+                Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+    assert(piecesPutDown.size() > 0);
+
+    // the weighted sums are kept up to date by the approximate update, not by
+    // calculating the exact influence areas
+    assert(SelectInfluenceAreaUpdate(Heuristic::CalculateWeightedAreas) ==
+           e_influenceAreaApproximate);
+
+    // heuristics which are not said to read the influence areas must get the same
+    // value whatever the areas saved in the players are
+    Player noAreaPlayer1(m_player1);
+    Player noAreaPlayer2(m_player2);
+    noAreaPlayer1.SetInfluenceAreaPlane(Bitboard());
+    noAreaPlayer2.SetInfluenceAreaPlane(Bitboard());
+    for (int32_t i = Heuristic::e_heuristicStartCount; i < Heuristic::e_heuristicCount; i++)
+    {
+        Heuristic::EvalFunction_t evalFunction = Heuristic::m_heuristicData[i].m_evalFunction;
+        if ( (evalFunction == Heuristic::CalculateRandom) ||
+             Heuristic::ReadsInfluenceAreas(evalFunction) )
+        {
+            continue;
+        }
+
+        assert(evalFunction(m_board, m_player1, m_player2) ==
+               evalFunction(m_board, noAreaPlayer1, noAreaPlayer2));
+    }
+
+    // remove them in reverse order
+    while (!piecesPutDown.empty())
+    {
+        Game1v1::RemovePiece(piecesPutDown.back(), coordsPutDown.back(), playersPutDown.back());
+        piecesPutDown.pop_back();
+        coordsPutDown.pop_back();
+        playersPutDown.pop_back();
+
+        assert(Heuristic::CalculateWeightedAreas(m_board, m_player1, m_player2) ==
+               Heuristic::CalculateWeightedAreasCompute(m_board, m_player1, m_player2));
+        assert(Heuristic::CalculateWeightedAreas(m_board, m_player2, m_player1) ==
+               Heuristic::CalculateWeightedAreasCompute(m_board, m_player2, m_player1));
+    }
+
+    assert(m_player1.GetTakenSquaresWeight() == 0);
+    assert(m_player2.GetTakenSquaresWeight() == 0);
+}
+
+void Game1v1Test::TestGame1v1SearchStats()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    // the first piece is not calculated with a search tree
+    MinMax(Heuristic::CalculateNKWeightedv1,
+           3,
+           Game1v1::e_Game1v1Player1,
+           resultPiece,
+           resultCoord,
+           stopFlag);
+    assert(resultPiece.GetType() != e_noPiece);
+    assert(GetSearchStats().nodes == 0);
+    assert(GetSearchStats().movesTried == 0);
+    Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+    MinMax(Heuristic::CalculateNKWeightedv1,
+           1,
+           Game1v1::e_Game1v1Player2,
+           resultPiece,
+           resultCoord,
+           stopFlag);
+    assert(resultPiece.GetType() != e_noPiece);
+    Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+
+    const int32_t SEARCH_DEPTH = 3;
+    int32_t nThreadsToTest[] = {1, 3};
+    for (uint32_t i = 0; i < (sizeof(nThreadsToTest) / sizeof(int32_t)); i++)
+    {
+        MinMax(Heuristic::CalculateInfluenceAreaWeighted,
+               SEARCH_DEPTH,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag,
+               Coordinate(),
+               Piece(e_noPiece),
+               nThreadsToTest[i]);
+        assert(resultPiece.GetType() != e_noPiece);
+
+        const SearchStats_t &stats = GetSearchStats();
+        assert(stats.nodesPerPly[0] == 1);
+        assert(stats.betaCutoffsPerPly[0] == 0);
+
+        uint64_t nodes = 0;
+        uint64_t cutoffs = 0;
+        for (int32_t ply = 0; ply < GAME1V1_SEARCH_STATS_PLIES; ply++)
+        {
+            if (ply > SEARCH_DEPTH)
+            {
+                assert(stats.nodesPerPly[ply] == 0);
+            }
+            nodes   += stats.nodesPerPly[ply];
+            cutoffs += stats.betaCutoffsPerPly[ply];
+        }
+        assert(nodes == stats.nodes);
+
+        uint64_t cutoffsPerIndex = 0;
+        for (int32_t index = 0; index < GAME1V1_SEARCH_STATS_CUTOFF_INDEXES; index++)
+        {
+            cutoffsPerIndex += stats.cutoffMoveIndex[index];
+        }
+        assert(cutoffsPerIndex == cutoffs);
+        assert(cutoffs > 0);
+
+        // no transposition table. Every node in the last ply is a leaf (both
+        // players have plenty of pieces left), and every node but the root is a move
+        assert(stats.transTableCutoffs == 0);
+        assert(stats.leafEvaluations == stats.nodesPerPly[SEARCH_DEPTH]);
+        assert(stats.movesTried == (stats.nodes - 1));
+        assert(stats.movesTried <= stats.movesGenerated);
+        assert(stats.elapsedSeconds >= 0.0);
+    }
+}
+
+void Game1v1Test::TestGame1v1SearchAllocations()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    // every version of operator new is counted. Pointers are volatile so the
+    // compiler can't leave out allocations that are never used
+    allocationcounter::Start();
+    int32_t* volatile singleObject = new int32_t;
+    int32_t* volatile array = new int32_t[2];
+    int32_t* volatile singleObjectNoThrow = new (std::nothrow) int32_t;
+    int32_t* volatile arrayNoThrow = new (std::nothrow) int32_t[2];
+    assert(allocationcounter::Stop() == 4);
+    delete singleObject;
+    delete [] array;
+    delete singleObjectNoThrow;
+    delete [] arrayNoThrow;
+
+    // everything the search needs is set up before allocations are counted.
+    // Each node of the search tree uses its own stack frame and nothing else
+    const int32_t SEARCH_DEPTH = 3;
+    TranspositionTable transTable(1);
+    TranspositionTable::Stats_t transTableStats;
+    TranspositionTable::ResetStats(transTableStats);
+    SearchStats_t searchStats;
+    MoveOrdering moveOrdering(SEARCH_DEPTH, m_board.GetNRows() * m_board.GetNColumns());
+
+    ePieceType_t lastPiecesMe[e_numberOfPieces];
+    ePieceType_t lastPiecesOpponent[e_numberOfPieces];
+    const Bitboard* oldNkPointsMe[e_numberOfPieces];
+    const Bitboard* oldNkPointsOpponent[e_numberOfPieces];
+
+    for (int32_t i = 0; i < Heuristic::e_heuristicCount; i++)
+    {
+        for (int32_t j = e_minimumPieceIndex ; j < e_numberOfPieces ; j++)
+        {
+            lastPiecesMe[j]        = e_noPiece;
+            oldNkPointsMe[j]       = NULL;
+            lastPiecesOpponent[j]  = e_noPiece;
+            oldNkPointsOpponent[j] = NULL;
+        }
+
+        Heuristic::EvalFunction_t heuristicMethod = Heuristic::m_heuristicData[i].m_evalFunction;
+        transTable.NewSearch(
+            static_cast<uint64_t>(reinterpret_cast<uintptr_t>(heuristicMethod)));
+        ResetSearchStats(searchStats);
+        moveOrdering.Clear();
+        CancellationToken cancelToken(stopFlag);
+        CancellationCheckpoint checkpoint(cancelToken);
+        bool subtreeFiltered;
+
+        AlphaBetaComputeFunction_t alphaBetaCompute =
+                SelectAlphaBetaCompute(heuristicMethod, IsSpecialisedSearchEnabled());
+
+        allocationcounter::Start();
+        alphaBetaCompute(
+                m_board,
+                m_player1,
+                oldNkPointsMe,
+                lastPiecesMe,
+                m_player2,
+                oldNkPointsOpponent,
+                lastPiecesOpponent,
+                heuristicMethod,
+                SEARCH_DEPTH,
+                SEARCH_DEPTH,
+                -INFINITE,
+                INFINITE,
+                &transTable,
+                transTableStats,
+                checkpoint,
+                Game1v1::e_searchModePVS,
+                moveOrdering,
+                searchStats,
+                subtreeFiltered);
+        int32_t nAllocations = allocationcounter::Stop();
+
+        assert(searchStats.nodes > 1);
+        assert(nAllocations == 0);
+    }
+}
+
+void Game1v1Test::TestGame1v1MoveOrdering()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    const int32_t N_SQUARES = m_board.GetNRows() * m_board.GetNColumns();
+
+    // moves are kept in the order they were added while there are no killers
+    // nor history. Once there are, killer moves go first and the rest of them are
+    // sorted by history
+    MoveOrdering moveOrdering(2, N_SQUARES);
+    PackedMove_t move1 = packedmove::Pack(e_5Piece_Cross, 0, 10);
+    PackedMove_t move2 = packedmove::Pack(e_5Piece_BigS, 1, 20);
+    PackedMove_t move3 = packedmove::Pack(e_1Piece_BabyPiece, 0, 30);
+    PackedMove_t move4 = packedmove::Pack(e_4Piece_LittleS, 1, 40);
+
+    moveOrdering.ClearMoves(1);
+    moveOrdering.AddMove(1, move1);
+    moveOrdering.AddMove(1, move2);
+    moveOrdering.AddMove(1, move3);
+    moveOrdering.SortMoves(1);
+    assert(moveOrdering.GetNMoves(1) == 3);
+    assert(moveOrdering.GetMove(1, 0) == move1);
+    assert(moveOrdering.GetMove(1, 1) == move2);
+    assert(moveOrdering.GetMove(1, 2) == move3);
+
+    moveOrdering.SaveCutoff(0, move4, 2);
+    moveOrdering.SaveCutoff(1, move2, 1);
+    moveOrdering.SaveCutoff(1, move3, 1);
+    assert(moveOrdering.GetKiller(1, 0) == move3);
+    assert(moveOrdering.GetKiller(1, 1) == move2);
+    assert(moveOrdering.GetKiller(0, 0) == move4);
+    assert(packedmove::IsNoMove(moveOrdering.GetKiller(0, 1)));
+    assert(moveOrdering.GetHistory(move4) == 4);
+    assert(moveOrdering.GetHistory(move1) == 0);
+
+    moveOrdering.ClearMoves(1);
+    moveOrdering.AddMove(1, move1);
+    moveOrdering.AddMove(1, move4);
+    moveOrdering.AddMove(1, move2);
+    moveOrdering.AddMove(1, move3);
+    moveOrdering.SortMoves(1);
+    assert(moveOrdering.GetMove(1, 0) == move3);
+    assert(moveOrdering.GetMove(1, 1) == move2);
+    assert(moveOrdering.GetMove(1, 2) == move4);
+    assert(moveOrdering.GetMove(1, 3) == move1);
+
+    moveOrdering.Clear();
+    assert(packedmove::IsNoMove(moveOrdering.GetKiller(1, 0)));
+    assert(moveOrdering.GetHistory(move4) == 0);
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    // the nk weighted heuristic doesn't depend on the moves evaluated before
+    // the current one, so the order of the moves can't change the result
+    const int32_t SEARCH_DEPTH = 3;
+    int32_t  values[2];
+    uint64_t nodes[2];
+    for (int32_t i = 0; i < 2; i++)
+    {
+        SetMoveOrdering(i == 1);
+        assert(IsMoveOrderingEnabled() == (i == 1));
+
+        values[i] = MinMax(
+                        Heuristic::CalculateNKWeightedv1,
+                        SEARCH_DEPTH,
+                        Game1v1::e_Game1v1Player1,
+                        resultPiece,
+                        resultCoord,
+                        stopFlag);
+        assert(resultPiece.GetType() != e_noPiece);
+        nodes[i] = GetSearchStats().nodes;
+    }
+
+    assert(values[0] == values[1]);
+    assert(nodes[1] < nodes[0]);
+
+#ifdef DEBUG_PRINT
+    std::cout << "  nodes without move ordering: " << nodes[0] << std::endl
+              << "  nodes with move ordering:    " << nodes[1] << std::endl;
+#endif
+}
+
+void Game1v1Test::TestGame1v1PrincipalVariationSearch()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    // both algorithms must pick the same move (the first one with the best value)
+    const int32_t SEARCH_DEPTH = 3;
+    eSearchMode_t modes[] = {e_searchModeAlphaBeta, e_searchModePVS};
+    int32_t    values[2];
+    uint64_t   nodes[2];
+    Piece      pieces[2] = {Piece(e_noPiece), Piece(e_noPiece)};
+    Coordinate coords[2];
+    for (int32_t i = 0; i < 2; i++)
+    {
+        SetSearchMode(modes[i]);
+        assert(GetSearchMode() == modes[i]);
+
+        values[i] = MinMax(
+                        Heuristic::CalculateNKWeightedv1,
+                        SEARCH_DEPTH,
+                        Game1v1::e_Game1v1Player1,
+                        pieces[i],
+                        coords[i],
+                        stopFlag);
+        assert(pieces[i].GetType() != e_noPiece);
+        nodes[i] = GetSearchStats().nodes;
+
+        if (modes[i] == e_searchModeAlphaBeta)
+        {
+            assert(GetSearchStats().nullWindowResearches == 0);
+        }
+    }
+
+    assert(values[0] == values[1]);
+    assert(pieces[0].GetType() == pieces[1].GetType());
+    assert(coords[0] == coords[1]);
+
+    // the null windows of PVS prune more than the full windows of alpha-beta
+    assert(nodes[1] <= nodes[0]);
+
+#ifdef DEBUG_PRINT
+    std::cout << "  nodes searched by alpha-beta:                   " << nodes[0] << std::endl
+              << "  nodes searched by principal variation search:   " << nodes[1] << std::endl;
+#endif
+
+    // the root searched with a window. Below the value of the position it fails
+    // low (no move), above it fails high with a value not smaller than beta
+    SetSearchMode(e_searchModePVS);
+    int32_t value = MinMaxWindow(
+                        Heuristic::CalculateNKWeightedv1,
+                        SEARCH_DEPTH,
+                        Game1v1::e_Game1v1Player1,
+                        resultPiece,
+                        resultCoord,
+                        stopFlag,
+                        Coordinate(),
+                        Piece(e_noPiece),
+                        1,
+                        NULL,
+                        values[0] + 1,
+                        values[0] + 10);
+    assert(value == (values[0] + 1));
+    assert(resultPiece.GetType() == e_noPiece);
+
+    value = MinMaxWindow(
+                Heuristic::CalculateNKWeightedv1,
+                SEARCH_DEPTH,
+                Game1v1::e_Game1v1Player1,
+                resultPiece,
+                resultCoord,
+                stopFlag,
+                Coordinate(),
+                Piece(e_noPiece),
+                1,
+                NULL,
+                values[0] - 10,
+                values[0] - 1);
+    assert(value >= (values[0] - 1));
+    assert(resultPiece.GetType() != e_noPiece);
+
+    // a window which contains the value of the position returns it exactly
+    value = MinMaxWindow(
+                Heuristic::CalculateNKWeightedv1,
+                SEARCH_DEPTH,
+                Game1v1::e_Game1v1Player1,
+                resultPiece,
+                resultCoord,
+                stopFlag,
+                Coordinate(),
+                Piece(e_noPiece),
+                1,
+                NULL,
+                values[0] - 1,
+                values[0] + 1);
+    assert(value == values[0]);
+    assert(coords[0] == resultCoord);
+
+    // iterative deepening searches depth 3 with an aspiration window
+    int32_t depthReached;
+    for (int32_t i = 0; i < 2; i++)
+    {
+        SetSearchMode(modes[i]);
+        TranspositionTable transTable(1);
+        values[i] = MinMaxIterativeDeepening(
+                        Heuristic::CalculateNKWeightedv1,
+                        SEARCH_DEPTH,
+                        0,
+                        Game1v1::e_Game1v1Player1,
+                        resultPiece,
+                        resultCoord,
+                        depthReached,
+                        stopFlag,
+                        Coordinate(),
+                        Piece(e_noPiece),
+                        1,
+                        &transTable);
+        assert(depthReached == SEARCH_DEPTH);
+        assert(resultPiece.GetType() != e_noPiece);
+    }
+    assert(values[0] == values[1]);
+
+    // the rest of the tests use alpha-beta
+    SetSearchMode(e_searchModeAlphaBeta);
+}
+
+void Game1v1Test::TestGame1v1CancellationLatency()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    // put down a few pieces so the search tree is not trivial
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player1,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player1);
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               Game1v1::e_Game1v1Player2,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        Game1v1::PutDownPiece(resultPiece, resultCoord, Game1v1::e_Game1v1Player2);
+    }
+
+    Board extraBoard(m_board);
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    // searches are cancelled long before they could be completed. The time they
+    // take to return after that depends on the machine. The bound is generous
+    const gulong  SEARCH_TIME_US  = 100000;
+    const gdouble MAX_LATENCY_SEC = 0.5;
+
+    CancelledSearchData_t searches[] =
+    {
+        {this, 1, false, NULL},
+        {this, 3, false, NULL},
+        {this, 1, true,  NULL},
+    };
+    for (uint32_t i = 0; i < (sizeof(searches) / sizeof(searches[0])); i++)
+    {
+        CancellationToken cancelToken;
+        searches[i].cancelToken = &cancelToken;
+
+        GThread* searchThread = g_thread_create(
+                reinterpret_cast<GThreadFunc>(Game1v1Test::CancelledSearchThreadRoutine),
+                reinterpret_cast<void*>(&searches[i]),
+                TRUE, // joinable
+                NULL);
+        assert(searchThread != NULL);
+
+        g_usleep(SEARCH_TIME_US);
+
+        GTimer* timer = g_timer_new();
+        cancelToken.Cancel();
+        g_thread_join(searchThread);
+        gdouble latency = g_timer_elapsed(timer, NULL);
+        g_timer_destroy(timer);
+
+#ifdef DEBUG_PRINT
+        std::cout << "    threads: " << searches[i].nThreads
+                  << (searches[i].iterativeDeepening ? " (iterative deepening)" : "")
+                  << " latency: " << (latency * 1000) << "ms" << std::endl;
+#endif
+        assert(latency < MAX_LATENCY_SEC);
+
+        // cancelled searches leave the board as it was
+        Coordinate thisCoord(0, 0);
+        for (thisCoord.m_row = 0 ;
+             thisCoord.m_row < extraBoard.GetNRows();
+             thisCoord.m_row++)
+        {
+            for (thisCoord.m_col = 0 ;
+                 thisCoord.m_col < extraBoard.GetNColumns();
+                 thisCoord.m_col++)
+            {
+                assert (m_board.IsCoordEmpty(thisCoord) ==
+                        extraBoard.IsCoordEmpty(thisCoord));
+            }
+        }
+    }
+}
+
+void* Game1v1Test::CancelledSearchThreadRoutine(void *a_threadParam)
+{
+    CancelledSearchData_t* searchData =
+            reinterpret_cast<CancelledSearchData_t*>(a_threadParam);
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    // none of these searches would be completed in a reasonable time
+    if (searchData->iterativeDeepening)
+    {
+        int32_t depthReached;
+        searchData->game->MinMaxIterativeDeepening(
+                Heuristic::CalculateInfluenceAreaWeighted,
+                GAME1V1_MAX_SEARCH_DEPTH,
+                0,
+                Game1v1::e_Game1v1Player1,
+                resultPiece,
+                resultCoord,
+                depthReached,
+                *(searchData->cancelToken),
+                Coordinate(),
+                Piece(e_noPiece),
+                searchData->nThreads);
+    }
+    else
+    {
+        searchData->game->MinMax(
+                Heuristic::CalculateInfluenceAreaWeighted,
+                8,
+                Game1v1::e_Game1v1Player1,
+                resultPiece,
+                resultCoord,
+                *(searchData->cancelToken),
+                Coordinate(),
+                Piece(e_noPiece),
+                searchData->nThreads);
+    }
+
+    return NULL;
+}
+
+void Game1v1Test::TestGame1v1EndgameSolver()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    // the game is played 1 ply deep till there are few moves left
+    SetEndgameThreshold(0);
+    assert(GetEndgameThreshold() == 0);
+
+    Game1v1::eGame1v1Player_t whoMoves = Game1v1::e_Game1v1Player1;
+    int32_t nPassesInARow = 0;
+    while (nPassesInARow < 2)
+    {
+        const Player &playerMe = GetPlayer(whoMoves);
+        const Player &playerOpponent = GetOpponent(whoMoves);
+        if ( (playerMe.NumberOfPiecesAvailable() < e_numberOfPieces) &&
+             (playerOpponent.NumberOfPiecesAvailable() < e_numberOfPieces) &&
+             (rules::CanPlayerGo(m_board, playerMe)) &&
+             ( (rules::CountValidMoves(m_board, playerMe) +
+                rules::CountValidMoves(m_board, playerOpponent)) <
+                   GAME1V1_DEFAULT_ENDGAME_THRESHOLD ) )
+        {
+            break;
+        }
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               whoMoves,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            nPassesInARow++;
+        }
+        else
+        {
+            nPassesInARow = 0;
+            Game1v1::PutDownPiece(resultPiece, resultCoord, whoMoves);
+        }
+
+        whoMoves = (whoMoves == Game1v1::e_Game1v1Player1) ?
+                        Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+    // the game can't be over before there are few moves left
+    assert(nPassesInARow < 2);
+    assert(IsEndgame(whoMoves) == false);
+
+    SetEndgameThreshold(GAME1V1_DEFAULT_ENDGAME_THRESHOLD);
+    assert(IsEndgame(whoMoves));
+
+    // the depth is ignored, and the evaluation function is never called
+    int32_t value = MinMax(
+                        Heuristic::CalculateNKWeightedv1,
+                        1,
+                        whoMoves,
+                        resultPiece,
+                        resultCoord,
+                        stopFlag);
+    assert(resultPiece.GetType() != e_noPiece);
+    assert(GetSearchStats().leafEvaluations == 0);
+    assert(GetSearchStats().endgameTerminals > 0);
+    uint64_t nodesNoTable = GetSearchStats().nodes;
+
+    // the same value with a transposition table, without move ordering and
+    // with a different heuristic (it is not used)
+    TranspositionTable transTable(1);
+    Piece thisPiece(e_noPiece);
+    Coordinate thisCoord;
+    int32_t thisValue = MinMax(
+                            Heuristic::CalculateNKWeightedv1,
+                            1,
+                            whoMoves,
+                            thisPiece,
+                            thisCoord,
+                            stopFlag,
+                            Coordinate(),
+                            Piece(e_noPiece),
+                            1,
+                            &transTable);
+    assert(thisValue == value);
+    assert(GetSearchStats().nodes <= nodesNoTable);
+
+    SetMoveOrdering(false);
+    thisValue = MinMax(
+                    Heuristic::CalculateCentreFocused,
+                    3,
+                    whoMoves,
+                    thisPiece,
+                    thisCoord,
+                    stopFlag);
+    assert(thisValue == value);
+    assert(GetSearchStats().leafEvaluations == 0);
+    SetMoveOrdering(true);
+
+    // iterative deepening solves the position once
+    int32_t depthReached;
+    thisValue = MinMaxIterativeDeepening(
+                    Heuristic::CalculateNKWeightedv1,
+                    GAME1V1_MAX_SEARCH_DEPTH,
+                    0,
+                    whoMoves,
+                    thisPiece,
+                    thisCoord,
+                    depthReached,
+                    stopFlag);
+    assert(thisValue == value);
+    assert(depthReached == (GetPlayer(whoMoves).NumberOfPiecesAvailable() +
+                            GetOpponent(whoMoves).NumberOfPiecesAvailable()));
+
+    // both players put down the moves of the solver till the end of the game. The
+    // result must be the one predicted by the first search
+    const Game1v1::eGame1v1Player_t solvedPlayer = whoMoves;
+    nPassesInARow = 0;
+    while (nPassesInARow < 2)
+    {
+        assert(IsEndgame(whoMoves));
+
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               whoMoves,
+               resultPiece,
+               resultCoord,
+               stopFlag,
+               Coordinate(),
+               Piece(e_noPiece),
+               1,
+               &transTable);
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            assert(rules::CanPlayerGo(m_board, GetPlayer(whoMoves)) == false);
+            nPassesInARow++;
+        }
+        else
+        {
+            nPassesInARow = 0;
+            Game1v1::PutDownPiece(resultPiece, resultCoord, whoMoves);
+        }
+
+        whoMoves = (whoMoves == Game1v1::e_Game1v1Player1) ?
+                        Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+
+    assert(value == (CalculateSquaresLeft(GetOpponent(solvedPlayer)) -
+                     CalculateSquaresLeft(GetPlayer(solvedPlayer))));
+
+#ifdef DEBUG_PRINT
+    std::cout << "  nodes searched by the endgame solver:           " << nodesNoTable << std::endl
+              << "  exact result of the game:                       " << value << std::endl;
+#endif
+}
+
+void Game1v1Test::TestGame1v1SpecialisedSearch()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // every heuristic gets its own search. Heuristics which are not described
+    // in Heuristic::m_heuristicData are called through their pointer
+    AlphaBetaComputeFunction_t pointerSearch =
+            SelectAlphaBetaCompute(Heuristic::CalculateSimple, false);
+    for (int32_t i = Heuristic::e_heuristicStartCount; i < Heuristic::e_heuristicCount; i++)
+    {
+        Heuristic::EvalFunction_t evalFunction = Heuristic::m_heuristicData[i].m_evalFunction;
+        assert(SelectAlphaBetaCompute(evalFunction, false) == pointerSearch);
+        assert(SelectAlphaBetaCompute(evalFunction, true)  != pointerSearch);
+        for (int32_t j = Heuristic::e_heuristicStartCount; j < i; j++)
+        {
+            assert(SelectAlphaBetaCompute(evalFunction, true) !=
+                   SelectAlphaBetaCompute(Heuristic::m_heuristicData[j].m_evalFunction, true));
+        }
+    }
+    assert(SelectAlphaBetaCompute(Heuristic::CalculateWeightedAreasCompute, true) == pointerSearch);
+
+    const char* SAMPLE_GAMES[] =
+    {
+        "examples/games/game.txt.2",
+        "examples/games/game.txt.3",
+        "examples/games/game.txt.4",
+    };
+    const int32_t N_SAMPLE_GAMES = sizeof(SAMPLE_GAMES) / sizeof(SAMPLE_GAMES[0]);
+
+    typedef struct
+    {
+        Heuristic::EvalFunction_t evalFunction;
+        const char*               name;
+        int32_t                   depth;
+    } BenchmarkSearch_t;
+    const BenchmarkSearch_t SEARCHES[] =
+    {
+        {Heuristic::CalculateWeightedAreas, "weighted areas", 3},
+        {Heuristic::CalculateSimple,        "simple",         3},
+        {Heuristic::CalculateNKWeightedv1,  "nk weighted v1", 2},
+    };
+    const int32_t N_SEARCHES = sizeof(SEARCHES) / sizeof(SEARCHES[0]);
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+
+    for (int32_t search = 0; search < N_SEARCHES; search++)
+    {
+        // time taken by the pointer (0) and the specialised (1) searches
+        gdouble elapsed[2] = {0.0, 0.0};
+
+        for (int32_t game = 0; game < N_SAMPLE_GAMES; game++)
+        {
+            int32_t  values[2];
+            uint64_t nodes[2];
+            Piece    pieces[2] = {Piece(e_noPiece), Piece(e_noPiece)};
+            Coordinate coords[2];
+            for (int32_t i = 0; i < 2; i++)
+            {
+                // the game is loaded before each search. Influence areas calculated
+                // by LoadGame might not be the same as the ones left by the search
+                std::ifstream gameFile(SAMPLE_GAMES[game]);
+                assert(gameFile.good());
+
+                this->Reset();
+                bool loaded = LoadGame(gameFile);
+                assert(loaded);
+
+                SetSpecialisedSearch(i == 1);
+                assert(IsSpecialisedSearchEnabled() == (i == 1));
+
+                GTimer* timer = g_timer_new();
+                values[i] = MinMax(
+                                SEARCHES[search].evalFunction,
+                                SEARCHES[search].depth,
+                                Game1v1::e_Game1v1Player1,
+                                resultPiece,
+                                resultCoord,
+                                stopFlag);
+                elapsed[i] += g_timer_elapsed(timer, NULL);
+                g_timer_destroy(timer);
+
+                nodes[i]  = GetSearchStats().nodes;
+                pieces[i] = resultPiece;
+                coords[i] = resultCoord;
+            }
+
+            assert(values[0] == values[1]);
+            assert(nodes[0] == nodes[1]);
+            assert(pieces[0].GetType() == pieces[1].GetType());
+            assert(coords[0] == coords[1]);
+        }
+
+#ifdef DEBUG_PRINT
+        std::cout << "  " << SEARCHES[search].name << std::endl
+                  << "    pointer dispatch:   " << elapsed[0] << "s" << std::endl
+                  << "    specialised search: " << elapsed[1] << "s" << std::endl;
+#endif
+    }
+
+    SetSpecialisedSearch(true);
+}
+
+void Game1v1Test::TestGame1v1VectorisedHeuristics()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    const weightedpopcount::eKernel_t defaultKernel = weightedpopcount::GetKernel();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    eGame1v1Player_t thisPlayer = Game1v1::e_Game1v1Player1;
+    int32_t nPassed = 0;
+    while (nPassed < 2)
+    {
+        for (int32_t kernel = weightedpopcount::e_kernelScalar;
+             kernel < weightedpopcount::e_kernelCount;
+             kernel++)
+        {
+            if (!weightedpopcount::SetKernel(static_cast<weightedpopcount::eKernel_t>(kernel)))
+            {
+                // not supported by this CPU
+                continue;
+            }
+
+            for (int32_t me = 0; me < 2; me++)
+            {
+                const Player &playerMe       = (me == 0) ? m_player1 : m_player2;
+                const Player &playerOpponent = (me == 0) ? m_player2 : m_player1;
+
+                assert(Heuristic::CalculateCentreFocused(m_board, playerMe, playerOpponent) ==
+                       Heuristic::CalculateCentreFocusedCompute(m_board, playerMe, playerOpponent));
+                assert(Heuristic::CalculateNKWeightedv1(m_board, playerMe, playerOpponent) ==
+                       Heuristic::CalculateNKWeightedv1Compute(m_board, playerMe, playerOpponent));
+
+                // the influence area heuristics have always been calculated with bit planes
+                int32_t influenceArea =
+                    Heuristic::CalculateInfluenceAreaWeighted(m_board, playerMe, playerOpponent);
+                int32_t influenceAreaEastwood =
+                    Heuristic::CalculateInfluenceAreaWeightedEastwood(m_board, playerMe, playerOpponent);
+                weightedpopcount::eKernel_t thisKernel = weightedpopcount::GetKernel();
+                weightedpopcount::SetKernel(weightedpopcount::e_kernelScalar);
+                assert(influenceArea ==
+                       Heuristic::CalculateInfluenceAreaWeighted(m_board, playerMe, playerOpponent));
+                assert(influenceAreaEastwood ==
+                       Heuristic::CalculateInfluenceAreaWeightedEastwood(m_board, playerMe, playerOpponent));
+                weightedpopcount::SetKernel(thisKernel);
+            }
+        }
+        weightedpopcount::SetKernel(defaultKernel);
+
+        // the game goes on till no player can put down any piece
+        Piece resultPiece(e_noPiece);
+        Coordinate resultCoord;
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               thisPlayer,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            nPassed++;
+        }
+        else
+        {
+            nPassed = 0;
+            Game1v1::PutDownPiece(resultPiece, resultCoord, thisPlayer);
+        }
+
+        thisPlayer = (thisPlayer == Game1v1::e_Game1v1Player1) ?
+                Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+    assert(m_board.GetOccupiedPlane().PopCount() > 0);
+
+#ifdef DEBUG_PRINT
+    // time taken by each kernel evaluating the final position
+    const int32_t N_EVALUATIONS = 100000;
+    for (int32_t kernel = weightedpopcount::e_kernelScalar;
+         kernel < weightedpopcount::e_kernelCount;
+         kernel++)
+    {
+        weightedpopcount::eKernel_t thisKernel = static_cast<weightedpopcount::eKernel_t>(kernel);
+        if (!weightedpopcount::SetKernel(thisKernel))
+        {
+            continue;
+        }
+
+        int32_t total = 0;
+        GTimer* timer = g_timer_new();
+        for (int32_t i = 0; i < N_EVALUATIONS; i++)
+        {
+            total += Heuristic::CalculateCentreFocused(m_board, m_player1, m_player2);
+        }
+        gdouble elapsed = g_timer_elapsed(timer, NULL);
+        g_timer_destroy(timer);
+
+        std::cout << "  " << weightedpopcount::GetKernelName(thisKernel) << ": "
+                  << (elapsed * 1000000000.0 / N_EVALUATIONS) << "ns per evaluation ("
+                  << total << ")" << std::endl;
+    }
+
+    GTimer* timer = g_timer_new();
+    int32_t total = 0;
+    for (int32_t i = 0; i < N_EVALUATIONS; i++)
+    {
+        total += Heuristic::CalculateCentreFocusedCompute(m_board, m_player1, m_player2);
+    }
+    gdouble elapsed = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+    std::cout << "  square by square: "
+              << (elapsed * 1000000000.0 / N_EVALUATIONS) << "ns per evaluation ("
+              << total << ")" << std::endl;
+
+    weightedpopcount::SetKernel(defaultKernel);
+#endif
+}
+
+void Game1v1Test::TestGame1v1ExactInfluenceArea()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    // the areas saved in the players are calculated from scratch once. From then on
+    // they are kept up to date by PutDownPiece and RemovePiece
+    rules::RecalculateInfluenceAreaInBoard(m_board, m_player1);
+    rules::RecalculateInfluenceAreaInBoard(m_board, m_player2);
+
+    std::vector<rules::Move_t> moves;
+    std::vector<PieceConf_t> confsPutDown;
+    std::vector<Coordinate> coordsPutDown;
+    std::vector<eGame1v1Player_t> playersPutDown;
+    eGame1v1Player_t thisPlayer = Game1v1::e_Game1v1Player1;
+    int32_t nPassed = 0;
+    while (nPassed < 2)
+    {
+        for (int32_t me = 0; me < 2; me++)
+        {
+            const Player &playerMe = (me == 0) ? m_player1 : m_player2;
+
+            // the exact influence area is made of the squares of every valid move
+            Bitboard expected;
+            rules::CalculateValidMoves(m_board, playerMe, moves);
+            for (uint32_t k = 0; k < moves.size(); k++)
+            {
+                for (uint8_t j = 0; j < moves[k].pieceConf->nSquares; j++)
+                {
+                    expected.Set(m_board.CoordToIndex(Coordinate(
+                            moves[k].coord.m_row + moves[k].pieceConf->squareRows[j],
+                            moves[k].coord.m_col + moves[k].pieceConf->squareCols[j])));
+                }
+            }
+
+            Bitboard influenceArea;
+            rules::CalculateInfluenceAreaInBoard(m_board, playerMe, influenceArea);
+            assert(influenceArea == expected);
+
+            // the area updated every time a piece is put down is the same as
+            // the one calculated from scratch
+            assert(playerMe.GetInfluenceAreaPlane() == expected);
+            assert(playerMe.InfluenceAreaSize() == expected.PopCount());
+        }
+
+        // the game goes on till no player can put down any piece. The search leaves
+        // the areas saved in the players as they were
+        Piece resultPiece(e_noPiece);
+        Coordinate resultCoord;
+        MinMax(Heuristic::CalculateInfluenceAreaExact,
+               1,
+               thisPlayer,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            nPassed++;
+        }
+        else
+        {
+            nPassed = 0;
+
+            PieceConf_t pieceConf;
+            PieceConfTable::Pack(
+                resultPiece.GetCurrentConfiguration(), resultPiece.GetType(), pieceConf);
+
+            Player &playerMe       = (thisPlayer == e_Game1v1Player1) ? m_player1 : m_player2;
+            Player &playerOpponent = (thisPlayer == e_Game1v1Player1) ? m_player2 : m_player1;
+            playerMe.UnsetPiece(resultPiece.GetType());
+            Game1v1::PutDownPiece(
+                    m_board,
+                    resultCoord,
+                    pieceConf,
+                    playerMe,
+                    playerOpponent,
+                    e_influenceAreaExact);
+
+            confsPutDown.push_back(pieceConf);
+            coordsPutDown.push_back(resultCoord);
+            playersPutDown.push_back(thisPlayer);
+        }
+
+        thisPlayer = (thisPlayer == Game1v1::e_Game1v1Player1) ?
+                Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+    assert(m_board.GetOccupiedPlane().PopCount() > 0);
+
+    // removing the pieces leaves the same influence areas as if they had
+    // never been put down
+    while (!confsPutDown.empty())
+    {
+        Player &playerMe =
+            (playersPutDown.back() == e_Game1v1Player1) ? m_player1 : m_player2;
+        Player &playerOpponent =
+            (playersPutDown.back() == e_Game1v1Player1) ? m_player2 : m_player1;
+        playerMe.SetPiece(confsPutDown.back().pieceType);
+        Game1v1::RemovePiece(
+                m_board,
+                coordsPutDown.back(),
+                confsPutDown.back(),
+                playerMe,
+                playerOpponent,
+                e_influenceAreaExact);
+
+        confsPutDown.pop_back();
+        coordsPutDown.pop_back();
+        playersPutDown.pop_back();
+
+        for (int32_t me = 0; me < 2; me++)
+        {
+            const Player &thisMe = (me == 0) ? m_player1 : m_player2;
+
+            Bitboard influenceArea;
+            rules::CalculateInfluenceAreaInBoard(m_board, thisMe, influenceArea);
+            assert(thisMe.GetInfluenceAreaPlane() == influenceArea);
+            assert(thisMe.InfluenceAreaSize() == influenceArea.PopCount());
+        }
+    }
+    assert(m_board.GetOccupiedPlane().IsEmpty());
+
+#ifdef DEBUG_PRINT
+    // time taken by a search with the approximate and the exact influence areas, and
+    // with a heuristic which doesn't read them, from a sample game
+    const Heuristic::EvalFunction_t HEURISTICS[] =
+    {
+        Heuristic::CalculateInfluenceAreaWeighted,
+        Heuristic::CalculateInfluenceAreaExact,
+        Heuristic::CalculateNKWeightedv1,
+    };
+    const char* HEURISTIC_NAMES[] = {"influence area", "exact influence area", "nk weighted"};
+    const int32_t SEARCH_DEPTH = 3;
+
+    for (int32_t i = 0; i < 3; i++)
+    {
+        std::ifstream gameFile("examples/games/game.txt.2");
+        assert(gameFile.good());
+
+        this->Reset();
+        bool loaded = LoadGame(gameFile);
+        assert(loaded);
+
+        Piece resultPiece(e_noPiece);
+        Coordinate resultCoord;
+        GTimer* timer = g_timer_new();
+        int32_t value = MinMax(
+                HEURISTICS[i],
+                SEARCH_DEPTH,
+                Game1v1::e_Game1v1Player1,
+                resultPiece,
+                resultCoord,
+                stopFlag);
+        gdouble elapsed = g_timer_elapsed(timer, NULL);
+        g_timer_destroy(timer);
+
+        std::cout << "  " << HEURISTIC_NAMES[i] << ", depth "
+                  << SEARCH_DEPTH << ": " << (elapsed * 1000) << "ms (" << value << ")"
+                  << std::endl;
+    }
+#endif
+}
+
+bool Game1v1Test::SameBoardState(
+        const Player::BoardState_t &a_state1,
+        const Player::BoardState_t &a_state2)
+{
+    return (a_state1.nkPoints              == a_state2.nkPoints)              &&
+           (a_state1.influenceArea         == a_state2.influenceArea)         &&
+           (a_state1.nkPointsCount         == a_state2.nkPointsCount)         &&
+           (a_state1.influencedCoordsCount == a_state2.influencedCoordsCount) &&
+           (a_state1.nkPointsWeight        == a_state2.nkPointsWeight)        &&
+           (a_state1.influenceAreaWeight   == a_state2.influenceAreaWeight)   &&
+           (a_state1.takenSquaresWeight    == a_state2.takenSquaresWeight)    &&
+           (a_state1.hashKey               == a_state2.hashKey);
+}
+
+void Game1v1Test::TestGame1v1UndoRecord()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // game1v1 must be reset before starting (otherwise it might fail)
+    this->Reset();
+
+    // no one will change it
+    volatile sig_atomic_t stopFlag = 0;
+
+    std::vector<rules::Move_t> moves;
+    eGame1v1Player_t thisPlayer = Game1v1::e_Game1v1Player1;
+    int32_t nPassed = 0;
+    int32_t nMovesChecked = 0;
+    while (nPassed < 2)
+    {
+        Player &playerMe       = (thisPlayer == Game1v1::e_Game1v1Player1) ? m_player1 : m_player2;
+        Player &playerOpponent = (thisPlayer == Game1v1::e_Game1v1Player1) ? m_player2 : m_player1;
+
+        const Board    boardBefore(m_board);
+        const Bitboard playerPlaneMeBefore       = m_board.GetPlayerPlane(playerMe);
+        const Bitboard playerPlaneOpponentBefore = m_board.GetPlayerPlane(playerOpponent);
+        Player::BoardState_t stateMeBefore;
+        Player::BoardState_t stateOpponentBefore;
+        playerMe.SaveBoardState(stateMeBefore);
+        playerOpponent.SaveBoardState(stateOpponentBefore);
+
+        // every valid move is put down and removed the same way the search does it
+        rules::CalculateValidMoves(m_board, playerMe, moves);
+        for (uint32_t k = 0; k < moves.size(); k++)
+        {
+            const PieceConf_t &thisConf = *(moves[k].pieceConf);
+
+            UndoRecord_t undoRecord;
+            playerMe.UnsetPiece(thisConf.pieceType);
+            Game1v1::PutDownPiece(
+                    m_board,
+                    moves[k].coord,
+                    thisConf,
+                    playerMe,
+                    playerOpponent,
+                    undoRecord);
+            assert(m_board.GetOccupiedPlane().PopCount() ==
+                   boardBefore.GetOccupiedPlane().PopCount() + thisConf.nSquares);
+
+            Game1v1::RemovePiece(
+                    m_board,
+                    moves[k].coord,
+                    thisConf,
+                    undoRecord,
+                    playerMe,
+                    playerOpponent);
+            playerMe.SetPiece(thisConf.pieceType);
+
+            Player::BoardState_t stateMeAfter;
+            Player::BoardState_t stateOpponentAfter;
+            playerMe.SaveBoardState(stateMeAfter);
+            playerOpponent.SaveBoardState(stateOpponentAfter);
+
+            assert(m_board.GetOccupiedPlane() == boardBefore.GetOccupiedPlane());
+            assert(m_board.GetEmptyPlane() == boardBefore.GetEmptyPlane());
+            assert(m_board.GetPlayerPlane(playerMe) == playerPlaneMeBefore);
+            assert(m_board.GetPlayerPlane(playerOpponent) == playerPlaneOpponentBefore);
+            assert(SameBoardState(stateMeAfter, stateMeBefore));
+            assert(SameBoardState(stateOpponentAfter, stateOpponentBefore));
+
+            nMovesChecked++;
+        }
+
+        // the game goes on till no player can put down any piece
+        Piece resultPiece(e_noPiece);
+        Coordinate resultCoord;
+        MinMax(Heuristic::CalculateNKWeightedv1,
+               1,
+               thisPlayer,
+               resultPiece,
+               resultCoord,
+               stopFlag);
+        if (resultPiece.GetType() == e_noPiece)
+        {
+            nPassed++;
+        }
+        else
+        {
+            nPassed = 0;
+            Game1v1::PutDownPiece(resultPiece, resultCoord, thisPlayer);
+        }
+
+        thisPlayer = (thisPlayer == Game1v1::e_Game1v1Player1) ?
+                Game1v1::e_Game1v1Player2 : Game1v1::e_Game1v1Player1;
+    }
+    assert(nMovesChecked > 0);
+
+#ifdef DEBUG_PRINT
+    // time taken by a search from a sample game. Pieces are removed in the
+    // search tree with an undo record
+    std::ifstream gameFile("examples/games/game.txt.2");
+    assert(gameFile.good());
+
+    this->Reset();
+    bool loaded = LoadGame(gameFile);
+    assert(loaded);
+
+    const int32_t SEARCH_DEPTH = 3;
+    Piece resultPiece(e_noPiece);
+    Coordinate resultCoord;
+    GTimer* timer = g_timer_new();
+    int32_t value = MinMax(
+            Heuristic::CalculateNKWeightedv1,
+            SEARCH_DEPTH,
+            Game1v1::e_Game1v1Player1,
+            resultPiece,
+            resultCoord,
+            stopFlag);
+    gdouble elapsed = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+    std::cout << "  " << nMovesChecked << " moves undone. Search depth "
+              << SEARCH_DEPTH << ": " << (elapsed * 1000) << "ms (" << value << ")"
+              << std::endl;
+#endif
+}
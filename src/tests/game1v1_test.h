@@ -25,6 +25,20 @@
 ///           Faustino Frechilla 13-Sep-2009  Original development
 ///           Faustino Frechilla 06-May-2010  Bitwise configuration check
 ///           Faustino Frechilla 15-Jul-2010  Bitwise stuff moved to bitwise_test.[cpp|h]
+///           agent              17-Oct-2026  Parallel MinMax test
+///           agent              17-Oct-2026  Zobrist keys and transposition table test
+///           agent              17-Oct-2026  Iterative deepening test
+///           agent              17-Oct-2026  Incremental heuristic test
+///           agent              17-Oct-2026  Search statistics test
+///           agent              17-Oct-2026  Search allocations test
+///           agent              17-Oct-2026  Move ordering test
+///           agent              17-Oct-2026  Principal variation search test
+///           agent              17-Oct-2026  Cancellation latency test
+///           agent              17-Oct-2026  Endgame solver test
+///           agent              17-Oct-2026  Specialised search benchmark
+///           agent              17-Oct-2026  Vectorised heuristics test
+///           agent              17-Oct-2026  Exact influence area test
+///           agent              17-Oct-2026  Undo record test
 /// @endhistory
 ///
 // ============================================================================
@@ -58,6 +72,96 @@ private:
     /// Tests if Game1v1::GetAllNucleationPoints works properly
     void TestGame1v1GetAllNucleationPoints(eGame1v1Player_t who);
 
+    /// tests the move calculated by MinMax doesn't depend on the number of
+    /// threads the search is split into
+    void TestGame1v1ParallelMinMax();
+
+    /// tests zobrist keys are kept up to date when pieces are put down and removed
+    /// and MinMax can make use of a transposition table
+    void TestGame1v1TranspositionTable();
+
+    /// tests MinMaxIterativeDeepening reaches the expected depth and
+    /// returns within its time budget
+    void TestGame1v1IterativeDeepening();
+
+    /// tests the weighted sums read by Heuristic::CalculateWeightedAreas are kept
+    /// up to date when pieces are put down and removed (its value must be the same
+    /// as the one calculated by Heuristic::CalculateWeightedAreasCompute), and the
+    /// heuristics not listed by Heuristic::ReadsInfluenceAreas don't read them
+    void TestGame1v1IncrementalHeuristic();
+
+    /// tests the statistics saved by MinMax are consistent with each other
+    /// (nodes per ply add up to the total, every cutoff has its move index...)
+    void TestGame1v1SearchStats();
+
+    /// tests MinMax doesn't allocate any memory once the search is running,
+    /// whatever the heuristic and with a transposition table
+    void TestGame1v1SearchAllocations();
+
+    /// tests killer moves and history are saved when a move prunes the rest of
+    /// the branches, and MinMax returns the same value with and without move ordering
+    /// (searching less nodes with it)
+    void TestGame1v1MoveOrdering();
+
+    /// tests the principal variation search returns the same move and value as
+    /// alpha-beta, and the root of the tree searched with a window returns bounds
+    /// when its value is not inside the window
+    void TestGame1v1PrincipalVariationSearch();
+
+    /// tests MinMax (1 and several threads) and MinMaxIterativeDeepening return
+    /// shortly after their cancellation token is cancelled, and cancelled searches
+    /// leave the board as it was
+    void TestGame1v1CancellationLatency();
+
+    /// tests positions with few moves left are solved up to the end of the game
+    /// without calling the evaluation function, with the same value whatever the
+    /// transposition table and move ordering are, and the game played out with
+    /// the moves of the solver finishes with the result it predicted
+    void TestGame1v1EndgameSolver();
+
+    /// tests the search specialised for each heuristic returns the same move and
+    /// value, visiting the same nodes, as the one which calls the heuristic through
+    /// its pointer on the sample games, and compares the time taken by both
+    void TestGame1v1SpecialisedSearch();
+
+    /// tests the heuristics calculated with weightedpopcount return the same value
+    /// as the square by square versions with every kernel supported by the CPU
+    /// while a game is played
+    void TestGame1v1VectorisedHeuristics();
+
+    /// tests the exact influence area is made of the squares of every valid move, and
+    /// the areas updated by PutDownPiece and RemovePiece with e_influenceAreaExact are
+    /// the same as the ones calculated from scratch while a game is played and undone
+    void TestGame1v1ExactInfluenceArea();
+
+    /// tests pieces put down and removed with an undo record leave the board and
+    /// both players bit-identical to how they were, for every valid move of the
+    /// positions of a game
+    void TestGame1v1UndoRecord();
+
+    /// @return true if both states saved by Player::SaveBoardState are the same
+    static bool SameBoardState(
+            const Player::BoardState_t &a_state1,
+            const Player::BoardState_t &a_state2);
+
+    /// @brief a search run in its own thread by TestGame1v1CancellationLatency
+    typedef struct
+    {
+        /// game the search is run on
+        Game1v1Test*             game;
+        /// number of threads of the search
+        int32_t                  nThreads;
+        /// true if it is run with MinMaxIterativeDeepening. MinMax otherwise
+        bool                     iterativeDeepening;
+        /// token the search is cancelled with
+        const CancellationToken* cancelToken;
+    } CancelledSearchData_t;
+
+    /// The routine of the thread TestGame1v1CancellationLatency runs its searches in
+    /// @param pointer to a CancelledSearchData_t structure
+    /// @return NULL
+    static void* CancelledSearchThreadRoutine(void *a_threadParam);
+
     void PutDownPiece(Piece &a_piece)
     {
         Game1v1::PutDownPiece(
@@ -0,0 +1,310 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  game_4players_test.cpp
+/// @brief regression testing for the search of the Game4Players class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <cassert>
+#include "game_4players_test.h"
+#include "rules.h"
+
+/// heuristic the positions of the test are evaluated with
+static const Heuristic::eHeuristicType_t GAME4PLAYERS_TEST_HEURISTIC =
+        Heuristic::e_heuristicInfluenceArea;
+
+/// size of the (small) board the searches of the test are run on
+static const int32_t GAME4PLAYERS_TEST_BOARD_SIZE = 12;
+
+/// number of moves put down before the searches of the test are run
+static const int32_t GAME4PLAYERS_TEST_OPENING_MOVES = 8;
+
+/// time budget (in milliseconds) of the iterative deepening test
+static const int32_t GAME4PLAYERS_TEST_TIME_BUDGET_MS = 500;
+
+Game4PlayersTest::Game4PlayersTest()
+{
+}
+
+Game4PlayersTest::~Game4PlayersTest()
+{
+}
+
+void Game4PlayersTest::DoTest()
+{
+    TestSelfPlayedGame();
+    TestParallelSearch();
+    TestIterativeDeepening();
+}
+
+void Game4PlayersTest::CheckNKPoints(const Game4Players &a_game)
+{
+    Bitboard nkPoints;
+    for (int32_t i = Game4Players::e_Game4_Player1; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        const Player &thisPlayer =
+            a_game.GetPlayer(static_cast<Game4Players::eGame4_Player_t>(i));
+
+        rules::CalculateNucleationPointsCompute(a_game.GetBoard(), thisPlayer, nkPoints);
+        assert(thisPlayer.GetNucleationPointsPlane() == nkPoints);
+    }
+}
+
+bool Game4PlayersTest::SameBoardState(
+        const Player::BoardState_t &a_state1,
+        const Player::BoardState_t &a_state2)
+{
+    return (a_state1.nkPoints              == a_state2.nkPoints)              &&
+           (a_state1.influenceArea         == a_state2.influenceArea)         &&
+           (a_state1.nkPointsCount         == a_state2.nkPointsCount)         &&
+           (a_state1.influencedCoordsCount == a_state2.influencedCoordsCount) &&
+           (a_state1.nkPointsWeight        == a_state2.nkPointsWeight)        &&
+           (a_state1.influenceAreaWeight   == a_state2.influenceAreaWeight)   &&
+           (a_state1.takenSquaresWeight    == a_state2.takenSquaresWeight)    &&
+           (a_state1.hashKey               == a_state2.hashKey);
+}
+
+void Game4PlayersTest::TestSelfPlayedGame()
+{
+    Game4Players theGame;
+    theGame.Reset(
+        GAME4PLAYERS_TEST_BOARD_SIZE,
+        GAME4PLAYERS_TEST_BOARD_SIZE,
+        Coordinate(0, 0),
+        Coordinate(0, GAME4PLAYERS_TEST_BOARD_SIZE - 1),
+        Coordinate(GAME4PLAYERS_TEST_BOARD_SIZE - 1, GAME4PLAYERS_TEST_BOARD_SIZE - 1),
+        Coordinate(GAME4PLAYERS_TEST_BOARD_SIZE - 1, 0));
+
+    CancellationToken token;
+    Game4Players::eGame4_Player_t currentPlayer = Game4Players::e_Game4_Player1;
+    int32_t nPasses = 0;
+    int32_t nMoves  = 0;
+
+    while (nPasses < Game4Players::e_Game4_PlayersCount)
+    {
+        Piece thisPiece(e_noPiece);
+        Coordinate thisCoord;
+        theGame.MinMax(
+            Heuristic::m_heuristicData[GAME4PLAYERS_TEST_HEURISTIC].m_evalFunction,
+            1,
+            currentPlayer,
+            thisPiece,
+            thisCoord,
+            token);
+
+        if (thisPiece.GetType() == e_noPiece)
+        {
+            assert(!rules::CanPlayerGo(theGame.GetBoard(), theGame.GetPlayer(currentPlayer)));
+            nPasses++;
+        }
+        else
+        {
+            // the 1st piece of each player touches its starting coordinate
+            // (which is not a nucleation point)
+            assert( (theGame.GetPlayer(currentPlayer).NumberOfPiecesAvailable() == e_numberOfPieces) ||
+                    rules::IsPieceDeployableCompute(
+                        theGame.GetBoard(),
+                        thisPiece.GetCurrentConfiguration(),
+                        thisCoord,
+                        theGame.GetPlayer(currentPlayer)));
+
+            // removing the piece restores the nk points of every player
+            theGame.PutDownPiece(thisPiece, thisCoord, currentPlayer);
+            CheckNKPoints(theGame);
+            theGame.RemovePiece(thisPiece, thisCoord, currentPlayer);
+            CheckNKPoints(theGame);
+
+            theGame.PutDownPiece(thisPiece, thisCoord, currentPlayer);
+            nPasses = 0;
+            nMoves++;
+        }
+
+        currentPlayer = Game4Players::GetNextPlayerType(currentPlayer);
+    }
+
+    // the board is not big enough for everybody
+    assert(nMoves > Game4Players::e_Game4_PlayersCount);
+    assert(nMoves < Game4Players::e_Game4_PlayersCount * e_numberOfPieces);
+
+    // a copy of the game holds its own players
+    Game4Players gameCopy(theGame);
+    gameCopy.Reset(
+        GAME4PLAYERS_TEST_BOARD_SIZE,
+        GAME4PLAYERS_TEST_BOARD_SIZE,
+        Coordinate(0, 0),
+        Coordinate(0, GAME4PLAYERS_TEST_BOARD_SIZE - 1),
+        Coordinate(GAME4PLAYERS_TEST_BOARD_SIZE - 1, GAME4PLAYERS_TEST_BOARD_SIZE - 1),
+        Coordinate(GAME4PLAYERS_TEST_BOARD_SIZE - 1, 0));
+    CheckNKPoints(theGame);
+    CheckNKPoints(gameCopy);
+    assert(gameCopy.GetPlayer(Game4Players::e_Game4_Player1).NumberOfPiecesAvailable() ==
+           e_numberOfPieces);
+}
+
+void Game4PlayersTest::TestParallelSearch()
+{
+    Game4Players theGame;
+    theGame.Reset(
+        GAME4PLAYERS_TEST_BOARD_SIZE,
+        GAME4PLAYERS_TEST_BOARD_SIZE,
+        Coordinate(0, 0),
+        Coordinate(0, GAME4PLAYERS_TEST_BOARD_SIZE - 1),
+        Coordinate(GAME4PLAYERS_TEST_BOARD_SIZE - 1, GAME4PLAYERS_TEST_BOARD_SIZE - 1),
+        Coordinate(GAME4PLAYERS_TEST_BOARD_SIZE - 1, 0));
+
+    CancellationToken token;
+    Game4Players::eGame4_Player_t currentPlayer = Game4Players::e_Game4_Player1;
+
+    // a few moves first, so the search is not run at the start of the game
+    for (int32_t i = 0; i < GAME4PLAYERS_TEST_OPENING_MOVES; i++)
+    {
+        Piece thisPiece(e_noPiece);
+        Coordinate thisCoord;
+        theGame.MinMax(
+            Heuristic::m_heuristicData[GAME4PLAYERS_TEST_HEURISTIC].m_evalFunction,
+            1,
+            currentPlayer,
+            thisPiece,
+            thisCoord,
+            token);
+        assert(thisPiece.GetType() != e_noPiece);
+
+        theGame.PutDownPiece(thisPiece, thisCoord, currentPlayer);
+        currentPlayer = Game4Players::GetNextPlayerType(currentPlayer);
+    }
+
+    Player::BoardState_t statesBefore[Game4Players::e_Game4_PlayersCount];
+    for (int32_t i = Game4Players::e_Game4_Player1; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        theGame.GetPlayer(static_cast<Game4Players::eGame4_Player_t>(i)).SaveBoardState(
+            statesBefore[i]);
+    }
+
+    Piece pieceSerial(e_noPiece);
+    Coordinate coordSerial;
+    int32_t valueSerial = theGame.MinMax(
+            Heuristic::m_heuristicData[GAME4PLAYERS_TEST_HEURISTIC].m_evalFunction,
+            3,
+            currentPlayer,
+            pieceSerial,
+            coordSerial,
+            token,
+            1);
+    assert(pieceSerial.GetType() != e_noPiece);
+
+    const Game4Players::SearchStats_t &stats = theGame.GetSearchStats();
+    assert(stats.nodes > stats.movesGenerated / 1000);
+    assert(stats.movesTried > 0);
+    assert(stats.leafEvaluations > 0);
+
+    Piece pieceParallel(e_noPiece);
+    Coordinate coordParallel;
+    int32_t valueParallel = theGame.MinMax(
+            Heuristic::m_heuristicData[GAME4PLAYERS_TEST_HEURISTIC].m_evalFunction,
+            3,
+            currentPlayer,
+            pieceParallel,
+            coordParallel,
+            token,
+            4);
+
+    assert(valueParallel == valueSerial);
+    assert(pieceParallel.GetType() == pieceSerial.GetType());
+    assert(pieceParallel.GetCurrentConfiguration().m_pieceSquares ==
+           pieceSerial.GetCurrentConfiguration().m_pieceSquares);
+    assert(coordParallel == coordSerial);
+
+    // the search doesn't modify the game. Pieces removed during the search restore
+    // the influence areas too
+    CheckNKPoints(theGame);
+    for (int32_t i = Game4Players::e_Game4_Player1; i < Game4Players::e_Game4_PlayersCount; i++)
+    {
+        Player::BoardState_t stateAfter;
+        theGame.GetPlayer(static_cast<Game4Players::eGame4_Player_t>(i)).SaveBoardState(
+            stateAfter);
+        assert(SameBoardState(statesBefore[i], stateAfter));
+    }
+
+    // a cancelled search returns straight away
+    CancellationToken cancelledToken;
+    cancelledToken.Cancel();
+    theGame.MinMax(
+        Heuristic::m_heuristicData[GAME4PLAYERS_TEST_HEURISTIC].m_evalFunction,
+        GAME4PLAYERS_MAX_SEARCH_DEPTH,
+        currentPlayer,
+        pieceParallel,
+        coordParallel,
+        cancelledToken,
+        2);
+}
+
+void Game4PlayersTest::TestIterativeDeepening()
+{
+    Game4Players theGame;
+
+    CancellationToken token;
+    Piece thisPiece(e_noPiece);
+    Coordinate thisCoord;
+    int32_t depthReached = 0;
+
+    GTimer* timer = g_timer_new();
+    theGame.MinMaxIterativeDeepening(
+        Heuristic::m_heuristicData[GAME4PLAYERS_TEST_HEURISTIC].m_evalFunction,
+        GAME4PLAYERS_MAX_SEARCH_DEPTH,
+        GAME4PLAYERS_TEST_TIME_BUDGET_MS,
+        Game4Players::e_Game4_Player1,
+        thisPiece,
+        thisCoord,
+        depthReached,
+        token,
+        2);
+    gdouble elapsed = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+    // depth 1 is always completed. The rest of iterations are cancelled
+    // when the time runs out (leave some margin for slow machines)
+    assert(depthReached >= 1);
+    assert(depthReached < GAME4PLAYERS_MAX_SEARCH_DEPTH);
+    assert(elapsed * 1000 < 4 * GAME4PLAYERS_TEST_TIME_BUDGET_MS);
+
+    // the 1st piece must take up the starting coordinate of the player
+    assert(thisPiece.GetType() != e_noPiece);
+    const Coordinate &startingCoord =
+        theGame.GetPlayer(Game4Players::e_Game4_Player1).GetStartingCoordinate();
+
+    bool startingCoordTaken = false;
+    PieceConfigurationContainer_t::const_iterator it;
+    for (it  = thisPiece.GetCurrentConfiguration().m_pieceSquares.begin();
+         it != thisPiece.GetCurrentConfiguration().m_pieceSquares.end();
+         it++)
+    {
+        if (Coordinate(thisCoord.m_row + it->m_row, thisCoord.m_col + it->m_col) ==
+                startingCoord)
+        {
+            startingCoordTaken = true;
+        }
+    }
+    assert(startingCoordTaken);
+}
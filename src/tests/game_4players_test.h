@@ -0,0 +1,68 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  game_4players_test.h
+/// @brief regression testing for the search of the Game4Players class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef GAME_4PLAYERS_TEST_H_
+#define GAME_4PLAYERS_TEST_H_
+
+#include "game_4players.h"
+
+/// @brief regression testing for the search of the Game4Players class
+class Game4PlayersTest
+{
+public:
+    Game4PlayersTest();
+    virtual ~Game4PlayersTest();
+
+    /// launches the 4 players test!
+    void DoTest();
+
+private:
+
+    /// plays a whole game with depth 1 searches checking the nk points of the
+    /// 4 players (updated incrementally) after each move
+    void TestSelfPlayedGame();
+
+    /// checks MinMax returns the same move no matter the number of threads, and
+    /// leaves the players exactly as they were
+    void TestParallelSearch();
+
+    /// checks MinMaxIterativeDeepening returns a move within its time budget
+    void TestIterativeDeepening();
+
+    /// @brief asserts the nk points of every player of a_game are the ones
+    ///        calculated from scratch using the board
+    static void CheckNKPoints(const Game4Players &a_game);
+
+    /// @return true if both states saved by Player::SaveBoardState are the same
+    static bool SameBoardState(
+            const Player::BoardState_t &a_state1,
+            const Player::BoardState_t &a_state2);
+};
+
+#endif /* GAME_4PLAYERS_TEST_H_ */
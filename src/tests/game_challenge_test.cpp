@@ -0,0 +1,179 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  game_challenge_test.cpp
+/// @brief regression testing for the GameChallenge class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <iostream>
+#include <glib.h> // GTimer
+#include "assert.h"
+#include "game_challenge_test.h"
+
+#define CHALLENGE_DIR "challengetest"
+
+/// number of threads used to test the parallel Solve
+static const int32_t GAME_CHALLENGE_TEST_THREADS = 4;
+
+/// time budget (in ms) given to Solve to try to solve a challenge which
+/// takes much longer than that
+static const int32_t GAME_CHALLENGE_TEST_TIME_BUDGET_MS = 200;
+
+GameChallengeTest::GameChallengeTest()
+{
+}
+
+GameChallengeTest::~GameChallengeTest()
+{
+}
+
+void GameChallengeTest::DoTest()
+{
+    TestSolve(1);
+    TestSolve(GAME_CHALLENGE_TEST_THREADS);
+    TestSolveTimeBudget(1);
+    TestSolveTimeBudget(GAME_CHALLENGE_TEST_THREADS);
+}
+
+void GameChallengeTest::LoadChallenge(const char* a_path, BlockemChallenge &out_challenge)
+{
+    try
+    {
+        out_challenge.LoadXMLChallenge(a_path);
+    }
+    catch (const std::runtime_error &ex)
+    {
+        // error!
+        std::cout << "Exception caught: " << ex.what() << std::endl;
+        assert(0);
+    }
+}
+
+bool GameChallengeTest::IsSolved(
+        const GameChallenge    &a_game,
+        const BlockemChallenge &a_challenge)
+{
+    if (a_game.GetChallenger().NumberOfPiecesAvailable() != 0)
+    {
+        return false;
+    }
+
+    Bitboard takenPlane;
+    STLCoordinateSet_t::const_iterator it;
+    for (it  = a_challenge.GetChallengerTakenSquares().begin();
+         it != a_challenge.GetChallengerTakenSquares().end();
+         it++)
+    {
+        takenPlane.Set(a_game.GetBoard().CoordToIndex(*it));
+    }
+
+    int32_t nSquares = takenPlane.PopCount();
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        if (a_challenge.IsChallengerPieceAvailable(static_cast<ePieceType_t>(i)))
+        {
+            nSquares += static_cast<int32_t>(
+                    a_game.GetChallenger().m_pieces[i].GetNSquares());
+        }
+    }
+
+    const Bitboard challengerPlane = a_game.GetBoard().GetPlayerPlane(a_game.GetChallenger());
+
+    return ( ((challengerPlane & takenPlane) == takenPlane) &&
+             (challengerPlane.PopCount() == nSquares)       );
+}
+
+void GameChallengeTest::TestSolve(int32_t a_nThreads)
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    BlockemChallenge theChallenge;
+
+    // solvable challenge. The challenger has squares taken and a starting
+    // coordinate (which is ignored)
+    LoadChallenge(CHALLENGE_DIR"/challenge_valid1.xml", theChallenge);
+    GameChallenge theGame(theChallenge);
+    assert(theGame.Solve(a_nThreads) == true);
+    assert(IsSolved(theGame, theChallenge));
+    assert(theGame.GetSolverStats().completed);
+    assert(theGame.GetSolverStats().nodes > 0);
+
+    // solvable challenge with only the baby piece left
+    LoadChallenge(CHALLENGE_DIR"/challenge_valid2.xml", theChallenge);
+    theGame.Reset(theChallenge);
+    assert(theGame.Solve(a_nThreads) == true);
+    assert(IsSolved(theGame, theChallenge));
+
+    // the opponent walls off the starting coordinate. The search is
+    // over before the first piece is put down
+    LoadChallenge(CHALLENGE_DIR"/challenge_solver_unreachable.xml", theChallenge);
+    theGame.Reset(theChallenge);
+    Bitboard occupiedPlane = theGame.GetBoard().GetOccupiedPlane();
+    assert(theGame.Solve(a_nThreads) == false);
+    assert(theGame.GetSolverStats().completed);
+    assert(theGame.GetSolverStats().nodes == 0);
+    assert(theGame.GetSolverStats().prunedNodes == 1);
+    assert(theGame.GetBoard().GetOccupiedPlane() == occupiedPlane);
+
+    // the whole tree has to be explored to know there is no solution
+    LoadChallenge(CHALLENGE_DIR"/challenge_solver_unsolvable.xml", theChallenge);
+    theGame.Reset(theChallenge);
+    occupiedPlane = theGame.GetBoard().GetOccupiedPlane();
+    assert(theGame.Solve(a_nThreads) == false);
+    assert(theGame.GetSolverStats().completed);
+    assert(theGame.GetSolverStats().nodes > 0);
+    assert(theGame.GetSolverStats().prunedNodes > 0);
+    assert(theGame.GetBoard().GetOccupiedPlane() == occupiedPlane);
+    assert(theGame.GetChallenger().NumberOfPiecesAvailable() == 8);
+}
+
+void GameChallengeTest::TestSolveTimeBudget(int32_t a_nThreads)
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    BlockemChallenge theChallenge;
+    LoadChallenge(CHALLENGE_DIR"/challenge_solver_timeout.xml", theChallenge);
+
+    GameChallenge theGame(theChallenge);
+    const Bitboard occupiedPlane = theGame.GetBoard().GetOccupiedPlane();
+
+    GTimer* timer = g_timer_new();
+    bool solved = theGame.Solve(a_nThreads, GAME_CHALLENGE_TEST_TIME_BUDGET_MS);
+    gdouble elapsed = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+    assert(solved == false);
+    assert(theGame.GetSolverStats().completed == false);
+    assert(theGame.GetSolverStats().nodes > 0);
+    assert(theGame.GetBoard().GetOccupiedPlane() == occupiedPlane);
+    assert(theGame.GetChallenger().NumberOfPiecesAvailable() == e_numberOfPieces);
+
+    // it must be stopped shortly after the time runs out
+    assert(elapsed < 10 * (GAME_CHALLENGE_TEST_TIME_BUDGET_MS / 1000.0));
+}
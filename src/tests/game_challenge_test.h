@@ -0,0 +1,71 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  game_challenge_test.h
+/// @brief regression testing for the GameChallenge class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef GAME_CHALLENGE_TEST_H_
+#define GAME_CHALLENGE_TEST_H_
+
+#include "game_challenge.h"
+#include "blockem_challenge.h"
+
+/// @brief regression testing for the GameChallenge class
+class GameChallengeTest
+{
+public:
+    GameChallengeTest();
+    virtual ~GameChallengeTest();
+
+    /// launches the game challenge test!
+    void DoTest();
+
+private:
+
+    /// test the challenge solver in 3 different cases:
+    ///   1) Solvable challenges (with and without a starting coordinate)
+    ///   2) Pieces don't fit in the region the challenger can reach
+    ///   3) Unsolvable challenge with room enough for all the pieces
+    /// @param number of threads Solve will be run with
+    void TestSolve(int32_t a_nThreads);
+
+    /// tests Solve returns shortly after its time budget runs out, leaving
+    /// the board as it was
+    /// @param number of threads Solve will be run with
+    void TestSolveTimeBudget(int32_t a_nThreads);
+
+    /// @brief loads the challenge saved in a_path
+    /// the test fails if it can't be loaded
+    static void LoadChallenge(const char* a_path, BlockemChallenge &out_challenge);
+
+    /// @return true if all the pieces of the challenger have been put down on
+    ///         top of the squares it took when a_challenge was loaded
+    static bool IsSolved(
+            const GameChallenge    &a_game,
+            const BlockemChallenge &a_challenge);
+};
+
+#endif /* GAME_CHALLENGE_TEST_H_ */
@@ -23,21 +23,40 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 18-Oct-2010  Original development
+///           agent              17-Oct-2026  Parallel Solve and benchmark
+///           agent              17-Oct-2026  Search allocations test
+///           agent              17-Oct-2026  Solve cancellation test
 /// @endhistory
 ///
 // ============================================================================
 
+#include <iostream>
+#include <glib.h> // GTimer
 #include "game_total_allocation_test.h"
 #include "bitwise.h"
 #include "rules.h"
-#ifdef DEBUG_PRINT
-#include <iostream>
-#endif
+#include "allocation_counter.h"
 
 static const int32_t TEST_NROWS = 14;
 static const int32_t TEST_NCOLS = 14;
 static const Coordinate TEST_STARTING_COORD = Coordinate();
 
+/// number of threads used to test the parallel Solve
+static const int32_t GAME_TOTAL_ALLOCATION_TEST_THREADS = 4;
+
+/// board sizes (rows, columns) used by BenchmarkSolve. All the pieces take
+/// 89 squares. Smaller boards than these can take hours to be solved
+static const int32_t BENCHMARK_SOLVE_SIZES[][2] =
+{
+    {14, 14},
+    {12, 18},
+    {10, 18},
+    { 9, 20},
+    {20, 20},
+};
+static const int32_t BENCHMARK_SOLVE_NSIZES =
+    sizeof(BENCHMARK_SOLVE_SIZES) / sizeof(BENCHMARK_SOLVE_SIZES[0]);
+
 GameTotalAllocationTest::GameTotalAllocationTest() :
     GameTotalAllocation(TEST_NROWS, TEST_NCOLS, TEST_STARTING_COORD)
 {
@@ -50,7 +69,12 @@ GameTotalAllocationTest::~GameTotalAllocationTest()
 void GameTotalAllocationTest::DoTest()
 {
     TestGameTotalAllocationPutDownAndRemovePiece();
-    TestSolve();
+    TestSolve(1);
+    TestSolve(GAME_TOTAL_ALLOCATION_TEST_THREADS);
+    TestAllocateAllPiecesAllocations();
+    TestSolveCancellation(1);
+    TestSolveCancellation(GAME_TOTAL_ALLOCATION_TEST_THREADS);
+    BenchmarkSolve();
 }
 
 bool GameTotalAllocationTest::IsBoardEmpty()
@@ -69,7 +93,23 @@ bool GameTotalAllocationTest::IsBoardEmpty()
     return true;
 }
 
-void GameTotalAllocationTest::TestSolve()
+bool GameTotalAllocationTest::IsSolved()
+{
+    if (m_player.NumberOfPiecesAvailable() != 0)
+    {
+        return false;
+    }
+
+    int32_t nSquares = 0;
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        nSquares += static_cast<int32_t>(m_player.m_pieces[i].GetNSquares());
+    }
+
+    return (GetBoard().GetPlayerPlane(m_player).PopCount() == nSquares);
+}
+
+void GameTotalAllocationTest::TestSolve(int32_t a_nThreads)
 {
 #ifdef DEBUG_PRINT
     std::cout << __FUNCTION__ << std::endl;
@@ -79,25 +119,28 @@ void GameTotalAllocationTest::TestSolve()
     Reset(2, 2, Coordinate(0, 0));    
     assert(IsBoardEmpty());
     assert(m_startingCoord.Initialised() == true);
-    assert(Solve() == false);
+    assert(Solve(a_nThreads) == false);
+    assert(IsBoardEmpty());
     
     // Impossible to solve starting from anywhere
     Reset(3, 3, Coordinate());
     assert(IsBoardEmpty());
     assert(m_startingCoord.Initialised() == false);
-    assert(Solve() == false);
+    assert(Solve(a_nThreads) == false);
     
     // Solvable game starting from anywhere
     Reset(14, 14, Coordinate());
     assert(IsBoardEmpty());
     assert(m_startingCoord.Initialised() == false);
-    assert(Solve() == true);
+    assert(Solve(a_nThreads) == true);
+    assert(IsSolved());
     
     // Solvable game starting from a specific coordinate
     Reset(15, 14, Coordinate(4, 4));
     assert(IsBoardEmpty());
     assert(m_startingCoord.Initialised() == true);
-    assert(Solve() == true);
+    assert(Solve(a_nThreads) == true);
+    assert(IsSolved());
     
     // put down manually the cross on 4, 4. Remove it.
     // put it down again and try to solve starting from
@@ -114,7 +157,168 @@ void GameTotalAllocationTest::TestSolve()
     PutDownPiece(crossPiece, Coordinate(4, 4));
     assert(m_player.IsPieceAvailable(e_5Piece_Cross) == false);
     assert(IsBoardEmpty() == false);    
-    assert(Solve() == true);    
+    assert(Solve(a_nThreads) == true);
+    assert(IsSolved());
+}
+
+void GameTotalAllocationTest::TestAllocateAllPiecesAllocations()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // same problem as the last one solved by TestSolve, but the backtracking
+    // algorithm is called directly (Solve copies the game before starting)
+    Piece crossPiece(e_5Piece_Cross);
+    Reset(15, 15, Coordinate());
+    PutDownPiece(crossPiece, Coordinate(4, 4));
+
+    ePieceType_t lastPieces[e_numberOfPieces];
+    Bitboard oldNkPoints[e_numberOfPieces];
+    for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces; i++)
+    {
+        lastPieces[i] = e_noPiece;
+    }
+    lastPieces[0] = e_5Piece_Cross;
+
+    // no one will cancel it
+    CancellationToken cancelToken;
+    CancellationCheckpoint checkpoint(cancelToken);
+
+    allocationcounter::Start();
+    bool solved = AllocateAllPieces(lastPieces, oldNkPoints, checkpoint);
+    int32_t nAllocations = allocationcounter::Stop();
+
+    assert(solved);
+    assert(IsSolved());
+    assert(nAllocations == 0);
+
+    // leave the game as it was created
+    Reset(TEST_NROWS, TEST_NCOLS, TEST_STARTING_COORD);
+}
+
+void GameTotalAllocationTest::TestSolveCancellation(int32_t a_nThreads)
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // solvable game, but the token is cancelled before starting
+    CancellationToken cancelledToken;
+    cancelledToken.Cancel();
+    Reset(14, 14, Coordinate());
+    assert(Solve(a_nThreads, cancelledToken) == false);
+    assert(IsBoardEmpty());
+
+    // all the pieces take 89 squares. It would take hours to find out
+    // this board can't be filled up
+    Reset(9, 10, Coordinate());
+
+    if (!g_thread_supported())
+    {
+        // glib thread system hasn't been initialized yet
+        g_thread_init(NULL);
+    }
+
+    // the time Solve takes to return after being cancelled depends on the
+    // machine. The bound is generous
+    const gulong  SOLVE_TIME_US   = 100000;
+    const gdouble MAX_LATENCY_SEC = 0.5;
+
+    CancellationToken cancelToken;
+    CancelledSolveData_t solveData;
+    solveData.game        = this;
+    solveData.nThreads    = a_nThreads;
+    solveData.cancelToken = &cancelToken;
+    solveData.solved      = true;
+
+    GThread* solveThread = g_thread_create(
+            reinterpret_cast<GThreadFunc>(GameTotalAllocationTest::CancelledSolveThreadRoutine),
+            reinterpret_cast<void*>(&solveData),
+            TRUE, // joinable
+            NULL);
+    assert(solveThread != NULL);
+
+    g_usleep(SOLVE_TIME_US);
+
+    GTimer* timer = g_timer_new();
+    cancelToken.Cancel();
+    g_thread_join(solveThread);
+    gdouble latency = g_timer_elapsed(timer, NULL);
+    g_timer_destroy(timer);
+
+#ifdef DEBUG_PRINT
+    std::cout << "    threads: " << a_nThreads
+              << " latency: " << (latency * 1000) << "ms" << std::endl;
+#endif
+    assert(latency < MAX_LATENCY_SEC);
+    assert(solveData.solved == false);
+    assert(IsBoardEmpty());
+
+    // leave the game as it was created
+    Reset(TEST_NROWS, TEST_NCOLS, TEST_STARTING_COORD);
+}
+
+void* GameTotalAllocationTest::CancelledSolveThreadRoutine(void *a_threadParam)
+{
+    CancelledSolveData_t* solveData =
+            reinterpret_cast<CancelledSolveData_t*>(a_threadParam);
+
+    solveData->solved = solveData->game->Solve(
+            solveData->nThreads,
+            *(solveData->cancelToken));
+
+    return NULL;
+}
+
+void GameTotalAllocationTest::BenchmarkSolve()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+#ifdef DEBUG_PRINT
+    std::cout << std::endl << "  total allocation solved in:";
+#endif
+
+    GTimer* timer = g_timer_new();
+    for (int32_t i = 0; i < BENCHMARK_SOLVE_NSIZES; i++)
+    {
+        int32_t nRows = BENCHMARK_SOLVE_SIZES[i][0];
+        int32_t nCols = BENCHMARK_SOLVE_SIZES[i][1];
+
+        Reset(nRows, nCols, Coordinate());
+        g_timer_start(timer);
+        assert(Solve(1) == true);
+#ifdef DEBUG_PRINT
+        gdouble elapsed1Thread = g_timer_elapsed(timer, NULL);
+#endif
+        assert(IsSolved());
+
+        Reset(nRows, nCols, Coordinate());
+        g_timer_start(timer);
+        assert(Solve(GAME_TOTAL_ALLOCATION_TEST_THREADS) == true);
+#ifdef DEBUG_PRINT
+        gdouble elapsedNThreads = g_timer_elapsed(timer, NULL);
+#endif
+        assert(IsSolved());
+
+#ifdef DEBUG_PRINT
+        std::cout << std::endl
+                  << "    " << nRows << "x" << nCols << ": "
+                  << (elapsed1Thread * 1000) << "ms with 1 thread, "
+                  << (elapsedNThreads * 1000) << "ms with "
+                  << GAME_TOTAL_ALLOCATION_TEST_THREADS << " threads";
+#endif
+    }
+    g_timer_destroy(timer);
+
+#ifdef DEBUG_PRINT
+    std::cout.flush();
+#endif
+
+    // leave the game as it was created
+    Reset(TEST_NROWS, TEST_NCOLS, TEST_STARTING_COORD);
 }
 
 void GameTotalAllocationTest::TestGameTotalAllocationPutDownAndRemovePiece()
@@ -134,14 +338,12 @@ void GameTotalAllocationTest::TestGameTotalAllocationPutDownAndRemovePiece()
     for (int8_t i = e_numberOfPieces - 1 ; i >= e_minimumPieceIndex ; i--)
     {
         // m_player should have all the pieces available
-        const std::list<PieceConfiguration> &pieceConfList =
-            m_player.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt  = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        const PieceConfTable &confTable = PieceConfTable::Instance();
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
+            const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
             // sets&iterators to retrieve nk points
             STLCoordinateSet_t nkPointsSetPlayer;
             STLCoordinateSet_t nkPointsSetExtraPlayer;
@@ -151,13 +353,13 @@ void GameTotalAllocationTest::TestGameTotalAllocationPutDownAndRemovePiece()
             // put down current piece on the game
             PutDownPiece(
                 m_player.GetStartingCoordinate(),
-                *pieceConfIt);
+                confTable.GetConf(confIt));
 
             // put down the very same piece on the extraBoard using the extra 
             // players using directly m_pieceSquares attribute
             PieceConfigurationContainer_t::const_iterator it;
-            for (it  = pieceConfIt->m_pieceSquares.begin();
-                 it != pieceConfIt->m_pieceSquares.end();
+            for (it  = pieceConf.m_pieceSquares.begin();
+                 it != pieceConf.m_pieceSquares.end();
                  it++)
             {
                 Coordinate playerCoord(
@@ -222,12 +424,12 @@ void GameTotalAllocationTest::TestGameTotalAllocationPutDownAndRemovePiece()
             // remove pieces and do it again
             RemovePiece(
                 m_player.GetStartingCoordinate(),
-                *pieceConfIt);
+                confTable.GetConf(confIt));
 
             // remove the very same pieces from the extraBoard using the extra players
             // using directly m_pieceSquares attribute
-            for (it  = pieceConfIt->m_pieceSquares.begin();
-                 it != pieceConfIt->m_pieceSquares.end();
+            for (it  = pieceConf.m_pieceSquares.begin();
+                 it != pieceConf.m_pieceSquares.end();
                  it++)
             {
                 Coordinate playerCoord(
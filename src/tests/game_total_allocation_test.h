@@ -23,6 +23,8 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 18-Oct-2010  Original development
+///           agent              17-Oct-2026  Parallel Solve and benchmark
+///           agent              17-Oct-2026  Search allocations test
 /// @endhistory
 ///
 // ============================================================================
@@ -46,12 +48,49 @@ public:
     
 private:
 
-    /// test the solve function in 3 different cases:
+    /// test the solve function in 5 different cases:
     ///   1) Impossible to solve starting from a specific coordinate
     ///   2) Impossible to solve starting from anywhere
     ///   3) Solvable game starting from anywhere
     ///   4) Solvable game starting from a specific coordinate
-    void TestSolve();
+    ///   5) Solvable game with a piece already put down
+    /// @param number of threads Solve will be run with
+    void TestSolve(int32_t a_nThreads);
+
+    /// tests the backtracking algorithm used by Solve doesn't allocate
+    /// any memory once it is running
+    void TestAllocateAllPiecesAllocations();
+
+    /// tests Solve returns false shortly after its cancellation token is
+    /// cancelled, leaving the board as it was
+    /// @param number of threads Solve will be run with
+    void TestSolveCancellation(int32_t a_nThreads);
+
+    /// @brief a Solve run in its own thread by TestSolveCancellation
+    typedef struct
+    {
+        /// game to be solved
+        GameTotalAllocationTest* game;
+        /// number of threads of the search
+        int32_t                  nThreads;
+        /// token the search is cancelled with
+        const CancellationToken* cancelToken;
+        /// value returned by Solve
+        bool                     solved;
+    } CancelledSolveData_t;
+
+    /// The routine of the thread TestSolveCancellation runs Solve in
+    /// @param pointer to a CancelledSolveData_t structure
+    /// @return NULL
+    static void* CancelledSolveThreadRoutine(void *a_threadParam);
+
+    /// measures how long Solve takes in a grid of board sizes using
+    /// 1 thread and GAME_TOTAL_ALLOCATION_TEST_THREADS threads. Results are
+    /// printed out to stdout
+    void BenchmarkSolve();
+
+    /// @return true if every piece of the player is put down on the board
+    bool IsSolved();
 
     /// tests if the (faster) way GameTotalAllocation puts down and removes
     /// pieces has the same results as the basic method that consists on setting
@@ -25,20 +25,30 @@
 ///           Faustino Frechilla 27-Nov-2009  Original development
 ///           Faustino Frechilla 28-Sep-2010  Blockem challenge test
 ///           Faustino Frechilla 18-Oct-2010  total allocation test
+///           agent              17-Oct-2026  self-play test
+///           agent              17-Oct-2026  opening book test
+///           agent              17-Oct-2026  4 players test
+///           agent              17-Oct-2026  game challenge test
 /// @endhistory
 ///
 // ============================================================================
 
 #include <iostream>
+#include "bitboard_test.h"
 #include "bitwise_test.h"
 #include "blockem_challenge_test.h"
 #include "board_test.h"
 #include "g_blocking_queue_test.h"
 #include "game1v1_test.h"
+#include "game_4players_test.h"
+#include "game_challenge_test.h"
 #include "game_total_allocation_test.h"
+#include "opening_book_test.h"
 #include "piece_test.h"
 #include "player_test.h"
 #include "rules_test.h"
+#include "self_play_test.h"
+#include "transposition_table_test.h"
 
 
 /// @brief a simple test with a well-known configuration
@@ -59,6 +69,13 @@ int main(int argc, char** argv)
     blockingQTest.DoTest();
     std::cout << "  [Passed]" << std::endl << std::endl;
 
+    // bitboard test
+    std::cout << "Bitboard test started...";
+    std::cout.flush();
+    BitboardTest bitboardTest;
+    bitboardTest.DoTest();
+    std::cout << "  [Passed]" << std::endl << std::endl;
+
     // board test
     std::cout << "Board test started...";
     std::cout.flush();
@@ -94,6 +111,13 @@ int main(int argc, char** argv)
     bitwiseTest.DoTest();
     std::cout << "  [Passed]" << std::endl << std::endl;
 
+    // transposition table test
+    std::cout << "Transposition table test started...";
+    std::cout.flush();
+    TranspositionTableTest transTableTest;
+    transTableTest.DoTest();
+    std::cout << "  [Passed]" << std::endl << std::endl;
+
     // Game1v1 test
     std::cout << "Game1v1 test started... ";
     std::cout.flush();
@@ -115,6 +139,34 @@ int main(int argc, char** argv)
     theChallengeTest.DoTest();
     std::cout << "  [Passed]" << std::endl << std::endl;
 
+    // Game challenge test
+    std::cout << "Game challenge test started... ";
+    std::cout.flush();
+    GameChallengeTest theGameChallengeTest;
+    theGameChallengeTest.DoTest();
+    std::cout << "  [Passed]" << std::endl << std::endl;
+
+    // Self-play test
+    std::cout << "Self-play test started... ";
+    std::cout.flush();
+    SelfPlayTest theSelfPlayTest;
+    theSelfPlayTest.DoTest();
+    std::cout << "  [Passed]" << std::endl << std::endl;
+
+    // Opening book test
+    std::cout << "Opening book test started... ";
+    std::cout.flush();
+    OpeningBookTest theOpeningBookTest;
+    theOpeningBookTest.DoTest();
+    std::cout << "  [Passed]" << std::endl << std::endl;
+
+    // Game 4 players test
+    std::cout << "Game 4 players test started... ";
+    std::cout.flush();
+    Game4PlayersTest the4PlayersTest;
+    the4PlayersTest.DoTest();
+    std::cout << "  [Passed]" << std::endl << std::endl;
+
     // everything went well!
     return 0;
 }
@@ -0,0 +1,369 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book_test.cpp
+/// @brief regression testing for the OpeningBook and OpeningBookBuilder classes
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <cassert>
+#include <cstdio>   // remove
+#include <fstream>
+#include <vector>
+#include "opening_book_test.h"
+
+/// file the book built by the test is saved into (in the current directory)
+static const char OPENING_BOOK_TEST_FILE[] = "opening_book_test.bin";
+
+/// file with no opening book in it
+static const char OPENING_BOOK_TEST_BAD_FILE[] = "opening_book_test_bad.bin";
+
+/// the influence area heuristic doesn't restore exactly the same values when
+/// pieces are removed, so the values of the book could depend on the path taken
+/// to reach a position. NK weighted doesn't
+static const Heuristic::eHeuristicType_t OPENING_BOOK_TEST_HEURISTIC =
+        Heuristic::e_heuristicNKWeightedv1;
+
+/// depth of the searches of the book built by the test
+static const int32_t OPENING_BOOK_TEST_DEPTH = 2;
+
+/// plies covered by the book built by the test
+static const int32_t OPENING_BOOK_TEST_PLIES = 4;
+
+/// moves expanded per position of the book built by the test
+static const int32_t OPENING_BOOK_TEST_WIDTH = 2;
+
+OpeningBookTest::OpeningBookTest()
+{
+}
+
+OpeningBookTest::~OpeningBookTest()
+{
+}
+
+void OpeningBookTest::DoTest()
+{
+    TestBuildSaveLoad();
+    TestGame1v1Lookup();
+    TestLoadErrors();
+}
+
+void OpeningBookTest::TestBuildSaveLoad()
+{
+    // no transposition table, so the searches of the book are the same ones
+    // TestGame1v1Lookup runs
+    OpeningBookBuilder builder(
+            OPENING_BOOK_TEST_HEURISTIC,
+            OPENING_BOOK_TEST_DEPTH,
+            OPENING_BOOK_TEST_PLIES,
+            OPENING_BOOK_TEST_WIDTH,
+            0);
+
+    std::vector<OpeningBook::Entry_t> entries;
+    int32_t nSearched = builder.Build(1, entries);
+    // 1 + 2 + 4 + 8 positions at most. Plies 0 and 1 (1st pieces) aren't saved,
+    // and every position saved is saved with its 7 symmetric positions
+    assert(nSearched > OPENING_BOOK_TEST_PLIES);
+    assert(nSearched <= 15);
+    assert(entries.size() > 0);
+    assert(entries.size() <= static_cast<std::size_t>(8 * (nSearched - 1)));
+
+    // the book doesn't depend on the number of threads
+    std::vector<OpeningBook::Entry_t> entriesThreads;
+    assert(builder.Build(3, entriesThreads) == nSearched);
+    assert(entriesThreads.size() == entries.size());
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        assert(entriesThreads[i].key   == entries[i].key);
+        assert(entriesThreads[i].move  == entries[i].move);
+        assert(entriesThreads[i].value == entries[i].value);
+        assert(!packedmove::IsNoMove(entries[i].move));
+    }
+
+    assert(OpeningBook::Save(
+                OPENING_BOOK_TEST_FILE,
+                OPENING_BOOK_TEST_HEURISTIC,
+                OPENING_BOOK_TEST_DEPTH,
+                OPENING_BOOK_TEST_PLIES,
+                entries));
+    // positions saved more than once are only kept once
+    assert(entries.size() <= entriesThreads.size());
+
+    OpeningBook book;
+    assert(!book.IsLoaded());
+    assert(book.GetNEntries() == 0);
+
+    assert(book.Load(OPENING_BOOK_TEST_FILE));
+    assert(book.IsLoaded());
+    assert(book.GetNEntries() == entries.size());
+    assert(book.GetHeuristicType() == OPENING_BOOK_TEST_HEURISTIC);
+    assert(book.GetDepth() == OPENING_BOOK_TEST_DEPTH);
+    assert(book.GetPlies() == OPENING_BOOK_TEST_PLIES);
+
+    for (uint32_t i = 0; i < book.GetNEntries(); i++)
+    {
+        if (i > 0)
+        {
+            assert(book.GetEntry(i - 1).key < book.GetEntry(i).key);
+        }
+
+        OpeningBook::Entry_t thisEntry;
+        assert(book.Lookup(entries[i].key, thisEntry));
+        assert(thisEntry.key   == entries[i].key);
+        assert(thisEntry.move  == entries[i].move);
+        assert(thisEntry.value == entries[i].value);
+    }
+
+    // the 1st piece of a player is never saved
+    OpeningBook::Entry_t dummyEntry;
+    assert(!book.Lookup(Game1v1().GetPositionKey(Game1v1::e_Game1v1Player1), dummyEntry));
+
+    book.Unload();
+    assert(!book.IsLoaded());
+    assert(book.GetNEntries() == 0);
+    assert(!book.Lookup(entries[0].key, dummyEntry));
+}
+
+void OpeningBookTest::TestGame1v1Lookup()
+{
+    OpeningBook book;
+    assert(book.Load(OPENING_BOOK_TEST_FILE));
+
+    Heuristic::EvalFunction_t heuristic =
+        Heuristic::m_heuristicData[OPENING_BOOK_TEST_HEURISTIC].m_evalFunction;
+    volatile sig_atomic_t dummyAtomic = 0;
+    CancellationToken cancelToken(dummyAtomic);
+
+    // the 1st pieces are the ones the book was expanded with
+    Game1v1 theGame;
+    theGame.SetOpeningBook(&book);
+    assert(theGame.GetOpeningBook() == &book);
+
+    Piece firstPiece[2];
+    Coordinate firstCoord[2];
+    Piece lastPiece(e_noPiece);
+    Coordinate lastCoord;
+    for (int32_t i = 0; i < 2; i++)
+    {
+        Game1v1::eGame1v1Player_t whoMoves =
+            (i == 0) ? Game1v1::e_Game1v1Player1 : Game1v1::e_Game1v1Player2;
+
+        theGame.MinMax(
+                heuristic,
+                OPENING_BOOK_TEST_DEPTH,
+                whoMoves,
+                firstPiece[i],
+                firstCoord[i],
+                cancelToken,
+                lastCoord,
+                lastPiece);
+        assert(firstPiece[i].GetType() != e_noPiece);
+
+        theGame.PutDownPiece(firstPiece[i], firstCoord[i], whoMoves);
+        lastPiece = firstPiece[i];
+        lastCoord = firstCoord[i];
+    }
+
+    // the same search run without the book
+    Game1v1 noBookGame(theGame);
+    noBookGame.SetOpeningBook(NULL);
+    Piece searchPiece(e_noPiece);
+    Coordinate searchCoord;
+    int32_t searchValue = noBookGame.MinMax(
+                                heuristic,
+                                OPENING_BOOK_TEST_DEPTH,
+                                Game1v1::e_Game1v1Player1,
+                                searchPiece,
+                                searchCoord,
+                                cancelToken,
+                                lastCoord,
+                                lastPiece);
+    assert(noBookGame.GetSearchStats().nodes > 0);
+
+    Piece bookPiece(e_noPiece);
+    Coordinate bookCoord;
+    int32_t bookValue = theGame.MinMax(
+                                heuristic,
+                                OPENING_BOOK_TEST_DEPTH,
+                                Game1v1::e_Game1v1Player1,
+                                bookPiece,
+                                bookCoord,
+                                cancelToken,
+                                lastCoord,
+                                lastPiece);
+    assert(theGame.GetSearchStats().nodes == 0);
+    assert(bookValue == searchValue);
+    assert(bookPiece.GetType() == searchPiece.GetType());
+    assert(bookCoord == searchCoord);
+    for (int32_t i = 0; i < static_cast<int32_t>(bookPiece.GetNSquares()); i++)
+    {
+        assert(bookPiece.GetCoord(i) == searchPiece.GetCoord(i));
+    }
+
+    // iterative deepening reads the book too
+    int32_t depthReached = 0;
+    Piece idPiece(e_noPiece);
+    Coordinate idCoord;
+    assert(theGame.MinMaxIterativeDeepening(
+                heuristic,
+                OPENING_BOOK_TEST_DEPTH,
+                0,
+                Game1v1::e_Game1v1Player1,
+                idPiece,
+                idCoord,
+                depthReached,
+                cancelToken,
+                lastCoord,
+                lastPiece) == bookValue);
+    assert(depthReached == OPENING_BOOK_TEST_DEPTH);
+    assert(theGame.GetSearchStats().nodes == 0);
+    assert(idPiece.GetType() == bookPiece.GetType());
+    assert(idCoord == bookCoord);
+
+    // searches with another depth or heuristic (random included) don't read the book
+    const Heuristic::EvalFunction_t otherHeuristics[] =
+    {
+        heuristic,
+        Heuristic::m_heuristicData[Heuristic::e_heuristicInfluenceArea].m_evalFunction,
+        Heuristic::m_heuristicData[Heuristic::e_heuristicRandom].m_evalFunction,
+    };
+    const int32_t otherDepths[] = {OPENING_BOOK_TEST_DEPTH - 1, OPENING_BOOK_TEST_DEPTH, 1};
+    for (int32_t i = 0; i < 3; i++)
+    {
+        Piece otherPiece(e_noPiece);
+        Coordinate otherCoord;
+        theGame.MinMax(
+                otherHeuristics[i],
+                otherDepths[i],
+                Game1v1::e_Game1v1Player1,
+                otherPiece,
+                otherCoord,
+                cancelToken,
+                lastCoord,
+                lastPiece);
+        assert(otherPiece.GetType() != e_noPiece);
+        assert(theGame.GetSearchStats().nodes > 0);
+    }
+
+    // the same opening with symmetric starting coordinates
+    Game1v1 mirroredGame(
+        Coordinate(DEFAULT_STARTING_ROW_PLAYER1, BOARD_1VS1_COLUMNS - DEFAULT_STARTING_COL_PLAYER1 - 1),
+        Coordinate(DEFAULT_STARTING_ROW_PLAYER2, BOARD_1VS1_COLUMNS - DEFAULT_STARTING_COL_PLAYER2 - 1));
+    mirroredGame.SetOpeningBook(&book);
+    for (int32_t i = 0; i < 2; i++)
+    {
+        MirrorColumns(firstPiece[i], firstCoord[i], lastPiece, lastCoord);
+        mirroredGame.PutDownPiece(
+                lastPiece,
+                lastCoord,
+                (i == 0) ? Game1v1::e_Game1v1Player1 : Game1v1::e_Game1v1Player2);
+    }
+
+    Piece mirroredPiece(e_noPiece);
+    Coordinate mirroredCoord;
+    assert(mirroredGame.MinMax(
+                heuristic,
+                OPENING_BOOK_TEST_DEPTH,
+                Game1v1::e_Game1v1Player1,
+                mirroredPiece,
+                mirroredCoord,
+                cancelToken,
+                lastCoord,
+                lastPiece) == bookValue);
+    assert(mirroredGame.GetSearchStats().nodes == 0);
+
+    Piece expectedPiece(e_noPiece);
+    Coordinate expectedCoord;
+    MirrorColumns(bookPiece, bookCoord, expectedPiece, expectedCoord);
+    assert(mirroredPiece.GetType() == expectedPiece.GetType());
+    for (int32_t i = 0; i < static_cast<int32_t>(mirroredPiece.GetNSquares()); i++)
+    {
+        assert( (mirroredCoord.m_row + mirroredPiece.GetCoord(i).m_row) ==
+                (expectedCoord.m_row + expectedPiece.GetCoord(i).m_row) );
+        assert( (mirroredCoord.m_col + mirroredPiece.GetCoord(i).m_col) ==
+                (expectedCoord.m_col + expectedPiece.GetCoord(i).m_col) );
+    }
+
+    // the book is not used for positions which are not in it. Player2 opens
+    // with the baby piece, which is never one of the moves expanded
+    Game1v1 outOfBookGame;
+    outOfBookGame.SetOpeningBook(&book);
+    outOfBookGame.PutDownPiece(firstPiece[0], firstCoord[0], Game1v1::e_Game1v1Player1);
+    outOfBookGame.PutDownPiece(
+            outOfBookGame.GetPlayer(Game1v1::e_Game1v1Player2).m_pieces[e_1Piece_BabyPiece],
+            Coordinate(DEFAULT_STARTING_ROW_PLAYER2, DEFAULT_STARTING_COL_PLAYER2),
+            Game1v1::e_Game1v1Player2);
+    outOfBookGame.MinMax(
+            heuristic,
+            OPENING_BOOK_TEST_DEPTH,
+            Game1v1::e_Game1v1Player1,
+            searchPiece,
+            searchCoord,
+            cancelToken);
+    assert(searchPiece.GetType() != e_noPiece);
+    assert(outOfBookGame.GetSearchStats().nodes > 0);
+}
+
+void OpeningBookTest::TestLoadErrors()
+{
+    OpeningBook book;
+    assert(!book.Load(OPENING_BOOK_TEST_BAD_FILE));
+    assert(!book.IsLoaded());
+
+    std::ofstream badFile(OPENING_BOOK_TEST_BAD_FILE, std::ios::out | std::ios::binary);
+    badFile << "This is not an opening book. It is just a bunch of characters";
+    badFile.close();
+    assert(!book.Load(OPENING_BOOK_TEST_BAD_FILE));
+    assert(!book.IsLoaded());
+    assert(book.GetNEntries() == 0);
+
+    // a valid book is unloaded if loading another file fails
+    assert(book.Load(OPENING_BOOK_TEST_FILE));
+    assert(!book.Load(OPENING_BOOK_TEST_BAD_FILE));
+    assert(!book.IsLoaded());
+
+    remove(OPENING_BOOK_TEST_BAD_FILE);
+    remove(OPENING_BOOK_TEST_FILE);
+}
+
+void OpeningBookTest::MirrorColumns(
+        const Piece      &a_piece,
+        const Coordinate &a_coord,
+        Piece            &out_piece,
+        Coordinate       &out_coord)
+{
+    // MirrorYAxis turns (row, col) squares into (row, -col)
+    out_piece = a_piece;
+    out_piece.MirrorYAxis();
+    out_coord.m_row = a_coord.m_row;
+    out_coord.m_col = BOARD_1VS1_COLUMNS - a_coord.m_col - 1;
+
+    for (int32_t i = 0; i < static_cast<int32_t>(a_piece.GetNSquares()); i++)
+    {
+        assert( (out_coord.m_row + out_piece.GetCoord(i).m_row) ==
+                (a_coord.m_row + a_piece.GetCoord(i).m_row) );
+        assert( (out_coord.m_col + out_piece.GetCoord(i).m_col) ==
+                (BOARD_1VS1_COLUMNS - (a_coord.m_col + a_piece.GetCoord(i).m_col) - 1) );
+    }
+}
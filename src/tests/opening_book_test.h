@@ -0,0 +1,69 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  opening_book_test.h
+/// @brief regression testing for the OpeningBook and OpeningBookBuilder classes
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef OPENING_BOOK_TEST_H_
+#define OPENING_BOOK_TEST_H_
+
+#include "opening_book.h"
+#include "opening_book_builder.h"
+#include "game1v1.h"
+
+/// @brief regression testing for the OpeningBook and OpeningBookBuilder classes
+class OpeningBookTest
+{
+public:
+    OpeningBookTest();
+    virtual ~OpeningBookTest();
+
+    /// launches the opening book test!
+    void DoTest();
+
+private:
+
+    /// builds a small book with different number of threads, saves it and
+    /// loads it back
+    void TestBuildSaveLoad();
+
+    /// checks MinMax and MinMaxIterativeDeepening return the moves of the book
+    /// (also in games with symmetric starting coordinates)
+    void TestGame1v1Lookup();
+
+    /// checks files which are not opening books are rejected
+    void TestLoadErrors();
+
+    /// @brief calculates the move symmetric to (a_piece, a_coord) when the columns
+    ///        of the 1vs1 board are mirrored
+    static void MirrorColumns(
+            const Piece      &a_piece,
+            const Coordinate &a_coord,
+            Piece            &out_piece,
+            Coordinate       &out_coord);
+};
+
+#endif /* OPENING_BOOK_TEST_H_ */
@@ -286,13 +286,11 @@ void PieceTest::DoTest()
     int32_t possibleConfigurationsPrecalc = 0;
     int32_t possibleConfigurations = 0;
 
+    const PieceConfTable &confTable = PieceConfTable::Instance();
     for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces ; i++)
     {
-        const std::list<PieceConfiguration> &pieceConfList =
-            m_player.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        pieceConfIt = pieceConfList.begin();
+        ePieceType_t pieceType = static_cast<ePieceType_t>(i);
+        int32_t confIt = confTable.GetFirstConf(pieceType);
         do
         {
             int16_t nRotations = 0;
@@ -303,7 +301,7 @@ void PieceTest::DoTest()
                 nRotations++;
 
                 // next precalculated configuration
-                pieceConfIt++;
+                confIt++;
                 possibleConfigurationsPrecalc++;
             }
             // reset the amount of rotations to right before mirroring the piece
@@ -311,7 +309,9 @@ void PieceTest::DoTest()
 
         } while (m_player.m_pieces[i].MirrorYAxis());
 
-        assert(pieceConfIt == pieceConfList.end());
+        assert(confIt == confTable.GetEndConf(pieceType));
+        assert(confTable.GetNConfs(pieceType) == 
+                (m_player.m_pieces[i].GetNRotations() * (m_player.m_pieces[i].CanMirror() ? 2 : 1)));
 
         m_player.m_pieces[i].Reset();
     }
@@ -333,25 +333,40 @@ void PieceTest::DoTest()
         STLCoordinateSet_t testSet;
         STLCoordinateSet_t::iterator testSetIterator;
 
-        const std::list<PieceConfiguration> &pieceConfList =
-            m_player.m_pieces[i].GetPrecalculatedConfs();
-
-        std::list<PieceConfiguration>::const_iterator pieceConfIt;
-        for (pieceConfIt = pieceConfList.begin();
-             pieceConfIt != pieceConfList.end();
-             pieceConfIt++)
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(i));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(i));
+                     confIt++)
         {
+            const PieceConf_t &packedConf = confTable.GetConf(confIt);
+            const PieceConfiguration &pieceConf = *(packedConf.pieceConf);
             testSet.clear();
 
+            // the packed arrays must describe the same configuration
+            assert(packedConf.pieceType == static_cast<ePieceType_t>(i));
+            assert(packedConf.confIndex == (confIt - confTable.GetFirstConf(packedConf.pieceType)));
+            assert(packedConf.nSquares == pieceConf.m_pieceSquares.size());
+            assert(packedConf.nNkPoints == pieceConf.m_nkPoints.size());
+            assert(packedConf.nForbiddenArea == pieceConf.m_forbiddenArea.size());
+            for (uint8_t j = 0; j < packedConf.nSquares; j++)
+            {
+                assert(packedConf.squareRows[j] == pieceConf.m_pieceSquares[j].m_row);
+                assert(packedConf.squareCols[j] == pieceConf.m_pieceSquares[j].m_col);
+            }
+            for (uint8_t j = 0; j < packedConf.nNkPoints; j++)
+            {
+                assert(packedConf.nkRows[j] == pieceConf.m_nkPoints[j].m_row);
+                assert(packedConf.nkCols[j] == pieceConf.m_nkPoints[j].m_col);
+            }
+
             // pieces are all put down in 7,7 (have a look at
             // PutDownPiece and RemovePiece
             Coordinate a_coord(7, 7);
 
-            PutDownPiece(*pieceConfIt);
+            PutDownPiece(pieceConf);
 
             PieceConfigurationContainer_t::const_iterator it;
-            for (it  = pieceConfIt->m_pieceSquares.begin();
-                 it != pieceConfIt->m_pieceSquares.end();
+            for (it  = pieceConf.m_pieceSquares.begin();
+                 it != pieceConf.m_pieceSquares.end();
                  it++)
             {
                 // ensure this coordinate is not used more than once
@@ -376,8 +391,8 @@ void PieceTest::DoTest()
                 assert(!m_board.IsCoordEmpty(thisCoord));
             }
 
-            for (it  = pieceConfIt->m_nkPoints.begin();
-                 it != pieceConfIt->m_nkPoints.end();
+            for (it  = pieceConf.m_nkPoints.begin();
+                 it != pieceConf.m_nkPoints.end();
                  it++)
             {
                 // ensure this coordinate is not used more than once
@@ -397,8 +412,8 @@ void PieceTest::DoTest()
                 }
             }
 
-            for (it  = pieceConfIt->m_forbiddenArea.begin();
-                 it != pieceConfIt->m_forbiddenArea.end();
+            for (it  = pieceConf.m_forbiddenArea.begin();
+                 it != pieceConf.m_forbiddenArea.end();
                  it++)
             {
                 // ensure this coordinate is not used more than once
@@ -418,10 +433,10 @@ void PieceTest::DoTest()
                 }
             }
 
-            RemovePiece(*pieceConfIt);
+            RemovePiece(pieceConf);
 
-            for (it  = pieceConfIt->m_pieceSquares.begin();
-                 it != pieceConfIt->m_pieceSquares.end();
+            for (it  = pieceConf.m_pieceSquares.begin();
+                 it != pieceConf.m_pieceSquares.end();
                  it++)
             {
                 Coordinate thisCoord(a_coord.m_row + it->m_row,
@@ -435,8 +450,8 @@ void PieceTest::DoTest()
                 assert(m_board.IsCoordEmpty(thisCoord));
             }
 
-            for (it  = pieceConfIt->m_nkPoints.begin();
-                 it != pieceConfIt->m_nkPoints.end();
+            for (it  = pieceConf.m_nkPoints.begin();
+                 it != pieceConf.m_nkPoints.end();
                  it++)
             {
                 Coordinate thisCoord(a_coord.m_row + it->m_row,
@@ -451,8 +466,8 @@ void PieceTest::DoTest()
                 }
             }
 
-            for (it  = pieceConfIt->m_forbiddenArea.begin();
-                 it != pieceConfIt->m_forbiddenArea.end();
+            for (it  = pieceConf.m_forbiddenArea.begin();
+                 it != pieceConf.m_forbiddenArea.end();
                  it++)
             {
                 Coordinate thisCoord(a_coord.m_row + it->m_row,
@@ -467,7 +482,7 @@ void PieceTest::DoTest()
                 }
             }
 
-        } // for (pieceConfIt = pieceConfList.begin();
+        } // for (confIt = confTable.GetFirstConf(i);
     } // for (int32_t i = e_minimumPieceIndex; i < e_numberOfPieces ; i++)
 
     std::cout << " [ OK ]" << std::endl;
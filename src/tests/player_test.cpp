@@ -23,6 +23,7 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 3-Jul-2010   Original development
+///           agent              17-Oct-2026  Spiral order of the nk points checked
 /// @endhistory
 ///
 // ============================================================================
@@ -37,6 +38,13 @@
 #define ROWS    14
 #define COLUMNS 14
 
+/// @return the ring of squares around the middle of the board a_coord is in
+static int32_t SpiralRing(const Coordinate &a_coord)
+{
+    return std::max(std::abs(a_coord.m_row - (ROWS / 2)),
+                    std::abs(a_coord.m_col - (COLUMNS / 2)));
+}
+
 PlayerTest::PlayerTest() :
     m_board(ROWS, COLUMNS),
     m_player(std::string("the player"), 'X', ROWS, COLUMNS, Coordinate())
@@ -286,9 +294,17 @@ void PlayerTest::TestNKSpiralAlgorithm(const Player &a_player)
         // assert any other nk point is found by the spiral algorithm
         for (int32_t i = 1; i < a_player.NumberOfNucleationPoints(); i++)
         {
+            Coordinate prevCoord(tmpCoord);
             rv = a_player.GetNextNucleationPointSpiral(iterator, tmpCoord);
             assert(rv == true);
 
+            // from the middle to the edges, ring after ring, each ring row by row
+            assert(SpiralRing(tmpCoord) == iterator);
+            assert( (SpiralRing(prevCoord) < SpiralRing(tmpCoord)) ||
+                    (prevCoord.m_row < tmpCoord.m_row) ||
+                    ( (prevCoord.m_row == tmpCoord.m_row) &&
+                      (prevCoord.m_col < tmpCoord.m_col) ) );
+
             setIt = coordSet.find(tmpCoord);
             assert(setIt != coordSet.end());
 
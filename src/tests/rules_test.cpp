@@ -23,15 +23,19 @@
 /// @history
 /// Ref       Who                When         What
 ///           Faustino Frechilla 15-Jul-2010  Original development
+///           agent              17-Oct-2026  Valid coords with bit planes test and benchmark
+///           agent              17-Oct-2026  Exact influence area test
 /// @endhistory
 ///
 // ============================================================================
 
-#ifdef DEBUG_PRINT
 #include <iostream>
-#endif
-
+#include <glib.h> // GTimer
 #include "rules_test.h"
+#include "coordinate_set.h"
+
+/// number of times every valid move is calculated by BenchmarkValidCoords
+static const int32_t BENCHMARK_VALID_COORDS_ROUNDS = 200;
 
 
 // ' ' -> empty char
@@ -137,6 +141,8 @@ void RulesTest::DoTest()
     TestIsCoordInfluencedByPlayerFastCompute();
     TestRecalculateInfluenceAreaInBoard();
     TestCanPlayerGo();
+    TestCalculateValidCoordsInBoard();
+    BenchmarkValidCoords();
 }
 
 void RulesTest::TestIsCoordTouchingPlayerCompute()
@@ -448,25 +454,24 @@ void RulesTest::TestIsPieceDeployableInCoord()
                 
                 if (m_player1.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        m_player1.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 m_baseBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 m_player1);                      
                         
                         if (deployableCompute == true)
                         {
                             PieceConfigurationContainer_t::const_iterator squareIt;
-                            for (squareIt  = it->m_pieceSquares.begin();
-                                 squareIt != it->m_pieceSquares.end();
+                            for (squareIt  = pieceConf.m_pieceSquares.begin();
+                                 squareIt != pieceConf.m_pieceSquares.end();
                                  squareIt++)
                             {
                                 Coordinate deployCoord(
@@ -475,7 +480,7 @@ void RulesTest::TestIsPieceDeployableInCoord()
                                 bool deployableInCoord =
                                     rules::IsPieceDeployableInCoord(
                                         m_baseBoard,
-                                        *it,
+                                        pieceConf,
                                         thisCoord,
                                         deployCoord,
                                         m_player1);     
@@ -488,25 +493,24 @@ void RulesTest::TestIsPieceDeployableInCoord()
                 
                 if (m_player2.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        m_player2.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 m_baseBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 m_player2);
                         
                         if (deployableCompute == true)
                         {
                             PieceConfigurationContainer_t::const_iterator squareIt;
-                            for (squareIt  = it->m_pieceSquares.begin();
-                                 squareIt != it->m_pieceSquares.end();
+                            for (squareIt  = pieceConf.m_pieceSquares.begin();
+                                 squareIt != pieceConf.m_pieceSquares.end();
                                  squareIt++)
                             {
                                 Coordinate deployCoord(
@@ -515,7 +519,7 @@ void RulesTest::TestIsPieceDeployableInCoord()
                                 bool deployableInCoord =
                                     rules::IsPieceDeployableInCoord(
                                         m_baseBoard,
-                                        *it,
+                                        pieceConf,
                                         thisCoord,
                                         deployCoord,
                                         m_player2);     
@@ -528,17 +532,16 @@ void RulesTest::TestIsPieceDeployableInCoord()
                 
                 if (m_player3.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        m_player3.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 m_baseBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 m_player3);
                         
@@ -546,8 +549,8 @@ void RulesTest::TestIsPieceDeployableInCoord()
                         if (deployableCompute == true)
                         {
                             PieceConfigurationContainer_t::const_iterator squareIt;
-                            for (squareIt  = it->m_pieceSquares.begin();
-                                 squareIt != it->m_pieceSquares.end();
+                            for (squareIt  = pieceConf.m_pieceSquares.begin();
+                                 squareIt != pieceConf.m_pieceSquares.end();
                                  squareIt++)
                             {
                                 Coordinate deployCoord(
@@ -556,7 +559,7 @@ void RulesTest::TestIsPieceDeployableInCoord()
                                 bool deployableInCoord =
                                     rules::IsPieceDeployableInCoord(
                                         m_baseBoard,
-                                        *it,
+                                        pieceConf,
                                         thisCoord,
                                         deployCoord,
                                         m_player3);     
@@ -569,25 +572,24 @@ void RulesTest::TestIsPieceDeployableInCoord()
                 
                 if (m_player4.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        m_player4.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 m_baseBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 m_player4);
                                 
                         if (deployableCompute == true)
                         {
                             PieceConfigurationContainer_t::const_iterator squareIt;
-                            for (squareIt  = it->m_pieceSquares.begin();
-                                 squareIt != it->m_pieceSquares.end();
+                            for (squareIt  = pieceConf.m_pieceSquares.begin();
+                                 squareIt != pieceConf.m_pieceSquares.end();
                                  squareIt++)
                             {
                                 Coordinate deployCoord(
@@ -596,7 +598,7 @@ void RulesTest::TestIsPieceDeployableInCoord()
                                 bool deployableInCoord =
                                     rules::IsPieceDeployableInCoord(
                                         m_baseBoard,
-                                        *it,
+                                        pieceConf,
                                         thisCoord,
                                         deployCoord,
                                         m_player4);     
@@ -637,17 +639,16 @@ void RulesTest::TestIsPieceDeployableInStartingPoint()
                  thisPiece < e_numberOfPieces;
                  thisPiece++)
             {
-                const std::list<PieceConfiguration>& precalcConfs = 
-                    localPlayer.m_pieces[thisPiece].GetPrecalculatedConfs();
-                std::list<PieceConfiguration>::const_iterator it;
-                for (it  = precalcConfs.begin();
-                     it != precalcConfs.end();
-                     it++)
+                const PieceConfTable &confTable = PieceConfTable::Instance();
+                for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                             confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                             confIt++)
                 {
+                    const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                     // manually check if the piece can be put down
                     PieceConfigurationContainer_t::const_iterator squareIt;
-                    for (squareIt  = it->m_pieceSquares.begin();
-                         squareIt != it->m_pieceSquares.end();
+                    for (squareIt  = pieceConf.m_pieceSquares.begin();
+                         squareIt != pieceConf.m_pieceSquares.end();
                          squareIt++)
                     {
                         Coordinate deployCoord(
@@ -662,11 +663,11 @@ void RulesTest::TestIsPieceDeployableInStartingPoint()
                         }
                     }
                     
-                    bool outOfTheBoard = (squareIt != it->m_pieceSquares.end());
+                    bool outOfTheBoard = (squareIt != pieceConf.m_pieceSquares.end());
                     
                     // assert what is expected to happen
-                    for (squareIt  = it->m_pieceSquares.begin();
-                         squareIt != it->m_pieceSquares.end();
+                    for (squareIt  = pieceConf.m_pieceSquares.begin();
+                         squareIt != pieceConf.m_pieceSquares.end();
                          squareIt++)
                     {
                         Coordinate deployCoord(
@@ -678,7 +679,7 @@ void RulesTest::TestIsPieceDeployableInStartingPoint()
                             // piece MUST be deployable in starting point
                             assert(rules::IsPieceDeployableInStartingPoint(
                                     localBoard,
-                                    *it,
+                                    pieceConf,
                                     thisCoord,
                                     deployCoord) == true);
                         }
@@ -687,7 +688,7 @@ void RulesTest::TestIsPieceDeployableInStartingPoint()
                             // piece is NOT deployable in starting point
                             assert(rules::IsPieceDeployableInStartingPoint(
                                     localBoard,
-                                    *it,
+                                    pieceConf,
                                     thisCoord,
                                     deployCoord) == false);
                         }
@@ -802,17 +803,16 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                 
                 if (localPlayer1.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        localPlayer1.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 localBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 localPlayer1);
                                 
@@ -831,7 +831,7 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                                                 localBoard,
                                                 localPlayer1,
                                                 *nkCoordIt,
-                                                *it,
+                                                pieceConf,
                                                 localPlayer1.m_pieces[thisPiece].GetRadius());
                                 }
                             }                            
@@ -842,17 +842,16 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                 
                 if (localPlayer2.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        localPlayer2.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 localBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 localPlayer2);
                                 
@@ -871,7 +870,7 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                                                 localBoard,
                                                 localPlayer2,
                                                 *nkCoordIt,
-                                                *it,
+                                                pieceConf,
                                                 localPlayer2.m_pieces[thisPiece].GetRadius());
                                 }
                             }                            
@@ -882,17 +881,16 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                 
                 if (localPlayer3.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        localPlayer3.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 localBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 localPlayer3);
                                 
@@ -911,7 +909,7 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                                                 localBoard,
                                                 localPlayer3,
                                                 *nkCoordIt,
-                                                *it,
+                                                pieceConf,
                                                 localPlayer3.m_pieces[thisPiece].GetRadius());
                                 }
                             }                            
@@ -922,17 +920,16 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                 
                 if (localPlayer4.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
                 {
-                    const std::list<PieceConfiguration>& precalcConfs = 
-                        localPlayer4.m_pieces[thisPiece].GetPrecalculatedConfs();
-                    std::list<PieceConfiguration>::const_iterator it;
-                    for (it  = precalcConfs.begin();
-                         it != precalcConfs.end();
-                         it++)
+                    const PieceConfTable &confTable = PieceConfTable::Instance();
+                    for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                                 confIt++)
                     {
+                        const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
                         bool deployableCompute = 
                             rules::IsPieceDeployableCompute(
                                 localBoard,
-                                *it,
+                                pieceConf,
                                 thisCoord,
                                 localPlayer4);
                                 
@@ -951,7 +948,7 @@ void RulesTest::TestHasValidCoordInNucleationPoint()
                                                 localBoard,
                                                 localPlayer4,
                                                 *nkCoordIt,
-                                                *it,
+                                                pieceConf,
                                                 localPlayer4.m_pieces[thisPiece].GetRadius());
                                 }
                             }                            
@@ -980,8 +977,75 @@ void RulesTest::TestIsCoordInfluencedByPlayerFastCompute()
 {
 }
 
+/// @return the squares taken by every move of a_moves
+static Bitboard InfluenceAreaOfMoves(
+        const Board                      &a_board,
+        const std::vector<rules::Move_t> &a_moves)
+{
+    Bitboard rv;
+    for (uint32_t k = 0; k < a_moves.size(); k++)
+    {
+        const PieceConf_t &pieceConf = *(a_moves[k].pieceConf);
+        for (uint8_t j = 0; j < pieceConf.nSquares; j++)
+        {
+            rv.Set(a_board.CoordToIndex(Coordinate(
+                    a_moves[k].coord.m_row + pieceConf.squareRows[j],
+                    a_moves[k].coord.m_col + pieceConf.squareCols[j])));
+        }
+    }
+    return rv;
+}
+
 void RulesTest::TestRecalculateInfluenceAreaInBoard()
 {
+    std::vector<rules::Move_t> moves;
+    Bitboard calculated;
+
+    const Player* players[] = {&m_player1, &m_player2, &m_player3, &m_player4};
+    for (int32_t i = 0; i < 4; i++)
+    {
+        Player localPlayer(*players[i]);
+
+        Bitboard nkPoints;
+        rules::CalculateNucleationPointsCompute(m_baseBoard, localPlayer, nkPoints);
+        localPlayer.SetNucleationPointsPlane(nkPoints);
+
+        // every square a valid move would take
+        rules::CalculateValidMoves(m_baseBoard, localPlayer, moves);
+        Bitboard expected = InfluenceAreaOfMoves(m_baseBoard, moves);
+
+        rules::CalculateInfluenceAreaInBoard(m_baseBoard, localPlayer, calculated);
+        assert(calculated == expected);
+
+        // starting points of the 4 players are taken, so the slow version
+        // (which only uses the nk points) must calculate the same area
+        Player computePlayer(localPlayer);
+        rules::RecalculateInfluenceAreaInBoardCompute(m_baseBoard, computePlayer);
+        assert(computePlayer.GetInfluenceAreaPlane() == expected);
+
+        rules::RecalculateInfluenceAreaInBoard(m_baseBoard, localPlayer);
+        assert(localPlayer.GetInfluenceAreaPlane() == expected);
+        assert(localPlayer.InfluenceAreaSize() == expected.PopCount());
+    }
+
+    // empty board. Only the squares around the starting point can be reached
+    Board emptyBoard(RULES_TEST_ROWS, RULES_TEST_COLUMNS, ' ');
+    Coordinate startingCoord(4, 9);
+    Player startingPlayer(
+            std::string("starting"), 'X', RULES_TEST_ROWS, RULES_TEST_COLUMNS, startingCoord);
+
+    rules::CalculateValidMoves(emptyBoard, startingPlayer, moves);
+    rules::CalculateInfluenceAreaInBoard(emptyBoard, startingPlayer, calculated);
+    assert(calculated == InfluenceAreaOfMoves(emptyBoard, moves));
+    assert(calculated.IsSet(emptyBoard.CoordToIndex(startingCoord)));
+
+    // no pieces left. Nothing can be reached
+    for (int32_t thisPiece = e_minimumPieceIndex; thisPiece < e_numberOfPieces; thisPiece++)
+    {
+        startingPlayer.UnsetPiece(static_cast<ePieceType_t>(thisPiece));
+    }
+    rules::CalculateInfluenceAreaInBoard(emptyBoard, startingPlayer, calculated);
+    assert(calculated.IsEmpty());
 }
 
 void RulesTest::TestCanPlayerGo()
@@ -1090,3 +1154,207 @@ void RulesTest::TestCanPlayerGo()
     // local player can't go
     assert(rules::CanPlayerGo(localBoard, localPlayer) == false);
 }
+
+void RulesTest::TestCalculateValidCoordsInBoard()
+{
+    Player* players[] = {&m_player1, &m_player2, &m_player3, &m_player4};
+    std::vector<Coordinate> validCoords(VALID_COORDS_SIZE);
+    std::vector<rules::Move_t> moves;
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        Player localPlayer(*players[i]);
+
+        Bitboard nkPoints;
+        rules::CalculateNucleationPointsCompute(m_baseBoard, localPlayer, nkPoints);
+        localPlayer.SetNucleationPointsPlane(nkPoints);
+
+        // every valid coord calculated per nucleation point must be found by
+        // CalculateValidCoordsInBoard, and nothing else
+        int32_t nExpectedMoves = 0;
+        for (int32_t thisPiece = e_numberOfPieces - 1;
+             thisPiece >= e_minimumPieceIndex;
+             thisPiece--)
+        {
+            if (!localPlayer.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
+            {
+                continue;
+            }
+
+            const PieceConfTable &confTable = PieceConfTable::Instance();
+            for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                         confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                         confIt++)
+            {
+                const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
+                Bitboard expected;
+                for (int32_t nkIndex = nkPoints.NextSetBit(0);
+                     nkIndex >= 0;
+                     nkIndex = nkPoints.NextSetBit(nkIndex + 1))
+                {
+                    Coordinate nkCoord;
+                    Bitboard::IndexToCoord(nkIndex, m_baseBoard.GetNColumns(), nkCoord);
+
+                    int32_t nValidCoords = rules::CalculateValidCoordsInNucleationPoint(
+                            m_baseBoard, localPlayer, nkCoord, pieceConf, validCoords);
+                    for (int32_t k = 0; k < nValidCoords; k++)
+                    {
+                        expected.Set(m_baseBoard.CoordToIndex(validCoords[k]));
+                    }
+                }
+
+                Bitboard calculated;
+                rules::CalculateValidCoordsInBoard(
+                        m_baseBoard, localPlayer, confTable.GetConf(confIt), nkPoints, calculated);
+                assert(calculated == expected);
+
+                nExpectedMoves += expected.PopCount();
+            }
+        }
+
+        // starting points of the 4 players are taken. Only nk points count
+        assert(rules::CalculateValidMoves(m_baseBoard, localPlayer, moves) == nExpectedMoves);
+        assert(static_cast<int32_t>(moves.size()) == nExpectedMoves);
+        for (uint32_t k = 0; k < moves.size(); k++)
+        {
+            assert(rules::IsPieceDeployableCompute(
+                    m_baseBoard, *(moves[k].pieceConf->pieceConf), moves[k].coord, localPlayer));
+        }
+    }
+
+    // empty board. Moves can only be made touching the starting point
+    Board emptyBoard(RULES_TEST_ROWS, RULES_TEST_COLUMNS, ' ');
+    Coordinate startingCoord(4, 9);
+    Player startingPlayer(
+            std::string("starting"), 'X', RULES_TEST_ROWS, RULES_TEST_COLUMNS, startingCoord);
+
+    int32_t nExpectedMoves = 0;
+    for (int32_t thisPiece = e_minimumPieceIndex; thisPiece < e_numberOfPieces; thisPiece++)
+    {
+        const PieceConfTable &confTable = PieceConfTable::Instance();
+        for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                     confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                     confIt++)
+        {
+            const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
+            nExpectedMoves += rules::CalculateValidCoordsInStartingPoint(
+                    emptyBoard, startingCoord, pieceConf, validCoords);
+        }
+    }
+
+    assert(rules::CalculateValidMoves(emptyBoard, startingPlayer, moves) == nExpectedMoves);
+    for (uint32_t k = 0; k < moves.size(); k++)
+    {
+        assert(rules::IsPieceDeployableInStartingPoint(
+                emptyBoard, *(moves[k].pieceConf->pieceConf), moves[k].coord, startingCoord));
+    }
+
+    // once the starting point is taken there is no valid move left
+    emptyBoard.SetPlayerInCoord(startingCoord, m_player2);
+    assert(rules::CalculateValidMoves(emptyBoard, startingPlayer, moves) == 0);
+    assert(moves.empty());
+}
+
+void RulesTest::BenchmarkValidCoords()
+{
+    Player* players[] = {&m_player1, &m_player2, &m_player3, &m_player4};
+    Player* localPlayers[4];
+    for (int32_t i = 0; i < 4; i++)
+    {
+        localPlayers[i] = new Player(*players[i]);
+
+        Bitboard nkPoints;
+        rules::CalculateNucleationPointsCompute(m_baseBoard, *localPlayers[i], nkPoints);
+        localPlayers[i]->SetNucleationPointsPlane(nkPoints);
+    }
+
+    // 1) the valid coords of every nucleation point are calculated one by one.
+    //    Duplicates are removed with a coordinate set
+    int32_t nMovesNkPoint = 0;
+    std::vector<Coordinate> validCoords(VALID_COORDS_SIZE);
+    CoordinateSet16x16 testedCoords;
+
+    GTimer* timer = g_timer_new();
+    for (int32_t round = 0; round < BENCHMARK_VALID_COORDS_ROUNDS; round++)
+    {
+        for (int32_t i = 0; i < 4; i++)
+        {
+            const Player &thisPlayer = *localPlayers[i];
+            for (int32_t thisPiece = e_numberOfPieces - 1;
+                 thisPiece >= e_minimumPieceIndex;
+                 thisPiece--)
+            {
+                if (!thisPlayer.IsPieceAvailable(static_cast<ePieceType_t>(thisPiece)))
+                {
+                    continue;
+                }
+
+                const PieceConfTable &confTable = PieceConfTable::Instance();
+                for (int32_t confIt  = confTable.GetFirstConf(static_cast<ePieceType_t>(thisPiece));
+                             confIt  < confTable.GetEndConf(static_cast<ePieceType_t>(thisPiece));
+                             confIt++)
+                {
+                    const PieceConfiguration &pieceConf = *(confTable.GetConf(confIt).pieceConf);
+                    bool nkExists;
+                    Coordinate thisNkPoint;
+                    Player::SpiralIterator nkIterator;
+
+                    nkExists = thisPlayer.GetFirstNucleationPointSpiral(nkIterator, thisNkPoint);
+                    while (nkExists)
+                    {
+                        int32_t nValidCoords = rules::CalculateValidCoordsInNucleationPoint(
+                                m_baseBoard, thisPlayer, thisNkPoint, pieceConf, validCoords);
+                        for (int32_t k = 0; k < nValidCoords; k++)
+                        {
+                            if (!testedCoords.isPresent(validCoords[k]))
+                            {
+                                testedCoords.insert(validCoords[k]);
+                                nMovesNkPoint++;
+                            }
+                        }
+
+                        nkExists = thisPlayer.GetNextNucleationPointSpiral(nkIterator, thisNkPoint);
+                    }
+
+                    testedCoords.clear();
+                }
+            }
+        }
+    }
+#ifdef DEBUG_PRINT
+    gdouble elapsedNkPoint = g_timer_elapsed(timer, NULL);
+#endif
+
+    // 2) the flat list of valid moves calculated with bit planes
+    int32_t nMovesBitboard = 0;
+    std::vector<rules::Move_t> moves;
+
+    g_timer_start(timer);
+    for (int32_t round = 0; round < BENCHMARK_VALID_COORDS_ROUNDS; round++)
+    {
+        for (int32_t i = 0; i < 4; i++)
+        {
+            nMovesBitboard += rules::CalculateValidMoves(m_baseBoard, *localPlayers[i], moves);
+        }
+    }
+#ifdef DEBUG_PRINT
+    gdouble elapsedBitboard = g_timer_elapsed(timer, NULL);
+#endif
+    g_timer_destroy(timer);
+
+    // both of them must have found the same moves
+    assert(nMovesNkPoint == nMovesBitboard);
+
+#ifdef DEBUG_PRINT
+    std::cout << std::endl
+              << "  valid moves calculated " << BENCHMARK_VALID_COORDS_ROUNDS << " times: "
+              << (elapsedNkPoint * 1000) << "ms per nucleation point, "
+              << (elapsedBitboard * 1000) << "ms with bit planes";
+    std::cout.flush();
+#endif
+
+    for (int32_t i = 0; i < 4; i++)
+    {
+        delete localPlayers[i];
+    }
+}
@@ -73,8 +73,14 @@ private:
     void TestRecalculateNKAroundCoord();                 // missing
     void TestRecalculateInfluenceAreaAroundPieceFast();  // missing
     void TestIsCoordInfluencedByPlayerFastCompute();     // missing
-    void TestRecalculateInfluenceAreaInBoard();          // missing
+    void TestRecalculateInfluenceAreaInBoard();
     void TestCanPlayerGo();
+    void TestCalculateValidCoordsInBoard();
+
+    /// @brief compares how long it takes to calculate every valid move of
+    ///        every player using CalculateValidCoordsInNucleationPoint and using
+    ///        CalculateValidCoordsInBoard. Results are printed out
+    void BenchmarkValidCoords();
 };
 
 #endif // RULES_TEST_H_
@@ -0,0 +1,164 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  self_play_test.cpp
+/// @brief regression testing for the SelfPlay class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <cassert>
+#include <sstream>
+#include <algorithm>
+#include "self_play_test.h"
+
+/// number of games played by the self-play test
+static const int32_t SELF_PLAY_TEST_NGAMES = 4;
+
+/// number of games played at the same time in the multithread part of the test
+static const int32_t SELF_PLAY_TEST_THREADS = 2;
+
+/// size of the transposition tables used in the test (in MB)
+static const int32_t SELF_PLAY_TEST_TT_SIZE_MB = 1;
+
+SelfPlayTest::SelfPlayTest()
+{
+}
+
+SelfPlayTest::~SelfPlayTest()
+{
+}
+
+void SelfPlayTest::DoTest()
+{
+    TestPlayGame();
+    TestRunThreads();
+}
+
+void SelfPlayTest::TestPlayGame()
+{
+    SelfPlay::AIConfig_t ai1;
+    ai1.heuristicType = Heuristic::e_heuristicInfluenceArea;
+    ai1.depth         = 1;
+
+    SelfPlay::AIConfig_t ai2;
+    ai2.heuristicType = Heuristic::e_heuristicSimple;
+    ai2.depth         = 2;
+
+    SelfPlay selfPlay(ai1, ai2, SELF_PLAY_TEST_TT_SIZE_MB);
+    TranspositionTable transTableAI1(SELF_PLAY_TEST_TT_SIZE_MB);
+    TranspositionTable transTableAI2(SELF_PLAY_TEST_TT_SIZE_MB);
+
+    std::string gameEven;
+    selfPlay.PlayGame(0, transTableAI1, transTableAI2, gameEven);
+    assert(gameEven.find("{\"game\":0,") == 0);
+    assert(gameEven[gameEven.size() - 1] == '}');
+    assert(gameEven.find('\n') == std::string::npos);
+    // AI 1 is player1 in even games
+    assert(gameEven.find("\"player1\":{\"ai\":1,") != std::string::npos);
+    assert(gameEven.find("\"player2\":{\"ai\":2,") != std::string::npos);
+    assert(gameEven.find("\"winner\":") != std::string::npos);
+
+    std::string gameOdd;
+    selfPlay.PlayGame(1, transTableAI1, transTableAI2, gameOdd);
+    assert(gameOdd.find("{\"game\":1,") == 0);
+    // and player2 in odd ones
+    assert(gameOdd.find("\"player1\":{\"ai\":2,") != std::string::npos);
+    assert(gameOdd.find("\"player2\":{\"ai\":1,") != std::string::npos);
+
+    // transposition tables are cleared before every game, so the same game
+    // must be played exactly the same way again, apart from the time it took
+    std::string gameEvenAgain;
+    selfPlay.PlayGame(0, transTableAI1, transTableAI2, gameEvenAgain);
+    RemoveTimes(gameEven);
+    RemoveTimes(gameEvenAgain);
+    assert(gameEven == gameEvenAgain);
+}
+
+void SelfPlayTest::TestRunThreads()
+{
+    SelfPlay::AIConfig_t ai1;
+    ai1.heuristicType = Heuristic::e_heuristicNKWeightedv1;
+    ai1.depth         = 1;
+
+    SelfPlay::AIConfig_t ai2;
+    ai2.heuristicType = Heuristic::e_heuristicSimple;
+    ai2.depth         = 1;
+
+    SelfPlay selfPlay(ai1, ai2, SELF_PLAY_TEST_TT_SIZE_MB);
+
+    std::ostringstream oneThread;
+    selfPlay.Run(SELF_PLAY_TEST_NGAMES, 1, oneThread);
+    std::vector<std::string> oneThreadLines;
+    SortedLines(oneThread.str(), oneThreadLines);
+
+    std::ostringstream severalThreads;
+    selfPlay.Run(SELF_PLAY_TEST_NGAMES, SELF_PLAY_TEST_THREADS, severalThreads);
+    std::vector<std::string> severalThreadsLines;
+    SortedLines(severalThreads.str(), severalThreadsLines);
+
+    assert(static_cast<int32_t>(oneThreadLines.size()) == SELF_PLAY_TEST_NGAMES);
+    assert(severalThreadsLines.size() == oneThreadLines.size());
+
+    for (uint32_t i = 0; i < oneThreadLines.size(); i++)
+    {
+        // a 1-thread run writes the games sorted by index
+        std::ostringstream gameTag;
+        gameTag << "{\"game\":" << i << ",";
+        assert(oneThreadLines[i].find(gameTag.str()) == 0);
+
+        // everything but times has to be the same
+        RemoveTimes(oneThreadLines[i]);
+        RemoveTimes(severalThreadsLines[i]);
+        assert(oneThreadLines[i] == severalThreadsLines[i]);
+    }
+}
+
+void SelfPlayTest::SortedLines(const std::string &a_text, std::vector<std::string> &out_lines)
+{
+    out_lines.clear();
+
+    std::istringstream textStream(a_text);
+    std::string line;
+    while (std::getline(textStream, line))
+    {
+        out_lines.push_back(line);
+    }
+
+    std::sort(out_lines.begin(), out_lines.end());
+}
+
+void SelfPlayTest::RemoveTimes(std::string &in_out_jsonLine)
+{
+    static const std::string TIME_KEY("\"ms\":");
+
+    std::string::size_type pos = in_out_jsonLine.find(TIME_KEY);
+    while (pos != std::string::npos)
+    {
+        std::string::size_type endValue = in_out_jsonLine.find_first_of(",}", pos);
+        assert(endValue != std::string::npos);
+        in_out_jsonLine.erase(pos, endValue - pos);
+
+        pos = in_out_jsonLine.find(TIME_KEY, pos);
+    }
+}
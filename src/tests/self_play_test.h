@@ -0,0 +1,64 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  self_play_test.h
+/// @brief regression testing for the SelfPlay class
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef SELF_PLAY_TEST_H_
+#define SELF_PLAY_TEST_H_
+
+#include <string>
+#include <vector>
+#include "self_play.h"
+
+/// @brief regression testing for the SelfPlay class
+class SelfPlayTest
+{
+public:
+    SelfPlayTest();
+    virtual ~SelfPlayTest();
+
+    /// launches the self-play test!
+    void DoTest();
+
+private:
+
+    /// plays a few games and checks the JSON lines they produce
+    void TestPlayGame();
+
+    /// checks the lines written by Run are the same no matter how many games
+    /// are played at the same time
+    void TestRunThreads();
+
+    /// splits a_text in lines (with no '\n') and saves them sorted into out_lines
+    static void SortedLines(const std::string &a_text, std::vector<std::string> &out_lines);
+
+    /// removes from in_out_jsonLine every "ms" value, which are the only ones
+    /// that change from one run of the same game to another
+    static void RemoveTimes(std::string &in_out_jsonLine);
+};
+
+#endif /* SELF_PLAY_TEST_H_ */
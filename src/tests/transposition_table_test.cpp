@@ -0,0 +1,347 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  transposition_table_test.cpp
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Packed moves
+/// @endhistory
+///
+// ============================================================================
+
+#include "transposition_table_test.h"
+#include "zobrist.h"
+#ifdef DEBUG_PRINT
+#include <iostream>
+#endif
+
+/// size of the table used by the test (in MB)
+static const int32_t TEST_TABLE_SIZE_MB = 1;
+
+/// number of columns of the board moves are packed for
+static const int32_t TEST_BOARD_COLUMNS = 14;
+
+TranspositionTableTest::TranspositionTableTest() :
+    m_table(TEST_TABLE_SIZE_MB)
+{
+}
+
+TranspositionTableTest::~TranspositionTableTest()
+{
+}
+
+void TranspositionTableTest::DoTest()
+{
+    // all other test functions are called from this one
+    TestPackedMove();
+    TestStoreAndProbe();
+    TestReplacement();
+    TestNewSearch();
+    TestDisabledTable();
+}
+
+void TranspositionTableTest::TestPackedMove()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    // Coordinate is a plain 8-byte value (no vtable)
+    assert(sizeof(Coordinate) == 2 * sizeof(int32_t));
+
+    assert(packedmove::IsNoMove(packedmove::NoMove()));
+    assert(packedmove::GetPieceType(packedmove::NoMove()) == e_noPiece);
+
+    // every square of a 20x20 board with the biggest piece type and conf index
+    Coordinate coord;
+    for (int32_t index = 0; index < 20 * 20; index++)
+    {
+        PackedMove_t move = packedmove::Pack(e_5Piece_SquarePlus, 7, index);
+        assert(packedmove::IsNoMove(move) == false);
+        assert(packedmove::GetPieceType(move) == e_5Piece_SquarePlus);
+        assert(packedmove::GetConfIndex(move) == 7);
+        assert(packedmove::GetSquareIndex(move) == index);
+
+        packedmove::ToCoordinate(move, 20, coord);
+        assert(coord == Coordinate(index / 20, index % 20));
+        assert(packedmove::FromCoordinate(e_5Piece_SquarePlus, 7, coord, 20) == move);
+    }
+
+    // the configuration is read from the precalculated table
+    const PieceConfTable &confTable = PieceConfTable::Instance();
+    for (int32_t confIt  = confTable.GetFirstConf(e_4Piece_LittleS);
+                 confIt  < confTable.GetEndConf(e_4Piece_LittleS);
+                 confIt++)
+    {
+        const PieceConf_t &pieceConf = confTable.GetConf(confIt);
+        PackedMove_t move = packedmove::Pack(pieceConf.pieceType, pieceConf.confIndex, 0);
+        assert(&packedmove::GetConf(move, confTable) == &pieceConf);
+    }
+}
+
+void TranspositionTableTest::TestStoreAndProbe()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    m_table.Clear();
+
+    // the table must be a power of 2 and fit in the size requested
+    uint32_t nEntries = m_table.GetNEntries();
+    assert(nEntries > 0);
+    assert((nEntries & (nEntries - 1)) == 0);
+    assert((nEntries * 16) <= static_cast<uint32_t>(TEST_TABLE_SIZE_MB << 20));
+
+    TranspositionTable::Stats_t stats;
+    TranspositionTable::ResetStats(stats);
+    TranspositionTable::Entry_t entry;
+
+    // best move saved with some of the positions
+    const PackedMove_t testMove = packedmove::FromCoordinate(
+            e_5Piece_SquarePlus, 7, Coordinate(13, 0), TEST_BOARD_COLUMNS);
+
+    // nothing was saved yet
+    assert(m_table.Probe(zobrist::Mix(1), entry, stats) == false);
+    assert(stats.misses == 1);
+    assert(stats.hits == 0);
+
+    // positive and negative values, with and without best move
+    m_table.Store(
+            zobrist::Mix(1),
+            3,
+            -1234,
+            TranspositionTable::e_boundExact,
+            testMove);
+    m_table.Store(
+            zobrist::Mix(2),
+            200,
+            2147483647,
+            TranspositionTable::e_boundLower,
+            packedmove::NoMove());
+
+    assert(m_table.Probe(zobrist::Mix(1), entry, stats));
+    assert(entry.value == -1234);
+    assert(entry.depth == 3);
+    assert(entry.bound == TranspositionTable::e_boundExact);
+    assert(entry.move == testMove);
+
+    assert(m_table.Probe(zobrist::Mix(2), entry, stats));
+    assert(entry.value == 2147483647);
+    assert(entry.depth == 200);
+    assert(entry.bound == TranspositionTable::e_boundLower);
+    assert(packedmove::IsNoMove(entry.move));
+    assert(stats.hits == 2);
+
+    // saving again the same position without best move keeps the old one
+    m_table.Store(
+            zobrist::Mix(1),
+            5,
+            -2147483647,
+            TranspositionTable::e_boundUpper,
+            packedmove::NoMove());
+    assert(m_table.Probe(zobrist::Mix(1), entry, stats));
+    assert(entry.value == -2147483647);
+    assert(entry.depth == 5);
+    assert(entry.bound == TranspositionTable::e_boundUpper);
+    assert(entry.move == testMove);
+
+    // a move which can't be packed is not saved
+    m_table.Store(
+            zobrist::Mix(3),
+            1,
+            0,
+            TranspositionTable::e_boundExact,
+            packedmove::FromCoordinate(
+                e_1Piece_BabyPiece, 0, Coordinate(40, 40), 41));
+    assert(m_table.Probe(zobrist::Mix(3), entry, stats));
+    assert(entry.value == 0);
+    assert(packedmove::IsNoMove(entry.move));
+}
+
+void TranspositionTableTest::TestReplacement()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    m_table.Clear();
+
+    TranspositionTable::Stats_t stats;
+    TranspositionTable::ResetStats(stats);
+    TranspositionTable::Entry_t entry;
+
+    // all these keys go to the same bucket, since only the lowest bits
+    // of the key are used to index the table
+    const int32_t nKeys = TranspositionTable::ENTRIES_PER_BUCKET + 1;
+    uint64_t keys[nKeys];
+    for (int32_t i = 0; i < nKeys; i++)
+    {
+        keys[i] = 0x0123ull | (static_cast<uint64_t>(i + 1) << 48);
+    }
+
+    // fill up the bucket. keys[1] is the shallowest entry
+    for (int32_t i = 0; i < TranspositionTable::ENTRIES_PER_BUCKET; i++)
+    {
+        m_table.Store(
+                keys[i],
+                (i == 1) ? 1 : 10 + i,
+                i,
+                TranspositionTable::e_boundExact,
+                packedmove::NoMove());
+    }
+
+    for (int32_t i = 0; i < TranspositionTable::ENTRIES_PER_BUCKET; i++)
+    {
+        assert(m_table.Probe(keys[i], entry, stats));
+        assert(entry.value == i);
+    }
+
+    // the bucket is full of other positions: a collision
+    assert(m_table.Probe(keys[nKeys - 1], entry, stats) == false);
+    assert(stats.collisions == 1);
+
+    // the shallowest entry must be replaced
+    m_table.Store(
+            keys[nKeys - 1],
+            5,
+            100,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+
+    assert(m_table.Probe(keys[nKeys - 1], entry, stats));
+    assert(entry.value == 100);
+    assert(m_table.Probe(keys[1], entry, stats) == false);
+    assert(m_table.Probe(keys[0], entry, stats));
+    assert(m_table.Probe(keys[2], entry, stats));
+
+    // entries saved by previous searches are replaced before deeper ones
+    m_table.NewSearch(0);
+    m_table.Store(
+            keys[0],
+            20,
+            0,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+    m_table.Store(
+            keys[2],
+            20,
+            2,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+    m_table.Store(
+            keys[3],
+            20,
+            3,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+    m_table.Store(
+            keys[1],
+            1,
+            1,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+
+    // keys[4] (depth 5) was the only one left from the previous search
+    assert(m_table.Probe(keys[1], entry, stats));
+    assert(m_table.Probe(keys[nKeys - 1], entry, stats) == false);
+}
+
+void TranspositionTableTest::TestNewSearch()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    TranspositionTable::Stats_t stats;
+    TranspositionTable::ResetStats(stats);
+    TranspositionTable::Entry_t entry;
+
+    m_table.NewSearch(1);
+    m_table.Store(
+            zobrist::Mix(10),
+            2,
+            10,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+
+    stats.hits   = 3;
+    stats.misses = 2;
+    stats.collisions = 1;
+    m_table.AddStats(stats);
+    m_table.AddStats(stats);
+    assert(m_table.GetStats().hits == 6);
+    assert(m_table.GetStats().misses == 4);
+    assert(m_table.GetStats().collisions == 2);
+
+    // same search id: entries can be reused. Stats are reset
+    m_table.NewSearch(1);
+    assert(m_table.GetStats().hits == 0);
+    assert(m_table.GetStats().misses == 0);
+    assert(m_table.GetStats().collisions == 0);
+    assert(m_table.Probe(zobrist::Mix(10), entry, stats));
+
+    // different search id: the table is emptied
+    m_table.NewSearch(2);
+    assert(m_table.Probe(zobrist::Mix(10), entry, stats) == false);
+}
+
+void TranspositionTableTest::TestDisabledTable()
+{
+#ifdef DEBUG_PRINT
+    std::cout << __FUNCTION__ << std::endl;
+#endif
+
+    TranspositionTable::Stats_t stats;
+    TranspositionTable::ResetStats(stats);
+    TranspositionTable::Entry_t entry;
+
+    TranspositionTable disabledTable(0);
+    assert(disabledTable.GetNEntries() == 0);
+    assert(disabledTable.GetSizeMB() == 0);
+
+    disabledTable.Store(
+            zobrist::Mix(1),
+            1,
+            1,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+    assert(disabledTable.Probe(zobrist::Mix(1), entry, stats) == false);
+    assert(stats.misses == 1);
+
+    // resizing the table enables it
+    disabledTable.Resize(1);
+    assert(disabledTable.GetSizeMB() == 1);
+    assert(disabledTable.GetNEntries() == m_table.GetNEntries());
+    disabledTable.Store(
+            zobrist::Mix(1),
+            1,
+            1,
+            TranspositionTable::e_boundExact,
+            packedmove::NoMove());
+    assert(disabledTable.Probe(zobrist::Mix(1), entry, stats));
+
+    // size is capped
+    disabledTable.Resize(-3);
+    assert(disabledTable.GetSizeMB() == 0);
+    assert(disabledTable.Probe(zobrist::Mix(1), entry, stats) == false);
+}
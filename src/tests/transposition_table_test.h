@@ -0,0 +1,66 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  transposition_table_test.h
+/// @brief
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Packed moves
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef TRANSPOSITION_TABLE_TEST_H_
+#define TRANSPOSITION_TABLE_TEST_H_
+
+#include "transposition_table.h"
+
+/// @brief regression testing for the TranspositionTable class
+class TranspositionTableTest
+{
+public:
+    TranspositionTableTest();
+    virtual ~TranspositionTableTest();
+
+    /// launches the TranspositionTable test!
+    void DoTest();
+
+private:
+    /// the table being tested
+    TranspositionTable m_table;
+
+    /// tests moves packed into PackedMove_t words can be read back
+    void TestPackedMove();
+
+    /// tests entries saved into the table can be retrieved exactly as they were saved
+    void TestStoreAndProbe();
+
+    /// tests which entry is replaced when a bucket is full
+    void TestReplacement();
+
+    /// tests statistics and the way the table is cleared by NewSearch
+    void TestNewSearch();
+
+    /// tests a table with size 0 doesn't save anything
+    void TestDisabledTable();
+};
+
+#endif /* TRANSPOSITION_TABLE_TEST_H_ */
@@ -0,0 +1,136 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  transposition_table.cpp
+/// @brief Fixed-size hash table of positions already evaluated by MinMax
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include <string.h> // memset
+#include "transposition_table.h"
+
+TranspositionTable::TranspositionTable(int32_t a_sizeMB) :
+    m_memory(NULL),
+    m_buckets(NULL),
+    m_nBuckets(0),
+    m_sizeMB(0),
+    m_generation(0),
+    m_searchId(0)
+{
+    ResetStats(m_stats);
+    Resize(a_sizeMB);
+}
+
+TranspositionTable::~TranspositionTable()
+{
+    if (m_memory != NULL)
+    {
+        delete [] m_memory;
+    }
+}
+
+void TranspositionTable::Resize(int32_t a_sizeMB)
+{
+    if (a_sizeMB < 0)
+    {
+        a_sizeMB = 0;
+    }
+    else if (a_sizeMB > TRANSPOSITION_TABLE_MAX_SIZE_MB)
+    {
+        a_sizeMB = TRANSPOSITION_TABLE_MAX_SIZE_MB;
+    }
+
+    if ( (a_sizeMB == m_sizeMB) && ((m_memory != NULL) || (a_sizeMB == 0)) )
+    {
+        // nothing to do
+        return;
+    }
+
+    if (m_memory != NULL)
+    {
+        delete [] m_memory;
+        m_memory  = NULL;
+        m_buckets = NULL;
+    }
+
+    m_sizeMB   = a_sizeMB;
+    m_nBuckets = 0;
+    if (m_sizeMB == 0)
+    {
+        // the table is disabled
+        return;
+    }
+
+    // the number of buckets must be a power of 2 so the index of a key
+    // can be calculated with a mask
+    uint64_t maxBuckets = (static_cast<uint64_t>(m_sizeMB) << 20) / sizeof(Bucket_t);
+    m_nBuckets = 1;
+    while ((static_cast<uint64_t>(m_nBuckets) << 1) <= maxBuckets)
+    {
+        m_nBuckets <<= 1;
+    }
+
+    // allocate an extra cache line so the buckets can be aligned
+    m_memory  = new uint8_t[(m_nBuckets * sizeof(Bucket_t)) + CACHE_LINE_SIZE];
+    m_buckets = reinterpret_cast<Bucket_t*>(
+            (reinterpret_cast<uintptr_t>(m_memory) + CACHE_LINE_SIZE - 1) &
+            ~static_cast<uintptr_t>(CACHE_LINE_SIZE - 1));
+
+    Clear();
+}
+
+void TranspositionTable::Clear()
+{
+    if (m_buckets != NULL)
+    {
+        memset(m_buckets, 0, m_nBuckets * sizeof(Bucket_t));
+    }
+}
+
+void TranspositionTable::NewSearch(uint64_t a_searchId)
+{
+    if (a_searchId != m_searchId)
+    {
+        // values saved by the previous search can't be used by this one
+        Clear();
+        m_searchId = a_searchId;
+    }
+
+    m_generation++;
+    ResetStats(m_stats);
+}
+
+void TranspositionTable::AddStats(const Stats_t &a_stats)
+{
+    m_stats.hits       += a_stats.hits;
+    m_stats.misses     += a_stats.misses;
+    m_stats.collisions += a_stats.collisions;
+}
+
+void TranspositionTable::ResetStats(Stats_t &out_stats)
+{
+    out_stats.hits       = 0;
+    out_stats.misses     = 0;
+    out_stats.collisions = 0;
+}
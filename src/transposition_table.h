@@ -0,0 +1,211 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  transposition_table.h
+/// @brief Fixed-size hash table of positions already evaluated by MinMax
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Best move saved as a PackedMove_t
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef TRANSPOSITION_TABLE_H_
+#define TRANSPOSITION_TABLE_H_
+
+#include <stdint.h> // for types
+#include "assert.h"
+#include "piece.h"
+#include "packed_move.h"
+
+/// default size of the transposition table (in MB)
+const int32_t TRANSPOSITION_TABLE_DEFAULT_SIZE_MB = 16;
+/// maximum size of the transposition table (in MB)
+const int32_t TRANSPOSITION_TABLE_MAX_SIZE_MB = 1024;
+
+/// @brief a fixed-size table which saves the result of the evaluation of positions
+/// The same position can be reached putting down the same pieces in a different
+/// order. The table saves, indexed by the zobrist hash key of the position
+/// (see namespace zobrist), the value calculated by the search, the depth it was
+/// searched with, which kind of value it is (exact or lower/upper bound) and the
+/// best move found, so the search doesn't need to explore the same subtree again
+///
+/// Entries are grouped in buckets of the size of a cache line. All the entries
+/// of a bucket are accessed with only one memory read. The table can be accessed
+/// by several threads at the same time without locks: every entry saves its key
+/// xor'ed with its data, so an entry half written by another thread is detected
+/// (its key won't match) and ignored
+class TranspositionTable
+{
+public:
+    /// size of a cache line (in bytes). Buckets are aligned to this size
+    static const int32_t CACHE_LINE_SIZE = 64;
+    /// number of entries per bucket
+    static const int32_t ENTRIES_PER_BUCKET = 4;
+
+    /// kind of value saved in an entry of the table
+    typedef enum
+    {
+        e_boundNone = 0, // no value saved (only used by empty entries)
+        e_boundExact,    // the value is exact
+        e_boundLower,    // the value is a lower bound (search failed high)
+        e_boundUpper,    // the value is an upper bound (search failed low)
+    } eBound_t;
+
+    /// data saved per position
+    typedef struct
+    {
+        /// value calculated by the search
+        int32_t      value;
+        /// depth of the subtree searched to calculate value
+        int32_t      depth;
+        /// kind of value
+        eBound_t     bound;
+        /// best move. packedmove::NoMove() if there is no best move saved
+        PackedMove_t move;
+    } Entry_t;
+
+    /// statistics of the access to the table. Every probe is counted either
+    /// as a hit, a miss or a collision
+    typedef struct
+    {
+        /// the position was found in the table
+        uint64_t hits;
+        /// the position was not found and its bucket was empty
+        uint64_t misses;
+        /// the position was not found, but its bucket was being used
+        /// by other positions
+        uint64_t collisions;
+    } Stats_t;
+
+    /// @param size of the table in MB. A table with size 0 is disabled (nothing
+    ///        is saved into it, every probe is a miss)
+    TranspositionTable(int32_t a_sizeMB = TRANSPOSITION_TABLE_DEFAULT_SIZE_MB);
+    virtual ~TranspositionTable();
+
+    /// @brief changes the size of the table. Every entry is lost
+    /// it doesn't do anything if the new size is the same as the current one
+    /// @param size of the table in MB. Capped to TRANSPOSITION_TABLE_MAX_SIZE_MB
+    void Resize(int32_t a_sizeMB);
+
+    /// @return the size of the table in MB
+    int32_t GetSizeMB() const;
+
+    /// @return the number of entries the table can save
+    uint32_t GetNEntries() const;
+
+    /// @brief empties the table
+    void Clear();
+
+    /// @brief prepares the table to be used by a new search
+    /// Statistics are reset. Entries saved by previous searches can still be used,
+    /// but they will be replaced first. The whole table is cleared if a_searchId
+    /// is different from the one used by the previous search (values calculated
+    /// with a different evaluation function can't be reused for example)
+    /// @param identifier of the search
+    void NewSearch(uint64_t a_searchId);
+
+    /// @brief looks for a position in the table
+    /// it doesn't take any lock. It can be called by several threads at the same time
+    /// @param zobrist hash key of the position
+    /// @param entry of the position. Only valid if true is returned
+    /// @param statistics that will be updated according to the result of the probe
+    /// @return true if the position was found
+    bool Probe(uint64_t a_key, Entry_t &out_entry, Stats_t &in_out_stats) const;
+
+    /// @brief saves a position in the table
+    /// if the bucket of the position is full the entry considered less valuable is replaced
+    /// it doesn't take any lock. It can be called by several threads at the same time
+    /// @param zobrist hash key of the position
+    /// @param depth of the subtree searched to calculate a_value
+    /// @param value calculated by the search
+    /// @param kind of value (exact, lower or upper bound)
+    /// @param best move. packedmove::NoMove() if there is no best move. Moves whose
+    ///        square index doesn't fit in the table (boards bigger than 32x32) are
+    ///        not saved
+    void Store(
+            uint64_t     a_key,
+            int32_t      a_depth,
+            int32_t      a_value,
+            eBound_t     a_bound,
+            PackedMove_t a_move);
+
+    /// @brief adds a_stats to the statistics of the table
+    /// Not thread safe. Threads are supposed to keep their own statistics
+    /// and add them once they're finished
+    void AddStats(const Stats_t &a_stats);
+
+    /// @return statistics of the accesses to the table since the last call to NewSearch
+    const Stats_t& GetStats() const;
+
+    /// @brief resets a statistics structure
+    static void ResetStats(Stats_t &out_stats);
+
+private:
+    /// an entry of the table as it is saved in memory
+    typedef struct
+    {
+        /// zobrist key xor'ed with data
+        uint64_t keyXorData;
+        /// the data of the entry packed into 64 bits
+        uint64_t data;
+    } PackedEntry_t;
+
+    /// a bucket of entries. It takes a whole cache line
+    typedef struct
+    {
+        PackedEntry_t entries[ENTRIES_PER_BUCKET];
+    } Bucket_t;
+
+    /// memory allocated for the table. It might not be aligned to the cache line
+    uint8_t* m_memory;
+    /// buckets of the table (aligned to CACHE_LINE_SIZE)
+    Bucket_t* m_buckets;
+    /// number of buckets. It is always a power of 2 (or 0 if the table is disabled)
+    uint32_t m_nBuckets;
+    /// size of the table in MB
+    int32_t m_sizeMB;
+    /// number of the current search (only 4 bits are saved into every entry)
+    uint8_t m_generation;
+    /// identifier of the current search
+    uint64_t m_searchId;
+    /// statistics of the accesses to the table
+    Stats_t m_stats;
+
+    /// @brief packs the data of an entry into 64 bits
+    uint64_t Pack(
+            int32_t      a_depth,
+            int32_t      a_value,
+            eBound_t     a_bound,
+            PackedMove_t a_move) const;
+
+    /// @brief unpacks 64 bits packed by Pack
+    static void Unpack(uint64_t a_data, Entry_t &out_entry);
+
+    // no copy constructor or operator= allowed
+    TranspositionTable(const TranspositionTable &a_src);
+    TranspositionTable& operator=(const TranspositionTable &a_src);
+};
+
+// include implementation details of inline functions
+#include "impl/transposition_table_impl.h"
+
+#endif /* TRANSPOSITION_TABLE_H_ */
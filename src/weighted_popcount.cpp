@@ -0,0 +1,266 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  weighted_popcount.cpp
+/// @brief Weighted sums of the bits set in several bit planes (scalar and SIMD kernels)
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#include "weighted_popcount.h"
+
+// SIMD kernels are only built for x86 processors. They are compiled with the
+// target attribute, so the rest of the program doesn't need any special flag,
+// and only run if the CPU supports them (checked at start up)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WEIGHTED_POPCOUNT_X86
+#include <immintrin.h>
+#endif
+
+/// type of the functions which implement a kernel
+typedef int32_t (*KernelFunction_t)(const Bitboard[], const int32_t[], int32_t);
+
+/// @brief the scalar kernel. It works on any CPU
+static int32_t CalculateScalar(
+        const Bitboard a_planes[],
+        const int32_t  a_weights[],
+        int32_t        a_nPlanes)
+{
+    int32_t rv = 0;
+    for (int32_t i = 0; i < a_nPlanes; i++)
+    {
+        rv += a_weights[i] * a_planes[i].PopCount();
+    }
+    return rv;
+}
+
+#ifdef WEIGHTED_POPCOUNT_X86
+/// @brief the SSE2 kernel
+/// Bits are counted per byte with the usual shift-and-mask reduction. Bytes are
+/// added up into 2 64-bit lanes with _mm_sad_epu8 and multiplied by the weight of
+/// their plane. _mm_mul_epu32 is an unsigned multiplication, but only the lowest
+/// 32 bits of the total are returned, and those are the same a signed one would give
+__attribute__((target("sse2")))
+static int32_t CalculateSSE2(
+        const Bitboard a_planes[],
+        const int32_t  a_weights[],
+        int32_t        a_nPlanes)
+{
+    const __m128i mask55 = _mm_set1_epi8(0x55);
+    const __m128i mask33 = _mm_set1_epi8(0x33);
+    const __m128i mask0f = _mm_set1_epi8(0x0f);
+    const __m128i zero   = _mm_setzero_si128();
+
+    __m128i total = _mm_setzero_si128();
+    for (int32_t i = 0; i < a_nPlanes; i++)
+    {
+        const __m128i* words = reinterpret_cast<const __m128i*>(a_planes[i].GetWords());
+
+        // bits set in each byte of the plane (8 at most), added up 4 vectors at a time
+        __m128i byteCounts = _mm_setzero_si128();
+        for (int32_t j = 0; j < (BITBOARD_N_WORDS / 2); j++)
+        {
+            __m128i v = _mm_loadu_si128(words + j);
+            v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), mask55));
+            v = _mm_add_epi8(_mm_and_si128(v, mask33),
+                             _mm_and_si128(_mm_srli_epi64(v, 2), mask33));
+            v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), mask0f);
+            byteCounts = _mm_add_epi8(byteCounts, v);
+        }
+
+        // horizontal add of the bytes into 2 64-bit lanes times the weight of the plane
+        __m128i planeCount = _mm_sad_epu8(byteCounts, zero);
+        total = _mm_add_epi64(
+                    total,
+                    _mm_mul_epu32(planeCount, _mm_set1_epi32(a_weights[i])));
+    }
+
+    total = _mm_add_epi64(total, _mm_unpackhi_epi64(total, total));
+    return _mm_cvtsi128_si32(total);
+}
+
+/// @brief the AVX2 kernel
+/// Bits are counted per nibble with a lookup table (_mm256_shuffle_epi8). The rest
+/// is the same as the SSE2 kernel with 4 64-bit lanes
+__attribute__((target("avx2")))
+static int32_t CalculateAVX2(
+        const Bitboard a_planes[],
+        const int32_t  a_weights[],
+        int32_t        a_nPlanes)
+{
+    const __m256i lookup = _mm256_setr_epi8(
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i mask0f = _mm256_set1_epi8(0x0f);
+    const __m256i zero   = _mm256_setzero_si256();
+
+    __m256i total = _mm256_setzero_si256();
+    for (int32_t i = 0; i < a_nPlanes; i++)
+    {
+        const __m256i* words = reinterpret_cast<const __m256i*>(a_planes[i].GetWords());
+
+        __m256i byteCounts = _mm256_setzero_si256();
+        for (int32_t j = 0; j < (BITBOARD_N_WORDS / 4); j++)
+        {
+            __m256i v = _mm256_loadu_si256(words + j);
+            byteCounts = _mm256_add_epi8(
+                            byteCounts,
+                            _mm256_add_epi8(
+                                _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, mask0f)),
+                                _mm256_shuffle_epi8(
+                                    lookup,
+                                    _mm256_and_si256(_mm256_srli_epi64(v, 4), mask0f))));
+        }
+
+        __m256i planeCount = _mm256_sad_epu8(byteCounts, zero);
+        total = _mm256_add_epi64(
+                    total,
+                    _mm256_mul_epu32(planeCount, _mm256_set1_epi32(a_weights[i])));
+    }
+
+    __m128i total128 = _mm_add_epi64(
+                            _mm256_castsi256_si128(total),
+                            _mm256_extracti128_si256(total, 1));
+    total128 = _mm_add_epi64(total128, _mm_unpackhi_epi64(total128, total128));
+    return _mm_cvtsi128_si32(total128);
+}
+#endif // WEIGHTED_POPCOUNT_X86
+
+/// @return the function which implements a_kernel. NULL if it is not built
+static KernelFunction_t GetKernelFunction(weightedpopcount::eKernel_t a_kernel)
+{
+    switch (a_kernel)
+    {
+    case weightedpopcount::e_kernelScalar:
+        return CalculateScalar;
+#ifdef WEIGHTED_POPCOUNT_X86
+    case weightedpopcount::e_kernelSSE2:
+        return CalculateSSE2;
+    case weightedpopcount::e_kernelAVX2:
+        return CalculateAVX2;
+#endif
+    default:
+        return NULL;
+    }
+}
+
+/// @return the best kernel supported by the CPU
+static weightedpopcount::eKernel_t SelectBestKernel()
+{
+    for (int32_t i = weightedpopcount::e_kernelCount - 1; i > weightedpopcount::e_kernelScalar; i--)
+    {
+        weightedpopcount::eKernel_t thisKernel = static_cast<weightedpopcount::eKernel_t>(i);
+        if (weightedpopcount::IsKernelSupported(thisKernel))
+        {
+            return thisKernel;
+        }
+    }
+    return weightedpopcount::e_kernelScalar;
+}
+
+/// kernel used by weightedpopcount::Calculate. Picked before main is run
+static weightedpopcount::eKernel_t g_kernel = SelectBestKernel();
+/// function which implements g_kernel
+static KernelFunction_t g_kernelFunction = GetKernelFunction(g_kernel);
+
+int32_t weightedpopcount::Calculate(
+        const Bitboard a_planes[],
+        const int32_t  a_weights[],
+        int32_t        a_nPlanes)
+{
+#ifdef DEBUG
+    assert(a_nPlanes <= WEIGHTED_POPCOUNT_MAX_PLANES);
+#endif
+    return g_kernelFunction(a_planes, a_weights, a_nPlanes);
+}
+
+int32_t weightedpopcount::Calculate(
+        eKernel_t      a_kernel,
+        const Bitboard a_planes[],
+        const int32_t  a_weights[],
+        int32_t        a_nPlanes)
+{
+#ifdef DEBUG
+    assert(IsKernelSupported(a_kernel));
+    assert(a_nPlanes <= WEIGHTED_POPCOUNT_MAX_PLANES);
+#endif
+    return GetKernelFunction(a_kernel)(a_planes, a_weights, a_nPlanes);
+}
+
+bool weightedpopcount::IsKernelSupported(eKernel_t a_kernel)
+{
+    if (GetKernelFunction(a_kernel) == NULL)
+    {
+        // not built for this processor
+        return false;
+    }
+
+#ifdef WEIGHTED_POPCOUNT_X86
+    // it might be called before main is run (while g_kernel is initialised)
+    __builtin_cpu_init();
+
+    switch (a_kernel)
+    {
+    case e_kernelSSE2:
+        return __builtin_cpu_supports("sse2");
+    case e_kernelAVX2:
+        return __builtin_cpu_supports("avx2");
+    default:
+        break;
+    }
+#endif
+
+    return true;
+}
+
+weightedpopcount::eKernel_t weightedpopcount::GetKernel()
+{
+    return g_kernel;
+}
+
+bool weightedpopcount::SetKernel(eKernel_t a_kernel)
+{
+    if (!IsKernelSupported(a_kernel))
+    {
+        return false;
+    }
+
+    g_kernel = a_kernel;
+    g_kernelFunction = GetKernelFunction(a_kernel);
+    return true;
+}
+
+const char* weightedpopcount::GetKernelName(eKernel_t a_kernel)
+{
+    switch (a_kernel)
+    {
+    case e_kernelScalar:
+        return "scalar";
+    case e_kernelSSE2:
+        return "SSE2";
+    case e_kernelAVX2:
+        return "AVX2";
+    default:
+        return "unknown";
+    }
+}
@@ -0,0 +1,90 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  weighted_popcount.h
+/// @brief Weighted sums of the bits set in several bit planes (scalar and SIMD kernels)
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef WEIGHTED_POPCOUNT_H_
+#define WEIGHTED_POPCOUNT_H_
+
+#include <stdint.h> // for types
+#include "bitboard.h"
+
+/// maximum number of planes weightedpopcount::Calculate can add up at once
+const int32_t WEIGHTED_POPCOUNT_MAX_PLANES = 16;
+
+/// @brief the heuristics which go through the whole board are a weighted sum
+/// of the number of squares set in a few bit planes (the circular weight of a
+/// square is split into bit planes too, see Board::GetCircularWeightSlice). These
+/// functions calculate that sum with the best kernel the CPU supports, picked once
+/// at start up: AVX2 or SSE2 on x86 processors, a scalar one otherwise. Every
+/// kernel returns exactly the same value
+namespace weightedpopcount
+{
+    /// kernels the weighted sum can be calculated with
+    typedef enum
+    {
+        e_kernelScalar = 0,
+        e_kernelSSE2,
+        e_kernelAVX2,
+
+        e_kernelCount, // number of kernels. Must be always at the end
+    } eKernel_t;
+
+    /// @return the sum of a_weights[i] times the number of bits set in a_planes[i]
+    ///         for every i in [0, a_nPlanes). It must fit in an int32_t
+    /// @param the planes. Up to WEIGHTED_POPCOUNT_MAX_PLANES
+    /// @param the weight of each plane
+    /// @param number of planes
+    int32_t Calculate(
+            const Bitboard a_planes[],
+            const int32_t  a_weights[],
+            int32_t        a_nPlanes);
+
+    /// @brief same as Calculate, but using the kernel a_kernel
+    /// a_kernel must be supported by the CPU (see IsKernelSupported)
+    int32_t Calculate(
+            eKernel_t      a_kernel,
+            const Bitboard a_planes[],
+            const int32_t  a_weights[],
+            int32_t        a_nPlanes);
+
+    /// @return true if the CPU the program is running on supports a_kernel
+    bool IsKernelSupported(eKernel_t a_kernel);
+
+    /// @return the kernel used by Calculate
+    eKernel_t GetKernel();
+
+    /// @brief sets the kernel used by Calculate. It is the best one supported by the
+    /// CPU by default. It is not thread safe: it can't be called while a search is running
+    /// @return false if a_kernel is not supported by the CPU (the kernel is not changed)
+    bool SetKernel(eKernel_t a_kernel);
+
+    /// @return the name of a_kernel
+    const char* GetKernelName(eKernel_t a_kernel);
+};
+
+#endif /* WEIGHTED_POPCOUNT_H_ */
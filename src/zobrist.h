@@ -0,0 +1,96 @@
+// ============================================================================
+// Copyright 2026 agent
+//
+// This file is part of Blockem.
+//
+// Blockem is free software: you can redistribute it and/or modify it under the
+// terms of the GNU General Public License as published by the Free Software
+// Foundation, either version 3 of the License, or (at your option) any later
+// version.
+//
+// Blockem is distributed in the hope that it will be useful, but WITHOUT ANY
+// WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along
+// with Blockem. If not, see http://www.gnu.org/licenses/.
+//
+/// @file  zobrist.h
+/// @brief Random keys used to calculate zobrist hash keys of blockem positions
+///
+/// @author agent
+/// @history
+/// Ref       Who                When         What
+///           agent              17-Oct-2026  Original development
+///           agent              17-Oct-2026  Key of positions solved by the endgame solver
+/// @endhistory
+///
+// ============================================================================
+
+#ifndef _ZOBRIST_H_
+#define _ZOBRIST_H_
+
+#include <stdint.h> // for types
+#include "piece.h"
+#include "coordinate.h"
+
+/// this namespace contains the random keys which, xor'ed together, make up
+/// the zobrist hash key of a position. Every feature of a position (a square
+/// taken by a player, a piece already used by a player...) has got its own
+/// key, so the hash key of a position can be updated incrementally each time
+/// a piece is put down or removed (xor'ing the keys of the squares it takes)
+///
+/// Keys are not saved in tables. They are calculated on the fly mixing the
+/// bits of a value which is unique per feature, which means there is no
+/// limit in the size of the board and keys are always the same (they can be
+/// saved into a file and used in a later run of the application)
+namespace zobrist
+{
+    /// @brief mixes the bits of a 64-bit value (splitmix64 finaliser)
+    /// 2 different input values will produce 2 different (random looking) outputs
+    inline uint64_t Mix(uint64_t a_value)
+    {
+        a_value += static_cast<uint64_t>(0x9e3779b97f4a7c15ull);
+        a_value  = (a_value ^ (a_value >> 30)) * static_cast<uint64_t>(0xbf58476d1ce4e5b9ull);
+        a_value  = (a_value ^ (a_value >> 27)) * static_cast<uint64_t>(0x94d049bb133111ebull);
+        return a_value ^ (a_value >> 31);
+    }
+
+    /// @return the key that represents the square a_coord taken by the
+    ///         player represented by a_presentationChar
+    inline uint64_t SquareKey(char a_presentationChar, const Coordinate &a_coord)
+    {
+        return Mix( (static_cast<uint64_t>(1) << 56) |
+                    (static_cast<uint64_t>(static_cast<uint8_t>(a_presentationChar)) << 40) |
+                    (static_cast<uint64_t>(a_coord.m_row & 0xfffff) << 20) |
+                     static_cast<uint64_t>(a_coord.m_col & 0xfffff) );
+    }
+
+    /// @return the key that represents a_piece already used (not available) by
+    ///         the player represented by a_presentationChar
+    inline uint64_t PieceKey(char a_presentationChar, ePieceType_t a_piece)
+    {
+        return Mix( (static_cast<uint64_t>(2) << 56) |
+                    (static_cast<uint64_t>(static_cast<uint8_t>(a_presentationChar)) << 40) |
+                     static_cast<uint64_t>(a_piece) );
+    }
+
+    /// @return the key that represents the player a_presentationChar being
+    ///         the next one to put down a piece
+    inline uint64_t SideToMoveKey(char a_presentationChar)
+    {
+        return Mix( (static_cast<uint64_t>(3) << 56) |
+                    (static_cast<uint64_t>(static_cast<uint8_t>(a_presentationChar)) << 40) );
+    }
+
+    /// @return the key xor'ed into the hash key of positions solved up to the end
+    ///         of the game, so their exact values are never mistaken for the ones
+    ///         calculated by an evaluation function in the same transposition table
+    inline uint64_t EndgameKey()
+    {
+        return Mix(static_cast<uint64_t>(4) << 56);
+    }
+}
+
+#endif // _ZOBRIST_H_